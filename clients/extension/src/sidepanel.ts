@@ -10,7 +10,7 @@
  * (ws://localhost:9099/ingest, the desktop) → tells the Meet tab's content
  * script to begin per-participant capture.
  */
-import { createTranscriptManager, groupSegments, type TranscriptSegment } from './transcript-rendering';
+import { createTranscriptManager, type TranscriptSegment } from './transcript-rendering';
 import { type CaptureStatus, isActive } from './capture-liveness';
 import { resolveEndpoints, normalizeDeployment, DEFAULT_DEPLOYMENT } from './endpoints';
 
@@ -172,7 +172,7 @@ function renderFeed(): void {
       feed.innerHTML = `<div class="empty"><div style="font-size:22px;">&#127911;</div><div>Listening — ${cap}…</div></div>`;
       return;
     }
-    const groups = groupSegments(txSegs);
+    const groups = mgr.getGroups();
     feed.innerHTML = `<div style="text-align:left;padding:2px 2px 10px;">` + groups.map(g => {
       const name = g.key || 'Speaker';
       const col = speakerColor(name);
@@ -1,8 +1,8 @@
 import type { TranscriptSegment, SegmentGroup, GroupingOptions } from './types';
 
-const DEFAULT_MAX_CHARS = 512;
+export const DEFAULT_MAX_CHARS = 512;
 
-function defaultGetGroupKey(segment: TranscriptSegment): string {
+export function defaultGetGroupKey(segment: TranscriptSegment): string {
   return segment.speaker || 'Unknown';
 }
 
@@ -50,43 +50,58 @@ export function groupSegments<T extends TranscriptSegment>(
 
   // Split large groups at segment boundaries
   const groups: SegmentGroup<T>[] = [];
-
   for (const raw of rawGroups) {
-    if (raw.segments.length === 0) continue;
-
-    let chunkSegments: T[] = [];
-    let chunkText = '';
-
-    const flushChunk = () => {
-      if (chunkSegments.length === 0) return;
-      const first = chunkSegments[0];
-      const last = chunkSegments[chunkSegments.length - 1];
-      groups.push({
-        key: raw.key,
-        startTime: first.absolute_start_time,
-        endTime: last.absolute_end_time || last.absolute_start_time,
-        startTimeSeconds: first.start_time ?? 0,
-        endTimeSeconds: last.end_time ?? 0,
-        combinedText: chunkText.trim(),
-        segments: chunkSegments,
-      });
-      chunkSegments = [];
-      chunkText = '';
-    };
-
-    for (const seg of raw.segments) {
-      const segText = (seg.text || '').trim();
-      if (!segText) continue;
-
-      const candidate = chunkText ? `${chunkText} ${segText}` : segText;
-      if (chunkSegments.length > 0 && candidate.length > maxChars) {
-        flushChunk();
-      }
-      chunkSegments.push(seg);
-      chunkText = chunkText ? `${chunkText} ${segText}` : segText;
+    for (const group of splitGroup(raw.key, raw.segments, maxChars)) groups.push(group);
+  }
+
+  return groups;
+}
+
+/**
+ * Split one run of consecutive same-key segments into groups of at most
+ * `maxChars` combined text, at segment boundaries. Split out of
+ * `groupSegments` so the incremental manager can rebuild a single run.
+ */
+export function splitGroup<T extends TranscriptSegment>(
+  key: string,
+  segments: T[],
+  maxChars: number,
+): SegmentGroup<T>[] {
+  const groups: SegmentGroup<T>[] = [];
+  if (segments.length === 0) return groups;
+
+  let chunkSegments: T[] = [];
+  let chunkText = '';
+
+  const flushChunk = () => {
+    if (chunkSegments.length === 0) return;
+    const first = chunkSegments[0];
+    const last = chunkSegments[chunkSegments.length - 1];
+    groups.push({
+      key,
+      startTime: first.absolute_start_time,
+      endTime: last.absolute_end_time || last.absolute_start_time,
+      startTimeSeconds: first.start_time ?? 0,
+      endTimeSeconds: last.end_time ?? 0,
+      combinedText: chunkText.trim(),
+      segments: chunkSegments,
+    });
+    chunkSegments = [];
+    chunkText = '';
+  };
+
+  for (const seg of segments) {
+    const segText = (seg.text || '').trim();
+    if (!segText) continue;
+
+    const candidate = chunkText ? `${chunkText} ${segText}` : segText;
+    if (chunkSegments.length > 0 && candidate.length > maxChars) {
+      flushChunk();
     }
-    flushChunk();
+    chunkSegments.push(seg);
+    chunkText = chunkText ? `${chunkText} ${segText}` : segText;
   }
+  flushChunk();
 
   return groups;
 }
@@ -0,0 +1,587 @@
+import type { TranscriptSegment, TranscriptState, SegmentGroup, GroupingOptions } from './types';
+import type { DedupStep } from './dedup';
+import { dedupStep } from './dedup';
+import { DEFAULT_MAX_CHARS, defaultGetGroupKey, splitGroup } from './grouping';
+import { createTranscriptState, segKey } from './state';
+
+// ---------------------------------------------------------------------------
+// Incremental index behind createTranscriptManager
+// ---------------------------------------------------------------------------
+//
+// The batch pipeline rebuilds everything on every tick:
+//
+//   recomputeTranscripts → deduplicateByIdentity → sortSegments
+//     → deduplicateSegments → sortByStartTime → groupSegments
+//
+// which is O(n log n) per WS message and dominates long meetings. The index
+// keeps each stage's result and only touches what a tick changes, producing
+// exactly the same output (including tie order between equal timestamps):
+//
+// - candidates: every confirmed segment plus every non-stale pending one,
+//   bucketed by identity key. Staleness is answered from a per-speaker index
+//   of confirmed texts instead of a scan over all of them.
+// - nodes: the identity winner per key, in a sorted array ordered like
+//   `sortSegments(deduplicateByIdentity(...))`. Each node stores the dedup
+//   fold's outcome at that position, so a change re-runs `dedupStep` from the
+//   changed position only until the fold converges with what it was before —
+//   normally one or two neighbours.
+// - kept nodes: two more sorted arrays, one in display order
+//   (`sortByStartTime`) and one in grouping order (`groupSegments`' sort).
+// - groups: built per run of same-key segments and reused while a run's
+//   members are unchanged.
+//
+// The sorted arrays use binary search (O(log n) comparisons) plus a splice,
+// whose memmove is negligible next to the localeCompare calls it replaces.
+
+/** A segment that may represent its identity key: confirmed, or a live pending draft. */
+interface Candidate<T> {
+  key: string;
+  seg: T;
+  /** 0 = confirmed, 1 = pending — `recomputeTranscripts` lists confirmed first. */
+  tier: 0 | 1;
+  /** Confirmed: when the key entered the map. Pending: when the speaker did. */
+  seq: number;
+  /** Index in the speaker's pending array (0 for confirmed). */
+  idx: number;
+}
+
+/** The identity winner for one key, with its dedup fold state. */
+interface Node<T> {
+  key: string;
+  seg: T;
+  /** The key's earliest candidate — fixes its place among equal start times. */
+  first: Candidate<T>;
+  alive: boolean;
+  /** `dedupStep` outcome at this node, and the last kept node after it. */
+  step: DedupStep | null;
+  last: Node<T> | null;
+  kept: boolean;
+}
+
+function cmpCandidate<T extends TranscriptSegment>(a: Candidate<T>, b: Candidate<T>): number {
+  return (
+    a.seg.absolute_start_time.localeCompare(b.seg.absolute_start_time) ||
+    a.tier - b.tier ||
+    a.seq - b.seq ||
+    a.idx - b.idx
+  );
+}
+
+function sameCandidate<T>(a: Candidate<T>, b: Candidate<T>): boolean {
+  return a.seg === b.seg && a.tier === b.tier && a.seq === b.seq && a.idx === b.idx;
+}
+
+/** `sortSegments(deduplicateByIdentity(recomputeTranscripts(state)))` order. */
+function cmpDedupOrder<T extends TranscriptSegment>(a: Node<T>, b: Node<T>): number {
+  return (
+    a.seg.absolute_start_time.localeCompare(b.seg.absolute_start_time) ||
+    cmpCandidate(a.first, b.first)
+  );
+}
+
+/** `sortByStartTime` over the kept nodes. */
+function cmpDisplayOrder<T extends TranscriptSegment>(a: Node<T>, b: Node<T>): number {
+  return (a.seg.start_time ?? 0) - (b.seg.start_time ?? 0) || cmpDedupOrder(a, b);
+}
+
+/** `groupSegments`' absolute_start_time sort over the display order. */
+function cmpGroupOrder<T extends TranscriptSegment>(a: Node<T>, b: Node<T>): number {
+  return (
+    a.seg.absolute_start_time.localeCompare(b.seg.absolute_start_time) ||
+    (a.seg.start_time ?? 0) - (b.seg.start_time ?? 0) ||
+    cmpCandidate(a.first, b.first)
+  );
+}
+
+/** An array kept in `cmp` order. Every element must compare unequal to every other. */
+class SortedList<X> {
+  items: X[] = [];
+
+  constructor(private readonly cmp: (a: X, b: X) => number) {}
+
+  private lowerBound(x: X): number {
+    let lo = 0;
+    let hi = this.items.length;
+    while (lo < hi) {
+      const mid = (lo + hi) >>> 1;
+      if (this.cmp(this.items[mid], x) < 0) lo = mid + 1;
+      else hi = mid;
+    }
+    return lo;
+  }
+
+  indexOf(x: X): number {
+    const i = this.lowerBound(x);
+    return this.items[i] === x ? i : -1;
+  }
+
+  insert(x: X): void {
+    this.items.splice(this.lowerBound(x), 0, x);
+  }
+
+  /** Remove `x`; returns the index it had, or -1. */
+  remove(x: X): number {
+    const i = this.indexOf(x);
+    if (i >= 0) this.items.splice(i, 1);
+    return i;
+  }
+
+  reset(xs: X[]): void {
+    this.items = xs.sort(this.cmp);
+  }
+}
+
+/** Confirmed texts of one speaker, shaped for `recomputeTranscripts`' staleness test. */
+interface SpeakerTexts {
+  counts: Map<string, number>;
+  /** Distinct texts in code-unit order: texts starting with `p` sit right at p's insertion point. */
+  sorted: string[];
+  /** Distinct text lengths → how many texts have each, to probe only real prefix lengths. */
+  lengths: Map<number, number>;
+}
+
+function textIndex(texts: string[], t: string): number {
+  let lo = 0;
+  let hi = texts.length;
+  while (lo < hi) {
+    const mid = (lo + hi) >>> 1;
+    if (texts[mid] < t) lo = mid + 1;
+    else hi = mid;
+  }
+  return lo;
+}
+
+interface GroupRun<T> {
+  key: string;
+  members: Node<T>[];
+  groups: SegmentGroup<T>[];
+}
+
+interface GroupCache<T> {
+  getGroupKey: (segment: TranscriptSegment) => string;
+  maxChars: number;
+  /** Runs keyed by their first node, for reuse on the next build. */
+  runs: Map<Node<T>, GroupRun<T>>;
+  groups: SegmentGroup<T>[];
+  stale: boolean;
+}
+
+/** Incrementally maintained transcript — the engine behind `createTranscriptManager`. */
+export interface TranscriptIndex<T extends TranscriptSegment = TranscriptSegment> {
+  /** The two maps, kept exactly as `bootstrapConfirmed` / `applyTranscriptTick` would. */
+  readonly state: TranscriptState<T>;
+  /** Replace everything with `segments` as the confirmed set. */
+  bootstrap(segments: T[]): void;
+  /** Apply one tick. Returns false when `applyTranscriptTick` would return null. */
+  applyTick(confirmed: T[], pending: T[] | undefined, speaker: string | null | undefined): boolean;
+  /** The `TranscriptManager.getSegments` output. */
+  segments(): T[];
+  /** `groupSegments(segments(), options)`. */
+  groups(options?: GroupingOptions): SegmentGroup<T>[];
+  clear(): void;
+}
+
+export function createTranscriptIndex<
+  T extends TranscriptSegment = TranscriptSegment,
+>(): TranscriptIndex<T> {
+  let state = createTranscriptState<T>();
+  let nextSeq = 0;
+  let confirmedSeq = new Map<string, number>();
+  let speakerSeq = new Map<string, number>();
+  let texts = new Map<string, SpeakerTexts>();
+  let candidates = new Map<string, Candidate<T>[]>();
+  let livePending = new Map<string, Candidate<T>[]>();
+  let nodes = new Map<string, Node<T>>();
+  let dedupOrder = new SortedList<Node<T>>(cmpDedupOrder);
+  let display = new SortedList<Node<T>>(cmpDisplayOrder);
+  let groupOrder = new SortedList<Node<T>>(cmpGroupOrder);
+  let output: T[] | null = null;
+  let groupCache: GroupCache<T> | null = null;
+
+  // Work collected while applying a tick, drained by flush().
+  const dirtySpeakers = new Set<string>();
+  const dirtyKeys = new Set<string>();
+  let seeds: Node<T>[] = [];
+
+  // ---- confirmed texts ----
+
+  function addText(speaker: string, text: string): void {
+    let idx = texts.get(speaker);
+    if (!idx) {
+      idx = { counts: new Map(), sorted: [], lengths: new Map() };
+      texts.set(speaker, idx);
+    }
+    const n = idx.counts.get(text) ?? 0;
+    idx.counts.set(text, n + 1);
+    if (n > 0) return;
+    idx.sorted.splice(textIndex(idx.sorted, text), 0, text);
+    idx.lengths.set(text.length, (idx.lengths.get(text.length) ?? 0) + 1);
+  }
+
+  function removeText(speaker: string, text: string): void {
+    const idx = texts.get(speaker)!;
+    const n = idx.counts.get(text)!;
+    if (n > 1) {
+      idx.counts.set(text, n - 1);
+      return;
+    }
+    idx.counts.delete(text);
+    idx.sorted.splice(textIndex(idx.sorted, text), 1);
+    const len = idx.lengths.get(text.length)!;
+    if (len > 1) idx.lengths.set(text.length, len - 1);
+    else idx.lengths.delete(text.length);
+    if (idx.counts.size === 0) texts.delete(speaker);
+  }
+
+  /** Same answer as the loop in `recomputeTranscripts`, without visiting every text. */
+  function isStale(speaker: string, pt: string): boolean {
+    const idx = texts.get(speaker);
+    if (!idx) return false;
+    // ct === pt or ct.startsWith(pt)
+    const at = idx.sorted[textIndex(idx.sorted, pt)];
+    if (at !== undefined && at.startsWith(pt)) return true;
+    // pt.startsWith(ct)
+    for (const len of idx.lengths.keys()) {
+      if (len < pt.length && idx.counts.has(pt.slice(0, len))) return true;
+    }
+    return false;
+  }
+
+  // ---- candidates ----
+
+  function addCandidate(c: Candidate<T>): void {
+    const list = candidates.get(c.key);
+    if (list) list.push(c);
+    else candidates.set(c.key, [c]);
+    dirtyKeys.add(c.key);
+  }
+
+  function removeCandidate(c: Candidate<T>): void {
+    const list = candidates.get(c.key)!;
+    list.splice(list.indexOf(c), 1);
+    if (list.length === 0) candidates.delete(c.key);
+    dirtyKeys.add(c.key);
+  }
+
+  function setConfirmed(seg: T): void {
+    const key = segKey(seg);
+    const prev = state.confirmed.get(key);
+    state.confirmed.set(key, seg);
+    if (prev === seg) return;
+
+    let seq = confirmedSeq.get(key);
+    if (seq === undefined) {
+      seq = nextSeq++;
+      confirmedSeq.set(key, seq);
+    }
+
+    const speaker = seg.speaker || '';
+    const text = (seg.text || '').trim();
+    if (prev) {
+      const prevSpeaker = prev.speaker || '';
+      const prevText = (prev.text || '').trim();
+      if (prevSpeaker !== speaker || prevText !== text) {
+        removeText(prevSpeaker, prevText);
+        addText(speaker, text);
+        dirtySpeakers.add(prevSpeaker);
+        dirtySpeakers.add(speaker);
+      }
+      removeCandidate(candidates.get(key)!.find(c => c.tier === 0)!);
+    } else {
+      addText(speaker, text);
+      dirtySpeakers.add(speaker);
+    }
+    addCandidate({ key, seg, tier: 0, seq, idx: 0 });
+  }
+
+  function setPending(speaker: string, pending: T[]): void {
+    if (pending.length > 0) {
+      if (!state.pendingBySpeaker.has(speaker)) speakerSeq.set(speaker, nextSeq++);
+      state.pendingBySpeaker.set(speaker, pending);
+    } else {
+      state.pendingBySpeaker.delete(speaker);
+      speakerSeq.delete(speaker);
+    }
+    dirtySpeakers.add(speaker);
+  }
+
+  /** Re-derive which of a speaker's pending segments are live (not stale). */
+  function refreshPending(speaker: string): void {
+    for (const c of livePending.get(speaker) ?? []) removeCandidate(c);
+    const live: Candidate<T>[] = [];
+    const segs = state.pendingBySpeaker.get(speaker);
+    if (segs) {
+      const seq = speakerSeq.get(speaker)!;
+      segs.forEach((seg, idx) => {
+        if (isStale(speaker, (seg.text || '').trim())) return;
+        const c: Candidate<T> = { key: segKey(seg), seg, tier: 1, seq, idx };
+        addCandidate(c);
+        live.push(c);
+      });
+    }
+    if (live.length > 0) livePending.set(speaker, live);
+    else livePending.delete(speaker);
+  }
+
+  // ---- nodes ----
+
+  /** `deduplicateByIdentity` for one key: first candidate's slot, newest `updated_at`'s value. */
+  function winner(list: Candidate<T>[]): { first: Candidate<T>; seg: T } {
+    list.sort(cmpCandidate);
+    let seg = list[0].seg;
+    for (let i = 1; i < list.length; i++) {
+      const s = list[i].seg;
+      if (s.updated_at && seg.updated_at && s.updated_at > seg.updated_at) seg = s;
+    }
+    return { first: list[0], seg };
+  }
+
+  function newNode(key: string, first: Candidate<T>, seg: T): Node<T> {
+    return { key, seg, first, alive: true, step: null, last: null, kept: false };
+  }
+
+  /**
+   * Bring one key's node in line with its candidates. Replacements are only
+   * queued on `inserts`: a new pending candidate can reuse the (seq, idx) of
+   * one that left in the same tick, so every stale node must be out of the
+   * sorted array before any new one goes in.
+   */
+  function refreshNode(key: string, inserts: Node<T>[]): void {
+    const list = candidates.get(key);
+    const old = nodes.get(key);
+    if (!list) {
+      if (old) dropNode(old);
+      return;
+    }
+    const { first, seg } = winner(list);
+    if (old && old.seg === seg && sameCandidate(old.first, first)) {
+      old.first = first;
+      return;
+    }
+    if (old) dropNode(old);
+    const node = newNode(key, first, seg);
+    nodes.set(key, node);
+    inserts.push(node);
+  }
+
+  function dropNode(node: Node<T>): void {
+    nodes.delete(node.key);
+    node.alive = false;
+    if (node.kept) hide(node);
+    const i = dedupOrder.remove(node);
+    const items = dedupOrder.items;
+    // The fold must be re-run from the node that now takes its place.
+    if (i < items.length) seeds.push(items[i]);
+    else if (i > 0) seeds.push(items[i - 1]);
+  }
+
+  function show(node: Node<T>): void {
+    node.kept = true;
+    display.insert(node);
+    groupOrder.insert(node);
+    output = null;
+    if (groupCache) groupCache.stale = true;
+  }
+
+  function hide(node: Node<T>): void {
+    node.kept = false;
+    display.remove(node);
+    groupOrder.remove(node);
+    output = null;
+    if (groupCache) groupCache.stale = true;
+  }
+
+  // ---- dedup fold ----
+
+  /**
+   * Re-run `dedupStep` from index `p` until a node's outcome matches what it
+   * stored before (everything after it is then unchanged). Collects every node
+   * whose kept status may have moved. Returns the last index visited.
+   */
+  function foldFrom(p: number, affected: Set<Node<T>>): number {
+    const items = dedupOrder.items;
+    let last = p > 0 ? items[p - 1].last : null;
+    if (last) affected.add(last);
+    let i = p;
+    for (; i < items.length; i++) {
+      const node = items[i];
+      const step = dedupStep(last?.seg, node.seg);
+      const next = step === 'skip' ? last : node;
+      const converged = node.step === step && node.last === next;
+      if (node.last) affected.add(node.last);
+      affected.add(node);
+      node.step = step;
+      node.last = next;
+      last = next;
+      if (converged) break;
+    }
+    return i;
+  }
+
+  /** A placed node survives unless the next non-skipped node replaces it. */
+  function isKept(node: Node<T>): boolean {
+    if (node.step === 'skip') return false;
+    const items = dedupOrder.items;
+    let i = dedupOrder.indexOf(node) + 1;
+    while (i < items.length && items[i].step === 'skip') i++;
+    return i >= items.length || items[i].step === 'push';
+  }
+
+  function flush(): void {
+    for (const speaker of dirtySpeakers) refreshPending(speaker);
+    dirtySpeakers.clear();
+    const inserts: Node<T>[] = [];
+    for (const key of dirtyKeys) refreshNode(key, inserts);
+    dirtyKeys.clear();
+    for (const node of inserts) {
+      dedupOrder.insert(node);
+      seeds.push(node);
+    }
+    if (seeds.length === 0) return;
+
+    const starts = [...new Set(seeds.filter(n => n.alive).map(n => dedupOrder.indexOf(n)))];
+    starts.sort((a, b) => a - b);
+    seeds = [];
+    const affected = new Set<Node<T>>();
+    let covered = -1;
+    for (const p of starts) {
+      if (p > covered) covered = foldFrom(p, affected);
+    }
+    for (const node of affected) {
+      if (!node.alive) continue;
+      const kept = isKept(node);
+      if (kept !== node.kept) {
+        if (kept) show(node);
+        else hide(node);
+      }
+    }
+  }
+
+  /** Derive every index from `state` in one pass (bootstrap). */
+  function rebuild(): void {
+    nextSeq = 0;
+    confirmedSeq = new Map();
+    speakerSeq = new Map();
+    texts = new Map();
+    candidates = new Map();
+    livePending = new Map();
+    nodes = new Map();
+    output = null;
+    groupCache = null;
+    dirtySpeakers.clear();
+    dirtyKeys.clear();
+    seeds = [];
+
+    for (const [key, seg] of state.confirmed) {
+      const seq = nextSeq++;
+      confirmedSeq.set(key, seq);
+      addText(seg.speaker || '', (seg.text || '').trim());
+      addCandidate({ key, seg, tier: 0, seq, idx: 0 });
+    }
+    for (const speaker of state.pendingBySpeaker.keys()) {
+      speakerSeq.set(speaker, nextSeq++);
+      refreshPending(speaker);
+    }
+    dirtyKeys.clear();
+
+    for (const [key, list] of candidates) {
+      const { first, seg } = winner(list);
+      nodes.set(key, newNode(key, first, seg));
+    }
+    dedupOrder.reset([...nodes.values()]);
+
+    const items = dedupOrder.items;
+    let last: Node<T> | null = null;
+    for (const node of items) {
+      node.step = dedupStep(last?.seg, node.seg);
+      if (node.step !== 'skip') last = node;
+      node.last = last;
+    }
+    const kept: Node<T>[] = [];
+    for (let i = 0; i < items.length; i++) {
+      if (i + 1 === items.length || items[i + 1].step === 'push') {
+        const node = items[i].last!;
+        node.kept = true;
+        kept.push(node);
+      }
+    }
+    display.reset(kept);
+    groupOrder.reset([...kept]);
+  }
+
+  // ---- groups ----
+
+  function buildGroups(cache: GroupCache<T>): void {
+    const items = groupOrder.items;
+    const runs = new Map<Node<T>, GroupRun<T>>();
+    const groups: SegmentGroup<T>[] = [];
+    let i = 0;
+    while (i < items.length) {
+      const key = cache.getGroupKey(items[i].seg);
+      let j = i + 1;
+      while (j < items.length && cache.getGroupKey(items[j].seg) === key) j++;
+
+      let run = cache.runs.get(items[i]);
+      if (!run || run.key !== key || run.members.length !== j - i || run.members.some((n, k) => n !== items[i + k])) {
+        const members = items.slice(i, j);
+        run = { key, members, groups: splitGroup(key, members.map(n => n.seg), cache.maxChars) };
+      }
+      runs.set(items[i], run);
+      for (const group of run.groups) groups.push(group);
+      i = j;
+    }
+    cache.runs = runs;
+    cache.groups = groups;
+    cache.stale = false;
+  }
+
+  return {
+    get state() {
+      return state;
+    },
+
+    bootstrap(segments: T[]): void {
+      state = createTranscriptState<T>();
+      for (const seg of segments) {
+        if (!seg.absolute_start_time || !(seg.text || '').trim()) continue;
+        state.confirmed.set(segKey(seg), seg);
+      }
+      rebuild();
+    },
+
+    applyTick(confirmed: T[], pending: T[] | undefined, speaker: string | null | undefined): boolean {
+      let changed = false;
+      for (const seg of confirmed) {
+        if (!seg.absolute_start_time || !(seg.text || '').trim()) continue;
+        setConfirmed(seg);
+        changed = true;
+      }
+      if (speaker !== undefined && speaker !== null) {
+        setPending(speaker, (pending || []).filter(s => s.absolute_start_time && (s.text || '').trim()));
+        changed = true;
+      }
+      flush();
+      return changed;
+    },
+
+    segments(): T[] {
+      if (!output) output = display.items.map(n => n.seg);
+      return output.slice();
+    },
+
+    groups(options: GroupingOptions = {}): SegmentGroup<T>[] {
+      const getGroupKey = options.getGroupKey ?? defaultGetGroupKey;
+      const maxChars = options.maxCharsPerGroup ?? DEFAULT_MAX_CHARS;
+      if (!groupCache || groupCache.getGroupKey !== getGroupKey || groupCache.maxChars !== maxChars) {
+        groupCache = { getGroupKey, maxChars, runs: new Map(), groups: [], stale: true };
+      }
+      if (groupCache.stale) buildGroups(groupCache);
+      return groupCache.groups.slice();
+    },
+
+    clear(): void {
+      state = createTranscriptState<T>();
+      rebuild();
+    },
+  };
+}
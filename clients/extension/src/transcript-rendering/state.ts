@@ -10,7 +10,7 @@ export function createTranscriptState<T extends TranscriptSegment = TranscriptSe
 /**
  * Segment key used for identity throughout the state functions.
  */
-function segKey<T extends TranscriptSegment>(seg: T): string {
+export function segKey<T extends TranscriptSegment>(seg: T): string {
   return seg.segment_id || seg.absolute_start_time;
 }
 
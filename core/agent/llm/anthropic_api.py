@@ -8,6 +8,10 @@ shadow the ``anthropic`` pip package.
 Config (constructor args win over env): ``VEXA_LLM_BASE_URL`` (default ``https://api.anthropic.com``),
 ``VEXA_LLM_API_KEY`` (falls back ``ANTHROPIC_AUTH_TOKEN`` → ``ANTHROPIC_API_KEY``),
 ``VEXA_LLM_MODEL``, ``VEXA_LLM_MAX_TOKENS`` (the Messages API requires max_tokens; default 4096).
+
+A ``system`` prefix long enough to be cached is sent as a text block marked ``cache_control:
+ephemeral`` — callers that keep it byte-stable across calls (the incremental meeting card turn) are
+billed and served from the prompt cache for it; shorter ones go as the plain string.
 """
 from __future__ import annotations
 
@@ -21,6 +25,8 @@ from llm.ports import CompletionResult
 
 _DEFAULT_BASE = "https://api.anthropic.com"
 _API_VERSION = "2023-06-01"
+# ≈ the Messages API's 1024-token minimum cacheable prefix; anything shorter can never hit the cache.
+_CACHE_MIN_CHARS = 4096
 
 
 def _max_tokens() -> int:
@@ -57,7 +63,9 @@ class AnthropicCompletion:
             "max_tokens": _max_tokens(),
             "messages": [{"role": "user", "content": prompt}],
         }
-        if system:
+        if system and len(system) >= _CACHE_MIN_CHARS:
+            payload["system"] = [{"type": "text", "text": system, "cache_control": {"type": "ephemeral"}}]
+        elif system:
             payload["system"] = system
         headers = {"x-api-key": self._key, "anthropic-version": _API_VERSION}
         try:
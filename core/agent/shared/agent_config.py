@@ -38,6 +38,7 @@ def model_allowlist() -> frozenset[str]:
 
 DEFAULT_CARD_KINDS: tuple[str, ...] = ("person", "company", "product")
 DEFAULT_CADENCE_SEGMENTS = 4
+DEFAULT_BEAT_DEBOUNCE_S = 6.0  # adaptive beat debounce (0 = the fixed cadence_segments / new-speaker gate)
 
 # v2 DEFAULTS — the polish + tagging POLICY. These live as code fallbacks but the user GOVERNS them by
 # editing ``agents/meeting.md`` (the seed carries the same text); changing the file changes the prompt,
@@ -66,6 +67,7 @@ class MeetingConfig:
     enabled: bool = True
     model: str = field(default_factory=default_meeting_model)
     cadence_segments: int = DEFAULT_CADENCE_SEGMENTS
+    beat_debounce_s: float = DEFAULT_BEAT_DEBOUNCE_S
     card_kinds: list[str] = field(default_factory=lambda: list(DEFAULT_CARD_KINDS))
     write_meeting_doc: bool = True
     steering: str = ""
@@ -130,6 +132,16 @@ def _as_cadence(val: object) -> int:
     return n if n >= 1 else DEFAULT_CADENCE_SEGMENTS
 
 
+def _as_debounce(val: object) -> float:
+    if isinstance(val, bool):
+        return DEFAULT_BEAT_DEBOUNCE_S
+    try:
+        s = float(val)  # type: ignore[arg-type]
+    except (TypeError, ValueError):
+        return DEFAULT_BEAT_DEBOUNCE_S
+    return s if s >= 0 else DEFAULT_BEAT_DEBOUNCE_S
+
+
 def _as_rules(val: object, default: str) -> str:
     """A governed POLICY string (polish_rules / tag_rules). A non-empty string (frontmatter scalar)
     overrides the code default; anything else (absent, blank, non-string) falls back to the default so a
@@ -164,6 +176,7 @@ def load_meeting_config(work: Path) -> MeetingConfig:
         enabled=_as_bool(fm.get("enabled"), True),
         model=_as_model(fm.get("model")),
         cadence_segments=_as_cadence(fm.get("cadence_segments")),
+        beat_debounce_s=_as_debounce(fm.get("beat_debounce_s")),
         card_kinds=_as_card_kinds(fm.get("card_kinds")),
         write_meeting_doc=_as_bool(fm.get("write_meeting_doc"), True),
         steering=body,
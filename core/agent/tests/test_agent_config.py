@@ -10,6 +10,7 @@ from __future__ import annotations
 from pathlib import Path
 
 from shared.agent_config import (
+    DEFAULT_BEAT_DEBOUNCE_S,
     DEFAULT_CADENCE_SEGMENTS,
     DEFAULT_CARD_KINDS,
     DEFAULT_POLISH_RULES,
@@ -112,6 +113,17 @@ def test_bad_cadence_falls_back(tmp_path):
     assert load_meeting_config(tmp_path).cadence_segments == DEFAULT_CADENCE_SEGMENTS
 
 
+def test_beat_debounce_parsed_and_bad_values_fall_back(tmp_path):
+    assert load_meeting_config(tmp_path).beat_debounce_s == DEFAULT_BEAT_DEBOUNCE_S
+    _write(tmp_path, "---\nbeat_debounce_s: 2.5\n---\n")
+    assert load_meeting_config(tmp_path).beat_debounce_s == 2.5
+    _write(tmp_path, "---\nbeat_debounce_s: 0\n---\n")
+    assert load_meeting_config(tmp_path).beat_debounce_s == 0.0  # 0 = the fixed cadence gate
+    for bad in ("soon", "-3", "true"):
+        _write(tmp_path, f"---\nbeat_debounce_s: {bad}\n---\n")
+        assert load_meeting_config(tmp_path).beat_debounce_s == DEFAULT_BEAT_DEBOUNCE_S
+
+
 def test_no_frontmatter_whole_body_is_steering(tmp_path):
     _write(tmp_path, "Just steer me, no fence here.")
     cfg = load_meeting_config(tmp_path)
@@ -47,3 +47,16 @@ def test_missing_model_fails_loud(monkeypatch):
     monkeypatch.delenv("VEXA_LLM_MODEL", raising=False)
     with pytest.raises(LLMConfigError):
         AnthropicCompletion(model="").complete("p")
+
+
+def test_long_system_prefix_is_marked_cacheable():
+    seen = {}
+
+    def handler(request: httpx.Request) -> httpx.Response:
+        seen["body"] = json.loads(request.content)
+        return httpx.Response(200, json={"content": [{"type": "text", "text": "ok"}]})
+
+    prefix = "rules " * 1000
+    _adapter(handler).complete("window", system=prefix)
+    assert seen["body"]["system"] == [{"type": "text", "text": prefix, "cache_control": {"type": "ephemeral"}}]
+    assert seen["body"]["messages"] == [{"role": "user", "content": "window"}]
@@ -1055,6 +1055,153 @@ def test_serve_meeting_doc_gating_off_skips_doc_turn():
     assert not any(e.get("turn_id") == "meeting-doc" for e in s.events())
 
 
+# ── incremental beats: cached prefix, speech-rate debounce, append-only mirror ───────────────────
+
+from llm.ports import CompletionResult  # noqa: E402
+from worker.worker import IncrementalCardTurn, MeetingTranscriptMirror, render_meeting_transcript  # noqa: E402
+
+
+class _EchoCompletion:
+    """A CompletionPort that records (system, prompt) and returns one note per window line."""
+
+    name = "echo"
+
+    def __init__(self):
+        self.calls = []
+
+    def complete(self, prompt, *, system=None, model=None):
+        self.calls.append((system, prompt))
+        import re as _re
+        notes = [{"id": i, "speaker": sp, "text": f"I said {i}."}
+                 for i, sp in _re.findall(r"id=(\S+) speaker=(\S+)\]", prompt)]
+        return CompletionResult(text=json.dumps({"notes": notes, "cards": []}), model="echo")
+
+
+def test_incremental_card_turn_keeps_a_stable_bounded_prefix(tmp_path):
+    """The rules + meta + confirmed notes ride ``system``, byte-identical beat to beat until a stride of
+    frozen notes lands; the prefix keeps only the last ``context_notes``; the user message is the
+    window alone."""
+    completion = _EchoCompletion()
+    turn = IncrementalCardTurn(tmp_path, completion=completion, meta={"title": "Meeting m1"},
+                               context_notes=4, context_stride=2)
+    sizes = []
+    for beat in range(40):
+        segs = [{"segment_id": f"s{beat:02d}", "speaker": "Jane", "text": "x", "rewrite_pass": 1},
+                {"segment_id": f"s{beat - 2:02d}", "speaker": "Jane", "text": "x", "rewrite_pass": 3}]
+        list(turn(segs if beat >= 2 else segs[:1]))
+        sizes.append(len(completion.calls[-1][0]))
+    systems = [c[0] for c in completion.calls]
+    assert "## Polish rules" in systems[0] and "title: Meeting m1" in systems[0]
+    assert all("## Polish rules" not in c[1] for c in completion.calls)  # window only, per beat
+    assert systems[3] == systems[2]                  # one frozen note pending → same bytes (cache hit)
+    assert "id=s01 " in systems[4] and "id=s02 " not in systems[4]  # a stride of two folded in
+    assert "id=s33 " in systems[-1] and "id=s29 " not in systems[-1]  # bounded to the last 4
+    assert max(sizes[10:]) == min(sizes[10:])        # flat however long the meeting runs
+    assert len(set(systems)) <= 1 + 40 // 2          # rebuilt once per stride, never per beat
+
+
+class _ClockStream(StepMeetingStream):
+    """One entry per read, advancing a fake clock ``dt`` seconds each read."""
+
+    def __init__(self, inbox, dt):
+        super().__init__(inbox)
+        self.t, self.dt, self.blocks = 0.0, dt, []
+
+    def clock(self):
+        return self.t
+
+    def xread(self, streams, count=1, block=None):
+        self.t += self.dt
+        self.blocks.append(block)
+        return super().xread(streams, count=count, block=block)
+
+
+def _fresh_per_beat(stream, **kw):
+    beats = []
+
+    def card_turn(segs):
+        beats.append([x["segment_id"] for x in segs if x["rewrite_pass"] == 1])
+        return iter(())
+
+    serve_meeting(stream, transcript_stream="tc:m1", out_topic="o", card_turn=card_turn, idle_ms=60_000,
+                  beat_segments=2, clock=stream.clock, **kw)
+    return beats
+
+
+def test_serve_meeting_debounce_batches_fast_speech_and_flushes_on_pause():
+    segs = [_transcript(f"{i}-0", {**_seg("Jane", "w"), "segment_id": f"s{i}"}) for i in range(12)]
+    fast = _ClockStream(list(segs), dt=0.1)  # 10 segments/s
+    assert _fresh_per_beat(fast, debounce_s=4) == [
+        [f"s{i}" for i in range(8)],   # 10/s × 4s → capped at 4 × beat_segments
+        [f"s{i}" for i in range(8, 12)],  # the trailing 4 flush once speech goes quiet…
+    ]
+    assert 4000 in fast.blocks and fast.blocks[-1] == 60_000  # …on a debounce-long read, then idle-reap
+    # the fixed gate, same stream: a beat every 2 segments
+    assert len(_fresh_per_beat(_ClockStream(list(segs), dt=0.1))) == 6
+
+
+def test_serve_meeting_debounce_keeps_slow_speech_responsive():
+    segs = [_transcript("1-0", {**_seg("Jane", "w"), "segment_id": "a"}),
+            _transcript("2-0", {**_seg("Jane", "w"), "segment_id": "b"}),
+            _transcript("3-0", {**_seg("Raj", "w"), "segment_id": "c"}),
+            _transcript("4-0", {**_seg("Raj", "w"), "segment_id": "d"})]
+    # one segment every 5s: the new-speaker gate is past the debounce, and a lone line flushes on the pause
+    assert _fresh_per_beat(_ClockStream(segs, dt=5.0), debounce_s=4) == [["a"], ["b", "c"], ["d"]]
+
+
+def test_transcript_mirror_appends_and_renders_like_the_upsert(tmp_path):
+    path = tmp_path / "kg" / "entities" / "meeting" / "m1.md"
+    mirror = MeetingTranscriptMirror(path, _MEETING_META)
+    notes = [{"id": f"n{i}", "speaker": "Jane", "text": f"line number {i}"} for i in range(50)]
+    mirror(notes[:49])
+    before = mirror.bytes_written
+    mirror([notes[49]])
+    appended = mirror.bytes_written - before
+    assert 0 < appended <= len("<!-- id:n49 --> **Jane:** line number 49\n")  # appended, not rewritten
+    assert path.read_text() == render_meeting_transcript(_MEETING_META, notes)
+
+    before = mirror.bytes_written
+    mirror([{"id": "n48", "speaker": "Jane", "text": "line forty-eight, refined"}])  # a window refinement
+    notes[48]["text"] = "line forty-eight, refined"
+    assert mirror.bytes_written - before < 2 * appended + 20   # only the tail from n48 on
+    assert path.read_text() == render_meeting_transcript(_MEETING_META, notes)
+    before = mirror.bytes_written
+    mirror([notes[48]])                                         # re-applying the same note: no I/O
+    assert mirror.bytes_written == before
+
+    mirror([{"id": "r0", "speaker": "Raj", "text": "hi"}])      # a new speaker → the header changes
+    notes.append({"id": "r0", "speaker": "Raj", "text": "hi"})
+    assert path.read_text() == render_meeting_transcript(_MEETING_META, notes)
+
+    path.write_text(path.read_text() + "edited behind the mirror's back\n")
+    mirror([{"id": "r1", "speaker": "Raj", "text": "again"}])  # a changed file is rewritten whole
+    notes.append({"id": "r1", "speaker": "Raj", "text": "again"})
+    assert path.read_text() == render_meeting_transcript(_MEETING_META, notes)
+
+    restarted = MeetingTranscriptMirror(path, _MEETING_META)   # a restarted worker adopts the file
+    restarted([{"id": "r2", "speaker": "Raj", "text": "back"}])
+    notes.append({"id": "r2", "speaker": "Raj", "text": "back"})
+    assert path.read_text() == render_meeting_transcript(_MEETING_META, notes)
+
+
+def test_serve_meeting_mirror_matches_per_note_upsert(tmp_path):
+    def inbox():
+        return [
+            _transcript("1-0", {**_seg("Jane", "um hello"), "segment_id": "a"}),
+            _transcript("2-0", {**_seg("Raj", "yeah hi"), "segment_id": "b"}),
+            _transcript("3-0", {**_seg("Jane", "so anyway"), "segment_id": "c"}),
+        ]
+
+    upserted, mirrored = tmp_path / "upsert.md", tmp_path / "mirror.md"
+    serve_meeting(ProcMeetingStream(inbox=inbox()), transcript_stream="tc:m1", out_topic="o",
+                  card_turn=_card_turn, idle_ms=10, proc_stream="proc:meeting:m1",
+                  on_proc_note=lambda note: upsert_meeting_transcript_file(upserted, _MEETING_META, note))
+    serve_meeting(ProcMeetingStream(inbox=inbox()), transcript_stream="tc:m1", out_topic="o",
+                  card_turn=_card_turn, idle_ms=10, proc_stream="proc:meeting:m1",
+                  on_proc_notes=MeetingTranscriptMirror(mirrored, _MEETING_META))
+    assert mirrored.read_text() == upserted.read_text()
+
+
 # ── workspace skills: governed skills/ symlinked into .claude/skills ──────────────────────────────
 
 def test_link_skills_creates_dir_and_symlink(tmp_path):
@@ -420,10 +420,10 @@ def main() -> None:  # pragma: no cover — the container entrypoint (wired in t
     # Meeting entry functions imported function-locally to avoid an import cycle at module load
     # (worker.meeting imports the generic helpers from this module).
     from worker.meeting import (
-        meeting_card_turn,
+        IncrementalCardTurn,
+        MeetingTranscriptMirror,
         meeting_doc_turn,
         serve_meeting,
-        upsert_meeting_transcript_file,
     )
     from shared.agent_config import load_meeting_config
 
@@ -458,14 +458,15 @@ def main() -> None:  # pragma: no cover — the container entrypoint (wired in t
         import datetime as _dt
         date = _dt.date.today().isoformat()
         title = f"Meeting {native}"
-        # Auth-B/#3a: mirror each cleaned proc note into the per-meeting workspace file, incrementally,
-        # so a chat agent focused on the meeting can `Read kg/entities/meeting/<native>.md` mid-meeting.
+        # Auth-B/#3a: mirror each cleaned proc note into the per-meeting workspace file, incrementally
+        # (append-only — a flush writes only the new/refined tail), so a chat agent focused on the
+        # meeting can `Read kg/entities/meeting/<native>.md` mid-meeting.
         meeting_file = work / "kg" / "entities" / "meeting" / f"{native}.md"
         meeting_meta = {
             "type": "meeting", "id": native, "title": title, "meeting_id": native,
             "session_uid": session_uid, "platform": platform, "date": date,
         }
-        on_proc_note = lambda note: upsert_meeting_transcript_file(meeting_file, meeting_meta, note)  # noqa: E731
+        mirror = MeetingTranscriptMirror(meeting_file, meeting_meta)
         # Deterministic dual-source render seam: persist the SAME notes/cards as the durable envelope
         # alongside the markdown, so live (redis) and finished (file) render identically.
         from worker.meeting import persist_envelope, _seed_dir, validate_envelope
@@ -485,11 +486,14 @@ def main() -> None:  # pragma: no cover — the container entrypoint (wired in t
             )
         serve_meeting(
             client, transcript_stream=transcript_stream, out_topic=out_topic,
-            card_turn=lambda segs: meeting_card_turn(
-                work, segs, model=cfg.model, card_kinds=cfg.card_kinds, steering=cfg.steering,
+            # Incremental beats: the rules + meeting meta + confirmed notes ride a byte-stable (cacheable)
+            # system prefix and only the window lines are new per beat — per-beat cost stays flat.
+            card_turn=IncrementalCardTurn(
+                work, model=cfg.model, card_kinds=cfg.card_kinds, steering=cfg.steering,
                 polish_rules=cfg.polish_rules, tag_rules=cfg.tag_rules,
+                meta={k: meeting_meta[k] for k in ("title", "platform", "date")},
             ),
-            idle_ms=idle_ms, beat_segments=cfg.cadence_segments,
+            idle_ms=idle_ms, beat_segments=cfg.cadence_segments, debounce_s=cfg.beat_debounce_s,
             doc_turn=doc_turn, enabled=cfg.enabled,
             start_id=os.environ.get("VEXA_TRANSCRIPT_START_ID", "0"),
             # P0 (cross-tenant leak fix): BOTH the processed-notes stream AND its cursor key on the
@@ -502,7 +506,7 @@ def main() -> None:  # pragma: no cover — the container entrypoint (wired in t
             # resume one row from another row's position (and leak progress across tenants).
             proc_stream=f"proc:meeting:{row_id}",
             cursor_key=f"proc:meeting:{row_id}:cursor",
-            on_proc_note=on_proc_note,
+            on_proc_notes=mirror,
             on_envelope=on_envelope,
             # Provenance stamped on every processed-notes entry: what pipeline/provider/model
             # produced this cleaned view — persisted verbatim into the durable view's `params`
@@ -12,7 +12,9 @@ from __future__ import annotations
 
 import json
 import logging
+import math
 import re
+import time
 from pathlib import Path
 from typing import Callable, Iterator
 
@@ -104,6 +106,74 @@ def build_card_prompt(
     )
 
 
+# The INCREMENTAL split of the same frame (``IncrementalCardTurn``): everything that does not change
+# beat-to-beat — the rules, kinds, steering, meeting meta and the confirmed-notes context — rides the
+# ``system`` prefix, byte-stable across beats so a provider can serve it from its prompt cache; the
+# per-beat user message carries ONLY the mutable window lines.
+_CARD_CONTEXT_FRAME = (
+    "You are a live meeting copilot watching a conversation in real time. Each message carries the "
+    "mutable transcript processing window. Each line is sent through at most three passes; pass 1 is "
+    "fresh, pass 2 should repair obvious ASR/name/entity errors, and pass 3 should be the final clean "
+    "version before the line freezes and leaves this window.\n\n"
+    "Return a processed transcript plus tag cards. For each input line, emit one note with the SAME id "
+    "and speaker, following the POLISH RULES below.\n\n"
+    "## Polish rules (governed by this workspace)\n{polish}\n\n"
+    "Do not create topic headings. Set chapter to an empty string unless the source text itself gives a "
+    "literal section title.\n\n"
+    "## Tag rules (governed by this workspace)\n{tags}\n\n"
+    "Emit tags ONLY as cards of these kinds: {kinds}. Do not use any other kind.\n\n"
+    "Respond with ONLY this JSON object (no prose, no markdown fence, and do NOT write any files):\n"
+    "{{\"notes\":[{{\"id\":\"<input id>\",\"speaker\":\"<speaker>\",\"chapter\":\"\",\"text\":\"<clean one-line note>\"}}],"
+    "\"cards\":[{{\"kind\":\"<one of {kinds}>\",\"title\":\"<short>\",\"body\":\"<one line>\",\"actionable\":true}}]}}\n"
+    "Use an empty cards array if the window lines add no tags.{steering}{meta}{confirmed}"
+)
+
+_CONTEXT_META_SECTION = "\n\n## Meeting\n{meta}\n"
+
+# Frozen lines are CONTEXT only (names, entities, what was already tagged) — never re-emitted.
+_CONTEXT_CONFIRMED_SECTION = (
+    "\n\n## Confirmed transcript so far (frozen — context only, do not emit notes for these)\n{lines}\n"
+)
+
+_CARD_WINDOW_FRAME = "Transcript processing window:\n\n{lines}"
+
+
+def build_card_context(
+    card_kinds: list[str],
+    steering: str = "",
+    *,
+    polish_rules: str = DEFAULT_POLISH_RULES,
+    tag_rules: str = DEFAULT_TAG_RULES,
+    meta: dict | None = None,
+    confirmed: list[dict] | tuple[dict, ...] = (),
+) -> str:
+    """Compose the STABLE ``system`` prefix of an incremental card turn: the same governed rules and
+    kinds as ``build_card_prompt``, plus the meeting ``meta`` and the ``confirmed`` (frozen) notes.
+    Pure + deterministic — the same inputs give the same bytes, which is what keeps it cacheable."""
+    section = _STEERING_SECTION.format(steering=steering.strip()) if steering.strip() else ""
+    meta_lines = "\n".join(f"{k}: {v}" for k, v in (meta or {}).items() if v is not None)
+    confirmed_lines = "\n".join(
+        f"[id={n.get('id') or '?'} speaker={n.get('speaker') or 'Speaker'}] {n.get('text') or ''}"
+        for n in confirmed
+    )
+    return _CARD_CONTEXT_FRAME.format(
+        kinds=", ".join(card_kinds),
+        polish=(polish_rules or DEFAULT_POLISH_RULES).strip(),
+        tags=(tag_rules or DEFAULT_TAG_RULES).strip(),
+        steering=section,
+        meta=_CONTEXT_META_SECTION.format(meta=meta_lines) if meta_lines else "",
+        confirmed=_CONTEXT_CONFIRMED_SECTION.format(lines=confirmed_lines) if confirmed_lines else "",
+    )
+
+
+def _window_lines(segments: list[dict]) -> str:
+    return "\n".join(
+        f"[pass {int(s.get('rewrite_pass') or 1)}/3 id={s.get('segment_id') or s.get('id') or '?'} "
+        f"speaker={s.get('speaker', '?')}] {s.get('text', '')}"
+        for s in segments
+    )
+
+
 def _extract_json_value(reply: str | None):
     if not reply:
         return None
@@ -255,21 +325,29 @@ def meeting_card_turn(
     ``completion`` is injectable; by default it resolves through the ``worker.worker``
     ``completion_factory`` seam (env-selected adapter, ``VEXA_LLM_PROVIDER``)."""
     kinds = card_kinds or list(DEFAULT_CARD_KINDS)
+    prompt = build_card_prompt(_window_lines(segments), kinds, steering, polish_rules=polish_rules, tag_rules=tag_rules)
+    yield from _card_completion(prompt, segments, kinds=kinds, model=model, completion=completion)
+
+
+def _card_completion(
+    prompt: str, segments: list[dict], *, kinds: list[str], model: str | None,
+    completion=None, system: str | None = None,
+) -> Iterator[dict]:
+    """The ONE completion call behind a card beat (shared by ``meeting_card_turn`` and
+    ``IncrementalCardTurn``): call the port, parse the reply into note + card events, and surface an
+    auth/model failure as its distinct event."""
     segment_by_id = {str(s.get("segment_id") or s.get("id") or ""): s for s in segments}
     stage_by_id = {seg_id: int(s.get("rewrite_pass") or 1) for seg_id, s in segment_by_id.items()}
-    lines = "\n".join(
-        f"[pass {int(s.get('rewrite_pass') or 1)}/3 id={s.get('segment_id') or s.get('id') or '?'} "
-        f"speaker={s.get('speaker', '?')}] {s.get('text', '')}"
-        for s in segments
-    )
-    prompt = build_card_prompt(lines, kinds, steering, polish_rules=polish_rules, tag_rules=tag_rules)
     # We DON'T forward raw model output as turn events — the JSON reply would leak into the UI as a
     # "note"; the meeting feed wants only the parsed notes/cards.
     try:
         if completion is None:
             import worker.worker as _w
             completion = getattr(_w, "completion_factory", completion_from_env)()
-        reply = completion.complete(prompt, model=model).text
+        if system is None:
+            reply = completion.complete(prompt, model=model).text
+        else:
+            reply = completion.complete(prompt, system=system, model=model).text
     except LLMAuthError as exc:
         # Fail LOUD on a 401/auth mismatch: a distinct auth-error (provider host + the
         # BASE_URL-vs-KEY fix) instead of the opaque generic model-error (WS1b).
@@ -292,6 +370,57 @@ def meeting_card_turn(
         yield {"type": "card", "card": card}
 
 
+DEFAULT_CONTEXT_NOTES = 24   # frozen notes carried in the incremental prefix (bounds its size)
+DEFAULT_CONTEXT_STRIDE = 8   # frozen notes batched before the prefix is rebuilt (bounds cache misses)
+
+
+class IncrementalCardTurn:
+    """A stateful ``card_turn`` for ``serve_meeting`` whose prompt cost stays FLAT over a long meeting.
+
+    The stable part of the beat (``build_card_context``: rules, kinds, steering, meeting ``meta`` and
+    the confirmed notes) is sent as the ``system`` prefix; the user message carries only the window
+    lines. Notes that come back ``frozen`` (pass 3) are collected and folded into the prefix only every
+    ``context_stride`` notes, and only the last ``context_notes`` of them are kept — so the prefix is
+    byte-identical for many beats in a row (a provider prompt-cache hit) and never grows with the
+    meeting. ``system`` is the current prefix (read-only; exposed for tests and logs)."""
+
+    def __init__(
+        self, work: Path, *, model: str | None = None, card_kinds: list[str] | None = None,
+        steering: str = "", polish_rules: str = DEFAULT_POLISH_RULES,
+        tag_rules: str = DEFAULT_TAG_RULES, meta: dict | None = None, completion=None,
+        context_notes: int = DEFAULT_CONTEXT_NOTES, context_stride: int = DEFAULT_CONTEXT_STRIDE,
+    ) -> None:
+        self.work = work
+        self.model = model
+        self.kinds = card_kinds or list(DEFAULT_CARD_KINDS)
+        self._frame = {"steering": steering, "polish_rules": polish_rules, "tag_rules": tag_rules, "meta": meta}
+        self.completion = completion
+        self.context_notes = max(0, context_notes)
+        self.context_stride = max(1, context_stride)
+        self._confirmed: list[dict] = []  # the frozen notes IN the current prefix
+        self._pending: dict[str, dict] = {}  # frozen since the last rebuild, not yet in the prefix
+        self.system = self._build()
+
+    def _build(self) -> str:
+        return build_card_context(self.kinds, confirmed=self._confirmed, **self._frame)
+
+    def __call__(self, segments: list[dict]) -> Iterator[dict]:
+        prompt = _CARD_WINDOW_FRAME.format(lines=_window_lines(segments))
+        for ev in _card_completion(
+            prompt, segments, kinds=self.kinds, model=self.model,
+            completion=self.completion, system=self.system,
+        ):
+            note = ev.get("note") if ev.get("type") == "note" else None
+            if note and note.get("frozen"):
+                self._pending[str(note.get("id"))] = {k: note.get(k) for k in ("id", "speaker", "text")}
+            yield ev
+        if len(self._pending) >= self.context_stride:
+            keep = self.context_notes
+            self._confirmed = ([*self._confirmed, *self._pending.values()][-keep:]) if keep else []
+            self._pending.clear()
+            self.system = self._build()
+
+
 # ── Auth-B/#3(a): persist the processed transcript to the workspace, INCREMENTALLY ────────────────
 # As the worker emits 1:1 cleaned `proc:meeting` notes, it ALSO upserts a per-meeting workspace file at
 # kg/entities/meeting/<native>.md so a chat agent focused on the meeting can `Read` it and answer "what's
@@ -303,28 +432,38 @@ def meeting_card_turn(
 _PROC_LINE_RE = re.compile(r"^<!-- id:(?P<id>.*?) -->", )
 
 
+def _transcript_header(meta: dict, speakers: list[str]) -> str:
+    """The per-meeting file up to (and including) the blank line under ``## Transcript``."""
+    fm_keys = ("type", "id", "title", "meeting_id", "session_uid", "platform", "date")
+    fm_lines = [f"{k}: {meta[k]}" for k in fm_keys if meta.get(k) is not None]
+    parts = ["---", *fm_lines, "---", "", "## Speakers", ""]
+    parts += [f"- {sp}" for sp in speakers] or ["- (none yet)"]
+    parts += ["", "## Transcript", ""]
+    return "\n".join(parts) + "\n"
+
+
+def _note_speaker(note: dict) -> str:
+    return str(note.get("speaker") or "Speaker").strip() or "Speaker"
+
+
+def _transcript_line(note: dict) -> str:
+    nid = str(note.get("id") or "").strip()
+    text = " ".join(str(note.get("text") or "").split())
+    tags = note.get("tags") or []
+    suffix = f"  _[tags: {', '.join(str(t) for t in tags)}]_" if tags else ""
+    return f"<!-- id:{nid} --> **{_note_speaker(note)}:** {text}{suffix}\n"
+
+
 def render_meeting_transcript(meta: dict, notes: list[dict]) -> str:
     """Render the per-meeting transcript file: YAML frontmatter (type/id/title/… from ``meta``), a
     Speakers list, and a Transcript section with one id-keyed line per note. Pure + deterministic so the
     upsert is testable offline."""
     speakers: list[str] = []
     for n in notes:
-        sp = str(n.get("speaker") or "Speaker").strip() or "Speaker"
+        sp = _note_speaker(n)
         if sp not in speakers:
             speakers.append(sp)
-    fm_keys = ("type", "id", "title", "meeting_id", "session_uid", "platform", "date")
-    fm_lines = [f"{k}: {meta[k]}" for k in fm_keys if meta.get(k) is not None]
-    parts = ["---", *fm_lines, "---", "", "## Speakers", ""]
-    parts += [f"- {sp}" for sp in speakers] or ["- (none yet)"]
-    parts += ["", "## Transcript", ""]
-    for n in notes:
-        nid = str(n.get("id") or "").strip()
-        sp = str(n.get("speaker") or "Speaker").strip() or "Speaker"
-        text = " ".join(str(n.get("text") or "").split())
-        tags = n.get("tags") or []
-        suffix = f"  _[tags: {', '.join(str(t) for t in tags)}]_" if tags else ""
-        parts.append(f"<!-- id:{nid} --> **{sp}:** {text}{suffix}")
-    return "\n".join(parts) + "\n"
+    return _transcript_header(meta, speakers) + "".join(_transcript_line(n) for n in notes)
 
 
 def persist_envelope(path: Path, envelope: dict) -> None:
@@ -368,6 +507,30 @@ def validate_envelope(envelope: dict, seed_dir: Path) -> list[str]:
     return [e.message for e in sorted(validator.iter_errors(envelope), key=lambda e: list(e.path))]
 
 
+def _read_transcript_notes(path: Path) -> list[dict]:
+    """Parse the id-keyed lines of an existing per-meeting file back into ``{id, speaker, text}`` notes
+    (empty when the file is absent or unreadable)."""
+    notes: list[dict] = []
+    if not path.exists():
+        return notes
+    try:
+        for line in path.read_text().splitlines():
+            m = _PROC_LINE_RE.match(line)
+            if not m:
+                continue
+            rest = line[m.end():].strip()
+            # parse "**Speaker:** text"
+            sp = "Speaker"
+            body = rest
+            if rest.startswith("**") and ":**" in rest:
+                sp = rest[2:rest.index(":**")].strip() or "Speaker"
+                body = rest[rest.index(":**") + 3:].strip()
+            notes.append({"id": m.group("id"), "speaker": sp, "text": body})
+    except OSError:
+        return []
+    return notes
+
+
 def upsert_meeting_transcript_file(path: Path, meta: dict, note: dict) -> None:
     """Idempotently UPSERT one cleaned ``note`` (keyed by ``note['id']``) into the per-meeting transcript
     file at ``path``. Reads the current id-keyed lines, replaces the matching id (or appends a new one),
@@ -376,23 +539,7 @@ def upsert_meeting_transcript_file(path: Path, meta: dict, note: dict) -> None:
     nid = str(note.get("id") or "").strip()
     if not nid:
         return
-    notes: list[dict] = []
-    if path.exists():
-        try:
-            for line in path.read_text().splitlines():
-                m = _PROC_LINE_RE.match(line)
-                if not m:
-                    continue
-                rest = line[m.end():].strip()
-                # parse "**Speaker:** text"
-                sp = "Speaker"
-                body = rest
-                if rest.startswith("**") and ":**" in rest:
-                    sp = rest[2:rest.index(":**")].strip() or "Speaker"
-                    body = rest[rest.index(":**") + 3:].strip()
-                notes.append({"id": m.group("id"), "speaker": sp, "text": body})
-        except OSError:
-            notes = []
+    notes = _read_transcript_notes(path)
     replaced = False
     for existing in notes:
         if existing.get("id") == nid:
@@ -406,6 +553,109 @@ def upsert_meeting_transcript_file(path: Path, meta: dict, note: dict) -> None:
     path.write_text(render_meeting_transcript(meta, notes))
 
 
+class MeetingTranscriptMirror:
+    """The APPEND-ONLY writer of the per-meeting transcript file — the live-loop replacement for calling
+    ``upsert_meeting_transcript_file`` per note, which re-read and rewrote the whole file (O(meeting)
+    per beat). Call it with a flush's batch of notes (``serve_meeting(on_proc_notes=...)``).
+
+    It keeps the lines (and their byte offsets) in memory: a new id is APPENDED, and a refinement of an
+    existing id truncates the file at the EARLIEST changed line and rewrites from there — refinements
+    only touch the live window, so that is a bounded tail, never the meeting. The header is rewritten
+    only when a new speaker joins the Speakers list. The bytes on disk are always exactly
+    ``render_meeting_transcript(meta, notes)``; a file already present at start (a restarted worker) is
+    adopted, and one changed behind the mirror's back is rewritten whole. ``bytes_written`` counts the
+    I/O for tests and logs."""
+
+    def __init__(self, path: Path, meta: dict) -> None:
+        self.path = Path(path)
+        self.meta = meta
+        self._notes: list[dict] = []
+        self._index: dict[str, int] = {}
+        self._speakers: list[str] = []
+        self._offsets: list[int] = []   # byte offset of each note line
+        self._size = -1                 # the file size the mirror last left on disk (-1 = never written)
+        self._loaded = False
+        self.bytes_written = 0
+
+    def _adopt(self) -> None:
+        self._loaded = True
+        for note in _read_transcript_notes(self.path):
+            self._index[note["id"]] = len(self._notes)
+            self._notes.append(note)
+            if note["speaker"] not in self._speakers:
+                self._speakers.append(note["speaker"])
+
+    def __call__(self, notes: list[dict]) -> None:
+        if not self._loaded:
+            self._adopt()
+        first: int | None = None
+        header_changed = False
+        for note in notes:
+            nid = str(note.get("id") or "").strip()
+            if not nid:
+                continue
+            i = self._index.get(nid)
+            if i is None:
+                i = self._index[nid] = len(self._notes)
+                self._notes.append({"id": nid, "speaker": note.get("speaker") or "Speaker", "text": note.get("text") or ""})
+            else:
+                existing = self._notes[i]
+                merged = {
+                    "id": nid,
+                    "speaker": note.get("speaker") or existing.get("speaker"),
+                    "text": note.get("text") or existing.get("text"),
+                }
+                if merged == existing and i < len(self._offsets):
+                    continue  # re-applying the same note is a no-op on disk
+                self._notes[i] = merged
+                if _note_speaker(merged) != _note_speaker(existing):  # rare: re-derive the Speakers list
+                    speakers = list(dict.fromkeys(_note_speaker(n) for n in self._notes))
+                    header_changed = header_changed or speakers != self._speakers
+                    self._speakers = speakers
+            sp = _note_speaker(self._notes[i])
+            if sp not in self._speakers:
+                self._speakers.append(sp)
+                header_changed = True
+            first = i if first is None else min(first, i)
+        if first is None and not header_changed:
+            return
+        try:
+            on_disk = self.path.stat().st_size
+        except OSError:
+            on_disk = -2
+        if header_changed or on_disk != self._size or first is None or first > len(self._offsets):
+            self._rewrite()
+        else:
+            self._write_from(first)
+
+    def _rewrite(self) -> None:
+        header = _transcript_header(self.meta, self._speakers).encode()
+        self._offsets = []
+        self.path.parent.mkdir(parents=True, exist_ok=True)
+        with open(self.path, "wb") as fh:
+            fh.write(header)
+        self.bytes_written += len(header)
+        self._size = len(header)
+        self._write_from(0)
+
+    def _write_from(self, first: int) -> None:
+        start = self._offsets[first] if first < len(self._offsets) else self._size
+        del self._offsets[first:]
+        chunks, pos = [], start
+        for note in self._notes[first:]:
+            line = _transcript_line(note).encode()
+            self._offsets.append(pos)
+            chunks.append(line)
+            pos += len(line)
+        data = b"".join(chunks)
+        with open(self.path, "r+b") as fh:
+            fh.seek(start)
+            fh.truncate()
+            fh.write(data)
+        self.bytes_written += len(data)
+        self._size = pos
+
+
 def _set_cursor(stream: _Stream, cursor_key: str | None, raw_id: str) -> None:
     """Freeze the per-meeting processed CURSOR = the last raw transcript stream-id cleaned. Best-effort:
     a fake stream without ``set`` (or a transient redis error) must never break the live beat."""
@@ -439,6 +689,9 @@ def serve_meeting(
     on_proc_note: Callable[[dict], None] | None = None,
     on_envelope: Callable[[dict], None] | None = None,
     proc_params: dict | None = None,
+    on_proc_notes: Callable[[list[dict]], None] | None = None,
+    debounce_s: float = 0.0,
+    clock: Callable[[], float] = time.monotonic,
 ) -> None:
     """Consume the meeting's ``transcript.v1`` Stream (the meetings⊥agent seam — read by schema), gate
     cheaply (a NEW speaker, or ``beat_segments`` segments), and run a copilot beat that XADDs proactive
@@ -448,6 +701,14 @@ def serve_meeting(
 
     Cards surfaced across the meeting are accumulated (de-duped by title) and, on ``session_end``,
     handed to ``doc_turn`` — the post-meeting WRITE turn that authors/updates the kg meeting entity.
+
+    ``debounce_s > 0`` ADAPTS the gate to the speech rate (segments/s, smoothed over reads): a fast
+    talker's beat waits for ``rate × debounce_s`` segments (capped at ``_MAX_BEAT_FACTOR ×
+    beat_segments``) instead of firing every ``beat_segments``, a new speaker only fires once
+    ``debounce_s`` has passed since the last beat, and buffered lines that go quiet for ``debounce_s``
+    fire a trailing beat. 0 keeps the fixed gate. ``on_proc_notes`` is the batch form of
+    ``on_proc_note`` — one call per mirror flush (``MeetingTranscriptMirror`` appends instead of
+    rewriting the file).
     """
     seen_speakers: set[str] = set()
     buffer: list[dict] = []
@@ -459,6 +720,8 @@ def serve_meeting(
     notes_by_id: dict[str, dict] = {}
     last = start_id
     n = 0
+    rate = 0.0                      # smoothed speech rate, segments/s (debounce only)
+    last_read = last_beat = clock()
 
     def _persist_envelope() -> None:
         """DURABLE RENDER SOURCE (deterministic dual-source): persist the SAME running notes/cards the
@@ -511,6 +774,11 @@ def serve_meeting(
                     on_proc_note(note)
                 except Exception:  # noqa: BLE001 — the workspace mirror is an optimization
                     log.warning("serve_meeting: on_proc_note upsert failed", exc_info=True)
+        if on_proc_notes is not None and mirror_dirty:
+            try:
+                on_proc_notes(list(mirror_dirty.values()))
+            except Exception:  # noqa: BLE001 — the workspace mirror is an optimization
+                log.warning("serve_meeting: on_proc_notes mirror failed", exc_info=True)
         if mirror_dirty:
             _persist_envelope()
         mirror_dirty.clear()
@@ -536,11 +804,29 @@ def serve_meeting(
                 seg["_rewrite_passes"] = int(seg.get("_rewrite_passes", 0)) + 1
         _flush_mirror()
 
+    def _gated_beat() -> None:
+        nonlocal n, processing_window, window_by_id, buffer, last_beat
+        n += 1
+        mutable = [seg for seg in processing_window if int(seg.get("_rewrite_passes", 0)) < 3]
+        if mutable:
+            _run_beat(mutable, n)
+        processing_window = [seg for seg in processing_window if int(seg.get("_rewrite_passes", 0)) < 3]
+        window_by_id = {seg["segment_id"]: seg for seg in processing_window}
+        buffer = []
+        last_beat = clock()
+
     while True:
-        resp = stream.xread({transcript_stream: last}, count=50, block=idle_ms)
+        pending = debounce_s > 0 and enabled and bool(buffer)
+        block = min(idle_ms, max(1, int(debounce_s * 1000))) if pending else idle_ms
+        resp = stream.xread({transcript_stream: last}, count=50, block=block)
+        now = clock()
         if not resp:
-            return  # transcript idle/ended → reap
+            if not pending:
+                return  # transcript idle/ended → reap
+            _gated_beat()  # trailing debounce: the buffered lines went quiet for debounce_s
+            continue
         new_speaker = False
+        arrived = 0
         for _name, entries in resp:
             for entry_id, fields in entries:
                 last = entry_id
@@ -580,6 +866,7 @@ def serve_meeting(
                     item["segment_id"] = sid
                     item["_rewrite_passes"] = 0
                     window_by_id[sid] = item
+                    arrived += 1
                     buffer.append(item)
                     processing_window.append(item)
                     # Baseline 1:1 cleaned note onto the processed stream — ALWAYS present per segment,
@@ -594,14 +881,28 @@ def serve_meeting(
                 # Advance the per-meeting CURSOR to the last raw stream-id we've now cleaned (gap-fill
                 # picks up from here on re-enable; OFF freezes it at the last processed entry).
                 _set_cursor(stream, cursor_key, entry_id)
-        if enabled and buffer and (new_speaker or len(buffer) >= beat_segments):
-            n += 1
-            mutable = [seg for seg in processing_window if int(seg.get("_rewrite_passes", 0)) < 3]
-            if mutable:
-                _run_beat(mutable, n)
-            processing_window = [seg for seg in processing_window if int(seg.get("_rewrite_passes", 0)) < 3]
-            window_by_id = {seg["segment_id"]: seg for seg in processing_window}
-            buffer = []
+        if debounce_s > 0:
+            if arrived:
+                inst = arrived / max(now - last_read, 0.05)
+                rate = inst if rate <= 0 else (1 - _RATE_ALPHA) * rate + _RATE_ALPHA * inst
+            last_read = now
+            due = (len(buffer) >= _debounced_threshold(rate, debounce_s, beat_segments)
+                   or (new_speaker and now - last_beat >= debounce_s))
+        else:
+            due = new_speaker or len(buffer) >= beat_segments
+        if enabled and buffer and due:
+            _gated_beat()
+
+
+_RATE_ALPHA = 0.3        # EWMA weight of the newest read in the smoothed speech rate
+_MAX_BEAT_FACTOR = 4     # a debounced beat never waits for more than 4× beat_segments
+
+
+def _debounced_threshold(rate: float, debounce_s: float, beat_segments: int) -> int:
+    """Segments a debounced beat waits for: what the speaker says in ``debounce_s`` at the current
+    ``rate``, never below ``beat_segments`` nor above ``_MAX_BEAT_FACTOR × beat_segments``."""
+    want = math.ceil(rate * debounce_s)
+    return max(beat_segments, min(want, _MAX_BEAT_FACTOR * beat_segments))
 
 
 def _accumulate_card(cards: list[dict], seen_titles: set[str], card: dict) -> None:
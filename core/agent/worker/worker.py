@@ -50,6 +50,8 @@ from worker.engine import (  # noqa: E402 — explicit re-exports for names `*`
 from worker.meeting import *  # noqa: F401,F403,E402
 from worker.meeting import (  # noqa: E402 — explicit re-exports for names `*` skips (underscore-prefixed) + clarity
     MEETING_DOC_PROMPT,
+    IncrementalCardTurn,
+    MeetingTranscriptMirror,
     _CARD_FRAME,
     _CARD_GROUP,
     _PROC_LINE_RE,
@@ -62,6 +64,7 @@ from worker.meeting import (  # noqa: E402 — explicit re-exports for names `*`
     _model_error_event,
     _proc_note,
     _set_cursor,
+    build_card_context,
     build_card_prompt,
     fallback_processed_notes,
     meeting_card_turn,
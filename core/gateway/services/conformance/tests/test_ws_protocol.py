@@ -214,6 +214,7 @@ def test_ws_goldens_conform_by_path():
         "Subscribed": "Subscribed.ack.json",
         "TranscriptionSegment": "TranscriptionSegment.live.json",
         "Transcript": "Transcript.bundle.json",
+        "TranscriptDelta": "TranscriptDelta.coalesced.json",
         "MeetingStatus": "MeetingStatus.active.json",
         "ChatMessage": "ChatMessage.summary.json",
         "Error": "Error.missing-key.json",
@@ -19,10 +19,11 @@ the conformance harness never imports it — it injects its own in-process fakes
 from __future__ import annotations
 
 import os
+import time
 from contextlib import asynccontextmanager
 from typing import Optional
 
-from .obs import TRACE_HEADER, get_trace_id
+from .obs import TRACE_HEADER, get_trace_id, incr, observe_ms
 from .ports import AuthUnavailable
 
 
@@ -75,14 +76,34 @@ class AdminApiAuthorizer:
     configured, and forwarding the request trace_id); ``authorize_subscribe`` POSTs
     ``/ws/authorize-subscribe`` to meeting-api (which now hosts the folded-in collector, P2) with
     the resolved user identity.
+
+    ``cache`` (``authcache.VerdictCache``, opt-in) answers repeat lookups from a short-TTL LRU and
+    coalesces concurrent lookups of one key into ONE validate; ``None`` validates every lookup.
     """
 
-    def __init__(self, client, admin_api_url: str, meeting_api_url: str):
+    def __init__(self, client, admin_api_url: str, meeting_api_url: str, cache=None):
         self._client = client
         self._admin_api_url = admin_api_url.rstrip("/")
         self._meeting_api_url = meeting_api_url.rstrip("/")
+        self._cache = cache
 
     async def resolve(self, api_key: str) -> Optional[dict]:
+        if self._cache is not None:
+            return await self._cache.get_or_load(api_key, lambda: self._validate(api_key))
+        return await self._validate(api_key)
+
+    async def _validate(self, api_key: str) -> Optional[dict]:
+        started = time.perf_counter()
+        try:
+            return await self._validate_hop(api_key)
+        except AuthUnavailable:
+            incr("auth.validate_unavailable")
+            raise
+        finally:
+            incr("auth.validate_calls")
+            observe_ms("auth.validate", (time.perf_counter() - started) * 1000.0)
+
+    async def _validate_hop(self, api_key: str) -> Optional[dict]:
         import httpx
 
         headers = {TRACE_HEADER: get_trace_id() or ""}
@@ -139,7 +160,7 @@ class AdminApiAuthorizer:
             return {"authorized": [], "errors": [f"authorization_call_failed:{e}"]}
 
 
-def build_auth_and_downstream(admin_api_url: str, meeting_api_url: str):
+def build_auth_and_downstream(admin_api_url: str, meeting_api_url: str, auth_cache=None):
     """#495: build the authorizer + downstream over TWO httpx clients with SEPARATE connection
     pools, and return ``(authorizer, downstream)``. This is the load-bearing decision the whole fix
     turns on — extracted here so it is unit-testable WITHOUT redis (build_production_app needs redis;
@@ -170,7 +191,7 @@ def build_auth_and_downstream(admin_api_url: str, meeting_api_url: str):
         timeout=httpx.Timeout(connect=10.0, read=None, write=10.0, pool=10.0),
         limits=httpx.Limits(max_connections=100, max_keepalive_connections=20),
     )
-    authorizer = AdminApiAuthorizer(auth_client, admin_api_url, meeting_api_url)
+    authorizer = AdminApiAuthorizer(auth_client, admin_api_url, meeting_api_url, cache=auth_cache)
     downstream = HttpxDownstreamClient(forward_client, stream_client=stream_client)
     return authorizer, downstream
 
@@ -206,15 +227,23 @@ def build_production_app(
     mcp_url = os.getenv("MCP_URL", "http://mcp:8010")
     redis_url = redis_url or os.getenv("REDIS_URL", "redis://redis:6379/0")
 
-    # #495: authorizer + downstream over SEPARATE httpx pools (see build_auth_and_downstream).
-    authorizer, downstream = build_auth_and_downstream(admin_api_url, meeting_api_url)
     redis_client = aioredis.from_url(
         redis_url, encoding="utf-8", decode_responses=True,
         socket_timeout=10, socket_connect_timeout=5, socket_keepalive=True,
         health_check_interval=30, retry_on_timeout=True,
     )
+    # Opt-in verdict cache (GATEWAY_AUTH_CACHE): short-TTL LRU + coalescing, evicted by admin-api's
+    # auth:invalidate pushes on the same redis the /ws fan-in uses.
+    from .authcache import from_env as _auth_cache_from_env
+
+    auth_cache = _auth_cache_from_env()
+    if auth_cache is not None:
+        auth_cache.listen_on(redis_client)
+    # #495: authorizer + downstream over SEPARATE httpx pools (see build_auth_and_downstream).
+    authorizer, downstream = build_auth_and_downstream(admin_api_url, meeting_api_url, auth_cache)
 
     from .ratelimit import from_env as _rate_limiter_from_env
+    from .fanout import from_env as _fanout_hub_from_env
 
     app = create_app(
         authorizer,
@@ -224,7 +253,9 @@ def build_production_app(
         agent_api_url=agent_api_url,  # P20·Stage 2: the agent control plane fronted under /api/*
         admin_api_url=admin_api_url,  # /user/webhook self-serve proxies to identity (admin-api)
         mcp_url=mcp_url,              # #795: the MCP streamable-HTTP front door under /mcp
-        rate_limiter=_rate_limiter_from_env(),  # WS-6: per-user DoS guard (generous defaults; env-tunable)
+        # WS-6: per-user DoS guard (generous defaults; env-tunable), cluster-wide GCRA on this redis.
+        rate_limiter=_rate_limiter_from_env(redis=redis_client),
+        fanout_hub=_fanout_hub_from_env(redis_client),  # one redis sub per /ws channel per pod (opt-in)
     )
 
     # --- fastapi-guard: per-IP rate limiting, IP allow/deny + auto-ban (edge_guard.py) ---
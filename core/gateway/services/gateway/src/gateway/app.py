@@ -26,19 +26,27 @@ spans (preserved from the carve so gate:tracing stays green).
 from __future__ import annotations
 
 import asyncio
+import inspect
 import json
 import os
+import time
 from contextlib import AsyncExitStack
-from typing import Dict, List, Optional, Set, Tuple
+from typing import TYPE_CHECKING, Any, AsyncIterator, Callable, Dict, List, Optional, Set, Tuple
 
 import httpx  # the downstream adapter's transport errors are mapped to 502/504 (not leaked as a 500)
 
 from fastapi import FastAPI, Request, Response, WebSocket, WebSocketDisconnect
 from fastapi.responses import StreamingResponse
 
-from .obs import TRACE_HEADER, TraceMiddleware, get_trace_id, log_event, set_user_id
+from .obs import (
+    TRACE_HEADER, TraceMiddleware, get_trace_id, incr, log_event, metrics_snapshot,
+    observe_transcript_send, observe_transcript_upstream, set_user_id,
+)
 from .ports import Authorizer, AuthUnavailable, DownstreamClient, RedisBus
 
+if TYPE_CHECKING:
+    from .fanout import FanoutHub
+
 # #495: the honest answer when the auth path itself is unreachable — a retryable 503, never a
 # 401 that blames the caller's (valid) key. Shared by /auth/me and the proxy authorizer. Also
 # emits a TYPED, non-empty auth-infra log line (FM02: the old path swallowed the failure in a
@@ -88,6 +96,16 @@ _DEFAULT_MCP_URL = "http://mcp:8010"
 # ``mcp-session-id`` is minted by the server on initialize and echoed by the client on every later
 # request; drop it at the edge and the session can never be bound. Passed through on BOTH legs.
 _MCP_HEADERS = ("mcp-session-id", "mcp-protocol-version")
+# Set on a relayed stream when the upstream did not: never let an intermediary buffer it into
+# uselessness.
+_RELAY_NO_BUFFER = {"Cache-Control": "no-cache", "X-Accel-Buffering": "no"}
+# What a recording byte response needs end-to-end: the framing of a 200/206/416 (length, range,
+# encoding — relayed raw, so the upstream's framing IS the body's), its validators, and the
+# ``location`` of a presigned-redirect answer.
+_MEDIA_HEADERS = (
+    "content-length", "content-range", "accept-ranges", "content-encoding", "content-disposition",
+    "etag", "last-modified", "cache-control", "location",
+)
 
 
 def _required_scopes(path: str) -> Optional[Set[str]]:
@@ -107,6 +125,7 @@ def create_app(
     admin_api_url: str = _DEFAULT_ADMIN_API_URL,
     mcp_url: str = _DEFAULT_MCP_URL,
     rate_limiter=None,
+    fanout_hub: Optional["FanoutHub"] = None,
 ) -> FastAPI:
     """Build the gateway FastAPI app over the injected ports.
 
@@ -114,6 +133,8 @@ def create_app(
     ``downstream``  — forwards proxied HTTP requests to meeting-api (the unified control plane:
                       /bots + /transcripts + /meetings + /recordings all live there now, P2).
     ``redis``       — pub/sub bus for the ``/ws`` fan-in.
+    ``fanout_hub``  — optional shared ``/ws`` fan-out (``fanout.FanoutHub``): one redis subscription
+                      per channel for the whole process. ``None`` keeps the per-subscription fan-in.
     """
     app = FastAPI(title="Vexa API Gateway (v0.12)")
     # The edge: mint/read X-Trace-Id and bind it for the request (logevent.v1 trace_id).
@@ -123,7 +144,13 @@ def create_app(
     # check), no downstream call. 200 + {status:"ok", service:"gateway"} = process is up.
     @app.get("/health")
     async def health():
-        return {"status": "ok", "service": "gateway"}
+        body = {"status": "ok", "service": "gateway"}
+        if fanout_hub is not None:
+            body["ws_fanout"] = fanout_hub.stats()
+        metrics = metrics_snapshot()
+        if metrics["counters"] or metrics["latency_ms"]:
+            body["metrics"] = metrics  # obs counters: auth-cache hit rate, validate latency
+        return body
 
     # --- /auth/me — caller identity from the API key (GET /auth/me with x-api-key →
     # user_id/email/scopes); the dashboard's login + session-validation resolve the user via this.
@@ -185,8 +212,13 @@ def create_app(
 
         # Per-user request rate limit (WS-6) — a valid key could otherwise fire unlimited requests at
         # the control plane (the max_concurrent_bots cap bounds active bots, not request rate). 429 when
-        # the per-user token bucket is empty; the bucket refills continuously (Retry-After: 1s).
-        if rate_limiter is not None and not rate_limiter.allow(str(user_id)):
+        # the per-user token bucket is empty; the bucket refills continuously (Retry-After: 1s). The
+        # cluster-wide GcraRateLimiter's allow() is a coroutine (one redis script call); the in-process
+        # bucket's is plain.
+        allowed = rate_limiter.allow(str(user_id)) if rate_limiter is not None else True
+        if inspect.isawaitable(allowed):
+            allowed = await allowed
+        if not allowed:
             return None, Response(
                 content=json.dumps({"detail": "Rate limit exceeded"}),
                 status_code=429,
@@ -306,9 +338,10 @@ def create_app(
         # Content-Length from the (already httpx-decoded) body; a stale one would corrupt it.
         # ``mcp-session-id``/``mcp-protocol-version`` join them for the same reason: they are the
         # MCP transport's session binding, and a forward that eats them breaks the handshake.
+        # ``etag``/``cache-control`` carry the transcript read's conditional-GET (If-None-Match → 304).
         passthrough = {
             k: resp_headers[k]
-            for k in ("content-range", "accept-ranges", "content-disposition") + _MCP_HEADERS
+            for k in ("content-range", "accept-ranges", "content-disposition", "etag", "cache-control") + _MCP_HEADERS
             if k in resp_headers
         }
         return Response(
@@ -388,10 +421,12 @@ def create_app(
         return await _forward("GET", _meeting(f"/recordings/{recording_id}/master"), request)
 
     # The master byte stream the recording player loads (the master metadata's raw_url points here).
+    # Relayed by _forward_media: a presigned 307 passes straight back to the player, and proxied
+    # bytes stream through unbuffered.
     @app.get("/recordings/{recording_id}/media/{media_file_id}/raw")
     async def get_recording_media_raw(recording_id: int, media_file_id: int, request: Request):
-        return await _forward(
-            "GET", _meeting(f"/recordings/{recording_id}/media/{media_file_id}/raw"), request
+        return await _forward_media(
+            _meeting(f"/recordings/{recording_id}/media/{media_file_id}/raw"), request
         )
 
     # native download alias (#579 C3): the sealed api.v1 media-download path a 0.10 client calls.
@@ -399,8 +434,8 @@ def create_app(
     # to it so recording playback no longer 404s. Forwarded verbatim (Range headers preserved).
     @app.get("/recordings/{recording_id}/media/{media_file_id}/download")
     async def get_recording_media_download(recording_id: int, media_file_id: int, request: Request):
-        return await _forward(
-            "GET", _meeting(f"/recordings/{recording_id}/media/{media_file_id}/raw"), request
+        return await _forward_media(
+            _meeting(f"/recordings/{recording_id}/media/{media_file_id}/raw"), request
         )
 
     @app.get("/meetings")
@@ -557,7 +592,7 @@ def create_app(
 
     # The RELAY forward: like _forward_stream, the body is streamed and never buffered — but the
     # UPSTREAM's own head is carried through (status + content-type + the transport headers named
-    # in _MCP_HEADERS) instead of the gateway minting an SSE envelope of its own. A route uses this
+    # in ``relay``) instead of the gateway minting an SSE envelope of its own. A route uses this
     # when the upstream, not the gateway, decides what the answer is: the MCP streamable-HTTP leg
     # answers an SSE stream, a JSON error, or a session-handshake refusal over the SAME GET, and
     # the gateway must not decide which by rewriting it (#698 fail-loud: no laundered statuses).
@@ -566,8 +601,21 @@ def create_app(
     # as the buffered forward types it (504 slow / 502 unreachable) — never a blanket 503. Only
     # after a head is in hand does the body iterator take over; the exit stack keeps the downstream
     # stream open for its life and closes it when the client goes away.
+    #
+    # Per leg: ``relay`` is the upstream header allowlist, ``chunks`` picks the body iterator
+    # (decoded ``aiter_bytes`` / wire-exact ``aiter_raw``), ``defaults`` are headers set only when
+    # the upstream did not, and ``on_open`` sees the upstream status once the head is in.
     async def _forward_stream_verbatim(
-        method: str, url: str, request: Request, *, api_key: Optional[str] = None
+        method: str,
+        url: str,
+        request: Request,
+        *,
+        api_key: Optional[str] = None,
+        relay: Tuple[str, ...] = _MCP_HEADERS,
+        chunks: Callable[[Any], AsyncIterator[bytes]] = lambda upstream: upstream.aiter_bytes(),
+        media_type: str = "application/json",
+        defaults: Dict[str, str] = _RELAY_NO_BUFFER,
+        on_open: Optional[Callable[[int], None]] = None,
     ) -> Response:
         headers, error = await _authorize(method, request, api_key=api_key)
         if error is not None:
@@ -589,27 +637,47 @@ def create_app(
             return Response(content=json.dumps({"detail": f"upstream unreachable: {type(e).__name__}"}),
                             status_code=502, media_type="application/json")
 
+        status = upstream.status_code
+        if on_open is not None:
+            on_open(status)
         log_event(
             "downstream_stream_opened",
             audience="system",
             level="debug",
             span="proxy",
-            fields={"method": method, "path": url, "downstream_status": upstream.status_code},
+            fields={"method": method, "path": url, "downstream_status": status},
         )
 
         async def body():
             async with stack:  # closes the downstream stream when the client disconnects
-                async for chunk in upstream.aiter_bytes():
+                async for chunk in chunks(upstream):
                     yield chunk
 
         up_headers = upstream.headers
-        media_type = up_headers.get("content-type") or "application/json"
-        relayed = {k: up_headers[k] for k in _MCP_HEADERS if k in up_headers}
-        # Never let an intermediary buffer a relayed stream into uselessness.
-        relayed.setdefault("Cache-Control", "no-cache")
-        relayed.setdefault("X-Accel-Buffering", "no")
+        relayed = {k: up_headers[k] for k in relay if k in up_headers}
+        for k, v in defaults.items():
+            relayed.setdefault(k, v)
         return StreamingResponse(
-            body(), status_code=upstream.status_code, media_type=media_type, headers=relayed
+            body(), status_code=status,
+            media_type=up_headers.get("content-type") or media_type, headers=relayed,
+        )
+
+    # The MEDIA forward: recording playback. The key is authorized here, and meeting-api scopes the
+    # media file to the resolved user. Its answer is then relayed as-is:
+    #   * a 307 to a presigned object-store URL (RECORDING_MEDIA_DELIVERY=presign) goes back to the
+    #     player with its Location. The bytes, and every Range seek, then go player ↔ store, and the
+    #     gateway's cost per playback is one authorized redirect.
+    #   * proxied bytes are relayed RAW, as the upstream's reads arrive, never decoded or re-chunked.
+    #     The upstream's Content-Length / Content-Range frame the body, and the buffered forward's
+    #     full-body read (one copy of every byte in gateway memory) is gone.
+    async def _forward_media(url: str, request: Request) -> Response:
+        return await _forward_stream_verbatim(
+            "GET", url, request,
+            relay=_MEDIA_HEADERS,
+            chunks=lambda upstream: upstream.aiter_raw(),
+            media_type="application/octet-stream",
+            defaults={},
+            on_open=lambda status: incr("media.redirected" if 300 <= status < 400 else "media.proxied"),
         )
 
     # The agent domain lives under the canonical /agent/* prefix (peer to the meetings domain). The SSE
@@ -685,12 +753,14 @@ def create_app(
     # ---- the /ws multiplex (carve of main.websocket_multiplex, main.py:2165-2340) ----
     @app.websocket("/ws")
     async def websocket_multiplex(ws: WebSocket):
-        await run_multiplex(ws, authorizer, redis)
+        await run_multiplex(ws, authorizer, redis, hub=fanout_hub)
 
     return app
 
 
-async def run_multiplex(ws: WebSocket, authorizer: Authorizer, redis: RedisBus) -> None:
+async def run_multiplex(
+    ws: WebSocket, authorizer: Authorizer, redis: RedisBus, *, hub: Optional["FanoutHub"] = None,
+) -> None:
     """The ``/ws`` control loop + fan-in, carved verbatim from main.websocket_multiplex.
 
     PUBLIC (P2 follow-up): the conformance ws-harness drives this directly to exercise the SHIPPED
@@ -699,12 +769,17 @@ async def run_multiplex(ws: WebSocket, authorizer: Authorizer, redis: RedisBus)
 
     guard (PRE-accept, opt-in) → accept → authenticate (missing key → error + close 4401) →
       loop over client frames:
-      subscribe   → authorize, register a redis fan-in per meeting, ack ``subscribed``;
+      subscribe   → authorize, register a redis fan-in per meeting, ack ``subscribed``
+                    (``mode:"delta"`` routes the transcript channel through ``coalesce.py``);
       unsubscribe → cancel the fan-in task(s), ack ``unsubscribed`` (stops forwarding);
       ping        → ``pong``;
       otherwise   → an ``error`` frame (invalid_json / unknown_action / invalid_*_payload).
     Each subscription fans in ``tc:meeting:{id}:mutable`` / ``bm:meeting:{id}:status`` /
     ``va:meeting:{id}:chat`` and forwards every raw payload to the socket (main.py:2204).
+
+    With ``hub`` (``fanout.FanoutHub``) the socket instead joins the process-wide fan-out: ONE
+    redis subscription per channel shared by every local socket, each with a bounded queue and the
+    hub's slow-consumer policy. The frames on the wire are identical either way.
     """
     # --- optional WS guard hook (GUARD_WS_ENABLED, default false) ---
     # HTTP SecurityMiddleware does not intercept /ws (Starlette middleware is HTTP-only).
@@ -724,7 +799,7 @@ async def run_multiplex(ws: WebSocket, authorizer: Authorizer, redis: RedisBus)
     if env_truthy(os.getenv("GUARD_WS_ENABLED")):
         from .edge_guard import ws_guard_check
 
-        if not ws_guard_check(ws):
+        if not await ws_guard_check(ws):
             await ws.close(code=4401)  # pre-accept reject → HTTP 403 to the upgrade
             return
 
@@ -767,10 +842,28 @@ async def run_multiplex(ws: WebSocket, authorizer: Authorizer, redis: RedisBus)
     user_id = user_data["user_id"]
     set_user_id(user_id)
 
-    sub_tasks: Dict[Tuple, asyncio.Task] = {}
+    # Every frame leaves through ``send``, which closes only the per-socket ``mutable_to_ws`` hop of
+    # a traced segment. The upstream hops are observed once per frame where it enters the process:
+    # the hub's channel pump, or (without the hub) this socket's own ``fan_in``.
+    slow_ms = float(os.getenv("TRANSCRIPT_TRACE_SLOW_MS", "5000"))
+
+    async def send(data) -> None:
+        await ws.send_text(data)
+        try:
+            observe_transcript_send(data, time.time() * 1000)
+        except Exception:  # noqa: BLE001 — observability never breaks the forward path
+            pass
+
+    sub_tasks: Dict[Tuple, List[asyncio.Task]] = {}
+    sub_channels: Dict[Tuple, List[str]] = {}
+    # mode:"delta" meetings — their transcript coalescer (+ its own hub sink when the hub is on)
+    coalescers: Dict[Tuple, Any] = {}
+    delta_sinks: Dict[Tuple, Any] = {}
     subscribed_meetings: Set[Tuple] = set()
+    sink = hub.attach(send, lambda code: ws.close(code=code)) if hub is not None else None
 
-    async def fan_in(channels: List[str]):
+    async def fan_in(channels: List[str], forward=None):
+        forward = forward or send
         pubsub = redis.pubsub()
         await pubsub.subscribe(*channels)
         try:
@@ -779,7 +872,11 @@ async def run_multiplex(ws: WebSocket, authorizer: Authorizer, redis: RedisBus)
                     continue
                 data = message.get("data")
                 try:
-                    await ws.send_text(data)  # forward the raw redis payload (main.py:2204)
+                    observe_transcript_upstream(data, time.time() * 1000, slow_ms)
+                except Exception:  # noqa: BLE001 — observability never breaks the forward path
+                    pass
+                try:
+                    await forward(data)  # forward the raw redis payload (main.py:2204)
                 except Exception:
                     break
         finally:
@@ -789,23 +886,49 @@ async def run_multiplex(ws: WebSocket, authorizer: Authorizer, redis: RedisBus)
             except Exception:
                 pass
 
-    async def subscribe_meeting(platform: str, native_id: str, user_id, meeting_id):
+    async def subscribe_meeting(platform: str, native_id: str, user_id, meeting_id,
+                                coalesce_ms: Optional[int] = None):
         key = (platform, native_id, user_id)
         if key in subscribed_meetings:
             return
         subscribed_meetings.add(key)
+        transcript = f"tc:meeting:{meeting_id}:mutable"
         channels = [
-            f"tc:meeting:{meeting_id}:mutable",
+            transcript,
             f"bm:meeting:{meeting_id}:status",
             f"va:meeting:{meeting_id}:chat",
         ]
-        sub_tasks[key] = asyncio.create_task(fan_in(channels))
+        # mode:"delta" — the transcript channel goes through a coalescer; status + chat stay raw.
+        coalescer = None
+        if coalesce_ms is not None:
+            from .coalesce import TranscriptCoalescer
+
+            coalescer = coalescers[key] = TranscriptCoalescer(
+                send, window_ms=coalesce_ms,
+                meeting={"id": meeting_id, "platform": platform, "native_id": native_id})
+            channels = channels[1:]
+        if sink is not None:
+            sub_channels[key] = channels
+            hub.subscribe(sink, channels)
+            if coalescer is not None:
+                delta_sinks[key] = hub.attach(coalescer.offer, lambda code: ws.close(code=code))
+                hub.subscribe(delta_sinks[key], [transcript])
+            return
+        sub_tasks[key] = [asyncio.create_task(fan_in(channels))]
+        if coalescer is not None:
+            sub_tasks[key].append(asyncio.create_task(fan_in([transcript], forward=coalescer.offer)))
 
     async def unsubscribe_meeting(platform: str, native_id: str, user_id):
         key = (platform, native_id, user_id)
-        task = sub_tasks.pop(key, None)
-        if task:
+        for task in sub_tasks.pop(key, []):
             task.cancel()
+        channels = sub_channels.pop(key, None)
+        if channels and sink is not None:
+            hub.unsubscribe(sink, channels)
+        if key in delta_sinks:
+            hub.detach(delta_sinks.pop(key))
+        if key in coalescers:
+            coalescers.pop(key).cancel()
         subscribed_meetings.discard(key)
 
     # Auto-subscribe the authed socket to its USER scope (Track G — meeting-status-ws §C.2). The
@@ -815,7 +938,11 @@ async def run_multiplex(ws: WebSocket, authorizer: Authorizer, redis: RedisBus)
     # path as the per-meeting channels — the gateway is a thin raw forwarder for the user channel
     # exactly as it is for tc:/bm:/va:. Per-meeting subscriptions below are unchanged.
     user_channel = f"u:{user_id}:meetings"
-    user_sub_task = asyncio.create_task(fan_in([user_channel]))
+    if sink is not None:
+        hub.subscribe(sink, [user_channel])
+        user_sub_task = None
+    else:
+        user_sub_task = asyncio.create_task(fan_in([user_channel]))
 
     try:
         while True:
@@ -860,6 +987,19 @@ async def run_multiplex(ws: WebSocket, authorizer: Authorizer, redis: RedisBus)
                         "type": "error", "error": "invalid_subscribe_payload",
                         "details": "no valid meeting objects"}))
                     continue
+                # Opt-in delivery mode: "raw" (default — every payload verbatim) or "delta"
+                # (coalesced transcript.delta frames keyed by segment_id, coalesce_ms window).
+                mode = msg.get("mode", "raw")
+                coalesce_ms = None
+                if mode == "delta":
+                    from .coalesce import clamp_coalesce_ms
+
+                    coalesce_ms = clamp_coalesce_ms(msg.get("coalesce_ms"))
+                if mode not in ("raw", "delta") or (mode == "delta" and coalesce_ms is None):
+                    await ws.send_text(json.dumps({
+                        "type": "error", "error": "invalid_subscribe_payload",
+                        "details": "'mode' must be \"raw\" or \"delta\" (with numeric 'coalesce_ms')"}))
+                    continue
 
                 # The downstream authorize hop must never crash the socket: a RAISE → authorization_call_failed
                 # frame + continue; a non-200 (errors carried, nothing authorized) → authorization_service_error
@@ -884,9 +1024,12 @@ async def run_multiplex(ws: WebSocket, authorizer: Authorizer, redis: RedisBus)
                     plat = item.get("platform"); nid = item.get("native_id")
                     user_id = item.get("user_id"); meeting_id = item.get("meeting_id")
                     if plat and nid and user_id and meeting_id:
-                        await subscribe_meeting(plat, nid, user_id, meeting_id)
+                        await subscribe_meeting(plat, nid, user_id, meeting_id, coalesce_ms)
                         subscribed.append({"platform": plat, "native_id": nid})
-                await ws.send_text(json.dumps({"type": "subscribed", "meetings": subscribed}))
+                ack: Dict[str, Any] = {"type": "subscribed", "meetings": subscribed}
+                if coalesce_ms is not None:
+                    ack.update(mode="delta", coalesce_ms=coalesce_ms)
+                await ws.send_text(json.dumps(ack))
 
             elif action == "unsubscribe":
                 meetings = msg.get("meetings", None)
@@ -929,9 +1072,17 @@ async def run_multiplex(ws: WebSocket, authorizer: Authorizer, redis: RedisBus)
     except WebSocketDisconnect:
         pass
     finally:
-        user_sub_task.cancel()  # Track G — tear down the user-scope fan-in on disconnect.
-        for task in sub_tasks.values():
-            task.cancel()
+        if user_sub_task is not None:
+            user_sub_task.cancel()  # Track G — tear down the user-scope fan-in on disconnect.
+        for tasks in sub_tasks.values():
+            for task in tasks:
+                task.cancel()
+        for coalescer in coalescers.values():
+            coalescer.cancel()
+        for extra in delta_sinks.values():
+            hub.detach(extra)
+        if sink is not None:
+            hub.detach(sink)  # drops this socket's channel refs; the last one out closes the pubsub
 
 
 # Backward-compatible private alias (kept so any existing internal reference still resolves; the
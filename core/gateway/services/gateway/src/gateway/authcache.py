@@ -0,0 +1,261 @@
+"""Bounded TTL cache of ``/internal/validate`` verdicts, with request coalescing and push invalidation.
+
+``AdminApiAuthorizer.resolve`` sits on the critical path of every proxied REST call and every ``/ws``
+connect + subscribe, so without a cache admin-api is a hot dependency of ALL traffic. ``VerdictCache``
+keeps the last verdict per key (an LRU of at most ``max_entries``):
+
+  * a VALID verdict (the user dict) for ``ttl_s`` (default 30s), never past the token's own
+    ``expires_at`` (carried on the verdict) — an expiring token is not served after it lapses;
+  * an INVALID verdict (``None``, admin-api answered 4xx) for ``negative_ttl_s`` (default 5s) — long
+    enough to blunt a bad-key flood, short enough that nothing sticks;
+  * NO verdict (``AuthUnavailable``) is never cached: the next call retries the hop (#495).
+
+Concurrent lookups of one key share ONE in-flight validate (coalescing).
+
+The TTL never widens a revocation window: admin-api publishes on ``auth:invalidate`` whenever a token
+is deleted or the user data the verdict carries changes (``admin_api/app/invalidation.py``); the
+listener evicts every cached key of that user. A validate that was in flight when an invalidation
+arrived answers its waiters but is not cached. The whole cache is flushed each time the listener
+(re)subscribes, since messages published while it was away are lost.
+
+Keys are held as sha256 digests — the same digest admin-api publishes, so raw tokens never ride
+redis. Hit/miss/coalesced/invalidation counters and the validate latency go to ``obs`` metrics.
+"""
+from __future__ import annotations
+
+import asyncio
+import hashlib
+import json
+import time
+from collections import OrderedDict
+from datetime import datetime, timezone
+from typing import Awaitable, Callable, Dict, Optional, Set
+
+from .obs import incr, log_event
+from .ratelimit import env_truthy
+
+AUTH_INVALIDATION_CHANNEL = "auth:invalidate"
+_RESUBSCRIBE_BACKOFF_S = (0.5, 1.0, 2.0, 5.0)
+
+
+def token_digest(api_key: str) -> str:
+    return hashlib.sha256(api_key.encode()).hexdigest()
+
+
+def _seconds_left(expires_at: object, now: float) -> float:
+    """Wall-clock seconds until an ISO-8601 ``expires_at`` (naive = UTC); ``inf`` when absent or
+    unparseable — the TTL alone then bounds the entry."""
+    if not isinstance(expires_at, str) or not expires_at:
+        return float("inf")
+    try:
+        at = datetime.fromisoformat(expires_at)
+    except ValueError:
+        return float("inf")
+    if at.tzinfo is None:
+        at = at.replace(tzinfo=timezone.utc)
+    return at.timestamp() - now
+
+
+class _Entry:
+    __slots__ = ("verdict", "expires", "user_id")
+
+    def __init__(self, verdict: Optional[dict], expires: float):
+        self.verdict = verdict
+        self.expires = expires
+        self.user_id = verdict.get("user_id") if verdict else None
+
+
+class _LeaderCancelled(Exception):
+    """Set on a shared load when its leading caller was cancelled: the waiters retry, they were not."""
+
+
+class VerdictCache:
+    def __init__(
+        self,
+        *,
+        max_entries: int = 10_000,
+        ttl_s: float = 30.0,
+        negative_ttl_s: float = 5.0,
+        clock: Optional[Callable[[], float]] = None,
+        wall_clock: Optional[Callable[[], float]] = None,
+    ):
+        if max_entries <= 0 or ttl_s <= 0 or negative_ttl_s < 0:
+            raise ValueError("max_entries and ttl_s must be > 0, negative_ttl_s >= 0")
+        self._max = max_entries
+        self._ttl = float(ttl_s)
+        self._neg_ttl = float(negative_ttl_s)
+        self._clock = clock or time.monotonic
+        self._wall = wall_clock or time.time  # only to read a verdict's expires_at
+        self._entries: "OrderedDict[str, _Entry]" = OrderedDict()
+        self._by_user: Dict[object, Set[str]] = {}
+        self._inflight: Dict[str, asyncio.Future] = {}
+        self._generation = 0
+        self._listener: Optional[asyncio.Task] = None
+        self._bus = None
+
+    # ---- lookups ----
+    async def get_or_load(self, api_key: str, load: Callable[[], Awaitable[Optional[dict]]]) -> Optional[dict]:
+        """The cached verdict for ``api_key``, else ONE ``load()`` shared by every concurrent caller.
+        ``load`` raising (``AuthUnavailable``) propagates to all of them and caches nothing. A leader
+        cancelled mid-load (its client went away) fails nobody else: the coalesced waiters retry,
+        and one of them leads a fresh ``load()``."""
+        self._ensure_listener()
+        digest = token_digest(api_key)
+        entry = self._entries.get(digest)
+        if entry is not None:
+            if entry.expires > self._clock():
+                self._entries.move_to_end(digest)
+                incr("auth_cache.hit")
+                return dict(entry.verdict) if entry.verdict else None
+            self._drop(digest)
+        pending = self._inflight.get(digest)
+        if pending is not None:
+            incr("auth_cache.coalesced")
+            try:
+                verdict = await asyncio.shield(pending)
+            except _LeaderCancelled:
+                return await self.get_or_load(api_key, load)
+            return dict(verdict) if verdict else None
+        incr("auth_cache.miss")
+        fut = asyncio.get_running_loop().create_future()
+        self._inflight[digest] = fut
+        generation = self._generation
+        try:
+            verdict = await load()
+        except asyncio.CancelledError:
+            if not fut.done():
+                fut.set_exception(_LeaderCancelled())
+                fut.exception()  # retrieved: a cancelled leader with no waiter is not "never retrieved"
+            raise
+        except Exception as e:
+            if not fut.done():
+                fut.set_exception(e)
+                fut.exception()  # retrieved: a failure with no coalesced waiter is not "never retrieved"
+            raise
+        else:
+            if not fut.done():
+                fut.set_result(verdict)
+            if generation == self._generation:
+                self._store(digest, verdict)
+            return dict(verdict) if verdict else None
+        finally:
+            self._inflight.pop(digest, None)
+
+    def _store(self, digest: str, verdict: Optional[dict]) -> None:
+        ttl = self._ttl if verdict else self._neg_ttl
+        if verdict:
+            ttl = min(ttl, _seconds_left(verdict.get("expires_at"), self._wall()))
+        if ttl <= 0:
+            return
+        self._drop(digest)
+        entry = self._entries[digest] = _Entry(verdict, self._clock() + ttl)
+        if entry.user_id is not None:
+            self._by_user.setdefault(entry.user_id, set()).add(digest)
+        while len(self._entries) > self._max:
+            oldest = next(iter(self._entries))
+            self._drop(oldest)
+            incr("auth_cache.evicted")
+
+    def _drop(self, digest: str) -> None:
+        entry = self._entries.pop(digest, None)
+        if entry is not None and entry.user_id is not None:
+            keys = self._by_user.get(entry.user_id)
+            if keys is not None:
+                keys.discard(digest)
+                if not keys:
+                    del self._by_user[entry.user_id]
+
+    # ---- invalidation ----
+    def invalidate_user(self, user_id) -> int:
+        self._generation += 1
+        # admin-api publishes the int id; tolerate either spelling of it
+        keys = set()
+        for uid in [u for u in self._by_user if str(u) == str(user_id)]:
+            keys |= self._by_user[uid]
+        for digest in keys:
+            self._drop(digest)
+        return len(keys)
+
+    def invalidate_token(self, digest: str) -> int:
+        self._generation += 1
+        present = digest in self._entries
+        self._drop(digest)
+        return int(present)
+
+    def clear(self) -> None:
+        self._generation += 1
+        self._entries.clear()
+        self._by_user.clear()
+
+    def apply_invalidation(self, raw) -> int:
+        """Apply one ``auth:invalidate`` message; returns the number of cached keys evicted."""
+        try:
+            msg = json.loads(raw) if isinstance(raw, (str, bytes)) else raw
+        except (TypeError, ValueError):
+            return 0
+        if not isinstance(msg, dict):
+            return 0
+        evicted = 0
+        if msg.get("token_sha256"):
+            evicted += self.invalidate_token(str(msg["token_sha256"]))
+        if msg.get("user_id") is not None:
+            evicted += self.invalidate_user(msg["user_id"])
+        incr("auth_cache.invalidations")
+        return evicted
+
+    # ---- the push listener ----
+    def listen_on(self, bus) -> None:
+        """Subscribe to ``auth:invalidate`` on ``bus`` (a ``ports.RedisBus``); started lazily on
+        the first lookup, inside the running loop."""
+        self._bus = bus
+
+    def _ensure_listener(self) -> None:
+        if self._bus is not None and (self._listener is None or self._listener.done()):
+            self._listener = asyncio.ensure_future(self._listen(self._bus))
+
+    async def _listen(self, bus) -> None:
+        attempt = 0
+        while True:
+            pubsub = bus.pubsub()
+            try:
+                await pubsub.subscribe(AUTH_INVALIDATION_CHANNEL)
+                self.clear()  # anything published while we were not listening is lost
+                async for message in pubsub.listen():
+                    if message.get("type") != "message":
+                        continue
+                    attempt = 0
+                    self.apply_invalidation(message.get("data"))
+            except asyncio.CancelledError:
+                raise
+            except Exception as e:  # noqa: BLE001 — keep listening across a redis blip
+                log_event("auth_cache_listener_error", audience="system", level="warning",
+                          span="auth", fields={"error": str(e)})
+            finally:
+                try:
+                    await pubsub.unsubscribe(AUTH_INVALIDATION_CHANNEL)
+                    await pubsub.close()
+                except Exception:
+                    pass
+            self.clear()
+            await asyncio.sleep(_RESUBSCRIBE_BACKOFF_S[min(attempt, len(_RESUBSCRIBE_BACKOFF_S) - 1)])
+            attempt += 1
+
+    def stats(self) -> dict:
+        return {"entries": len(self._entries), "users": len(self._by_user), "inflight": len(self._inflight)}
+
+
+def from_env(getenv: Callable[[str, str], str] = None) -> Optional[VerdictCache]:
+    """Build the production cache from env, or ``None`` (a validate per lookup, as before).
+
+    ``GATEWAY_AUTH_CACHE=1`` → on: ``GATEWAY_AUTH_CACHE_TTL_S`` (30), ``GATEWAY_AUTH_CACHE_NEGATIVE_TTL_S``
+    (5), ``GATEWAY_AUTH_CACHE_MAX`` (10000)."""
+    import os as _os
+
+    g = getenv or _os.getenv
+    if not env_truthy(g("GATEWAY_AUTH_CACHE", "")):
+        return None
+    return VerdictCache(
+        max_entries=int(g("GATEWAY_AUTH_CACHE_MAX", "10000")),
+        ttl_s=float(g("GATEWAY_AUTH_CACHE_TTL_S", "30")),
+        negative_ttl_s=float(g("GATEWAY_AUTH_CACHE_NEGATIVE_TTL_S", "5")),
+    )
@@ -0,0 +1,143 @@
+"""Delta delivery for ``/ws`` transcript frames — the opt-in ``mode:"delta"`` subscription.
+
+By default the multiplex forwards every raw ``tc:meeting:{id}:mutable`` payload verbatim, and the
+client re-sorts + re-dedups its whole segment list per frame (``transcript-rendering``'s
+``upsertSegments`` / ``deduplicateSegments``). A meeting subscribed with ``mode:"delta"`` instead
+gets its transcript payloads through a ``TranscriptCoalescer``: segments are collected per
+``segment_id`` for ``coalesce_ms`` (the latest version wins), and one ``transcript.delta`` frame
+carries every segment that CHANGED in the window — a segment whose content equals what this socket
+was last sent is not resent. Status / chat channels stay raw.
+
+Ordering is preserved: a payload the coalescer cannot key (a non-transcript frame, a segment
+without ``segment_id``) flushes the pending window first and is then forwarded raw.
+"""
+from __future__ import annotations
+
+import asyncio
+import json
+from collections import OrderedDict
+from datetime import datetime, timezone
+from typing import Awaitable, Callable, Optional
+
+DELIVERY_MODES = ("raw", "delta")
+DEFAULT_COALESCE_MS = 150
+MIN_COALESCE_MS = 50
+MAX_COALESCE_MS = 1000
+# Per-meeting memory of what the socket already holds (segment_id → fingerprint), LRU-bounded.
+_SENT_CAP = 4096
+# Stamped per ingest even when nothing changed — not part of a segment's identity for dedup
+# (the transcript.v1 ``trace`` gains fresh collector stamps on every republish).
+_VOLATILE = ("updated_at", "trace")
+
+
+def clamp_coalesce_ms(raw) -> Optional[int]:
+    """The client's ``coalesce_ms`` clamped to [50, 1000] (None → the default; junk → None)."""
+    if raw is None:
+        return DEFAULT_COALESCE_MS
+    if isinstance(raw, bool) or not isinstance(raw, (int, float)):
+        return None
+    return int(min(MAX_COALESCE_MS, max(MIN_COALESCE_MS, raw)))
+
+
+def _fingerprint(seg: dict) -> str:
+    return json.dumps({k: v for k, v in seg.items() if k not in _VOLATILE}, sort_keys=True, default=str)
+
+
+class TranscriptCoalescer:
+    """One delta-mode meeting on one socket. ``offer`` is the fan-in's forward (never blocks);
+    the window's single flush task sends the ``transcript.delta`` frame."""
+
+    def __init__(self, send: Callable[[str], Awaitable[None]], *, meeting: dict, window_ms: int):
+        self._send = send
+        self._meeting = meeting
+        self._window_s = window_ms / 1000.0
+        self._pending: "OrderedDict[str, dict]" = OrderedDict()
+        self._frames = 0
+        self._sent: "OrderedDict[str, str]" = OrderedDict()
+        self._timer: Optional[asyncio.Task] = None
+        self.frames_in = 0
+        self.frames_out = 0
+
+    async def offer(self, data) -> None:
+        self.frames_in += 1
+        segments = _keyed_segments(data)
+        if segments is None:
+            await self.flush()
+            await self._send(data)
+            self.frames_out += 1
+            return
+        for seg in segments:
+            self._pending[seg["segment_id"]] = seg
+            self._pending.move_to_end(seg["segment_id"])
+        self._frames += 1
+        if self._timer is None:
+            self._timer = asyncio.ensure_future(self._flush_later())
+
+    async def _flush_later(self) -> None:
+        await asyncio.sleep(self._window_s)
+        self._timer = None
+        await self.flush()
+
+    async def flush(self) -> None:
+        if self._timer is not None and self._timer is not asyncio.current_task():
+            self._timer.cancel()
+        self._timer = None
+        if not self._pending:
+            return
+        changed = []
+        for sid, seg in self._pending.items():
+            fp = _fingerprint(seg)
+            if self._sent.get(sid) == fp:
+                continue
+            self._sent[sid] = fp
+            self._sent.move_to_end(sid)
+            changed.append(seg)
+        while len(self._sent) > _SENT_CAP:
+            self._sent.popitem(last=False)
+        frames, self._frames = self._frames, 0
+        self._pending.clear()
+        if not changed:
+            return
+        await self._send(json.dumps({
+            "type": "transcript.delta",
+            "meeting": self._meeting,
+            "segments": changed,
+            "frames": frames,
+            "ts": datetime.now(timezone.utc).isoformat().replace("+00:00", "Z"),
+        }))
+        self.frames_out += 1
+
+    def cancel(self) -> None:
+        if self._timer is not None:
+            self._timer.cancel()
+            self._timer = None
+        self._pending.clear()
+
+
+def _keyed_segments(data) -> Optional[list]:
+    """The payload's segments, each carrying ``segment_id`` + ``completed`` (+ the bundle speaker),
+    or None when it is not a fully-keyed transcript payload (→ forwarded raw)."""
+    try:
+        msg = json.loads(data) if isinstance(data, (str, bytes)) else data
+    except (TypeError, ValueError):
+        return None
+    if not isinstance(msg, dict):
+        return None
+    kind = msg.get("type")
+    if kind == "transcription_segment":
+        seg = {k: v for k, v in msg.items() if k != "type"}
+        return [seg] if seg.get("segment_id") else None
+    if kind != "transcript":
+        return None
+    out = []
+    speaker = msg.get("speaker")
+    for bucket, completed in (("confirmed", True), ("pending", False)):
+        for raw in msg.get(bucket) or []:
+            if not isinstance(raw, dict) or not raw.get("segment_id"):
+                return None
+            seg = dict(raw)
+            seg.setdefault("completed", completed)
+            if speaker and not seg.get("speaker"):
+                seg["speaker"] = speaker
+            out.append(seg)
+    return out
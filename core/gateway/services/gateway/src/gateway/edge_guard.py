@@ -39,7 +39,7 @@ from typing import TYPE_CHECKING, Iterable, Optional
 
 from guard import SecurityConfig, SecurityMiddleware
 
-from .ratelimit import env_truthy
+from .ratelimit import GcraRateLimiter, env_truthy
 
 if TYPE_CHECKING:
     from fastapi import FastAPI, WebSocket
@@ -193,28 +193,32 @@ def apply_guard(app: FastAPI, config: SecurityConfig | None = None) -> None:
 # ``dispatch`` is bound to an HTTP ``Request`` and the internal ``SecurityCheckPipeline``
 # needs a full ``GuardRequest``). So this is a MINIMAL standalone limiter:
 #
-#   ponytail: standalone WS limiter — shares the vexa:guard: redis namespace (when
-#   Redis is on, the HTTP middleware persists there) but NOT SecurityMiddleware's
-#   in-process counters; the WS path keeps its OWN in-process buckets. Promote to
-#   fastapi-guard's native WS support if/when upstream adds a reusable IP-check.
+#   ponytail: standalone WS limiter — SecurityMiddleware's counters are not reusable, so
+#   the WS path keeps its own. With guard Redis on (``GUARD_ENABLE_REDIS``, the default)
+#   the per-IP rate limit is the cluster-wide ``GcraRateLimiter`` under the same
+#   ``vexa:guard:`` namespace (``…ws:<ip>``), so N gateway replicas enforce ONE budget per
+#   IP; without Redis it is an in-process sliding window. Bans stay per-replica. Promote
+#   to fastapi-guard's native WS support if/when upstream adds a reusable IP-check.
 
 _WS_GUARD: Optional["_WsGuard"] = None
 
 
 class _WsGuard:
-    """In-memory per-IP rate limiter + auto-ban for the ``/ws`` connect path.
+    """Per-IP rate limiter + auto-ban for the ``/ws`` connect path.
 
     Mirrors the HTTP layer's knobs (rate limit, auto-ban threshold/duration,
     blacklist, whitelist) from the SAME :class:`SecurityConfig` the HTTP middleware
-    uses, so one env surface governs both. In-process only — when Redis is enabled
-    the HTTP middleware shares state across processes via Redis; this WS guard does
-    not (the ceiling named above).
+    uses, so one env surface governs both. The rate step runs on ``limiter`` (the
+    shared GCRA: ``rate_limit`` burst, refilled at ``rate_limit / rate_limit_window``
+    per second) when given, else on in-process sliding windows; the ban ledger is
+    in-process either way (the ceiling named above).
     """
 
-    __slots__ = ("_config", "_rl", "_bans", "_ban_counts")
+    __slots__ = ("_config", "_limiter", "_rl", "_bans", "_ban_counts")
 
-    def __init__(self, config: SecurityConfig) -> None:
+    def __init__(self, config: SecurityConfig, limiter: Optional[GcraRateLimiter] = None) -> None:
         self._config = config
+        self._limiter = limiter
         # ip -> sliding-window timestamps (monotonic)
         self._rl: defaultdict[str, deque[float]] = defaultdict(deque)
         # ip -> unban monotonic time
@@ -222,7 +226,20 @@ class _WsGuard:
         # ip -> count of rate-limit violations (toward auto-ban)
         self._ban_counts: defaultdict[str, int] = defaultdict(int)
 
-    def check(self, client_ip: str) -> bool:
+    async def _over_limit(self, client_ip: str, now: float) -> bool:
+        cfg = self._config
+        if self._limiter is not None:
+            return not await self._limiter.allow(client_ip)
+        bucket = self._rl[client_ip]
+        cutoff = now - float(cfg.rate_limit_window)
+        while bucket and bucket[0] <= cutoff:
+            bucket.popleft()
+        if len(bucket) >= int(cfg.rate_limit):
+            return True
+        bucket.append(now)
+        return False
+
+    async def check(self, client_ip: str) -> bool:
         """Return True if the IP may connect, False if over-limit or banned."""
         now = time.monotonic()
         cfg = self._config
@@ -240,15 +257,9 @@ class _WsGuard:
                 return False
             del self._bans[client_ip]
 
-        # Per-IP sliding-window rate limit.
+        # Per-IP rate limit (shared GCRA, or the in-process sliding window).
         if cfg.enable_rate_limiting:
-            window = float(cfg.rate_limit_window)
-            limit = int(cfg.rate_limit)
-            bucket = self._rl[client_ip]
-            cutoff = now - window
-            while bucket and bucket[0] <= cutoff:
-                bucket.popleft()
-            if len(bucket) >= limit:
+            if await self._over_limit(client_ip, now):
                 # Over limit → count toward auto-ban; ban when the threshold is reached.
                 # Auto-ban only fires when IP banning is enabled (the config knob is
                 # otherwise ignored, which would let banning slip in via the back door).
@@ -261,31 +272,56 @@ class _WsGuard:
                         # first over-limit post-expiry immediately re-bans for a full duration.
                         self._bans[client_ip] = now + float(cfg.auto_ban_duration)
                         self._ban_counts[client_ip] = 0
-                        bucket.clear()
+                        self._rl.pop(client_ip, None)
                 return False
-            bucket.append(now)
         return True
 
 
-def reset_ws_guard(config: SecurityConfig | None = None) -> None:
-    """Rebuild the WS guard singleton (tests call this to isolate behavior)."""
+def _shared_ws_limiter(config: SecurityConfig) -> Optional[GcraRateLimiter]:
+    """The cluster-wide WS rate limiter when guard Redis is on (else None → in-process)."""
+    if not (config.enable_redis and config.enable_rate_limiting and config.redis_url):
+        return None
+    import redis.asyncio as aioredis
+
+    client = aioredis.from_url(
+        config.redis_url, encoding="utf-8", decode_responses=True,
+        socket_timeout=5, socket_connect_timeout=5, health_check_interval=30,
+    )
+    return GcraRateLimiter(
+        client,
+        capacity=int(config.rate_limit),
+        refill_per_sec=int(config.rate_limit) / float(config.rate_limit_window),
+        prefix=f"{config.redis_prefix}ws:",
+        metric="ws_guard",
+    )
+
+
+def _build_ws_guard(config: SecurityConfig) -> "_WsGuard":
+    return _WsGuard(config, _shared_ws_limiter(config))
+
+
+def reset_ws_guard(
+    config: SecurityConfig | None = None, limiter: Optional[GcraRateLimiter] = None
+) -> None:
+    """Rebuild the WS guard singleton (tests call this to isolate behavior; ``limiter``
+    injects a shared GCRA over a fake redis)."""
     global _WS_GUARD
-    _WS_GUARD = _WsGuard(config or build_guard_config())
+    _WS_GUARD = _WsGuard(config or build_guard_config(), limiter)
 
 
-def check_ws(client_ip: str) -> bool:
+async def check_ws(client_ip: str) -> bool:
     """Check whether ``client_ip`` may open a WS connection.
 
     The singleton is built from env on first call and reused across connects so
-    in-process counters persist. Tests force a fresh singleton via :func:`reset_ws_guard`.
+    its counters persist. Tests force a fresh singleton via :func:`reset_ws_guard`.
     """
     global _WS_GUARD
     if _WS_GUARD is None:
-        _WS_GUARD = _WsGuard(build_guard_config())
-    return _WS_GUARD.check(client_ip)
+        _WS_GUARD = _build_ws_guard(build_guard_config())
+    return await _WS_GUARD.check(client_ip)
 
 
-def ws_guard_check(ws: WebSocket) -> bool:
+async def ws_guard_check(ws: WebSocket) -> bool:
     """Resolve the client IP from ``ws`` (using the singleton's trusted-proxies/XFF config)
     and check it against the WS guard. Returns True if the connect may proceed.
 
@@ -295,9 +331,9 @@ def ws_guard_check(ws: WebSocket) -> bool:
     """
     global _WS_GUARD
     if _WS_GUARD is None:
-        _WS_GUARD = _WsGuard(build_guard_config())
+        _WS_GUARD = _build_ws_guard(build_guard_config())
     client_ip = resolve_ws_client_ip(ws, _WS_GUARD._config)
-    return _WS_GUARD.check(client_ip)
+    return await _WS_GUARD.check(client_ip)
 
 
 def resolve_ws_client_ip(ws: WebSocket, config: SecurityConfig) -> str:
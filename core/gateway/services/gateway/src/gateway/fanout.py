@@ -0,0 +1,240 @@
+"""Shared per-channel fan-out for the ``/ws`` multiplex — ONE redis subscription per channel per
+gateway process, however many local sockets watch it.
+
+Without the hub every subscription opens its own fan-in (``run_multiplex.fan_in``): 200 viewers of
+one all-hands meeting = 600 redis pub/sub subscriptions on one pod (``tc:…:mutable`` /
+``bm:…:status`` / ``va:…:chat`` each), and redis pushes every payload 200× over the wire. With
+the hub, the first local subscriber to a channel opens its single pubsub, the last one to leave
+closes it, and each payload is copied into every subscriber's bounded queue.
+
+Each socket owns ONE ``Sink``: a bounded FIFO of raw payloads drained to the socket by its own
+writer task, so a slow socket can never stall the redis reader or its neighbours. When a queue is
+full the sink applies the slow-consumer policy:
+
+  * ``resync`` (default) — close the socket with ``1013`` (try again later). The client reconnects,
+    re-subscribes and re-reads the REST snapshot; nothing is silently lost from a change-only stream.
+  * ``drop_oldest`` — discard the oldest queued payload and keep going (counted in ``dropped``).
+
+Frames are forwarded RAW and unchanged — the ``ws.v1`` frame contract is untouched; only the
+transport between redis and the socket is shared. Opt-in (``GATEWAY_WS_SHARED_FANOUT``, default
+false): ``None`` from ``from_env`` keeps the per-subscription fan-in, exactly as before.
+"""
+from __future__ import annotations
+
+import asyncio
+import time
+from collections import deque
+from typing import Awaitable, Callable, Dict, Iterable, Optional, Set
+
+from .obs import log_event, observe_transcript_upstream
+from .ports import RedisBus
+from .ratelimit import env_truthy
+
+SLOW_POLICIES = ("resync", "drop_oldest")
+# 1013 "Try Again Later" (RFC 6455 §7.4.1): a standard code, so no new ws.v1 vocabulary.
+RESYNC_CLOSE_CODE = 1013
+_RESUBSCRIBE_BACKOFF_S = (0.5, 1.0, 2.0, 5.0)
+
+
+class Sink:
+    """One socket's share of the hub: a bounded payload FIFO + the writer task that drains it."""
+
+    def __init__(
+        self,
+        hub: "FanoutHub",
+        send: Callable[[str], Awaitable[None]],
+        close: Optional[Callable[[int], Awaitable[None]]],
+    ):
+        self._hub = hub
+        self._send = send
+        self._close = close
+        self._queue: deque = deque()
+        self._ready = asyncio.Event()
+        self.channels: Set[str] = set()
+        self.dropped = 0
+        self.closed = False
+        self._writer = asyncio.create_task(self._drain())
+
+    def offer(self, data) -> None:
+        """Queue one payload (never blocks the redis reader). Full → the hub's slow policy."""
+        if self.closed:
+            return
+        if len(self._queue) >= self._hub.queue_size:
+            if self._hub.slow_policy == "drop_oldest":
+                self._queue.popleft()
+                self.dropped += 1
+                self._hub.dropped += 1
+            else:
+                self._hub.resyncs += 1
+                self._evict(RESYNC_CLOSE_CODE)
+                return
+        self._queue.append(data)
+        self._ready.set()
+
+    async def _drain(self) -> None:
+        try:
+            while not self.closed:
+                await self._ready.wait()
+                self._ready.clear()
+                while self._queue and not self.closed:
+                    await self._send(self._queue.popleft())
+                    self._hub.frames_out += 1
+        except asyncio.CancelledError:
+            raise
+        except Exception:  # noqa: BLE001 — the socket is gone; stop forwarding (the legacy fan_in `break`)
+            self.closed = True
+            self._hub.detach(self)
+
+    def _evict(self, code: int) -> None:
+        self.closed = True
+        self._queue.clear()
+        log_event("ws_fanout_resync", audience="system", level="warning", span="ws",
+                  fields={"channels": sorted(self.channels), "queue_size": self._hub.queue_size})
+        self._hub.detach(self)
+        if self._close is not None:
+            asyncio.ensure_future(self._close(code))
+
+    def cancel(self) -> None:
+        self.closed = True
+        self._writer.cancel()
+
+
+class _Channel:
+    __slots__ = ("sinks", "task")
+
+    def __init__(self) -> None:
+        self.sinks: Set[Sink] = set()
+        self.task: Optional[asyncio.Task] = None
+
+
+class FanoutHub:
+    """Process-wide redis → sockets fan-out. ``attach`` a socket, ``subscribe``/``unsubscribe`` its
+    channels, ``detach`` on disconnect. All methods are synchronous (single event loop): the
+    per-channel reader task is started/cancelled as the channel's local refcount crosses zero."""
+
+    def __init__(self, redis: RedisBus, *, queue_size: int = 256, slow_policy: str = "resync",
+                 trace_slow_ms: float = 5000.0):
+        if queue_size <= 0:
+            raise ValueError("queue_size must be > 0")
+        if slow_policy not in SLOW_POLICIES:
+            raise ValueError(f"slow_policy must be one of {SLOW_POLICIES}")
+        self._redis = redis
+        self.queue_size = queue_size
+        self.slow_policy = slow_policy
+        self.trace_slow_ms = float(trace_slow_ms)
+        self._channels: Dict[str, _Channel] = {}
+        self._sinks: Set[Sink] = set()
+        self.messages_in = 0
+        self.frames_out = 0
+        self.dropped = 0
+        self.resyncs = 0
+        self.redis_errors = 0
+
+    # ---- socket lifecycle ----
+    def attach(
+        self,
+        send: Callable[[str], Awaitable[None]],
+        close: Optional[Callable[[int], Awaitable[None]]] = None,
+    ) -> Sink:
+        sink = Sink(self, send, close)
+        self._sinks.add(sink)
+        return sink
+
+    def detach(self, sink: Sink) -> None:
+        self.unsubscribe(sink, list(sink.channels))
+        self._sinks.discard(sink)
+        sink.cancel()
+
+    # ---- channel refcounting ----
+    def subscribe(self, sink: Sink, channels: Iterable[str]) -> None:
+        if sink.closed:
+            return
+        for name in channels:
+            ch = self._channels.get(name)
+            if ch is None:
+                ch = self._channels[name] = _Channel()
+                ch.task = asyncio.create_task(self._pump(name, ch))
+            ch.sinks.add(sink)
+            sink.channels.add(name)
+
+    def unsubscribe(self, sink: Sink, channels: Iterable[str]) -> None:
+        for name in channels:
+            sink.channels.discard(name)
+            ch = self._channels.get(name)
+            if ch is None:
+                continue
+            ch.sinks.discard(sink)
+            if not ch.sinks:
+                del self._channels[name]
+                if ch.task is not None:
+                    ch.task.cancel()
+
+    async def _pump(self, name: str, ch: _Channel) -> None:
+        """The channel's ONE redis subscription. A redis fault is logged and re-subscribed with
+        backoff while local subscribers remain (the per-socket fan-in just died silently)."""
+        attempt = 0
+        while ch.sinks:
+            pubsub = self._redis.pubsub()
+            try:
+                await pubsub.subscribe(name)
+                async for message in pubsub.listen():
+                    if message.get("type") != "message":
+                        continue
+                    attempt = 0
+                    self.messages_in += 1
+                    data = message.get("data")
+                    try:  # upstream transcript hops: once per frame, not once per viewer
+                        observe_transcript_upstream(data, time.time() * 1000, self.trace_slow_ms)
+                    except Exception:  # noqa: BLE001 — observability never breaks the fan-out
+                        pass
+                    for sink in list(ch.sinks):
+                        sink.offer(data)
+                return
+            except asyncio.CancelledError:
+                raise
+            except Exception as e:  # noqa: BLE001 — keep the channel alive across a redis blip
+                self.redis_errors += 1
+                log_event("ws_fanout_redis_error", audience="system", level="warning", span="ws",
+                          fields={"channel": name, "error": str(e)})
+            finally:
+                try:
+                    await pubsub.unsubscribe(name)
+                    await pubsub.close()
+                except Exception:
+                    pass
+            await asyncio.sleep(_RESUBSCRIBE_BACKOFF_S[min(attempt, len(_RESUBSCRIBE_BACKOFF_S) - 1)])
+            attempt += 1
+
+    def stats(self) -> dict:
+        """Served on ``/health`` (``ws_fanout``) when the hub is on."""
+        return {
+            "sockets": len(self._sinks),
+            "redis_subscriptions": len(self._channels),
+            "channel_subscribers": sum(len(ch.sinks) for ch in self._channels.values()),
+            "queue_size": self.queue_size,
+            "slow_policy": self.slow_policy,
+            "queued": sum(len(s._queue) for s in self._sinks),
+            "messages_in": self.messages_in,
+            "frames_out": self.frames_out,
+            "dropped": self.dropped,
+            "resyncs": self.resyncs,
+            "redis_errors": self.redis_errors,
+        }
+
+
+def from_env(redis: RedisBus, getenv: Callable[[str, str], str] = None) -> Optional[FanoutHub]:
+    """Build the production hub from env, or ``None`` (per-subscription fan-in) when off.
+
+    ``GATEWAY_WS_SHARED_FANOUT=1`` → on, with a per-socket queue of ``GATEWAY_WS_QUEUE_SIZE``
+    (default 256) payloads and ``GATEWAY_WS_SLOW_POLICY`` (``resync`` | ``drop_oldest``)."""
+    import os as _os
+
+    g = getenv or _os.getenv
+    if not env_truthy(g("GATEWAY_WS_SHARED_FANOUT", "")):
+        return None
+    return FanoutHub(
+        redis,
+        queue_size=int(g("GATEWAY_WS_QUEUE_SIZE", "256")),
+        slow_policy=(g("GATEWAY_WS_SLOW_POLICY", "resync") or "resync").strip().lower(),
+        trace_slow_ms=float(g("TRANSCRIPT_TRACE_SLOW_MS", "5000") or "5000"),
+    )
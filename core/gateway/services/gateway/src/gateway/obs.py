@@ -11,7 +11,11 @@ It provides:
   * ``log_event(...)`` which emits ONE JSON line conforming to ``logevent.v1``,
   * ``TraceMiddleware`` — a FastAPI/Starlette middleware that reads/sets the ``X-Trace-Id``
     header: MINTS a trace_id at the edge when absent, binds it for the request, echoes it on
-    the response. Downstream hops forward the SAME id so every hop's logs share it.
+    the response. Downstream hops forward the SAME id so every hop's logs share it,
+  * ``incr`` / ``observe_ms`` / ``metrics_snapshot`` — process-wide counters + latency histograms
+    (the auth-verdict cache hit rate and validate latency), served on ``/health`` under ``metrics``,
+  * ``observe_transcript_upstream`` / ``observe_transcript_send`` — a transcript.v1 ``trace`` closed
+    into ``transcript.*`` histograms: upstream hops once per received frame, the socket hop per send.
 
 The core is a tiny factory keyed by service name (``make_log_event`` / ``make_trace_middleware``)
 so the in-process conformance chain can stand up a second emitter for the downstream hop
@@ -21,6 +25,7 @@ process, the contextvar propagation the real cross-process services get via ``X-
 from __future__ import annotations
 
 import contextvars
+import functools
 import json
 import sys
 import uuid
@@ -63,6 +68,47 @@ def set_user_id(user_id: Any) -> contextvars.Token:
     return _user_id.set(user_id)
 
 
+# ---- process-wide metrics (counters + cumulative latency histograms, ``le`` buckets in ms) ----
+LATENCY_BUCKETS_MS = (1, 2, 5, 10, 25, 50, 100, 250, 500, 1000, 2500)
+# Multi-second hops (the transcript.v1 trace stages, capture → /ws) outgrow the request buckets.
+LONG_LATENCY_BUCKETS_MS = (10, 25, 50, 100, 250, 500, 1000, 2500, 5000, 10000, 30000)
+_counters: dict[str, int] = {}
+_latency: dict[str, dict] = {}
+
+
+def incr(name: str, n: int = 1) -> None:
+    _counters[name] = _counters.get(name, 0) + n
+
+
+def observe_ms(name: str, ms: float, buckets: tuple = LATENCY_BUCKETS_MS) -> None:
+    """Record one latency sample. ``buckets`` fixes the histogram's bounds on its first sample."""
+    h = _latency.get(name)
+    if h is None:
+        h = _latency[name] = {"count": 0, "sum_ms": 0.0, "le": tuple(buckets), "buckets": [0] * len(buckets)}
+    h["count"] += 1
+    h["sum_ms"] += ms
+    for i, le in enumerate(h["le"]):
+        if ms <= le:
+            h["buckets"][i] += 1
+
+
+def metrics_snapshot() -> dict:
+    """``{"counters": {...}, "latency_ms": {name: {count, sum_ms, buckets}}}`` — empty until recorded."""
+    return {
+        "counters": dict(_counters),
+        "latency_ms": {
+            name: {"count": h["count"], "sum_ms": round(h["sum_ms"], 3),
+                   "buckets": {str(le): c for le, c in zip(h["le"], h["buckets"])}}
+            for name, h in _latency.items()
+        },
+    }
+
+
+def reset_metrics() -> None:
+    _counters.clear()
+    _latency.clear()
+
+
 def make_log_event(service: str) -> Callable[..., dict]:
     """Build a ``log_event`` bound to ``service`` (the ``logevent.v1`` ``service`` field)."""
 
@@ -145,3 +191,78 @@ def make_trace_middleware(log_event: Callable[..., dict]) -> type:
 SERVICE = "gateway"
 log_event = make_log_event(SERVICE)
 TraceMiddleware = make_trace_middleware(log_event)
+
+
+# ---- transcript.v1 ``Trace`` → ``transcript.*`` histograms ----
+# Hops, in order: (stage, from-stamp, to-stamp). ``stt_queue`` / ``stt_decode`` are durations the STT
+# service reported. Everything up to the gateway's receipt is observed ONCE per frame where the frame
+# enters the process (the hub's channel pump, or a socket's own fan-in without the hub); only the
+# last hop, ``mutable_to_ws``, is per socket.
+_TRACE_HOPS = (
+    ("capture_to_submit", "captured_ms", "submitted_ms"),
+    ("stt_round_trip", "submitted_ms", "transcribed_ms"),
+    ("result_to_publish", "transcribed_ms", "published_ms"),
+    ("stream", "published_ms", "ingested_ms"),
+    ("collector", "ingested_ms", "mutable_ms"),
+)
+
+
+def _traced(data) -> bool:
+    if isinstance(data, bytes):
+        return b'"trace"' in data
+    return isinstance(data, str) and '"trace"' in data
+
+
+@functools.lru_cache(maxsize=256)
+def _frame_traces(data) -> tuple:
+    """``(segment_id, trace)`` for every traced segment of a transcript frame (bundle or coalesced
+    delta). Cached on the payload: the hub hands every socket the same object, so a frame shown to
+    N viewers is parsed once."""
+    try:
+        msg = json.loads(data)
+    except (TypeError, ValueError):
+        return ()
+    if not isinstance(msg, dict):
+        return ()
+    if msg.get("type") == "transcript":
+        segments = [*(msg.get("confirmed") or []), *(msg.get("pending") or [])]
+    elif msg.get("type") == "transcript.delta":
+        segments = list(msg.get("segments") or [])
+    else:
+        return ()
+    return tuple((seg.get("segment_id"), seg["trace"]) for seg in segments
+                 if isinstance(seg, dict) and isinstance(seg.get("trace"), dict))
+
+
+def observe_transcript_upstream(data, received_ms: float, slow_ms: float) -> None:
+    """The upstream hops of every traced segment in a frame the gateway just received: one
+    ``transcript.<stage>`` histogram per hop, plus ``end_to_end`` (capture → gateway receipt); a
+    segment slower than ``slow_ms`` end to end also logs its stages. Call once per received frame.
+    Frames without a trace cost one substring test."""
+    if not _traced(data):
+        return
+    for segment_id, trace in _frame_traces(data):
+        stages = {}
+        for stage, a, b in _TRACE_HOPS:
+            if isinstance(trace.get(a), (int, float)) and isinstance(trace.get(b), (int, float)):
+                stages[stage] = max(0.0, trace[b] - trace[a])
+        for stage in ("stt_queue", "stt_decode"):
+            if isinstance(trace.get(f"{stage}_ms"), (int, float)):
+                stages[stage] = max(0.0, float(trace[f"{stage}_ms"]))
+        if isinstance(trace.get("captured_ms"), (int, float)):
+            stages["end_to_end"] = max(0.0, received_ms - trace["captured_ms"])
+        for stage, ms in stages.items():
+            observe_ms(f"transcript.{stage}", ms, buckets=LONG_LATENCY_BUCKETS_MS)
+        if stages.get("end_to_end", 0.0) > slow_ms:
+            log_event("transcript_latency_slow", audience="system", level="warning", span="ws",
+                      fields={"segment_id": segment_id, **{k: round(v, 1) for k, v in stages.items()}})
+
+
+def observe_transcript_send(data, sent_ms: float) -> None:
+    """The per-socket hop: ``mutable_to_ws`` for every traced segment of a frame just sent."""
+    if not _traced(data):
+        return
+    for _, trace in _frame_traces(data):
+        if isinstance(trace.get("mutable_ms"), (int, float)):
+            observe_ms("transcript.mutable_to_ws", max(0.0, sent_ms - trace["mutable_ms"]),
+                       buckets=LONG_LATENCY_BUCKETS_MS)
@@ -91,6 +91,11 @@ class StreamedResponse(Protocol):
 
     def aiter_bytes(self) -> AsyncIterator[bytes]: ...
 
+    def aiter_raw(self) -> AsyncIterator[bytes]:
+        """The body exactly as it came off the wire — no content-decoding, no re-chunking. The
+        recording media relay uses it, so the upstream's own framing headers stay true."""
+        ...
+
 
 @runtime_checkable
 class DownstreamClient(Protocol):
@@ -5,6 +5,15 @@ A valid API key could otherwise fire UNLIMITED REST requests; the only prior cap
 token bucket: ``capacity`` burst tokens, refilled at ``refill_per_sec``; one token per request, a 429
 when the bucket is empty. Pure + clock-injectable, so it unit-tests without real time.
 
+Two implementations of the same ``allow(key)`` shape:
+
+* ``PerUserRateLimiter`` — in-process buckets. Right for one replica (and the unit harnesses); with N
+  replicas behind a load balancer each holds its own bucket, so the effective limit is N× the setting.
+* ``GcraRateLimiter`` — cluster-wide GCRA (generic cell rate algorithm) on redis: one atomic script
+  call per request, ONE key per active user (its theoretical arrival time, expiring when the user
+  goes idle), so every replica enforces the one shared limit. Keys well under their limit are
+  pre-admitted locally (``local_slack``) and settled on their next script call. ``await allow(key)``.
+
 Wired at the single REST funnel (``app._forward``, keyed by the resolved ``user_id``) and constructed
 from env in ``adapters.build_production_app``. Injectable into ``create_app`` so tests drive a tight
 bucket; ``None`` (the default) disables it — existing harnesses that build ``create_app`` directly are
@@ -13,7 +22,10 @@ unaffected.
 from __future__ import annotations
 
 import time
-from typing import Callable, Dict, Optional
+from collections import OrderedDict
+from typing import Awaitable, Callable, Dict, Optional, Tuple
+
+from .obs import incr, log_event
 
 # The single source of truth for "truthy" env values (case-insensitive). Shared by
 # ``edge_guard._env_bool`` and ``app.py``'s ``GUARD_WS_ENABLED`` check so the three env-bool
@@ -61,12 +73,136 @@ class PerUserRateLimiter:
         return False
 
 
-def from_env(getenv: Callable[[str, str], str] = None) -> Optional["PerUserRateLimiter"]:
+# ── cluster-wide GCRA ────────────────────────────────────────────────────────
+# One key per active user holds its TAT (theoretical arrival time, µs since the epoch). A request of
+# `cost` advances the TAT by cost × interval; it is admitted iff the advanced TAT stays within
+# `tolerance` (capacity × interval) of now — exactly the token bucket above (capacity burst, refill at
+# 1/interval), but O(1) state per key that expires once the user has been idle long enough to be
+# back at full burst. `prepaid` settles requests a replica already admitted on its local fast path:
+# they are charged unconditionally, before `cost` is decided.
+#
+# KEYS[1]=the key  ARGV: now_us, interval_us, tolerance_us, cost, prepaid → {admitted 0|1, tat − now µs}
+_GCRA_LUA = """
+local now = tonumber(ARGV[1])
+local interval = tonumber(ARGV[2])
+local tat = tonumber(redis.call('GET', KEYS[1]) or ARGV[1])
+if tat < now then tat = now end
+tat = tat + tonumber(ARGV[5]) * interval
+local admitted = 0
+local nxt = tat + tonumber(ARGV[4]) * interval
+if nxt - now <= tonumber(ARGV[3]) then
+  tat = nxt
+  admitted = 1
+end
+if tat > now then
+  redis.call('SET', KEYS[1], string.format('%.0f', tat), 'PX', math.ceil((tat - now) / 1000))
+end
+return {admitted, math.floor(tat - now)}
+"""
+
+
+def gcra_step(tat_us: Optional[float], now_us: float, interval_us: float, tolerance_us: float,
+              cost: float, prepaid: float = 0.0) -> Tuple[bool, float]:
+    """The script's arithmetic in Python (the local fast path and the redis-down fallback run it):
+    returns ``(admitted, new_tat_us)``."""
+    tat = max(tat_us if tat_us is not None else now_us, now_us) + prepaid * interval_us
+    nxt = tat + cost * interval_us
+    if nxt - now_us <= tolerance_us:
+        return True, nxt
+    return False, tat
+
+
+class _LocalView:
+    """This replica's view of one key: the TAT last settled with redis plus local admissions since."""
+
+    __slots__ = ("tat", "pending", "synced")
+
+    def __init__(self, tat: float):
+        self.tat = tat
+        self.pending = 0.0
+        self.synced = float("-inf")   # never settled → no fast path until the first script call
+
+
+class GcraRateLimiter:
+    """Cluster-wide per-key limit over redis. ``await allow(key)`` → False when over the limit.
+
+    Same knobs as ``PerUserRateLimiter`` (``capacity`` burst, ``refill_per_sec`` sustained). The local
+    fast path admits without a round trip when this replica's view of the key — settled with redis
+    within ``sync_s`` — stays under HALF the burst even after the request, up to ``local_slack``
+    unsettled requests; the next script call charges them. The cluster can therefore over-admit a key
+    by at most ``replicas × local_slack`` over a ``sync_s`` window, and only for keys nowhere near
+    their limit; ``local_slack=0`` makes every request a script call. The view is an LRU bounded by
+    ``max_local_keys``. If redis errors, the replica falls back to enforcing the limit on its own view
+    (per-replica, as before) rather than failing open.
+    """
+
+    def __init__(self, redis, *, capacity: float, refill_per_sec: float, prefix: str = "ratelimit:",
+                 local_slack: int = 4, sync_s: float = 1.0, max_local_keys: int = 10_000,
+                 metric: str = "ratelimit", clock: Optional[Callable[[], float]] = None):
+        if capacity <= 0 or refill_per_sec <= 0:
+            raise ValueError("capacity must be > 0 and refill_per_sec > 0")
+        self._script: Callable[..., Awaitable] = redis.register_script(_GCRA_LUA)
+        self._prefix = prefix
+        self._interval = 1e6 / float(refill_per_sec)
+        self._tolerance = float(capacity) * self._interval
+        self._slack = max(0, int(local_slack))
+        self._sync_us = float(sync_s) * 1e6
+        self._max_keys = max(1, int(max_local_keys))
+        self._clock = clock or time.time
+        self._views: "OrderedDict[str, _LocalView]" = OrderedDict()
+        self._metric = metric
+        self._degraded = False
+
+    def _view(self, key: str, now: float) -> _LocalView:
+        v = self._views.get(key)
+        if v is None:
+            v = self._views[key] = _LocalView(now)
+            if len(self._views) > self._max_keys:
+                self._views.popitem(last=False)
+        else:
+            self._views.move_to_end(key)
+        return v
+
+    async def allow(self, key: str, cost: float = 1.0) -> bool:
+        now = self._clock() * 1e6
+        v = self._view(key, now)
+        if (self._slack and v.pending + cost <= self._slack and now - v.synced < self._sync_us
+                and max(v.tat, now) + cost * self._interval - now <= self._tolerance / 2):
+            v.tat = max(v.tat, now) + cost * self._interval
+            v.pending += cost
+            incr(f"{self._metric}.local_admit")
+            return True
+        try:
+            admitted, ahead = await self._script(
+                keys=[self._prefix + key],
+                args=[int(now), self._interval, self._tolerance, cost, v.pending],
+            )
+        except Exception as e:  # noqa: BLE001 — a redis blip degrades to per-replica limits, not open
+            incr(f"{self._metric}.redis_error")
+            if not self._degraded:
+                self._degraded = True
+                log_event("ratelimit_redis_unavailable", audience="system", level="warning",
+                          fields={"limiter": self._metric, "error": str(e)})
+            admitted, v.tat = gcra_step(v.tat, now, self._interval, self._tolerance, cost)
+            v.pending = 0.0
+        else:
+            self._degraded = False
+            v.tat, v.pending, v.synced = now + float(ahead), 0.0, now
+            admitted = bool(int(admitted))
+        if not admitted:
+            incr(f"{self._metric}.denied")
+        return admitted
+
+
+def from_env(getenv: Callable[[str, str], str] = None, redis=None):
     """Build the production limiter from env (generous per-user defaults), or ``None`` when disabled.
 
-    ``GATEWAY_RATE_LIMIT_DISABLED=1`` → off. Else a per-user bucket of ``GATEWAY_RATE_LIMIT_BURST``
-    (default 120) tokens refilled at ``GATEWAY_RATE_LIMIT_RPS`` (default 40)/s — high enough for normal
-    dashboards, low enough to stop a single key from hammering the control plane."""
+    ``GATEWAY_RATE_LIMIT_DISABLED=1`` → off. Else a per-user limit of ``GATEWAY_RATE_LIMIT_BURST``
+    (default 120) burst refilled at ``GATEWAY_RATE_LIMIT_RPS`` (default 40)/s — high enough for normal
+    dashboards, low enough to stop a single key from hammering the control plane. Given a ``redis``
+    client that limit is cluster-wide (``GcraRateLimiter``, pre-admitting up to
+    ``GATEWAY_RATE_LIMIT_LOCAL_SLACK`` (default 4) requests per clearly-idle key);
+    ``GATEWAY_RATE_LIMIT_BACKEND=local`` keeps the in-process buckets."""
     import os as _os
 
     g = getenv or _os.getenv
@@ -74,4 +210,7 @@ def from_env(getenv: Callable[[str, str], str] = None) -> Optional["PerUserRateL
         return None
     burst = float(g("GATEWAY_RATE_LIMIT_BURST", "120"))
     rps = float(g("GATEWAY_RATE_LIMIT_RPS", "40"))
+    if redis is not None and g("GATEWAY_RATE_LIMIT_BACKEND", "redis").strip().lower() != "local":
+        return GcraRateLimiter(redis, capacity=burst, refill_per_sec=rps,
+                               local_slack=int(g("GATEWAY_RATE_LIMIT_LOCAL_SLACK", "4")))
     return PerUserRateLimiter(capacity=burst, refill_per_sec=rps)
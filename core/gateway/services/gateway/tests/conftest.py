@@ -108,6 +108,10 @@ class FakeDownstream:
                 for chunk in chunks:
                     yield chunk
 
+            async def aiter_raw(_self):
+                for chunk in chunks:
+                    yield chunk
+
         yield _Streamed()
 
 
@@ -151,3 +155,26 @@ class FakeRedis:
     async def publish(self, channel: str, data: str) -> None:
         for q in list(self._subs.get(channel, [])):
             await q.put(data)
+
+
+class ScriptRedis:
+    """The redis side of ``ratelimit.GcraRateLimiter``: one shared key space whose script call
+    applies ``gcra_step`` (the Lua script's arithmetic). ``down`` makes every call raise."""
+
+    def __init__(self):
+        self.tat: dict = {}
+        self.calls = 0
+        self.down = False
+
+    def register_script(self, _source):
+        from gateway.ratelimit import gcra_step as _gcra_step
+
+        async def run(keys, args):
+            self.calls += 1
+            if self.down:
+                raise ConnectionError("redis unreachable")
+            now, interval, tolerance, cost, prepaid = (float(a) for a in args)
+            admitted, tat = _gcra_step(self.tat.get(keys[0]), now, interval, tolerance, cost, prepaid)
+            self.tat[keys[0]] = tat
+            return [int(admitted), int(tat - now)]
+        return run
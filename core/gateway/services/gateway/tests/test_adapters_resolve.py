@@ -149,3 +149,27 @@ async def test_auth_isolated_from_slow_downstream():
     release.set()
     await hang
     await forward_client.aclose()
+
+
+async def test_cached_resolve_validates_once_and_records_latency():
+    """The opt-in verdict cache sits in front of the validate hop: one POST for repeat lookups,
+    the hop's latency + call count land in the obs metrics."""
+    from gateway import obs
+    from gateway.authcache import VerdictCache
+
+    obs.reset_metrics()
+    posts = []
+
+    def handler(req):
+        posts.append(req)
+        return httpx.Response(200, json={"user_id": 7, "scopes": ["bot"]})
+
+    client = httpx.AsyncClient(transport=httpx.MockTransport(handler))
+    auth = AdminApiAuthorizer(client, ADMIN, "http://meeting-api:8080", cache=VerdictCache())
+    for _ in range(3):
+        assert (await auth.resolve("vxa_bot_ok"))["user_id"] == 7
+    assert len(posts) == 1
+    snap = obs.metrics_snapshot()
+    assert snap["counters"]["auth.validate_calls"] == 1 and snap["counters"]["auth_cache.hit"] == 2
+    assert snap["latency_ms"]["auth.validate"]["count"] == 1
+    obs.reset_metrics()
@@ -0,0 +1,180 @@
+"""The auth-verdict cache (``authcache.VerdictCache``) — TTL + LRU bounds, coalescing of concurrent
+lookups into ONE validate, AuthUnavailable never cached, and admin-api's ``auth:invalidate`` pushes
+evicting a user's keys (including a validate that raced the push). Clock-injected, no network."""
+from __future__ import annotations
+
+import asyncio
+import json
+from datetime import datetime, timezone
+
+from gateway import obs
+from gateway.authcache import AUTH_INVALIDATION_CHANNEL, VerdictCache, from_env, token_digest
+from gateway.ports import AuthUnavailable
+from conftest import FakeRedis
+
+
+class _Clock:
+    def __init__(self):
+        self.t = 1000.0
+
+    def __call__(self):
+        return self.t
+
+
+def _loader(verdicts: dict, calls: list, gate: asyncio.Event = None):
+    def make(key):
+        async def load():
+            calls.append(key)
+            if gate is not None:
+                await gate.wait()
+            v = verdicts[key]
+            if isinstance(v, Exception):
+                raise v
+            return v
+        return load
+    return make
+
+
+async def test_hit_within_ttl_then_revalidates_after():
+    obs.reset_metrics()
+    clock, calls = _Clock(), []
+    load = _loader({"k": {"user_id": 7, "scopes": ["bot"]}, "bad": None}, calls)
+    cache = VerdictCache(ttl_s=30, negative_ttl_s=5, clock=clock)
+    assert (await cache.get_or_load("k", load("k")))["user_id"] == 7
+    assert (await cache.get_or_load("k", load("k")))["user_id"] == 7
+    assert await cache.get_or_load("bad", load("bad")) is None
+    clock.t += 6   # negative verdict expired, positive still fresh
+    await cache.get_or_load("bad", load("bad"))
+    await cache.get_or_load("k", load("k"))
+    assert calls == ["k", "bad", "bad"]
+    clock.t += 30
+    await cache.get_or_load("k", load("k"))
+    assert calls == ["k", "bad", "bad", "k"]
+    counters = obs.metrics_snapshot()["counters"]
+    assert counters["auth_cache.hit"] == 2 and counters["auth_cache.miss"] == 4
+
+
+async def test_an_allow_is_never_served_past_the_tokens_expiry():
+    clock, calls = _Clock(), []
+    wall = 1_800_000_000.0
+    soon = datetime.fromtimestamp(wall + 10, timezone.utc).isoformat()
+    lapsed = datetime.fromtimestamp(wall - 1, timezone.utc).replace(tzinfo=None).isoformat() + "Z"
+    load = _loader({"soon": {"user_id": 7, "expires_at": soon}, "lapsed": {"user_id": 8, "expires_at": lapsed}}, calls)
+    cache = VerdictCache(ttl_s=30, clock=clock, wall_clock=lambda: wall)
+    await cache.get_or_load("soon", load("soon"))
+    clock.t += 9
+    await cache.get_or_load("soon", load("soon"))
+    assert calls == ["soon"]
+    clock.t += 2   # past expires_at, well inside ttl_s
+    await cache.get_or_load("soon", load("soon"))
+    assert calls == ["soon", "soon"]
+    await cache.get_or_load("lapsed", load("lapsed"))
+    await cache.get_or_load("lapsed", load("lapsed"))
+    assert calls == ["soon", "soon", "lapsed", "lapsed"]   # already lapsed → never cached
+
+
+async def test_concurrent_lookups_share_one_validate():
+    obs.reset_metrics()
+    gate, calls = asyncio.Event(), []
+    load = _loader({"k": {"user_id": 7}}, calls, gate)
+    cache = VerdictCache()
+    tasks = [asyncio.ensure_future(cache.get_or_load("k", load("k"))) for _ in range(20)]
+    await asyncio.sleep(0)
+    gate.set()
+    results = await asyncio.gather(*tasks)
+    assert calls == ["k"] and all(r == {"user_id": 7} for r in results)
+    assert obs.metrics_snapshot()["counters"]["auth_cache.coalesced"] == 19
+
+
+async def test_a_cancelled_leader_does_not_fail_the_coalesced_waiters():
+    gate, calls = asyncio.Event(), []
+    load = _loader({"k": {"user_id": 7}}, calls, gate)
+    cache = VerdictCache()
+    leader = asyncio.ensure_future(cache.get_or_load("k", load("k")))
+    await asyncio.sleep(0)
+    waiter = asyncio.ensure_future(cache.get_or_load("k", load("k")))
+    await asyncio.sleep(0)
+    leader.cancel()                          # the leader's client disconnected mid-validate
+    await asyncio.sleep(0)
+    gate.set()
+    assert await waiter == {"user_id": 7}    # the waiter retried its own load, not a CancelledError
+    assert leader.cancelled() and calls == ["k", "k"]
+    assert await cache.get_or_load("k", load("k")) == {"user_id": 7} and len(calls) == 2  # cached
+
+
+async def test_auth_unavailable_reaches_every_waiter_and_is_not_cached():
+    gate, calls = asyncio.Event(), []
+    verdicts = {"k": AuthUnavailable("admin-api down")}
+    load = _loader(verdicts, calls, gate)
+    cache = VerdictCache()
+    tasks = [asyncio.ensure_future(cache.get_or_load("k", load("k"))) for _ in range(3)]
+    await asyncio.sleep(0)
+    gate.set()
+    outcomes = await asyncio.gather(*tasks, return_exceptions=True)
+    assert all(isinstance(o, AuthUnavailable) for o in outcomes)
+    verdicts["k"] = {"user_id": 7}
+    assert await cache.get_or_load("k", load("k")) == {"user_id": 7}
+    assert len(calls) == 2
+
+
+async def test_lru_bound_evicts_the_least_recently_used():
+    calls = []
+    load = _loader({k: {"user_id": i} for i, k in enumerate("abc")}, calls)
+    cache = VerdictCache(max_entries=2)
+    for k in ("a", "b", "a", "c"):  # touching "a" makes "b" the LRU
+        await cache.get_or_load(k, load(k))
+    await cache.get_or_load("a", load("a"))
+    await cache.get_or_load("b", load("b"))
+    assert calls == ["a", "b", "c", "b"]
+
+
+async def test_push_invalidation_evicts_every_key_of_the_user():
+    calls = []
+    load = _loader({"k1": {"user_id": 7}, "k2": {"user_id": 7}, "other": {"user_id": 8}}, calls)
+    cache = VerdictCache()
+    for k in ("k1", "k2", "other"):
+        await cache.get_or_load(k, load(k))
+    assert cache.apply_invalidation(json.dumps({"type": "user_changed", "user_id": 7})) == 2
+    for k in ("k1", "k2", "other"):
+        await cache.get_or_load(k, load(k))
+    assert calls == ["k1", "k2", "other", "k1", "k2"]
+    # a revoked token is addressed by its digest (the raw secret never rides redis)
+    assert cache.apply_invalidation({"type": "token_revoked", "token_sha256": token_digest("other")}) == 1
+
+
+async def test_a_validate_racing_an_invalidation_is_not_cached():
+    gate, calls = asyncio.Event(), []
+    load = _loader({"k": {"user_id": 7}}, calls, gate)
+    cache = VerdictCache()
+    task = asyncio.ensure_future(cache.get_or_load("k", load("k")))
+    await asyncio.sleep(0)
+    cache.apply_invalidation({"type": "user_changed", "user_id": 7})
+    gate.set()
+    assert await task == {"user_id": 7}
+    await cache.get_or_load("k", load("k"))
+    assert calls == ["k", "k"]
+
+
+async def test_listener_applies_pushes_from_the_bus():
+    redis, calls = FakeRedis(), []
+    load = _loader({"k": {"user_id": 7}}, calls)
+    cache = VerdictCache()
+    cache.listen_on(redis)
+    await cache.get_or_load("k", load("k"))
+    for _ in range(5):
+        await asyncio.sleep(0)
+    await cache.get_or_load("k", load("k"))   # cached (the listener's subscribe-time flush is behind us)
+    calls_before = len(calls)
+    await redis.publish(AUTH_INVALIDATION_CHANNEL, json.dumps({"type": "user_changed", "user_id": 7}))
+    for _ in range(5):
+        await asyncio.sleep(0)
+    await cache.get_or_load("k", load("k"))
+    assert len(calls) == calls_before + 1
+    cache._listener.cancel()
+
+
+def test_cache_is_opt_in_from_env():
+    assert from_env(lambda k, d="": {}.get(k, d)) is None
+    env = {"GATEWAY_AUTH_CACHE": "1", "GATEWAY_AUTH_CACHE_TTL_S": "10", "GATEWAY_AUTH_CACHE_MAX": "50"}
+    cache = from_env(lambda k, d="": env.get(k, d))
+    assert cache._ttl == 10.0 and cache._max == 50 and cache._neg_ttl == 5.0
@@ -0,0 +1,71 @@
+"""``mode:"delta"`` transcript coalescing (``coalesce.TranscriptCoalescer``) — per-segment latest
+version per window, unchanged segments not resent, unkeyable payloads flushed-then-raw, and the
+``coalesce_ms`` clamp. Pure asyncio; the window is driven with ``flush()`` or a tiny sleep."""
+from __future__ import annotations
+
+import asyncio
+import json
+
+from gateway.coalesce import TranscriptCoalescer, clamp_coalesce_ms
+
+
+def _bundle(*segs, pending=()):
+    return json.dumps({"type": "transcript", "speaker": "Alice", "meeting": {"id": 42},
+                       "confirmed": list(segs), "pending": list(pending), "ts": "t"})
+
+
+def _seg(sid, text, **kw):
+    return {"segment_id": sid, "text": text, "start": 0.0, "end": 1.0, "updated_at": kw.pop("at", "t0"), **kw}
+
+
+def _coalescer(window_ms=50):
+    sent = []
+
+    async def send(data):
+        sent.append(json.loads(data))
+
+    return sent, TranscriptCoalescer(send, meeting={"id": 42, "platform": "google_meet", "native_id": "r"},
+                                     window_ms=window_ms)
+
+
+async def test_window_collapses_each_segment_to_its_latest_version():
+    sent, c = _coalescer()
+    await c.offer(_bundle(pending=[_seg("a", "hel")]))
+    await c.offer(_bundle(pending=[_seg("a", "hello")]))
+    await c.offer(_bundle(_seg("a", "hello world"), pending=[_seg("b", "and")]))
+    assert sent == []  # nothing leaves before the window closes
+    await asyncio.sleep(0.08)
+    assert len(sent) == 1
+    frame = sent[0]
+    assert frame["type"] == "transcript.delta" and frame["frames"] == 3
+    assert frame["meeting"] == {"id": 42, "platform": "google_meet", "native_id": "r"}
+    assert [(s["segment_id"], s["text"], s["completed"], s["speaker"]) for s in frame["segments"]] == [
+        ("a", "hello world", True, "Alice"), ("b", "and", False, "Alice")]
+
+
+async def test_unchanged_segments_are_not_resent():
+    sent, c = _coalescer()
+    await c.offer(_bundle(_seg("a", "done")))
+    await c.flush()
+    # the collector re-publishes the same confirmed segment with a fresh updated_at — no new frame
+    await c.offer(_bundle(_seg("a", "done", at="t1")))
+    await c.flush()
+    await c.offer(_bundle(_seg("a", "done"), _seg("b", "new")))
+    await c.flush()
+    assert [[s["segment_id"] for s in f["segments"]] for f in sent] == [["a"], ["b"]]
+
+
+async def test_unkeyable_payload_flushes_the_window_then_goes_raw():
+    sent, c = _coalescer(window_ms=1000)
+    await c.offer(_bundle(_seg("a", "first")))
+    raw = json.dumps({"type": "transcription_segment", "text": "no id"})
+    await c.offer(raw)
+    assert [f["type"] for f in sent] == ["transcript.delta", "transcription_segment"]
+    assert c.frames_in == 2 and c.frames_out == 2
+    c.cancel()
+
+
+def test_coalesce_ms_is_clamped():
+    assert clamp_coalesce_ms(None) == 150
+    assert clamp_coalesce_ms(5) == 50 and clamp_coalesce_ms(10_000) == 1000 and clamp_coalesce_ms(220.7) == 220
+    assert clamp_coalesce_ms("fast") is None and clamp_coalesce_ms(True) is None
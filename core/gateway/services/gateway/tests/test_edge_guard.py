@@ -25,7 +25,7 @@ from guard import SecurityConfig
 from httpx import ASGITransport
 from starlette.websockets import WebSocketDisconnect
 
-from conftest import FakeAuthorizer, FakeDownstream, FakeRedis, VALID_KEY
+from conftest import FakeAuthorizer, FakeDownstream, FakeRedis, ScriptRedis, VALID_KEY
 from gateway import edge_guard as _edge_guard
 from gateway.app import run_multiplex
 from gateway.edge_guard import (
@@ -34,7 +34,7 @@ from gateway.edge_guard import (
     build_guard_config,
     reset_ws_guard,
 )
-from gateway.ratelimit import PerUserRateLimiter
+from gateway.ratelimit import GcraRateLimiter, PerUserRateLimiter
 
 
 def _guard_middleware(app: FastAPI) -> Any:
@@ -501,6 +501,26 @@ class TestWsGuard:
             assert ws.accepted is True
             assert ws.sent and ws.sent[0].get("error") == "missing_api_key"
 
+    @pytest.mark.asyncio
+    async def test_ws_budget_is_shared_across_replicas(self) -> None:
+        """With guard Redis on, the per-IP WS budget is the cluster-wide GCRA: two gateway
+        replicas (two guards, one redis) admit ``rate_limit`` connects from an IP BETWEEN
+        them, and an exhausted IP is denied on the replica it never touched."""
+        cfg = _enforcing_config(rate_limit=2, rate_limit_window=60)
+        redis = ScriptRedis()
+        a, b = (
+            _edge_guard._WsGuard(
+                cfg,
+                GcraRateLimiter(redis, capacity=2, refill_per_sec=2 / 60, local_slack=0),
+            )
+            for _ in range(2)
+        )
+        assert await a.check("10.0.0.8") is True
+        assert await b.check("10.0.0.8") is True
+        assert await a.check("10.0.0.8") is False
+        assert await b.check("10.0.0.8") is False
+        assert await b.check("10.0.0.9") is True  # another IP has its own budget
+
 
 # ── A5: both layers in one app ─────────────────────────────────────────────────
 
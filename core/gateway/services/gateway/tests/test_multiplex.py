@@ -5,7 +5,12 @@ proving the carve of ``main.websocket_multiplex``:
   * missing api-key → missing_api_key error + close 4401,
   * subscribe → subscribed ack; a redis payload on a subscribed channel is forwarded RAW,
   * unsubscribe → unsubscribed ack AND the fan-in STOPS (later payloads are not forwarded),
-  * ping → pong; invalid_json / unknown_action error frames.
+  * ping → pong; invalid_json / unknown_action error frames;
+  * with the shared ``FanoutHub``: one redis subscription per channel across sockets, the same
+    raw frames, per-socket unsubscribe, and the resync / drop_oldest slow-consumer policies;
+  * a transcript.v1 ``trace`` is closed into per-hop ``transcript.*`` histograms, and a
+    ``transcript_latency_slow`` line past ``TRANSCRIPT_TRACE_SLOW_MS``: the upstream hops once per
+    received frame, however many sockets watch it, and ``mutable_to_ws`` once per socket.
 """
 from __future__ import annotations
 
@@ -200,3 +205,235 @@ async def test_connect_auto_subscribes_user_channel_and_forwards():
 
     ws.disconnect()
     await task
+
+
+# ── shared fan-out hub (fanout.FanoutHub, GATEWAY_WS_SHARED_FANOUT) ──────────────────────────────
+
+from gateway.fanout import RESYNC_CLOSE_CODE, FanoutHub, from_env as fanout_from_env
+
+
+class _CountingRedis(FakeRedis):
+    """FakeRedis that counts pubsub() opens — one per live redis subscription."""
+
+    def __init__(self):
+        super().__init__()
+        self.opened = 0
+
+    def pubsub(self):
+        self.opened += 1
+        return super().pubsub()
+
+
+async def _spin(n: int = 10):
+    for _ in range(n):
+        await asyncio.sleep(0)
+
+
+async def test_hub_shares_one_redis_subscription_per_channel_across_sockets():
+    redis, auth = _CountingRedis(), FakeAuthorizer(valid_key=API_KEY, auth_map=AUTH_MAP)
+    hub = FanoutHub(redis)
+    sockets = [_WS(inbound=[SUBSCRIBE], api_key=API_KEY, close_when_drained=False) for _ in range(5)]
+    tasks = [asyncio.ensure_future(_run_multiplex(ws, auth, redis, hub=hub)) for ws in sockets]
+    await _spin()
+    # 3 meeting channels + the shared u:7:meetings — NOT 5 × 4
+    assert redis.opened == 4 and hub.stats()["redis_subscriptions"] == 4
+    assert hub.stats()["sockets"] == 5 and hub.stats()["channel_subscribers"] == 20
+
+    await redis.publish("tc:meeting:42:mutable", json.dumps({"type": "transcription_segment", "text": "hi"}))
+    await _spin()
+    for ws in sockets:  # the ws.v1 frame arrives RAW and unchanged on every socket
+        assert [f for f in ws.sent if f.get("type") == "transcription_segment"] == [
+            {"type": "transcription_segment", "text": "hi"}]
+    assert hub.stats()["messages_in"] == 1 and hub.stats()["frames_out"] == 5
+
+    for ws in sockets:
+        ws.disconnect()
+    await asyncio.gather(*tasks)
+    await _spin()
+    assert hub.stats()["redis_subscriptions"] == 0 and hub.stats()["sockets"] == 0
+    assert redis._subs.get("tc:meeting:42:mutable") == [], "the last socket out closes the pubsub"
+
+
+async def test_hub_unsubscribe_stops_forwarding_for_that_socket_only():
+    redis, auth = FakeRedis(), FakeAuthorizer(valid_key=API_KEY, auth_map=AUTH_MAP)
+    hub = FanoutHub(redis)
+    a = _WS(inbound=[SUBSCRIBE], api_key=API_KEY, close_when_drained=False)
+    b = _WS(inbound=[SUBSCRIBE], api_key=API_KEY, close_when_drained=False)
+    tasks = [asyncio.ensure_future(_run_multiplex(ws, auth, redis, hub=hub)) for ws in (a, b)]
+    await _spin()
+    a._inbound.put_nowait(json.dumps({
+        "action": "unsubscribe", "meetings": [{"platform": "google_meet", "native_id": "room-1"}]}))
+    await _spin()
+    assert any(f.get("type") == "unsubscribed" for f in a.sent)
+
+    await redis.publish("tc:meeting:42:mutable", json.dumps({"type": "transcription_segment", "text": "after"}))
+    await _spin()
+    assert not any(f.get("text") == "after" for f in a.sent)
+    assert any(f.get("text") == "after" for f in b.sent)
+    for ws in (a, b):
+        ws.disconnect()
+    await asyncio.gather(*tasks)
+
+
+async def test_hub_slow_consumer_policies():
+    stalled = asyncio.Event()
+
+    async def never_sends(data):
+        await stalled.wait()
+
+    # resync: the full queue closes the socket 1013 and drops its channel refs
+    closed = []
+
+    async def record_close(code):
+        closed.append(code)
+
+    hub = FanoutHub(FakeRedis(), queue_size=2, slow_policy="resync")
+    sink = hub.attach(never_sends, record_close)
+    hub.subscribe(sink, ["tc:meeting:1:mutable"])
+    for i in range(4):
+        sink.offer(str(i))
+    await _spin()
+    assert closed == [RESYNC_CLOSE_CODE] and hub.stats()["resyncs"] == 1
+    assert hub.stats()["redis_subscriptions"] == 0 and hub.stats()["sockets"] == 0
+
+    # drop_oldest: the socket stays, the oldest payloads go
+    hub = FanoutHub(FakeRedis(), queue_size=2, slow_policy="drop_oldest")
+    sent = []
+
+    async def slow(data):
+        sent.append(data)
+        await stalled.wait()
+
+    sink = hub.attach(slow)
+    await _spin()
+    for i in range(5):
+        sink.offer(str(i))
+    assert hub.stats()["dropped"] == 3 and list(sink._queue) == ["3", "4"]
+    hub.detach(sink)
+
+
+def test_hub_is_opt_in_from_env():
+    env = {"GATEWAY_WS_QUEUE_SIZE": "8", "GATEWAY_WS_SLOW_POLICY": "drop_oldest"}
+    assert fanout_from_env(FakeRedis(), lambda k, d="": env.get(k, d)) is None
+    env["GATEWAY_WS_SHARED_FANOUT"] = "true"
+    hub = fanout_from_env(FakeRedis(), lambda k, d="": env.get(k, d))
+    assert hub.queue_size == 8 and hub.slow_policy == "drop_oldest"
+
+
+# ── mode:"delta" subscriptions (coalesce.py) ─────────────────────────────────────────────────────
+
+async def _delta_round_trip(hub):
+    redis, auth = FakeRedis(), FakeAuthorizer(valid_key=API_KEY, auth_map=AUTH_MAP)
+    ws = _WS(inbound=[{**SUBSCRIBE, "mode": "delta", "coalesce_ms": 50}], api_key=API_KEY, close_when_drained=False)
+    task = asyncio.ensure_future(_run_multiplex(ws, auth, redis, hub=hub(redis) if hub else None))
+    await _spin()
+    assert {"type": "subscribed", "meetings": [{"platform": "google_meet", "native_id": "room-1"}],
+            "mode": "delta", "coalesce_ms": 50} in ws.sent
+    for text in ("he", "hello"):
+        await redis.publish("tc:meeting:42:mutable", json.dumps({
+            "type": "transcript", "speaker": "Alice",
+            "pending": [{"segment_id": "s1", "text": text}], "confirmed": []}))
+    await redis.publish("bm:meeting:42:status", json.dumps({"type": "meeting.status", "payload": {"status": "active"}}))
+    await _spin()
+    assert any(f.get("type") == "meeting.status" for f in ws.sent), "status stays raw"
+    assert not any(f.get("type") in ("transcript", "transcript.delta") for f in ws.sent)
+    await asyncio.sleep(0.08)
+    deltas = [f for f in ws.sent if f.get("type") == "transcript.delta"]
+    assert len(deltas) == 1 and deltas[0]["segments"] == [
+        {"segment_id": "s1", "text": "hello", "completed": False, "speaker": "Alice"}]
+    ws.disconnect()
+    await task
+
+
+async def test_delta_mode_coalesces_the_transcript_channel_only():
+    await _delta_round_trip(None)
+
+
+async def test_delta_mode_under_the_shared_hub():
+    await _delta_round_trip(FanoutHub)
+
+
+async def test_unknown_mode_is_an_invalid_subscribe_payload():
+    ws = _WS(inbound=[{**SUBSCRIBE, "mode": "firehose"}], api_key=API_KEY)
+    redis, auth = _redis_and_auth()
+    await _run_multiplex(ws, auth, redis)
+    assert [f["error"] for f in ws.sent if f.get("type") == "error"] == ["invalid_subscribe_payload"]
+
+
+# ── transcript.v1 trace: closed at the /ws send ──────────────────────────────────────────────────
+
+async def test_traced_transcript_is_closed_into_stage_histograms(monkeypatch):
+    import time
+
+    from gateway import obs
+
+    obs.reset_metrics()
+    lines: list = []
+    obs.capture(lines)
+    monkeypatch.setenv("TRANSCRIPT_TRACE_SLOW_MS", "5000")
+    now = time.time() * 1000
+    trace = {"captured_ms": now - 9000, "submitted_ms": now - 8800, "stt_queue_ms": 30, "stt_decode_ms": 400,
+             "transcribed_ms": now - 8300, "published_ms": now - 8290, "ingested_ms": now - 8280,
+             "mutable_ms": now - 8270}
+    ws = _WS(inbound=[SUBSCRIBE], api_key=API_KEY, close_when_drained=False)
+    redis, auth = _redis_and_auth()
+    task = asyncio.ensure_future(_run_multiplex(ws, auth, redis))
+    try:
+        await _spin()
+        await redis.publish("tc:meeting:42:mutable", json.dumps({
+            "type": "transcript", "speaker": "Alice", "pending": [],
+            "confirmed": [{"segment_id": "s1", "text": "hi", "completed": True, "trace": trace},
+                          {"segment_id": "s2", "text": "untraced", "completed": True}]}))
+        await _spin()
+        frame = next(f for f in ws.sent if f.get("type") == "transcript")
+        assert frame["confirmed"][0]["trace"] == trace, "the frame itself is forwarded verbatim"
+        latency = obs.metrics_snapshot()["latency_ms"]
+        for stage in ("capture_to_submit", "stt_round_trip", "stt_queue", "stt_decode", "result_to_publish",
+                      "stream", "collector", "mutable_to_ws", "end_to_end"):
+            assert latency[f"transcript.{stage}"]["count"] == 1, stage
+        assert latency["transcript.capture_to_submit"]["sum_ms"] == 200
+        assert "30000" in latency["transcript.end_to_end"]["buckets"], "long hops use the long buckets"
+        assert "2500" in latency["transcript.end_to_end"]["buckets"] and latency["transcript.end_to_end"]["buckets"]["5000"] == 0
+        slow = [e for e in lines if e["event"] == "transcript_latency_slow"]
+        assert len(slow) == 1 and slow[0]["fields"]["segment_id"] == "s1" and slow[0]["fields"]["end_to_end"] >= 9000
+    finally:
+        obs.capture(None)
+        obs.reset_metrics()
+        ws.disconnect()
+        await task
+
+
+async def test_upstream_hops_are_observed_once_per_frame_not_once_per_viewer():
+    import time
+
+    from gateway import obs
+
+    obs.reset_metrics()
+    lines: list = []
+    obs.capture(lines)
+    now = time.time() * 1000
+    trace = {"captured_ms": now - 9000, "submitted_ms": now - 8800, "transcribed_ms": now - 8300,
+             "published_ms": now - 8290, "ingested_ms": now - 8280, "mutable_ms": now - 8270}
+    redis, auth = _redis_and_auth()
+    hub = FanoutHub(redis, trace_slow_ms=5000)
+    sockets = [_WS(inbound=[SUBSCRIBE], api_key=API_KEY, close_when_drained=False) for _ in range(3)]
+    tasks = [asyncio.ensure_future(_run_multiplex(ws, auth, redis, hub=hub)) for ws in sockets]
+    try:
+        await _spin()
+        await redis.publish("tc:meeting:42:mutable", json.dumps({
+            "type": "transcript", "pending": [],
+            "confirmed": [{"segment_id": "s1", "text": "hi", "completed": True, "trace": trace}]}))
+        await _spin()
+        assert all(any(f.get("type") == "transcript" for f in ws.sent) for ws in sockets)
+        latency = obs.metrics_snapshot()["latency_ms"]
+        for stage in ("capture_to_submit", "stt_round_trip", "result_to_publish", "stream", "collector",
+                      "end_to_end"):
+            assert latency[f"transcript.{stage}"]["count"] == 1, stage
+        assert latency["transcript.mutable_to_ws"]["count"] == 3      # the one per-socket hop
+        assert len([e for e in lines if e["event"] == "transcript_latency_slow"]) == 1
+    finally:
+        obs.capture(None)
+        obs.reset_metrics()
+        for ws in sockets:
+            ws.disconnect()
+        await asyncio.gather(*tasks)
@@ -113,6 +113,19 @@ def test_range_response_preserves_content_range_headers():
     assert r.headers["content-type"].startswith("audio/webm")
 
 
+def test_conditional_transcript_get_round_trips_etag_and_304():
+    """The transcript read's conditional GET survives the proxy: If-None-Match and ?since= go
+    down, the 304 and its ETag come back (the buffered proxy otherwise drops end-to-end headers)."""
+    downstream = FakeDownstream(status_code=304, body=None, extra_headers={"etag": '"abc"', "cache-control": "private, no-cache"})
+    client, _ = _client(downstream=downstream)
+    r = client.get("/transcripts/google_meet/abc-defg-hij?since=1760000000.5",
+                   headers={**AUTH, "if-none-match": '"abc"'})
+    assert r.status_code == 304
+    assert r.headers["etag"] == '"abc"'
+    assert downstream.last["headers"]["if-none-match"] == '"abc"'
+    assert downstream.last["params"] == {"since": "1760000000.5"}
+
+
 def test_rate_limit_returns_429_past_the_per_user_cap():
     """WS-6: with a per-user limiter injected, requests up to the bucket pass (verbatim), the next is
     throttled with 429 + Retry-After — closing the unlimited-requests-on-a-valid-key DoS gap."""
@@ -248,6 +261,41 @@ def test_native_chat_read_forwards_to_meeting_api():
     assert downstream.last["url"].endswith("/bots/google_meet/abc-defg-hij/chat")
 
 
+def test_presigned_recording_redirect_is_relayed_after_auth():
+    """RECORDING_MEDIA_DELIVERY=presign: meeting-api answers a 307 to the object store; the gateway
+    authorizes, then hands the redirect back (the bytes never cross it)."""
+    url = "https://objects.test/recordings/7/100/master.webm?X-Amz-Expires=300"
+    downstream = FakeDownstream(status_code=307, stream_chunks=[],
+                                extra_headers={"location": url, "cache-control": "private, no-store"})
+    client, _ = _client(downstream=downstream)
+    r = client.get("/recordings/5/media/9/raw?type=audio", headers={**AUTH, "range": "bytes=0-"},
+                   follow_redirects=False)
+    assert r.status_code == 307
+    assert r.headers["location"] == url
+    assert r.headers["cache-control"] == "private, no-store"
+    assert downstream.last["headers"]["x-user-id"] == "7"      # ownership is resolved downstream
+    assert downstream.last["headers"]["range"] == "bytes=0-"
+
+    downstream.last = None
+    assert client.get("/recordings/5/media/9/raw", follow_redirects=False).status_code == 401
+    assert downstream.last is None                             # no key → no redirect is ever minted
+
+
+def test_proxied_recording_bytes_stream_with_upstream_framing():
+    """The proxied path relays the upstream's raw reads with its own Content-Length/Content-Range."""
+    chunks = [b"a" * 65536, b"b" * 34464]
+    downstream = FakeDownstream(status_code=206, content_type="video/webm", stream_chunks=chunks,
+                                extra_headers={"content-range": "bytes 0-99999/722448",
+                                               "content-length": "100000", "accept-ranges": "bytes"})
+    client, _ = _client(downstream=downstream)
+    r = client.get("/recordings/5/media/9/download", headers={**AUTH, "range": "bytes=0-99999"})
+    assert r.status_code == 206
+    assert r.content == b"".join(chunks)
+    assert r.headers["content-length"] == "100000"
+    assert r.headers["content-range"] == "bytes 0-99999/722448"
+    assert downstream.last["url"].endswith("/recordings/5/media/9/raw")
+
+
 def test_recording_download_alias_forwards_to_raw():
     """#579 C3: GET /recordings/{id}/media/{mid}/download aliases to the .../raw byte route."""
     client, downstream = _client()
@@ -1,5 +1,12 @@
-"""WS-6 — per-user token-bucket rate limiter (the gateway DoS guard), pure-logic module tests."""
-from gateway.ratelimit import PerUserRateLimiter, from_env
+"""WS-6 — per-user token-bucket rate limiter (the gateway DoS guard), pure-logic module tests.
+
+The cluster-wide ``GcraRateLimiter`` runs over conftest's ``ScriptRedis``, so two limiters over one
+behave like two gateway replicas over one redis. ``ScriptRedis`` applies ``gcra_step``; the parity
+test runs the shipped ``_GCRA_LUA`` itself (under lupa) and holds the two to the same answers."""
+import pytest
+
+from conftest import ScriptRedis
+from gateway.ratelimit import _GCRA_LUA, GcraRateLimiter, PerUserRateLimiter, from_env, gcra_step
 
 
 def test_token_bucket_allows_burst_then_blocks():
@@ -66,3 +73,127 @@ def test_stress_many_users_isolated_under_load():
     for u in range(500):
         allowed = sum(1 for _ in range(10) if rl.allow(f"u{u}"))
         assert allowed == 5, f"user u{u} got {allowed} (expected 5)"
+
+
+@pytest.mark.asyncio
+async def test_gcra_replicas_share_one_limit():
+    """Two replicas over one redis admit the configured burst ONCE between them — the in-process
+    buckets would admit it once per replica."""
+    now = {"t": 1000.0}
+    redis = ScriptRedis()
+    replicas = [GcraRateLimiter(redis, capacity=10, refill_per_sec=1, local_slack=0, clock=lambda: now["t"])
+                for _ in range(2)]
+    verdicts = [await replicas[i % 2].allow("u") for i in range(40)]
+    assert verdicts.count(True) == 10
+
+    local = [PerUserRateLimiter(capacity=10, refill_per_sec=1, clock=lambda: now["t"]) for _ in range(2)]
+    assert [local[i % 2].allow("u") for i in range(40)].count(True) == 20   # the N× leak this fixes
+
+
+@pytest.mark.asyncio
+async def test_gcra_refills_like_the_token_bucket():
+    now = {"t": 0.0}
+    rl = GcraRateLimiter(ScriptRedis(), capacity=2, refill_per_sec=1.0, local_slack=0, clock=lambda: now["t"])
+    assert await rl.allow("u") and await rl.allow("u")
+    assert await rl.allow("u") is False
+    now["t"] = 1.0
+    assert await rl.allow("u") is True
+    assert await rl.allow("u") is False
+    now["t"] = 10.0                          # a long gap refills only up to capacity
+    assert await rl.allow("u") and await rl.allow("u")
+    assert await rl.allow("u") is False
+    assert await rl.allow("v") is True       # keys are independent
+
+
+@pytest.mark.asyncio
+async def test_gcra_local_fast_path_settles_on_the_next_script_call():
+    """A key far under its limit is pre-admitted locally up to local_slack, and the next script
+    call charges those admissions to the shared TAT — nothing is lost, only deferred."""
+    now = {"t": 0.0}
+    redis = ScriptRedis()
+    rl = GcraRateLimiter(redis, capacity=100, refill_per_sec=10, local_slack=4, clock=lambda: now["t"])
+    assert all([await rl.allow("u") for _ in range(6)])
+    assert redis.calls == 2                  # 1st (unsettled key) + 6th (slack spent); 2nd–5th local
+    assert redis.tat["ratelimit:u"] == pytest.approx(6 * 100_000)   # all six charged: 6 × 0.1s, in µs
+
+    # A view older than sync_s never fast-paths: the next request goes to redis.
+    now["t"] = 2.0
+    await rl.allow("u")
+    assert redis.calls == 3
+
+
+@pytest.mark.asyncio
+async def test_gcra_fast_path_overshoot_is_bounded():
+    """Three replicas with local_slack=4 hammering one key: the cluster admits the burst plus at most
+    replicas × slack, never the 3× of per-replica buckets."""
+    now = {"t": 0.0}
+    redis = ScriptRedis()
+    replicas = [GcraRateLimiter(redis, capacity=20, refill_per_sec=0.01, local_slack=4, clock=lambda: now["t"])
+                for _ in range(3)]
+    admitted = sum([await replicas[i % 3].allow("flooder") for i in range(300)])
+    assert 20 <= admitted <= 20 + 3 * 4
+
+
+@pytest.mark.asyncio
+async def test_gcra_redis_outage_enforces_per_replica_not_open():
+    now = {"t": 0.0}
+    redis = ScriptRedis()
+    redis.down = True
+    rl = GcraRateLimiter(redis, capacity=3, refill_per_sec=0.01, local_slack=0, clock=lambda: now["t"])
+    assert [await rl.allow("u") for _ in range(5)] == [True, True, True, False, False]
+
+
+@pytest.mark.asyncio
+async def test_gcra_local_view_is_bounded():
+    redis = ScriptRedis()
+    rl = GcraRateLimiter(redis, capacity=5, refill_per_sec=1, max_local_keys=100, clock=lambda: 0.0)
+    for u in range(1000):
+        await rl.allow(f"u{u}")
+    assert len(rl._views) == 100
+    assert len(redis.tat) == 1000            # the shared state is one key per user (expiring in redis)
+
+
+def test_from_env_with_redis_builds_the_cluster_limiter():
+    assert isinstance(from_env(lambda k, d="": d, redis=ScriptRedis()), GcraRateLimiter)
+    env = {"GATEWAY_RATE_LIMIT_BACKEND": "local"}
+    assert isinstance(from_env(lambda k, d="": env.get(k, d), redis=ScriptRedis()), PerUserRateLimiter)
+
+
+def _lua_gcra():
+    """``_GCRA_LUA`` under lupa with a dict-backed ``redis.call`` (GET / SET … PX) — the script as
+    redis runs it, string ARGV and all. Returns ``(run(key, args) -> [admitted, ahead], store)``."""
+    lupa = pytest.importorskip("lupa")
+    lua, store = lupa.LuaRuntime(), {}
+
+    def call(cmd, key, *rest):
+        if cmd == "GET":
+            return store.get(key)
+        assert cmd == "SET" and rest[1] == "PX" and rest[2] >= 1
+        store[key] = rest[0]
+        return "OK"
+
+    script = lua.eval("function(call) redis = {call = call} return function(KEYS, ARGV) "
+                      + _GCRA_LUA + " end end")(call)
+
+    def run(key, args):
+        out = script(lua.table_from([key]), lua.table_from([str(a) for a in args]))
+        return [int(out[1]), int(out[2])]
+    return run, store
+
+
+def test_the_lua_script_and_gcra_step_agree():
+    """Every step of a refill-and-burst sequence: the script's verdict, its ``ahead`` and the TAT it
+    stores match ``gcra_step`` fed the same stored TAT — so the fast path, the redis-down fallback
+    and ``ScriptRedis`` all decide what the real script decides."""
+    run, store = _lua_gcra()
+    interval, tolerance = 1e6 / 3, 5 * (1e6 / 3)          # 3/s, burst 5: fractional µs on purpose
+    steps = [(0, 1, 0)] * 7 + [(400_000, 1, 0), (400_001, 2, 0), (2_000_000, 1, 3), (2_000_000, 1, 0),
+                               (9_000_000, 0.5, 0), (9_000_000, 4, 1), (60_000_000, 1, 0)]
+    for now, cost, prepaid in steps:
+        before = store.get("k")
+        admitted, tat = gcra_step(None if before is None else float(before), now, interval, tolerance,
+                                  cost, prepaid)
+        got = run("k", [now, interval, tolerance, cost, prepaid])
+        assert got == [int(admitted), int(tat - now)], (now, cost, prepaid)
+        if tat > now:
+            assert float(store["k"]) == round(tat)
@@ -0,0 +1,61 @@
+"""Push invalidation of the gateway's cached ``/internal/validate`` verdicts.
+
+The gateway may cache a key's verdict for a short TTL (``gateway/authcache.py``). So the TTL never
+widens a revocation window, every write that changes what ``/internal/validate`` would answer
+publishes one message on the ``auth:invalidate`` redis channel:
+
+  * ``{"type": "token_revoked", "user_id", "token_sha256"}`` — a token was deleted;
+  * ``{"type": "user_changed", "user_id"}`` — user data the verdict carries changed (webhook
+    config, workspace memberships, the admin role).
+
+Opt-in: ``AUTH_INVALIDATION_REDIS_URL`` unset → a no-op, and the gateway cache stays bounded by
+its own TTL. Best-effort by design: the DB commit has already happened, so a redis fault is logged
+and never fails the write (the gateway also flushes its whole cache whenever it re-subscribes).
+"""
+from __future__ import annotations
+
+import hashlib
+import json
+import logging
+import os
+from typing import Optional
+
+logger = logging.getLogger("admin_api.invalidation")
+
+AUTH_INVALIDATION_CHANNEL = "auth:invalidate"
+
+_client = None
+
+
+def token_sha256(token: str) -> str:
+    """The token's digest — the gateway keys its cache by this, so the raw secret never rides redis."""
+    return hashlib.sha256(token.encode()).hexdigest()
+
+
+def _redis():
+    global _client
+    url = os.getenv("AUTH_INVALIDATION_REDIS_URL", "")
+    if not url:
+        return None
+    if _client is None:
+        import redis.asyncio as aioredis
+
+        _client = aioredis.from_url(url, socket_timeout=2, socket_connect_timeout=2)
+    return _client
+
+
+async def publish_auth_invalidation(*, user_id: int, token: Optional[str] = None) -> bool:
+    """Publish one invalidation; True when it reached redis."""
+    client = _redis()
+    if client is None:
+        return False
+    if token is not None:
+        message = {"type": "token_revoked", "user_id": user_id, "token_sha256": token_sha256(token)}
+    else:
+        message = {"type": "user_changed", "user_id": user_id}
+    try:
+        await client.publish(AUTH_INVALIDATION_CHANNEL, json.dumps(message))
+        return True
+    except Exception as e:  # noqa: BLE001 — the write is committed; the gateway TTL still bounds it
+        logger.warning("auth invalidation publish failed (%s): %s", message["type"], e)
+        return False
@@ -31,6 +31,7 @@ from sqlalchemy.ext.asyncio import AsyncSession
 from ..schema.models import APIToken, PlatformSetting, User
 from ..token_scope import VALID_SCOPES, generate_prefixed_token
 from .db import get_db
+from .invalidation import publish_auth_invalidation
 
 ADMIN_KEY_HEADER = APIKeyHeader(name="X-Admin-API-Key", auto_error=False)
 USER_KEY_HEADER = APIKeyHeader(name="X-API-Key", auto_error=False)
@@ -327,8 +328,10 @@ def create_app() -> FastAPI:
         tok = await db.get(APIToken, token_id)
         if not tok:
             raise HTTPException(status.HTTP_404_NOT_FOUND, detail="Token not found")
+        user_id, token_value = tok.user_id, tok.token
         await db.delete(tok)
         await db.commit()
+        await publish_auth_invalidation(user_id=user_id, token=token_value)
         return Response(status_code=status.HTTP_204_NO_CONTENT)
 
     # --- user tier: webhook self-serve (writes to user.data JSONB) ---
@@ -348,6 +351,7 @@ def create_app() -> FastAPI:
         db.add(user)
         await db.commit()
         await db.refresh(user)
+        await publish_auth_invalidation(user_id=user.id)  # the webhook config rides /internal/validate
         return UserResponse.model_validate(user)
 
     @app.get("/user/webhook")
@@ -523,6 +527,9 @@ def create_app() -> FastAPI:
             # admin gate reads THIS, with its VEXA_ADMIN_EMAILS allowlist kept as an override.
             "is_admin": (user.data or {}).get("is_admin") is True if isinstance(user.data, dict) else False,
         }
+        # The gateway caches this verdict; a token's expiry bounds how long a cached allow may live.
+        if api_token.expires_at is not None:
+            resp["expires_at"] = api_token.expires_at.isoformat() + "Z"  # stored naive UTC
         data_blob = user.data if isinstance(user.data, dict) else {}
         if data_blob.get("webhook_url"):
             resp["webhook_url"] = data_blob["webhook_url"]
@@ -601,6 +608,7 @@ def create_app() -> FastAPI:
         attributes.flag_modified(user, "data")
         db.add(user)
         await db.commit()
+        await publish_auth_invalidation(user_id=user.id)  # is_admin rides /internal/validate
         return {"claimed": True, "admin_exists": True}
 
     @app.get("/internal/users/{user_id}/memberships", include_in_schema=False)
@@ -630,6 +638,7 @@ def create_app() -> FastAPI:
         attributes.flag_modified(user, "data")
         db.add(user)
         await db.commit()
+        await publish_auth_invalidation(user_id=user.id)  # workspaces ride /internal/validate
         return {"memberships": memberships}
 
     @app.delete("/internal/users/{user_id}/memberships/{workspace_id}", include_in_schema=False)
@@ -645,6 +654,7 @@ def create_app() -> FastAPI:
         attributes.flag_modified(user, "data")
         db.add(user)
         await db.commit()
+        await publish_auth_invalidation(user_id=user.id)  # workspaces ride /internal/validate
         return {"memberships": memberships}
 
     # --- internal tier: calendar-sync configs — meeting-api's ICS poller discovers every user
@@ -0,0 +1,48 @@
+"""admin-api → gateway push invalidation (``app/invalidation.py``).
+
+Offline: the redis client is swapped for a recorder, so no broker is needed.
+  * AUTH_INVALIDATION_REDIS_URL unset → a no-op (pre-change behavior, nothing published).
+  * a revoked token is published by its sha256 digest — the raw secret never rides redis.
+  * a publish fault is swallowed (the DB write already committed).
+"""
+from __future__ import annotations
+
+import asyncio
+import hashlib
+import json
+
+from admin_api.app import invalidation
+
+
+class _Recorder:
+    def __init__(self, fail: bool = False):
+        self.published = []
+        self.fail = fail
+
+    async def publish(self, channel, data):
+        if self.fail:
+            raise ConnectionError("redis down")
+        self.published.append((channel, json.loads(data)))
+
+
+def test_unset_url_is_a_noop(monkeypatch):
+    monkeypatch.delenv("AUTH_INVALIDATION_REDIS_URL", raising=False)
+    assert asyncio.run(invalidation.publish_auth_invalidation(user_id=7)) is False
+
+
+def test_revoked_token_is_published_by_digest(monkeypatch):
+    rec = _Recorder()
+    monkeypatch.setattr(invalidation, "_redis", lambda: rec)
+    assert asyncio.run(invalidation.publish_auth_invalidation(user_id=7, token="vxa_user_secret")) is True
+    assert asyncio.run(invalidation.publish_auth_invalidation(user_id=7)) is True
+    (ch1, revoked), (ch2, changed) = rec.published
+    assert ch1 == ch2 == invalidation.AUTH_INVALIDATION_CHANNEL == "auth:invalidate"
+    assert revoked == {"type": "token_revoked", "user_id": 7,
+                       "token_sha256": hashlib.sha256(b"vxa_user_secret").hexdigest()}
+    assert "vxa_user_secret" not in json.dumps(revoked)
+    assert changed == {"type": "user_changed", "user_id": 7}
+
+
+def test_publish_fault_never_fails_the_write(monkeypatch):
+    monkeypatch.setattr(invalidation, "_redis", lambda: _Recorder(fail=True))
+    assert asyncio.run(invalidation.publish_auth_invalidation(user_id=7, token="t")) is False
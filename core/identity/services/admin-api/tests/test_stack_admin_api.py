@@ -104,6 +104,7 @@ def test_golden_identity_flow(client):
     assert v["webhook_url"] == "https://example.com/hook"
     assert v["webhook_secret"] == "shh"
     assert v["webhook_events"] == {"meeting.completed": True}
+    assert "expires_at" not in v                                 # minted without expires_in
 
     # 4. revoke → the same token no longer validates
     r = client.delete(f"/admin/tokens/{token_id}", headers=_admin())
@@ -252,6 +253,10 @@ def test_list_user_tokens_scoped_and_secret_free(client):
     assert tokens[0]["expires_at"] is not None
     assert "token" not in tokens[0]                              # secret never listed
 
+    # The validate verdict carries the expiry too — the gateway's verdict cache is bounded by it.
+    v = client.post("/internal/validate", headers=_internal(), json={"token": minted["token"]}).json()
+    assert v["expires_at"].endswith("Z")
+
     assert client.get("/admin/users/999999/tokens", headers=_admin()).status_code == 404
     assert client.get(f"/admin/users/{alice['id']}/tokens").status_code == 403  # admin tier required
 
@@ -12,6 +12,8 @@
 #   ./bin/eval.sh replay-test   # O-TEL-2 DETERMINISTIC replay gate (offline, no server) — the gate:replay target
 #   ./bin/eval.sh flag-test     # O-TEL-3 flag→store→surface→replay-routing eval (offline, no meeting)
 #   ./bin/eval.sh benchmark <tape> [p] [native] # LOSS oracle: re-transcribe full tape audio offline, diff vs live (needs STT env)
+#   ./bin/eval.sh load          # SCALE probe: N concurrent synthetic bots (MODE=segments|ingest|stt) → load-report.v1, gated
+#   ./bin/eval.sh load-test     # the load harness's offline test (fake redis + /health, no stack)
 # All knobs are env (see README / src/drive.mjs). e.g. GAP_MEAN=-0.5 ./bin/eval.sh drive
 set -euo pipefail
 HERE="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
@@ -29,6 +31,9 @@ HERE="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
 [ "${1:-}" = "capture" ] && exec node "$HERE/src/capture.mjs" "${@:2}"
 # 'benchmark' re-transcribes a tape's full audio offline (needs STT env, NOT the bot secrets).
 [ "${1:-}" = "benchmark" ] && exec node "$HERE/src/benchmark.mjs" "${@:2}"
+# 'load' drives the LOCAL stack with synthetic bots from the cached clip pools (stack env, NOT the bot secrets).
+[ "${1:-}" = "load" ] && exec node "$HERE/src/load.mjs" "${@:2}"
+[ "${1:-}" = "load-test" ] && exec node "$HERE/load.test.mjs" "${@:2}"
 SECRETS="${SECRETS:-$HERE/secrets.env}"
 [ -f "$SECRETS" ] && { set -a; . "$SECRETS"; set +a; } || { echo "no secrets.env ($SECRETS) — cp secrets.env.example secrets.env"; exit 1; }
 case "${1:-}" in
@@ -37,5 +42,5 @@ case "${1:-}" in
   noise)  exec node "$HERE/src/noise.mjs" ;;
   corpus) exec node "$HERE/src/corpus.mjs" ;;
   judge)  exec python3 "$HERE/src/judge.py" ;;
-  *) echo "usage: eval.sh {launch|drive|noise|analyze|capture|benchmark|judge|corpus|observe|replay|replay-test|flag-test}"; exit 2 ;;
+  *) echo "usage: eval.sh {launch|drive|noise|analyze|capture|benchmark|load|load-test|judge|corpus|observe|replay|replay-test|flag-test}"; exit 2 ;;
 esac
@@ -0,0 +1,166 @@
+#!/usr/bin/env node
+/**
+ * load — the scale-probe harness, OFFLINE. No stack: a node:net server speaks just enough RESP to
+ * take XADDs, and a node:http server plays meeting-api + gateway /health. Asserts:
+ *   • the RESP codec round-trips and reassembles replies split at ANY byte;
+ *   • histogram deltas / quantiles over the services' cumulative `le` shape;
+ *   • the gate — ceilings, baseline regressions past tolerance AND noise floor, unknown rules;
+ *   • an end-to-end MODE=segments run (3 bots, tiny synthetic clip pool) publishes drafts → finals
+ *     carrying trace.published_ms + session_end, and writes a load-report.v1 whose db_writer /
+ *     ingest sections are the run's DELTA of the scraped histograms.
+ *
+ * Run: node eval/load.test.mjs   (from meetings/) — zero-npm-dep.
+ */
+import { mkdtempSync, writeFileSync, readFileSync, rmSync } from 'node:fs';
+import { createServer as createHttp } from 'node:http';
+import { createServer as createNet } from 'node:net';
+import { execFile } from 'node:child_process';
+import { tmpdir } from 'node:os';
+import { dirname, join } from 'node:path';
+import { fileURLToPath } from 'node:url';
+import { encodeCommand, parseReply, respReader, connectRedis, RespError, histDelta, histQuantile, summarize, gate, metrics } from './src/load.mjs';
+
+const HERE = dirname(fileURLToPath(import.meta.url));
+
+let failed = 0;
+const check = (name, cond, detail = '') => {
+  console.log(`  ${cond ? '✅' : '❌'} ${name}${cond ? '' : '  — ' + detail}`);
+  if (!cond) failed++;
+};
+
+/** A RESP server that records commands: XADD → a fresh id, PING → PONG, anything else → -ERR. */
+function fakeRedis() {
+  const commands = [];
+  let seq = 0;
+  const server = createNet((sock) => {
+    sock.on('data', respReader((cmd) => {
+      commands.push(cmd);
+      const verb = String(cmd[0]).toUpperCase();
+      if (verb === 'PING') sock.write('+PONG\r\n');
+      else if (verb === 'XADD') { const id = `${Date.now()}-${seq++}`; sock.write(`$${id.length}\r\n${id}\r\n`); }
+      else sock.write(`-ERR unknown command '${cmd[0]}'\r\n`);
+    }));
+  });
+  return new Promise((resolve) => server.listen(0, '127.0.0.1', () => resolve({ server, commands, port: server.address().port })));
+}
+
+async function main() {
+  // ── RESP ─────────────────────────────────────────────────────────────────
+  {
+    const wire = encodeCommand(['XADD', 'transcription_segments', '*', 'payload', '{"t":"é"}']);
+    check('a command encodes as an array of byte-length bulk strings',
+      wire.toString() === '*5\r\n$4\r\nXADD\r\n$22\r\ntranscription_segments\r\n$1\r\n*\r\n$7\r\npayload\r\n$10\r\n{"t":"é"}\r\n', JSON.stringify(wire.toString()));
+    check('…and parses back to the same argv', JSON.stringify(parseReply(wire).value) === JSON.stringify(['XADD', 'transcription_segments', '*', 'payload', '{"t":"é"}']));
+    const replies = Buffer.from('+OK\r\n:42\r\n$-1\r\n*2\r\n$3\r\nabc\r\n*1\r\n:7\r\n-ERR boom\r\n');
+    const got = [];
+    const feed = respReader((v) => got.push(v));
+    for (let i = 0; i < replies.length; i++) feed(replies.subarray(i, i + 1));   // one byte at a time
+    check('replies split at every byte reassemble in order',
+      got.length === 5 && got[0] === 'OK' && got[1] === 42 && got[2] === null && JSON.stringify(got[3]) === '["abc",[7]]' && got[4] instanceof RespError && got[4].message === 'ERR boom',
+      JSON.stringify(got));
+
+    const { server, commands, port } = await fakeRedis();
+    const r = connectRedis(`redis://127.0.0.1:${port}/0`);
+    await r.ready;
+    const ids = await Promise.all([r.call('PING'), r.call('XADD', 's', '*', 'k', 'v'), r.call('XADD', 's', '*', 'k', 'w')]);
+    let err = null;
+    await r.call('NOPE').catch((e) => { err = e; });
+    check('pipelined calls resolve in order; an error reply rejects only its own call',
+      ids[0] === 'PONG' && /^\d+-0$/.test(ids[1]) && /^\d+-1$/.test(ids[2]) && err instanceof RespError && commands.length === 4, JSON.stringify({ ids, err: String(err) }));
+    await r.close();
+    server.close();
+  }
+
+  // ── histograms ───────────────────────────────────────────────────────────
+  {
+    const before = { count: 10, buckets: { '10': 8, '100': 10, '1000': 10 } };
+    const after = { count: 30, buckets: { '10': 10, '100': 20, '1000': 29 } };
+    const d = histDelta(after, before);
+    check('histDelta subtracts counts and every cumulative bucket', d.count === 20 && d.buckets['10'] === 2 && d.buckets['100'] === 10 && d.buckets['1000'] === 19, JSON.stringify(d));
+    check('histQuantile: the first bucket holding the rank', histQuantile(d, 0.5) === 100 && histQuantile(d, 0.95) === 1000 && histQuantile(d, 0.05) === 10);
+    check('histQuantile: past the last bound is +Inf, empty is null', histQuantile(d, 1) === Infinity && histQuantile({ count: 0, buckets: {} }, 0.5) === null);
+    const s = summarize(Array.from({ length: 200_000 }, (_, i) => i % 1000));
+    check('summarize holds 200k samples (no spread-arg overflow)', s.count === 200_000 && s.max === 999 && s.p50 === 499, JSON.stringify(s));
+  }
+
+  // ── the gate ─────────────────────────────────────────────────────────────
+  {
+    const rep = (p95, lag, errors = 0) => ({ fanout: { mutable_to_viewer_ms: { p95 } }, ingest: { consumer_lag: { max: lag } }, bots: { errors } });
+    check('metrics flattens only what the report has', JSON.stringify(metrics(rep(40, 3))) === JSON.stringify({ 'ingest.consumer_lag.max': 3, 'fanout.mutable_to_viewer_ms.p95': 40, errors: 0 }));
+    check('ceiling: over the limit fails, at the limit passes',
+      gate(rep(40, 3), { ceilings: 'fanout.mutable_to_viewer_ms.p95<=30' }).length === 1 && gate(rep(30, 3), { ceilings: 'fanout.mutable_to_viewer_ms.p95<=30' }).length === 0);
+    check('an unknown gate rule is a violation, not silently ignored', gate(rep(1, 1), { ceilings: 'fanout.p95<=3' })[0]?.reason === 'unknown gate rule');
+    const base = rep(100, 0);
+    check('baseline: +20% tolerance passes, +60% regresses', gate(rep(120, 0), { baseline: base }).length === 0 && gate(rep(160, 0), { baseline: base })[0]?.reason === 'regression');
+    check('baseline: a 0 → 5 lag stays inside the noise floor; 0 → 50 does not',
+      gate(rep(100, 5), { baseline: base }).length === 0 && gate(rep(100, 50), { baseline: base })[0]?.metric === 'ingest.consumer_lag.max');
+    check('baseline: any new error fails', gate(rep(100, 0, 1), { baseline: base })[0]?.metric === 'errors');
+  }
+
+  // ── end to end: MODE=segments against the fakes ──────────────────────────
+  {
+    const dir = mkdtempSync(join(tmpdir(), 'load-test-'));
+    const wav = (sec) => {                                  // a 16kHz mono int16 WAV of a quiet tone
+      const n = Math.round(16000 * sec), b = Buffer.alloc(44 + n * 2);
+      b.write('RIFF', 0); b.writeUInt32LE(36 + n * 2, 4); b.write('WAVEfmt ', 8); b.writeUInt32LE(16, 16); b.writeUInt16LE(1, 20); b.writeUInt16LE(1, 22);
+      b.writeUInt32LE(16000, 24); b.writeUInt32LE(32000, 28); b.writeUInt16LE(2, 32); b.writeUInt16LE(16, 34); b.write('data', 36); b.writeUInt32LE(n * 2, 40);
+      for (let i = 0; i < n; i++) b.writeInt16LE(Math.round(3000 * Math.sin(i / 8)), 44 + i * 2);
+      return b.toString('base64');
+    };
+    writeFileSync(join(dir, 'A.json'), JSON.stringify([{ text: 'Anna here, one two three four five', b64: wav(2.2), durSec: 2.2 }]));
+    writeFileSync(join(dir, 'B.json'), JSON.stringify([{ text: 'Boris here, six seven eight', b64: wav(1.5), durSec: 1.5 }]));
+
+    const { server: redisSrv, commands, port: redisPort } = await fakeRedis();
+    let healthCalls = 0;
+    const hist = (count, les) => ({ count, buckets: Object.fromEntries(les.map(([le, n]) => [String(le), n])) });
+    const http = createHttp((req, res) => {
+      res.setHeader('Content-Type', 'application/json');
+      if (req.url !== '/health') { res.statusCode = 404; return res.end('{}'); }
+      const grown = healthCalls++ > 0;                     // the first scrape is the "before" snapshot
+      res.end(JSON.stringify({ status: 'ok', pipeline: {
+        consumer_lag: grown ? 4 : 0, pending_depth: 0,
+        ingest: { last_lag_ms: grown ? 12 : 0, latency_ms: { stream_ms: hist(grown ? 15 : 5, [[5, grown ? 9 : 5], [10, grown ? 15 : 5]]) } },
+        db_writer: { ticks: grown ? 9 : 2, segments: grown ? 40 : 10, failures: 0, max_tick_ms: 18,
+          latency_ms: { sink_ms: hist(grown ? 4 : 1, [[5, grown ? 1 : 1], [10, grown ? 4 : 1]]), durable_ms: hist(grown ? 30 : 10, [[30000, 10], [45000, grown ? 30 : 10]]) } },
+      } }));
+    });
+    await new Promise((r) => http.listen(0, '127.0.0.1', r));
+    const api = `http://127.0.0.1:${http.address().port}`;
+    const report = join(dir, 'report.json');
+    const run = (extra) => new Promise((resolve) => execFile(process.execPath, [join(HERE, 'src', 'load.mjs')], {
+      env: { ...process.env, MODE: 'segments', BOTS: '3', DURATION_S: '2', RAMP_S: '0', GAP_S: '0', SETTLE_S: '0', SCRAPE_S: '0.2',
+        EVAL_CACHE: dir, REDIS_URL: `redis://127.0.0.1:${redisPort}/0`, MEETING_API: api, GATEWAY: api, REPORT: report, MEETING_ID_BASE: '7000', ...extra },
+      timeout: 30_000,
+    }, (err, stdout, stderr) => resolve({ code: err ? err.code : 0, stdout, stderr })));
+
+    const out = await run({});
+    check('a segments run exits 0 with no gate configured', out.code === 0, out.stderr || out.stdout.slice(-400));
+    const payloads = commands.filter((c) => c[0] === 'XADD').map((c) => JSON.parse(c[4]));
+    const segs = payloads.filter((p) => p.type === 'transcription');
+    const ends = payloads.filter((p) => p.type === 'session_end');
+    check('3 bots → 3 meetings (MEETING_ID_BASE..), each closed by one session_end',
+      new Set(segs.map((p) => p.meeting_id)).size === 3 && ends.length === 3 && segs.every((p) => p.meeting_id >= 7000 && p.meeting_id < 7003));
+    const all = segs.flatMap((p) => p.segments);
+    check('drafts grow then a final completes each turn; every segment carries trace.published_ms',
+      all.some((s) => !s.completed) && all.some((s) => s.completed) && all.every((s) => typeof s.trace?.published_ms === 'number')
+      && all.filter((s) => s.completed).every((s) => s.text.endsWith('here, one two three four five') || s.text.endsWith('here, six seven eight')));
+    const rep = JSON.parse(readFileSync(report, 'utf8'));
+    check('the report is load-report.v1 with the run config', rep.schema === 'load-report.v1' && rep.mode === 'segments' && rep.config.bots === 3);
+    check('db_writer = the run\'s histogram delta (durable p95 45s, 7 ticks, 30 segments)',
+      rep.db_writer?.ticks === 7 && rep.db_writer.segments === 30 && rep.db_writer.durable_ms.count === 20 && rep.db_writer.durable_ms.p95 === 45000, JSON.stringify(rep.db_writer));
+    check('ingest: sampled consumer lag + the stream hop delta', rep.ingest.consumer_lag.max === 4 && rep.ingest.stream_ms.count === 10 && rep.ingest.stream_ms.p50 === 10, JSON.stringify(rep.ingest));
+    check('segments + per-bot resources reported', rep.segments.published === segs.length && rep.resources.per_bot.source === 'harness' && rep.gate.pass === true);
+
+    const gated = await run({ GATE: 'ingest.consumer_lag.max<=1' });
+    check('a breached ceiling exits 1 and records the violation',
+      gated.code === 1 && JSON.parse(readFileSync(report, 'utf8')).gate.violations[0]?.metric === 'ingest.consumer_lag.max', gated.stdout.slice(-300));
+
+    http.close();
+    redisSrv.close();
+    rmSync(dir, { recursive: true, force: true });
+  }
+
+  if (failed) { console.error(`\n❌ load: ${failed} checks FAILED.`); process.exit(1); }
+  console.log('\n✅ load: all checks pass — RESP codec, histogram deltas, regression gate, and a segments run → load-report.v1.');
+}
+main().catch((e) => { console.error(e); process.exit(1); });
@@ -7,7 +7,7 @@
 // the pipeline uses, then diff that reference against what the pipeline CONFIRMED.
 // Content the full pass heard but the live transcript lacks = LOST.
 //
-//   node benchmark.mjs <tape.jsonl> [platform] [native]
+//   node benchmark.mjs <tape.jsonl | tape.cap2> [platform] [native]
 //   needs STT: TRANSCRIPTION_SERVICE_URL + TRANSCRIPTION_SERVICE_TOKEN (same as the desktop)
 //   GATEWAY=http://localhost:8056   where the live transcript is read
 //   LANG=                           force a language (default: let whisper detect)
@@ -15,11 +15,10 @@
 //   MATCH_WINDOW_S=12                a ref word counts as "kept" if it appears in live ±this
 //   LOST_RECALL=0.4  MIN_LOST_WORDS=5   a ref span is LOST if <RECALL of its (content) words
 //                                       survive AND it has ≥MIN_LOST_WORDS content words
-import fs from 'node:fs';
-import readline from 'node:readline';
+import { pcmView, readTape } from './capture-wire.mjs';
 
 const TAPE = process.argv[2];
-if (!TAPE) { console.error('usage: benchmark.mjs <tape.jsonl> [platform] [native]'); process.exit(1); }
+if (!TAPE) { console.error('usage: benchmark.mjs <tape.jsonl | tape.cap2> [platform] [native]'); process.exit(1); }
 const GATEWAY = (process.env.GATEWAY || 'http://localhost:8056').replace(/\/+$/, '');
 let TX = (process.env.TRANSCRIPTION_SERVICE_URL || '').replace(/\/+$/, '');
 const TX_TOKEN = process.env.TRANSCRIPTION_SERVICE_TOKEN || '';
@@ -44,9 +43,7 @@ function decodeFrame(buf) {
   let pcmStart = 12;
   if (named) { const nameLen = buf.readInt32LE(12); pcmStart = 16 + ((nameLen + 3) & ~3); }
   const n = Math.max(0, (buf.length - pcmStart) >> 2);
-  const samples = new Float32Array(n);
-  for (let i = 0; i < n; i++) samples[i] = buf.readFloatLE(pcmStart + i * 4);
-  return { speakerIndex, ts, samples };
+  return { speakerIndex, ts, samples: pcmView(buf, pcmStart, n) };
 }
 
 function float32ToWav(samples, rate = RATE) {
@@ -101,19 +98,16 @@ async function main() {
   // transcript timestamps in ABSOLUTE epoch seconds (the capture frame ts), so the
   // reference must too. Per-frame marks map a whisper within-chunk offset back to real
   // epoch time, so the gaps we drop by concatenating don't drift the match window.
-  const rl = readline.createInterface({ input: fs.createReadStream(TAPE), crlfDelay: Infinity });
   let header = null, t0 = null;
   const chunks = []; let cur = [], curN = 0, curMarks = [];
   const flush = () => {
     if (curN > 0) { const a = new Float32Array(curN); let o = 0; for (const s of cur) { a.set(s, o); o += s.length; } chunks.push({ samples: a, marks: curMarks }); }
     cur = []; curN = 0; curMarks = [];
   };
-  for await (const line of rl) {
-    if (!line) continue;
-    const m = JSON.parse(line);
+  for await (const m of readTape(TAPE)) {
     if (!header) { header = m; continue; }
     if (!m.bin) continue;
-    const f = decodeFrame(Buffer.from(m.d, 'base64'));
+    const f = decodeFrame(m.frame);
     if (!f || f.speakerIndex !== 999 || !f.samples.length) continue;
     if (t0 === null) t0 = f.ts;
     curMarks.push({ off: curN / RATE, tsec: f.ts / 1000 });   // concat-offset (s) → real epoch (s)
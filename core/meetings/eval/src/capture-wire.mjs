@@ -0,0 +1,94 @@
+// capture-wire — the @vexa/capture-codec audio frame encoder (inlined; eval is zero-npm-dep, not
+// a workspace pkg), shared by replay.mjs and load.mjs. Matches modules/capture-codec/src/index.ts
+// byte-for-byte: no-name = [Int32 track][Float64 ts][Float32 pcm…]; named =
+// high-bit track + [Int32 nameLen][UTF-8 name, 4B-padded][Float32 pcm…]. Also the tape reader
+// (legacy JSONL or the capture.v2 container) shared by replay.mjs, capture.mjs and benchmark.mjs.
+import fs from 'node:fs';
+import readline from 'node:readline';
+
+const NAME_FLAG = 0x80000000 | 0;
+export function encodeAudioFrame(speakerIndex, ts, pcm, speakerName) {
+  const name = speakerName && speakerName.length ? speakerName : '';
+  if (!name) {
+    const buf = new ArrayBuffer(12 + pcm.length * 4);
+    const view = new DataView(buf);
+    view.setInt32(0, speakerIndex, true);
+    view.setFloat64(4, ts, true);
+    new Float32Array(buf, 12).set(pcm);
+    return buf;
+  }
+  const nameBytes = new TextEncoder().encode(name);
+  const padded = (nameBytes.length + 3) & ~3;
+  const buf = new ArrayBuffer(16 + padded + pcm.length * 4);
+  const view = new DataView(buf);
+  view.setInt32(0, speakerIndex | NAME_FLAG, true);
+  view.setFloat64(4, ts, true);
+  view.setInt32(12, nameBytes.length, true);
+  new Uint8Array(buf, 16, nameBytes.length).set(nameBytes);
+  new Float32Array(buf, 16 + padded).set(pcm);
+  return buf;
+}
+
+// Float32 PCM at `start` of a frame Buffer — a VIEW when 4-byte aligned (capture.v2 records
+// always are), else one copy. Replaces the per-sample readFloatLE walk.
+export function pcmView(buf, start, n) {
+  const at = buf.byteOffset + start;
+  if ((at & 3) === 0) return new Float32Array(buf.buffer, at, n);
+  return new Float32Array(buf.buffer.slice(at, at + n * 4));
+}
+
+// capture.v2 — the tape at rest (mirrors capture-codec readCaptureV2Header / captureV2Records /
+// decodeEventBinary; contract: modules/capture-codec/src/contracts/capture-v2.md).
+//   container : [u32 'CAP2'][u32 2][u32 metaLen][u32 0][meta JSON, 4B-padded] record…
+//   record    : [u32 kind][u32 byteLen][f64 t][payload, 4B-padded]   kind 1 audio · 2 event · 3 text · 4 REC1
+const CAP2_MAGIC = 0x32504143;
+const EVENT_KINDS = ['speaker-joined', 'speaker-left', 'active-speaker', 'caption', 'segment', 'lifecycle', 'track-lock', 'chat'];
+
+function eventText(b) {
+  const kind = EVENT_KINDS[b[0]], fields = b[1];
+  if (!kind) return null;
+  const ev = { kind, ts: b.readDoubleLE(4) };
+  let o = 12;
+  for (const [bit, key] of [[1, 'speaker'], [2, 'text'], [4, 'detail']]) {
+    if (!(fields & bit)) continue;
+    const n = b.readUInt32LE(o), s = b.toString('utf8', o + 4, o + 4 + n);
+    ev[key] = key === 'detail' ? JSON.parse(s) : s;
+    o += 4 + n;
+  }
+  return JSON.stringify(ev);
+}
+
+// Read a tape of EITHER format as the legacy tape's messages: the header object first, then
+// `{t, bin:true, frame}` (frame = the wire bytes, a zero-copy Buffer slice for v2 — a JSONL
+// line's base64 is decoded into one) or `{t, bin:false, d:text}`. A v2 file is loaded once and
+// its length prefixes walked; a JSONL tape streams line by line as before.
+export async function* readTape(path) {
+  const fd = fs.openSync(path, 'r'), probe = Buffer.alloc(4);
+  const n = fs.readSync(fd, probe, 0, 4, 0);
+  fs.closeSync(fd);
+  if (n === 4 && probe.readUInt32LE(0) === CAP2_MAGIC) {
+    const buf = fs.readFileSync(path);
+    const metaLen = buf.readUInt32LE(8);
+    yield { v: buf.readUInt32LE(4), ...JSON.parse(buf.toString('utf8', 16, 16 + metaLen)) };
+    let o = 16 + ((metaLen + 3) & ~3);
+    while (o + 16 <= buf.length) {
+      const kind = buf.readUInt32LE(o), len = buf.readUInt32LE(o + 4), t = buf.readDoubleLE(o + 8);
+      if (o + 16 + len > buf.length) break;                 // truncated tail (capture cut mid-write)
+      const body = buf.subarray(o + 16, o + 16 + len);
+      if (kind === 1 || kind === 4) yield { t, bin: true, frame: body };
+      else if (kind === 2) { const d = eventText(body); if (d) yield { t, bin: false, d }; }
+      else if (kind === 3) yield { t, bin: false, d: body.toString('utf8') };
+      o += 16 + ((len + 3) & ~3);
+    }
+    return;
+  }
+  const rl = readline.createInterface({ input: fs.createReadStream(path), crlfDelay: Infinity });
+  let header = false;
+  for await (const line of rl) {
+    if (!line) continue;
+    let m; try { m = JSON.parse(line); } catch { continue; }
+    if (header && m.bin) m.frame = Buffer.from(m.d, 'base64');
+    header = true;
+    yield m;
+  }
+}
@@ -10,14 +10,13 @@
 //   • gmeet lane (google_meet): PER-PARTICIPANT channels 0..N (named) + mic ch1000;
 //     ch999 is ALWAYS absent here, by design.
 //
-//   node capture.mjs <tape.jsonl>
+//   node capture.mjs <tape.jsonl | tape.cap2>
 //   DROP_RMS=0.006   silence floor (matches the pipeline's drop gate)
 //   STALL_MS=3000    inter-frame gap above which capture is "stalled"
-import fs from 'node:fs';
-import readline from 'node:readline';
+import { pcmView, readTape } from './capture-wire.mjs';
 
 const TAPE = process.argv[2];
-if (!TAPE) { console.error('usage: capture.mjs <tape.jsonl>'); process.exit(1); }
+if (!TAPE) { console.error('usage: capture.mjs <tape.jsonl | tape.cap2>'); process.exit(1); }
 const DROP_RMS = Number(process.env.DROP_RMS || 0.006);
 const STALL_MS = Number(process.env.STALL_MS || 3000);
 const RATE = 16000;
@@ -28,7 +27,8 @@ function decode(buf) {
   const raw = buf.readInt32LE(0), named = raw < 0, idx = named ? (raw & 0x7fffffff) : raw;
   let p = named ? 16 + (((buf.readInt32LE(12)) + 3) & ~3) : 12;
   const n = Math.max(0, (buf.length - p) >> 2);
-  let s = 0; for (let i = 0; i < n; i++) { const v = buf.readFloatLE(p + i * 4); s += v * v; }
+  const pcm = pcmView(buf, p, n);
+  let s = 0; for (let i = 0; i < n; i++) s += pcm[i] * pcm[i];
   return { idx, n, rms: n ? Math.sqrt(s / n) : 0 };
 }
 
@@ -41,16 +41,13 @@ const agg = (chans) => {
 const fmt = (c) => `${c.f}f · ${(c.smp / RATE).toFixed(1)}s · avgRMS=${(c.rmsSum / c.f).toFixed(4)} · <floor ${Math.round(100 * c.dropped / c.f)}% · maxGap=${(c.maxGap / 1000).toFixed(1)}s`;
 
 async function main() {
-  const rl = readline.createInterface({ input: fs.createReadStream(TAPE), crlfDelay: Infinity });
   let header = null, other = 0;
   const ch = new Map();           // idx → {f, smp, rmsSum, dropped, lastT, maxGap}
   const hk = {}; const spk = new Set();
-  for await (const line of rl) {
-    if (!line) continue;
-    let m; try { m = JSON.parse(line); } catch { continue; }
+  for await (const m of readTape(TAPE)) {
     if (!header) { header = m; continue; }
     if (m.bin) {
-      const d = decode(Buffer.from(m.d, 'base64'));
+      const d = decode(m.frame);
       if (!d) continue;
       if (d.idx > MIC) { other++; continue; }   // REC1 chunk / unknown (REC_MAGIC ≫ 1000) — not capture audio
       let c = ch.get(d.idx);
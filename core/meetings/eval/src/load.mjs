@@ -0,0 +1,538 @@
+#!/usr/bin/env node
+// load — the SCALE probe. benchmark/replay measure one tape against one STT; this replays the
+// TTS clip corpus (corpus.mjs pools) as N concurrent synthetic bots against a running stack and
+// writes a machine-readable report (load-report.v1) that a CI job can gate regressions on.
+//
+// Three modes — pick the tier under test, the rest of the stack is measured as it runs:
+//   MODE=segments  each bot is a meeting publishing transcript.v1 drafts → finals straight onto
+//                  `transcription_segments` (XADD, the bot's own wire; trace.published_ms set), so
+//                  the collector, the db_writer and the gateway fan-out carry the load. VIEWERS=k
+//                  opens k gateway /ws viewers per meeting and times each frame's arrival.
+//   MODE=ingest    each bot streams its clips as @vexa/capture-codec frames into the desktop
+//                  ingest at real-time pacing (the real capture → STT → publish pipeline).
+//   MODE=stt       each bot POSTs its clips to the STT service at real-time pacing (RTF per call).
+//
+//   node load.mjs
+//   BOTS=50  DURATION_S=120  RAMP_S=10   concurrent bots, how long each speaks, start stagger
+//   GAP_S=0.5                            silence between a bot's turns
+//   SETTLE_S=                            wait after the bots stop before the final scrape
+//                                        (default 45 for segments — a 30s settle + a db_writer tick)
+//   REDIS_URL=redis://localhost:6379/0   segments mode
+//   API_KEY=                             segments mode: owner of the synthetic meetings (created via
+//                                        POST /meetings, deleted after unless KEEP=1); required for
+//                                        VIEWERS. Unset → MEETING_ID_BASE=<n> numbers meetings
+//                                        n..n+BOTS-1 with no rows behind them (collector-only load).
+//   INGEST=ws://localhost:9099  PLATFORM=google_meet   ingest mode (google_meet → named frames,
+//                                        other platforms → ch999 + active-speaker hints)
+//   TRANSCRIPTION_SERVICE_URL (+_TOKEN)  stt mode
+//   GATEWAY=http://localhost:8056        meetings, /ws viewers and the gateway /health histograms
+//   MEETING_API=http://localhost:8080    /health pipeline: consumer lag, ingest + db_writer latency
+//   SCRAPE_S=5                           how often /health (and docker stats) are sampled
+//   DOCKER_STATS=<regex>                 sample `docker stats` for the matching containers (CPU/RAM)
+//   REPORT=load-report.json              where the report goes
+//   GATE=key<=value,...                  absolute ceilings on report metrics (see `metrics`)
+//   BASELINE=<report.json> TOLERANCE=0.2 fail a metric that regressed >TOLERANCE past the baseline
+//                                        (and past its noise floor) — exit 1 on any violation
+import fs from 'node:fs';
+import net from 'node:net';
+import { execFile } from 'node:child_process';
+import { randomBytes } from 'node:crypto';
+import { CACHE_DIR } from './corpus.mjs';
+import { ALL_SPEAKERS, sleep } from './speakers.mjs';
+import { encodeAudioFrame } from './capture-wire.mjs';
+
+const RATE = 16000;
+const FRAME_MS = 100;
+const STREAM = 'transcription_segments';
+
+// ── RESP (redis wire) — a minimal pipelined client over node:net, enough for XADD/PING ──
+export class RespError extends Error {}
+
+export function encodeCommand(args) {
+  const parts = [Buffer.from(`*${args.length}\r\n`)];
+  for (const a of args) {
+    const b = Buffer.isBuffer(a) ? a : Buffer.from(String(a));
+    parts.push(Buffer.from(`$${b.length}\r\n`), b, Buffer.from('\r\n'));
+  }
+  return Buffer.concat(parts);
+}
+
+/** One reply starting at `at` → `{ value, end }`, or null while the reply is still incomplete. */
+export function parseReply(buf, at = 0) {
+  const eol = buf.indexOf('\r\n', at);
+  if (eol < 0) return null;
+  const line = buf.toString('utf8', at + 1, eol);
+  switch (String.fromCharCode(buf[at])) {
+    case '+': return { value: line, end: eol + 2 };
+    case '-': return { value: new RespError(line), end: eol + 2 };
+    case ':': return { value: Number(line), end: eol + 2 };
+    case '$': {
+      const n = Number(line);
+      if (n < 0) return { value: null, end: eol + 2 };
+      if (buf.length < eol + 2 + n + 2) return null;
+      return { value: buf.toString('utf8', eol + 2, eol + 2 + n), end: eol + 2 + n + 2 };
+    }
+    case '*': {
+      const n = Number(line);
+      if (n < 0) return { value: null, end: eol + 2 };
+      const out = [];
+      let pos = eol + 2;
+      for (let i = 0; i < n; i++) {
+        const r = parseReply(buf, pos);
+        if (!r) return null;
+        out.push(r.value); pos = r.end;
+      }
+      return { value: out, end: pos };
+    }
+    default: throw new RespError(`unexpected RESP type byte 0x${buf[at].toString(16)}`);
+  }
+}
+
+/** Feed socket chunks, get whole replies back in order (split anywhere, several per chunk). */
+export function respReader(onReply) {
+  let buf = Buffer.alloc(0);
+  return (chunk) => {
+    buf = buf.length ? Buffer.concat([buf, chunk]) : chunk;
+    let at = 0, r;
+    while (at < buf.length && (r = parseReply(buf, at))) { onReply(r.value); at = r.end; }
+    buf = buf.subarray(at);
+  };
+}
+
+export function connectRedis(url) {
+  const u = new URL(url);
+  const sock = net.connect({ host: u.hostname || 'localhost', port: Number(u.port || 6379) });
+  sock.setNoDelay(true);
+  const waiting = [];
+  sock.on('data', respReader((v) => {
+    const w = waiting.shift();
+    if (w) (v instanceof RespError ? w.reject(v) : w.resolve(v));
+  }));
+  const failAll = (e) => { for (const w of waiting.splice(0)) w.reject(e); };
+  sock.on('error', failAll);
+  sock.on('close', () => failAll(new Error('redis connection closed')));
+  const call = (...args) => new Promise((resolve, reject) => { waiting.push({ resolve, reject }); sock.write(encodeCommand(args)); });
+  const ready = new Promise((resolve, reject) => { sock.once('connect', resolve); sock.once('error', reject); })
+    .then(async () => {
+      if (u.password) await call('AUTH', ...(u.username ? [decodeURIComponent(u.username)] : []), decodeURIComponent(u.password));
+      const db = u.pathname.replace(/^\//, '');
+      if (db && db !== '0') await call('SELECT', db);
+    });
+  return { ready, call, close: () => new Promise((r) => sock.end(r)) };
+}
+
+// ── stats ──
+const rankOf = (sorted, q) => sorted[Math.min(sorted.length - 1, Math.max(0, Math.ceil(q * sorted.length) - 1))];
+export const quantile = (samples, q) => (samples.length ? rankOf([...samples].sort((a, b) => a - b), q) : null);
+export function summarize(samples) {
+  if (!samples.length) return { count: 0, p50: null, p95: null, p99: null, max: null, mean: null };
+  const s = Float64Array.from(samples).sort();
+  return { count: s.length, p50: rankOf(s, 0.5), p95: rankOf(s, 0.95), p99: rankOf(s, 0.99),
+    max: s[s.length - 1], mean: s.reduce((a, b) => a + b, 0) / s.length };
+}
+
+/** after − before of a cumulative `le` histogram (`{count, buckets:{le:n}}` — every service spells it so). */
+export function histDelta(after, before) {
+  if (!after) return null;
+  const buckets = {};
+  for (const [le, n] of Object.entries(after.buckets || {})) buckets[le] = n - (before?.buckets?.[le] ?? 0);
+  return { count: (after.count ?? 0) - (before?.count ?? 0), buckets };
+}
+
+/** The q-quantile of a cumulative histogram as its bucket's upper bound; Infinity past the last one. */
+export function histQuantile(h, q) {
+  if (!h || !h.count) return null;
+  const rank = q * h.count;
+  const les = Object.entries(h.buckets).map(([le, n]) => [Number(le), n]).sort((a, b) => a[0] - b[0]);
+  for (const [le, n] of les) if (n >= rank) return le;
+  return Infinity;
+}
+const histSummary = (h) => (h ? { count: h.count, p50: histQuantile(h, 0.5), p95: histQuantile(h, 0.95), p99: histQuantile(h, 0.99) } : null);
+
+// ── gating ──
+// Every gated metric is lower-is-better. The floor is the smallest regression that counts: a
+// relative TOLERANCE alone would fail a 0 → 2 lag or a 10 → 13ms hop on noise.
+export const GATED = {
+  'stt.rtf.p95': 0.02,
+  'stt.rtf.max': 0.05,
+  'ingest.consumer_lag.max': 10,
+  'ingest.read_lag_ms.max': 250,
+  'ingest.stream_ms.p95': 25,
+  'db_writer.durable_ms.p95': 5000,
+  'db_writer.sink_ms.p95': 25,
+  'db_writer.max_tick_ms': 250,
+  'fanout.mutable_to_viewer_ms.p95': 25,
+  'fanout.publish_to_viewer_ms.p95': 50,
+  'resources.per_bot.cpu_pct': 0.5,
+  'resources.per_bot.mem_mb': 2,
+  'errors': 0,
+};
+
+/** The report's gated numbers, flattened to `GATED` keys (absent tiers are simply omitted). */
+export function metrics(report) {
+  const out = {};
+  const put = (k, v) => { if (typeof v === 'number' && !Number.isNaN(v)) out[k] = v; };
+  put('stt.rtf.p95', report.stt?.rtf?.p95);
+  put('stt.rtf.max', report.stt?.rtf?.max);
+  put('ingest.consumer_lag.max', report.ingest?.consumer_lag?.max);
+  put('ingest.read_lag_ms.max', report.ingest?.read_lag_ms?.max);
+  put('ingest.stream_ms.p95', report.ingest?.stream_ms?.p95);
+  put('db_writer.durable_ms.p95', report.db_writer?.durable_ms?.p95);
+  put('db_writer.sink_ms.p95', report.db_writer?.sink_ms?.p95);
+  put('db_writer.max_tick_ms', report.db_writer?.max_tick_ms);
+  put('fanout.mutable_to_viewer_ms.p95', report.fanout?.mutable_to_viewer_ms?.p95);
+  put('fanout.publish_to_viewer_ms.p95', report.fanout?.publish_to_viewer_ms?.p95);
+  put('resources.per_bot.cpu_pct', report.resources?.per_bot?.cpu_pct);
+  put('resources.per_bot.mem_mb', report.resources?.per_bot?.mem_mb);
+  put('errors', report.bots?.errors);
+  return out;
+}
+
+/** `key<=value,…` ceilings and/or a baseline report → the violations (empty = pass). */
+export function gate(report, { ceilings = '', baseline = null, tolerance = 0.2 } = {}) {
+  const m = metrics(report);
+  const violations = [];
+  for (const rule of ceilings.split(',').map((s) => s.trim()).filter(Boolean)) {
+    const [key, lim] = rule.split('<=').map((s) => s.trim());
+    if (!(key in GATED) || lim === undefined || !Number.isFinite(Number(lim))) { violations.push({ metric: rule, reason: 'unknown gate rule' }); continue; }
+    if (key in m && m[key] > Number(lim)) violations.push({ metric: key, value: m[key], limit: Number(lim), reason: 'ceiling' });
+  }
+  if (baseline) {
+    const b = metrics(baseline);
+    for (const [key, floor] of Object.entries(GATED)) {
+      if (!(key in m) || !(key in b)) continue;
+      const limit = Math.max(b[key] * (1 + tolerance), b[key] + floor);
+      if (m[key] > limit) violations.push({ metric: key, value: m[key], baseline: b[key], limit, reason: 'regression' });
+    }
+  }
+  return violations;
+}
+
+// ── the corpus: every cached speaker pool, decoded once ──
+function loadPools() {
+  const pools = [];
+  for (const s of ALL_SPEAKERS) {
+    const f = `${CACHE_DIR}/${s.key}.json`;
+    if (!fs.existsSync(f)) continue;
+    const clips = JSON.parse(fs.readFileSync(f, 'utf8')).map((c) => {
+      const wav = Buffer.from(c.b64, 'base64');
+      const n = (wav.length - 44) >> 1;
+      const pcm = new Float32Array(n);
+      for (let i = 0; i < n; i++) pcm[i] = wav.readInt16LE(44 + i * 2) / 32768;
+      return { text: c.text, durSec: c.durSec, wav, pcm };
+    });
+    if (clips.length) pools.push({ s, index: pools.length, clips });
+  }
+  return pools;
+}
+
+async function main() {
+  const MODE = process.env.MODE || 'segments';
+  if (!['segments', 'ingest', 'stt'].includes(MODE)) { console.error(`[load] MODE must be segments | ingest | stt (got ${MODE})`); process.exit(2); }
+  const BOTS = Math.max(1, Number(process.env.BOTS || 50));
+  const DURATION_S = Number(process.env.DURATION_S || 120);
+  const RAMP_S = Number(process.env.RAMP_S ?? 10);
+  const GAP_S = Number(process.env.GAP_S ?? 0.5);
+  const SETTLE_S = Number(process.env.SETTLE_S ?? (MODE === 'segments' ? 45 : 5));
+  const VIEWERS = MODE === 'segments' ? Number(process.env.VIEWERS || 0) : 0;
+  const SCRAPE_S = Number(process.env.SCRAPE_S || 5);
+  const GATEWAY = (process.env.GATEWAY || 'http://localhost:8056').replace(/\/+$/, '');
+  const MEETING_API = (process.env.MEETING_API || 'http://localhost:8080').replace(/\/+$/, '');
+  const API_KEY = process.env.API_KEY || '';
+  const PLATFORM = process.env.PLATFORM || 'google_meet';
+  const REPORT = process.env.REPORT || 'load-report.json';
+  const RUN = randomBytes(3).toString('hex');
+
+  const pools = loadPools();
+  if (!pools.length) { console.error(`[load] no clip pools in ${CACHE_DIR} — run ./bin/eval.sh corpus (or set EVAL_CACHE)`); process.exit(1); }
+  const rnd = (a) => a[Math.floor(Math.random() * a.length)];
+  const nextTurn = () => { const p = rnd(pools); return { pool: p, clip: rnd(p.clips) }; };
+  console.log(`[load] run ${RUN} · MODE=${MODE} · ${BOTS} bots × ${DURATION_S}s (ramp ${RAMP_S}s) · ${VIEWERS} viewers/meeting · ${pools.reduce((n, p) => n + p.clips.length, 0)} clips`);
+
+  const errors = new Map();
+  const fail = (where, e) => { const k = `${where}: ${String(e?.message ?? e).slice(0, 120)}`; errors.set(k, (errors.get(k) || 0) + 1); };
+  const sample = { rtf: [], sttWallMs: [], sttQueueMs: [], sttDecodeMs: [], xaddMs: [], mutableToViewer: [], publishToViewer: [], lag: [], pending: [], readLag: [] };
+  const counts = { turns: 0, segmentsPublished: 0, frames: 0, bytes: 0, maxBuffered: 0, sttRequests: 0, audioS: 0, viewerFrames: 0, botsStarted: 0, botsFailed: 0 };
+
+  // ── the scrape loop: /health on meeting-api + gateway, /stats on STT, docker stats ──
+  const TX_BASE = (process.env.TRANSCRIPTION_SERVICE_URL || '').replace(/\/+$/, '').replace(/\/v1\/audio\/transcriptions$/, '');
+  const getJson = async (url) => { try { const r = await fetch(url, { signal: AbortSignal.timeout(3000) }); return r.ok ? await r.json() : null; } catch { return null; } };
+  const scrapeAll = async () => ({
+    meetingApi: await getJson(`${MEETING_API}/health`),
+    gateway: await getJson(`${GATEWAY}/health`),
+    stt: TX_BASE ? await getJson(`${TX_BASE}/stats`) : null,
+  });
+  const containers = new Map(); // name → { cpu:[], memMb:[] }
+  const dockerRe = process.env.DOCKER_STATS ? new RegExp(process.env.DOCKER_STATS) : null;
+  const toMb = (s) => { const m = /([\d.]+)\s*([KMG]i?B|B)/.exec(s || ''); if (!m) return null; const k = { B: 1 / 2 ** 20, KiB: 1 / 1024, KB: 1 / 1024, MiB: 1, MB: 1, GiB: 1024, GB: 1024 }[m[2]] ?? 1; return Number(m[1]) * k; };
+  const dockerSample = () => new Promise((resolve) => {
+    execFile('docker', ['stats', '--no-stream', '--format', '{{json .}}'], { timeout: 10_000 }, (err, out) => {
+      if (err) { fail('docker stats', err); return resolve(); }
+      for (const line of out.split('\n').filter(Boolean)) {
+        let d; try { d = JSON.parse(line); } catch { continue; }
+        if (!dockerRe.test(d.Name)) continue;
+        const c = containers.get(d.Name) || { cpu: [], memMb: [] };
+        c.cpu.push(parseFloat(d.CPUPerc)); const mb = toMb(String(d.MemUsage).split('/')[0]); if (mb !== null) c.memMb.push(mb);
+        containers.set(d.Name, c);
+      }
+      resolve();
+    });
+  });
+  const before = await scrapeAll();
+  let scraping = true;
+  const scraper = (async () => {
+    while (scraping) {
+      const h = await getJson(`${MEETING_API}/health`);
+      const p = h?.pipeline;
+      if (typeof p?.consumer_lag === 'number') sample.lag.push(p.consumer_lag);
+      if (typeof p?.pending_depth === 'number') sample.pending.push(p.pending_depth);
+      if (typeof p?.ingest?.last_lag_ms === 'number') sample.readLag.push(p.ingest.last_lag_ms);
+      if (dockerRe) await dockerSample();
+      await sleep(SCRAPE_S * 1000);
+    }
+  })();
+
+  // ── synthetic meetings (segments mode) ──
+  const meetings = [];
+  const letters = (n) => Array.from(randomBytes(n), (b) => String.fromCharCode(97 + (b % 26))).join('');
+  if (MODE === 'segments') {
+    if (VIEWERS && !API_KEY) { console.error('[load] VIEWERS needs API_KEY (viewers subscribe through the gateway as the meetings\' owner)'); process.exit(2); }
+    for (let i = 0; i < BOTS; i++) {
+      if (!API_KEY) {
+        const base = Number(process.env.MEETING_ID_BASE || 900000);
+        meetings.push({ id: base + i, native: `load-${RUN}-${i}`, platform: PLATFORM, owned: false });
+        continue;
+      }
+      const native = `${letters(3)}-${letters(4)}-${letters(3)}`;
+      try {
+        const r = await fetch(`${GATEWAY}/meetings`, {
+          method: 'POST', headers: { 'X-API-Key': API_KEY, 'Content-Type': 'application/json' },
+          body: JSON.stringify({ title: `load ${RUN} #${i}`, meeting_url: `https://meet.google.com/${native}`, auto_join: false }),
+        });
+        if (!r.ok) throw new Error(`POST /meetings ${r.status}`);
+        const row = await r.json();
+        meetings.push({ id: row.id, native: row.native_meeting_id || native, platform: row.platform || 'google_meet', owned: true });
+      } catch (e) { fail('meeting create', e); }
+    }
+    if (!meetings.length) { console.error('[load] no meetings to drive'); process.exit(1); }
+  }
+
+  // ── viewers: gateway /ws, raw mode; each transcript frame is timed against its trace ──
+  const viewerSockets = [];
+  const GW_WS = GATEWAY.replace(/^http/, 'ws');
+  const openViewer = (m) => new Promise((resolve) => {
+    const ws = new WebSocket(`${GW_WS}/ws?api_key=${encodeURIComponent(API_KEY)}`);
+    viewerSockets.push(ws);
+    const timer = setTimeout(() => { fail('viewer', 'no subscribed ack in 10s'); resolve(); }, 10_000);
+    ws.onopen = () => ws.send(JSON.stringify({ action: 'subscribe', meetings: [{ platform: m.platform, native_id: m.native }] }));
+    ws.onerror = () => { clearTimeout(timer); fail('viewer', 'ws error'); resolve(); };
+    ws.onmessage = (ev) => {
+      const now = Date.now();
+      let msg; try { msg = JSON.parse(ev.data); } catch { return; }
+      if (msg.type === 'subscribed') { clearTimeout(timer); resolve(); return; }
+      if (msg.type === 'error') { fail('viewer', msg.error); return; }
+      if (msg.type !== 'transcript') return;
+      counts.viewerFrames++;
+      for (const seg of [...(msg.confirmed || []), ...(msg.pending || [])]) {
+        const t = seg.trace;
+        if (typeof t?.mutable_ms === 'number') sample.mutableToViewer.push(Math.max(0, now - t.mutable_ms));
+        if (typeof t?.published_ms === 'number') sample.publishToViewer.push(Math.max(0, now - t.published_ms));
+      }
+    };
+  });
+  await Promise.all(meetings.flatMap((m) => Array.from({ length: VIEWERS }, () => openViewer(m))));
+
+  // ── the bots ──
+  let redis = null;
+  if (MODE === 'segments') {
+    redis = connectRedis(process.env.REDIS_URL || 'redis://localhost:6379/0');
+    try { await redis.ready; await redis.call('PING'); } catch (e) { console.error(`[load] redis unreachable (${e.message})`); process.exit(1); }
+  }
+  let TX = '';
+  const TX_TOKEN = process.env.TRANSCRIPTION_SERVICE_TOKEN || '';
+  if (MODE === 'stt') {
+    if (!TX_BASE) { console.error('[load] MODE=stt needs TRANSCRIPTION_SERVICE_URL (+_TOKEN)'); process.exit(2); }
+    TX = `${TX_BASE}/v1/audio/transcriptions`;
+  }
+  const INGEST = (process.env.INGEST || 'ws://localhost:9099').replace(/\/+$/, '');
+
+  const segmentsBot = async (i, deadline) => {
+    const m = meetings[i];
+    const t0 = Date.now();
+    const publish = async (seg) => {
+      const payload = { type: 'transcription', meeting_id: m.id, native_meeting_id: m.native, platform: m.platform,
+        segments: [{ ...seg, trace: { published_ms: Date.now() } }] };
+      const s = performance.now();
+      await redis.call('XADD', STREAM, '*', 'payload', JSON.stringify(payload));
+      sample.xaddMs.push(performance.now() - s);
+      counts.segmentsPublished++;
+    };
+    for (let k = 0; Date.now() < deadline; k++) {
+      const { pool, clip } = nextTurn();
+      const words = clip.text.split(/\s+/);
+      const start = (Date.now() - t0) / 1000;
+      const base = { segment_id: `${RUN}-${i}-${k}`, start, speaker: pool.s.en, language: 'en',
+        absolute_start_time: new Date(t0 + start * 1000).toISOString() };
+      for (let t = 1; t < clip.durSec; t++) {            // one growing draft per second of speech
+        await sleep(1000);
+        await publish({ ...base, end: start + t, text: words.slice(0, Math.ceil((words.length * t) / clip.durSec)).join(' '), completed: false });
+      }
+      await sleep(Math.max(0, (start + clip.durSec) * 1000 - (Date.now() - t0)));
+      await publish({ ...base, end: start + clip.durSec, text: clip.text, completed: true,
+        absolute_end_time: new Date(t0 + (start + clip.durSec) * 1000).toISOString() });
+      counts.turns++;
+      await sleep(GAP_S * 1000);
+    }
+    await redis.call('XADD', STREAM, '*', 'payload', JSON.stringify({ type: 'session_end', meeting_id: m.id, native_meeting_id: m.native }));
+  };
+
+  const ingestBot = async (i, deadline) => {
+    const native = `load-${RUN}-${i}`;
+    const ws = new WebSocket(`${INGEST}/?platform=${encodeURIComponent(PLATFORM)}&native_meeting_id=${native}`);
+    ws.binaryType = 'arraybuffer';
+    await new Promise((resolve, reject) => {
+      let done = false;
+      const go = () => { if (!done) { done = true; resolve(); } };
+      ws.onerror = () => reject(new Error('ingest connect failed'));
+      ws.onopen = () => { ws.onmessage = (ev) => { try { if (JSON.parse(ev.data).type === 'ready') go(); } catch { /* */ } }; setTimeout(go, 2000); };
+    });
+    const named = PLATFORM === 'google_meet';
+    const step = (RATE * FRAME_MS) / 1000;
+    const t0 = Date.now();
+    let sent = 0;                                          // frames sent — the pacing clock
+    const send = (pcm, pool) => {
+      const buf = named && pool ? encodeAudioFrame(pool.index, Date.now(), pcm, pool.s.en) : encodeAudioFrame(999, Date.now(), pcm);
+      ws.send(buf);
+      counts.frames++; counts.bytes += buf.byteLength; counts.maxBuffered = Math.max(counts.maxBuffered, ws.bufferedAmount);
+      sent++;
+    };
+    const pace = () => sleep(Math.max(0, t0 + sent * FRAME_MS - Date.now()));
+    const silence = new Float32Array(step);
+    while (Date.now() < deadline) {
+      const { pool, clip } = nextTurn();
+      if (!named) ws.send(JSON.stringify({ kind: 'active-speaker', speaker: pool.s.en, ts: Date.now(), detail: { hint: 'dom-active' } }));
+      for (let o = 0; o < clip.pcm.length; o += step) { send(clip.pcm.subarray(o, o + step), pool); await pace(); }
+      for (let g = 0; g < (GAP_S * 1000) / FRAME_MS; g++) { send(silence, null); await pace(); }
+      counts.turns++;
+    }
+    await sleep(2000);                                     // let the pipeline emit trailing confirms
+    ws.close();
+  };
+
+  const sttBot = async (i, deadline) => {
+    while (Date.now() < deadline) {
+      const { clip } = nextTurn();
+      const boundary = `----loadFB${i.toString(36)}${Date.now().toString(36)}`;
+      const field = (n, v) => Buffer.from(`--${boundary}\r\nContent-Disposition: form-data; name="${n}"\r\n\r\n${v}\r\n`);
+      const body = Buffer.concat([
+        Buffer.from(`--${boundary}\r\nContent-Disposition: form-data; name="file"; filename="audio.wav"\r\nContent-Type: audio/wav\r\n\r\n`),
+        clip.wav, Buffer.from('\r\n'), field('model', 'whisper-1'), field('response_format', 'verbose_json'),
+        Buffer.from(`--${boundary}--\r\n`),
+      ]);
+      const headers = { 'Content-Type': `multipart/form-data; boundary=${boundary}` };
+      if (TX_TOKEN) headers.Authorization = `Bearer ${TX_TOKEN}`;
+      const s = Date.now();
+      try {
+        const r = await fetch(TX, { method: 'POST', headers, body });
+        if (!r.ok) throw new Error(`STT ${r.status}`);
+        const d = await r.json();
+        const wall = Date.now() - s;
+        sample.sttWallMs.push(wall); sample.rtf.push(wall / (clip.durSec * 1000));
+        if (typeof d.timing?.queue_ms === 'number') sample.sttQueueMs.push(d.timing.queue_ms);
+        if (typeof d.timing?.decode_ms === 'number') sample.sttDecodeMs.push(d.timing.decode_ms);
+        counts.sttRequests++; counts.audioS += clip.durSec; counts.turns++;
+      } catch (e) { fail('stt', e); }
+      await sleep(Math.max(0, s + (clip.durSec + GAP_S) * 1000 - Date.now()));  // a live bot's cadence
+    }
+  };
+
+  const bot = { segments: segmentsBot, ingest: ingestBot, stt: sttBot }[MODE];
+  const nBots = MODE === 'segments' ? meetings.length : BOTS;
+  const cpu0 = process.cpuUsage();
+  const rss0 = process.memoryUsage().rss;
+  let rssMax = rss0;
+  const rssTimer = setInterval(() => { rssMax = Math.max(rssMax, process.memoryUsage().rss); }, 1000);
+  const started = Date.now();
+  const progress = setInterval(() => console.log(`[load] t=${((Date.now() - started) / 1000).toFixed(0)}s · turns ${counts.turns} · segs ${counts.segmentsPublished} · frames ${counts.frames} · stt ${counts.sttRequests} · errors ${[...errors.values()].reduce((a, b) => a + b, 0)}`), 10_000);
+  await Promise.all(Array.from({ length: nBots }, async (_, i) => {
+    await sleep(nBots > 1 ? (i * RAMP_S * 1000) / (nBots - 1) : 0);
+    counts.botsStarted++;
+    try { await bot(i, Date.now() + DURATION_S * 1000); } catch (e) { counts.botsFailed++; fail(`${MODE} bot`, e); }
+  }));
+  const wallS = (Date.now() - started) / 1000;
+  const cpu = process.cpuUsage(cpu0);
+  clearInterval(progress);
+  clearInterval(rssTimer);
+  console.log(`[load] bots done after ${wallS.toFixed(0)}s — settling ${SETTLE_S}s for the flush + fan-out tail…`);
+  await sleep(SETTLE_S * 1000);
+  scraping = false;
+  await scraper;
+  const after = await scrapeAll();
+
+  for (const ws of viewerSockets) { try { ws.close(); } catch { /* */ } }
+  await redis?.close();
+  if (process.env.KEEP !== '1') {
+    for (const m of meetings.filter((x) => x.owned)) {
+      try { await fetch(`${GATEWAY}/meetings/${m.id}`, { method: 'DELETE', headers: { 'X-API-Key': API_KEY } }); } catch (e) { fail('meeting delete', e); }
+    }
+  }
+
+  // ── the report ──
+  const ingestH = (stage) => histSummary(histDelta(after.meetingApi?.pipeline?.ingest?.latency_ms?.[stage], before.meetingApi?.pipeline?.ingest?.latency_ms?.[stage]));
+  const dbw = (k) => histSummary(histDelta(after.meetingApi?.pipeline?.db_writer?.latency_ms?.[k], before.meetingApi?.pipeline?.db_writer?.latency_ms?.[k]));
+  const gw = {};
+  for (const [name, h] of Object.entries(after.gateway?.metrics?.latency_ms || {})) {
+    if (name.startsWith('transcript.')) gw[name.slice('transcript.'.length)] = histSummary(histDelta(h, before.gateway?.metrics?.latency_ms?.[name]));
+  }
+  const sttServer = {};
+  for (const [stage, h] of Object.entries(after.stt?.latency_ms || {})) sttServer[stage] = histSummary(histDelta(h, before.stt?.latency_ms?.[stage]));
+  const harnessCpuPct = ((cpu.user + cpu.system) / 1000 / (wallS * 1000)) * 100;
+  const harnessRssMb = rssMax / 2 ** 20;
+  const containerStats = Object.fromEntries([...containers].map(([name, c]) => [name, {
+    cpu_pct_mean: summarize(c.cpu).mean, cpu_pct_max: summarize(c.cpu).max, mem_mb_max: summarize(c.memMb).max,
+  }]));
+  // Per bot: what the tier under test spends on one more bot — the sampled containers when given,
+  // else the harness process itself (the synthetic bots ARE the load in that case).
+  const cs = Object.values(containerStats);
+  const perBot = cs.length
+    ? { cpu_pct: cs.reduce((a, c) => a + (c.cpu_pct_mean || 0), 0) / nBots, mem_mb: cs.reduce((a, c) => a + (c.mem_mb_max || 0), 0) / nBots, source: 'containers' }
+    : { cpu_pct: harnessCpuPct / nBots, mem_mb: Math.max(0, rssMax - rss0) / 2 ** 20 / nBots, source: 'harness' };
+  const report = {
+    schema: 'load-report.v1',
+    run: RUN, mode: MODE, started_at: new Date(started).toISOString(), wall_s: Math.round(wallS),
+    config: { bots: nBots, duration_s: DURATION_S, ramp_s: RAMP_S, gap_s: GAP_S, viewers: VIEWERS, platform: PLATFORM },
+    bots: { started: counts.botsStarted, failed: counts.botsFailed, turns: counts.turns,
+      errors: [...errors.values()].reduce((a, b) => a + b, 0), error_kinds: Object.fromEntries(errors) },
+    ...(MODE === 'stt' && { stt: { requests: counts.sttRequests, audio_s: Math.round(counts.audioS), rtf: summarize(sample.rtf),
+      wall_ms: summarize(sample.sttWallMs), queue_ms: summarize(sample.sttQueueMs), decode_ms: summarize(sample.sttDecodeMs), server: sttServer } }),
+    ...(MODE === 'segments' && { segments: { published: counts.segmentsPublished, xadd_ms: summarize(sample.xaddMs) } }),
+    ...(MODE === 'ingest' && { capture: { frames: counts.frames, mb: counts.bytes / 2 ** 20, max_buffered_bytes: counts.maxBuffered } }),
+    ingest: { consumer_lag: summarize(sample.lag), pending_depth: summarize(sample.pending), read_lag_ms: summarize(sample.readLag),
+      stream_ms: ingestH('stream_ms'), collector_ms: ingestH('collector_ms') },
+    db_writer: after.meetingApi?.pipeline?.db_writer ? {
+      ticks: after.meetingApi.pipeline.db_writer.ticks - (before.meetingApi?.pipeline?.db_writer?.ticks ?? 0),
+      segments: after.meetingApi.pipeline.db_writer.segments - (before.meetingApi?.pipeline?.db_writer?.segments ?? 0),
+      failures: after.meetingApi.pipeline.db_writer.failures - (before.meetingApi?.pipeline?.db_writer?.failures ?? 0),
+      max_tick_ms: after.meetingApi.pipeline.db_writer.max_tick_ms, sink_ms: dbw('sink_ms'), durable_ms: dbw('durable_ms'),
+    } : null,
+    fanout: { frames: counts.viewerFrames, mutable_to_viewer_ms: summarize(sample.mutableToViewer),
+      publish_to_viewer_ms: summarize(sample.publishToViewer), gateway: gw },
+    resources: { harness: { cpu_pct: harnessCpuPct, rss_mb_max: harnessRssMb }, containers: containerStats, per_bot: perBot },
+  };
+  const baseline = process.env.BASELINE ? JSON.parse(fs.readFileSync(process.env.BASELINE, 'utf8')) : null;
+  const violations = gate(report, { ceilings: process.env.GATE || '', baseline, tolerance: Number(process.env.TOLERANCE ?? 0.2) });
+  report.metrics = metrics(report);
+  report.gate = { pass: violations.length === 0, violations };
+  fs.writeFileSync(REPORT, JSON.stringify(report, (_, v) => (v === Infinity ? '+Inf' : v), 2) + '\n');
+
+  const f = (v, d = 0) => (typeof v === 'number' ? v.toFixed(d) : String(v ?? '–'));
+  console.log(`\nreport → ${REPORT}`);
+  for (const [k, v] of Object.entries(report.metrics)) console.log(`  ${k.padEnd(34)} ${f(v, k.includes('rtf') || k.includes('pct') ? 2 : 0)}`);
+  for (const v of violations) console.log(`  ✗ ${v.metric} = ${f(v.value, 2)} > ${f(v.limit, 2)} (${v.reason}${v.baseline !== undefined ? `, baseline ${f(v.baseline, 2)}` : ''})`);
+  console.log(`\nLOAD mode=${MODE} bots=${nBots} viewers=${VIEWERS} turns=${counts.turns} errors=${report.bots.errors} gate=${violations.length ? 'FAIL' : 'pass'}`);
+  if (violations.length) process.exit(1);
+}
+
+if (import.meta.url === `file://${process.argv[1]}`) {
+  main().catch((e) => { console.error('[load]', e.message); process.exit(1); });
+}
@@ -0,0 +1,109 @@
+/**
+ * Audio-kernels microbenchmark — CPU per bot-minute, JS reference vs WASM SIMD.
+ *
+ * Each kernel is timed over ONE MINUTE of audio at the rate it sees in a bot
+ * (16 kHz mono for RMS and the Int16 upload encode; 48 kHz stereo for downmix,
+ * 48 kHz mono for the decimator), fed in the frame size its caller uses. The
+ * figure is the median of ROUNDS runs after a warm-up — ms of CPU per bot-minute
+ * of audio, per kernel, so before/after numbers compare directly.
+ *
+ * Run: pnpm --filter @vexa/audio-kernels bench   (`-- --json` for a machine-readable line)
+ */
+import { wasmKernels, reference, DECIMATE3_TAPS } from "./index.js";
+
+const ROUNDS = 15;
+const MINUTE_16K = 16000 * 60;
+const MINUTE_48K = 48000 * 60;
+
+function noise(n: number): Float32Array {
+  let s = 12345;
+  return Float32Array.from({ length: n }, () => {
+    s = (Math.imul(s, 1664525) + 1013904223) >>> 0;
+    return 0.3 * (s / 2 ** 31 - 1);
+  });
+}
+
+/** Split a minute into the caller's frame size. */
+const frames = (x: Float32Array, size: number) =>
+  Array.from({ length: Math.ceil(x.length / size) }, (_, i) => x.subarray(i * size, (i + 1) * size));
+
+function timeMs(run: () => void): number {
+  run();                                                          // warm-up (JIT / instance)
+  const samples: number[] = [];
+  for (let r = 0; r < ROUNDS; r++) {
+    const t0 = performance.now();
+    run();
+    samples.push(performance.now() - t0);
+  }
+  return samples.sort((a, b) => a - b)[ROUNDS >> 1];
+}
+
+interface Case { kernel: string; shape: string; js: () => void; wasm: (() => void) | null }
+
+const mono16 = noise(MINUTE_16K);
+const stereo48 = noise(MINUTE_48K * 2);
+const mono48 = noise(MINUTE_48K);
+const w = wasmKernels;
+let sink = 0;                                                     // keeps results observable
+
+const cases: Case[] = [
+  (() => {
+    const f = frames(mono16, 1600);                               // 100 ms frames — the gates' grain
+    return {
+      kernel: "rms", shape: "16k mono · 100 ms frames",
+      js: () => { for (const x of f) sink += reference.sumSquares(x); },
+      wasm: w && (() => { for (const x of f) sink += w.sumSquares(x); }),
+    };
+  })(),
+  (() => {
+    const f = frames(mono16, 16000 * 5);                          // 5 s STT windows
+    const out = new Int16Array(16000 * 5);
+    return {
+      kernel: "floatToInt16", shape: "16k mono · 5 s windows",
+      js: () => { for (const x of f) sink += reference.floatToInt16(x, out)[0]; },
+      wasm: w && (() => { for (const x of f) sink += w.floatToInt16(x, out)[0]; }),
+    };
+  })(),
+  (() => {
+    const f = frames(stereo48, 480 * 2 * 2);                      // 20 ms stereo frames
+    const out = new Float32Array(960);
+    return {
+      kernel: "downmix", shape: "48k stereo · 20 ms frames",
+      js: () => { for (const x of f) sink += reference.downmix(x, 2, out)[0]; },
+      wasm: w && (() => { for (const x of f) sink += w.downmix2(x, out)[0]; }),
+    };
+  })(),
+  (() => {
+    const h = DECIMATE3_TAPS;
+    const f = frames(mono48, 960).map((x) => {                    // 20 ms frames + the carried history
+      const withHist = new Float32Array(h.length - 1 + x.length);
+      withHist.set(x, h.length - 1);
+      return withHist;
+    });
+    const out = new Float32Array(320);
+    return {
+      kernel: "resample48kTo16k", shape: "48k mono · 20 ms frames",
+      js: () => { for (const x of f) sink += reference.firDecimate3(x, h, out)[0]; },
+      wasm: w && (() => { for (const x of f) sink += w.firDecimate3(x, h, out)[0]; }),
+    };
+  })(),
+];
+
+const rows = cases.map((c) => {
+  const js = timeMs(c.js);
+  const wasm = c.wasm ? timeMs(c.wasm) : null;
+  return { kernel: c.kernel, shape: c.shape, jsMsPerBotMin: js, wasmMsPerBotMin: wasm, speedup: wasm ? js / wasm : null };
+});
+
+if (process.argv.includes("--json")) {
+  console.log(JSON.stringify({ backend: w ? "wasm-simd" : "js", rounds: ROUNDS, rows }));
+} else {
+  console.log(`audio-kernels — CPU ms per bot-minute of audio (median of ${ROUNDS})${w ? "" : " — no WASM SIMD on this host"}`);
+  const pad = (s: string, n: number) => s.padEnd(n);
+  console.log(`  ${pad("kernel", 18)}${pad("shape", 28)}${pad("js", 10)}${pad("wasm", 10)}speedup`);
+  for (const r of rows) {
+    console.log(`  ${pad(r.kernel, 18)}${pad(r.shape, 28)}${pad(r.jsMsPerBotMin.toFixed(2), 10)}` +
+      `${pad(r.wasmMsPerBotMin === null ? "—" : r.wasmMsPerBotMin.toFixed(2), 10)}${r.speedup === null ? "—" : r.speedup.toFixed(2) + "×"}`);
+  }
+}
+if (Number.isNaN(sink)) console.log("");                          // never true; defeats dead-code elimination
@@ -0,0 +1,88 @@
+/**
+ * @vexa/audio-kernels — the per-sample audio hot loops, once.
+ *
+ * Energy/RMS (the silence gates), Float32 → Int16 quantization (the STT upload
+ * encode), interleaved downmix and 48 kHz → 16 kHz decimation run on every frame
+ * for every speaker on every bot. Each is a WASM SIMD kernel when the host has
+ * WASM SIMD, and the JS reference kernel otherwise — the two are bit-identical
+ * (src/kernels.test.ts), so the backend never changes a transcript or a gate
+ * decision. `kernelBackend` says which one loaded; `src/bench.ts` measures both.
+ *
+ * Pure + zero-dep.
+ */
+import * as ref from './reference.js';
+import { loadWasmKernels } from './wasm.js';
+
+export { quantize, DECIMATE3_TAPS } from './reference.js';
+
+const wasm = loadWasmKernels();
+
+/** Which implementation serves the kernels in this process. */
+export const kernelBackend: 'wasm-simd' | 'js' = wasm ? 'wasm-simd' : 'js';
+
+/** Below this many samples the copy into linear memory costs more than the loop. */
+const WASM_MIN_SAMPLES = 64;
+
+/** Σ x² over the window (f64). */
+export function sumSquares(x: Float32Array): number {
+  return wasm && x.length >= WASM_MIN_SAMPLES ? wasm.sumSquares(x) : ref.sumSquares(x);
+}
+
+/** Root-mean-square energy of a PCM window in [-1, 1]; 0 for an empty window. */
+export function rms(x: Float32Array): number {
+  return x.length === 0 ? 0 : Math.sqrt(sumSquares(x) / x.length);
+}
+
+/** Float32 [-1, 1] → Int16 PCM through `quantize`. Writes into `out` when given. */
+export function floatToInt16(x: Float32Array, out: Int16Array = new Int16Array(x.length)): Int16Array {
+  if (out.length < x.length) throw new RangeError(`floatToInt16: out holds ${out.length} < ${x.length} samples`);
+  return wasm && x.length >= WASM_MIN_SAMPLES ? wasm.floatToInt16(x, out) : ref.floatToInt16(x, out);
+}
+
+/** Interleaved `channels`-channel frames → mono (the per-frame mean). */
+export function downmix(interleaved: Float32Array, channels: number): Float32Array {
+  if (!Number.isInteger(channels) || channels < 1) throw new RangeError(`downmix: bad channel count ${channels}`);
+  const out = new Float32Array(Math.floor(interleaved.length / channels));
+  if (channels === 1) { out.set(interleaved.subarray(0, out.length)); return out; }
+  return wasm && channels === 2 && out.length >= WASM_MIN_SAMPLES ? wasm.downmix2(interleaved, out) : ref.downmix(interleaved, channels, out);
+}
+
+/**
+ * Streaming 48 kHz → 16 kHz decimator: the low-pass FIR (DECIMATE3_TAPS) evaluated at
+ * every third input sample. Carries its filter history across `push` calls, so
+ * feeding a stream in frames yields exactly the samples one whole-stream call would;
+ * output lags input by the filter's group delay (23.5 input samples ≈ 0.5 ms).
+ */
+export class Downsampler48to16 {
+  private hist = new Float32Array(ref.DECIMATE3_TAPS.length - 1);
+
+  push(x48k: Float32Array): Float32Array {
+    const h = ref.DECIMATE3_TAPS;
+    const input = new Float32Array(this.hist.length + x48k.length);
+    input.set(this.hist);
+    input.set(x48k, this.hist.length);
+    const n = input.length >= h.length ? Math.floor((input.length - h.length) / 3) + 1 : 0;
+    const out = new Float32Array(n);
+    if (n > 0) {
+      if (wasm && n >= WASM_MIN_SAMPLES) wasm.firDecimate3(input, h, out);
+      else ref.firDecimate3(input, h, out);
+    }
+    this.hist = input.slice(3 * n);
+    return out;
+  }
+
+  reset(): void {
+    this.hist = new Float32Array(ref.DECIMATE3_TAPS.length - 1);
+  }
+}
+
+/** One-shot 48 kHz → 16 kHz (a fresh Downsampler48to16 over the whole buffer). */
+export function resample48kTo16k(x48k: Float32Array): Float32Array {
+  return new Downsampler48to16().push(x48k);
+}
+
+/** Both implementations, unthresholded — for benchmarks and A/B checks
+ *  (`wasmKernels` is null on a host without WASM SIMD). */
+export const reference = ref;
+export const wasmKernels = wasm;
+export type { WasmKernels } from './wasm.js';
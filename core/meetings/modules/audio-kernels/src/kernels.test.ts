@@ -0,0 +1,97 @@
+/**
+ * Audio-kernels golden — the WASM SIMD kernels are bit-identical to the JS reference
+ * (so the backend can never move a gate decision or an uploaded sample), the quantizer
+ * is the upload codec's, and the decimator is a real low-pass that streams exactly.
+ * Run: npm test  (or npx tsx src/kernels.test.ts)
+ */
+import {
+  kernelBackend, wasmKernels, reference, quantize,
+  sumSquares, rms, floatToInt16, downmix, Downsampler48to16, resample48kTo16k, DECIMATE3_TAPS,
+} from "./index.js";
+
+let failed = 0;
+const check = (name: string, cond: boolean, detail = "") => {
+  console.log(`  ${cond ? "✅" : "❌"} ${name}${cond ? "" : "  — " + detail}`);
+  if (!cond) failed++;
+};
+
+/** Deterministic noise in [-amp, amp] (LCG), so failures reproduce. */
+function noise(n: number, amp = 1, seed = 7): Float32Array {
+  let s = seed >>> 0;
+  return Float32Array.from({ length: n }, () => {
+    s = (Math.imul(s, 1664525) + 1013904223) >>> 0;
+    return amp * (s / 2 ** 31 - 1);
+  });
+}
+const tone = (hz: number, n: number, sr = 48000) => Float32Array.from({ length: n }, (_, i) => Math.sin((2 * Math.PI * hz * i) / sr));
+const sameBits = (a: ArrayLike<number>, b: ArrayLike<number>) =>
+  a.length === b.length && Array.prototype.every.call(a, (v: number, i: number) => Object.is(v, b[i]));
+
+console.log(`  backend: ${kernelBackend}`);
+
+// ── the quantizer is the upload codec's (clamped, asymmetric, rounded) ─────────
+{
+  const toInt16 = (x: number) => { const s = Math.max(-1, Math.min(1, x)); return Math.round(s < 0 ? s * 0x8000 : s * 0x7FFF); };
+  const edges = [0, -0, 1, -1, 1.5, -1.5, 0.5, -0.5, 1 / 65534, -1 / 65536, 3 / 65534, -3 / 65536, 1e-30, NaN, Infinity, -Infinity];
+  const tiled = Float32Array.from({ length: 80 }, (_, i) => edges[i % edges.length]);   // ≥ the WASM cut-over
+  const got = floatToInt16(tiled);
+  check("edge values quantize like encodeWav's toInt16 (clamp, ±0, halves, NaN → 0)",
+    Array.from(tiled).every((v, i) => got[i] === (Number.isNaN(v) ? 0 : toInt16(v))), JSON.stringify(Array.from(got.subarray(0, 16))));
+  check("anchors: ±1 → 32767/−32768, ½ → 16384, NaN → 0",
+    got[2] === 32767 && got[3] === -32768 && got[6] === 16384 && got[13] === 0);
+  check("quantize() is the same mapping", edges.every((v) => Number.isNaN(v) || quantize(v) === toInt16(v)));
+}
+
+if (wasmKernels) {
+  // Lengths cover the SIMD body, the scalar tail, and both at once.
+  const lengths = [1, 3, 4, 7, 8, 9, 63, 64, 257, 16000, 16003];
+  const inputs = lengths.map((n, i) => noise(n, 1.2, 11 + i));       // past ±1 to exercise the clamp
+
+  check("sumSquares: WASM ≡ reference (bit-exact)",
+    inputs.every((x) => Object.is(wasmKernels!.sumSquares(x), reference.sumSquares(x))));
+  check("floatToInt16: WASM ≡ reference (bit-exact)",
+    inputs.every((x) => sameBits(wasmKernels!.floatToInt16(x, new Int16Array(x.length)), reference.floatToInt16(x, new Int16Array(x.length)))));
+  check("downmix (stereo): WASM ≡ reference (bit-exact)",
+    inputs.every((x) => {
+      const out = () => new Float32Array(x.length >> 1);
+      return sameBits(wasmKernels!.downmix2(x, out()), reference.downmix(x, 2, out()));
+    }));
+  check("decimate: WASM ≡ reference (bit-exact)",
+    inputs.filter((x) => x.length >= DECIMATE3_TAPS.length).every((x) => {
+      const out = () => new Float32Array(Math.floor((x.length - DECIMATE3_TAPS.length) / 3) + 1);
+      return sameBits(wasmKernels!.firDecimate3(x, DECIMATE3_TAPS, out()), reference.firDecimate3(x, DECIMATE3_TAPS, out()));
+    }));
+} else {
+  console.log("  ⏭  no WASM SIMD on this host — JS reference only");
+}
+
+// ── the public surface ────────────────────────────────────────────────────────
+{
+  check("rms(empty) === 0", rms(new Float32Array(0)) === 0);
+  check("rms(constant 0.1) ≈ 0.1", Math.abs(rms(new Float32Array(16000).fill(0.1)) - 0.1) < 1e-7);
+  const x = noise(1000);
+  let direct = 0;
+  for (const v of x) direct += v * v;
+  check("sumSquares matches a direct pass", Math.abs(sumSquares(x) - direct) < 1e-9 * direct);
+  check("downmix: mono is a copy, 3-ch is the mean",
+    sameBits(downmix(Float32Array.of(1, 2), 1), [1, 2]) && sameBits(downmix(Float32Array.of(0.25, 0.5, 0.75, 1, 1, 1), 3), [0.5, 1]));
+}
+
+// ── decimator: a low-pass that streams exactly ───────────────────────────────
+{
+  const h = DECIMATE3_TAPS;
+  check("taps: 48, a multiple of four, unity DC gain", h.length === 48 && Math.abs(h.reduce((a, b) => a + b, 0) - 1) < 1e-6);
+  const gain = (hz: number) => rms(resample48kTo16k(tone(hz, 48000)).subarray(100)) / Math.SQRT1_2;
+  check("1 kHz passes (≈ unity)", Math.abs(gain(1000) - 1) < 0.01, String(gain(1000)));
+  check("12 kHz (aliases onto 4 kHz at 16k) is attenuated > 40 dB", gain(12000) < 0.01, String(gain(12000)));
+  const x = noise(48000 + 17);
+  const whole = resample48kTo16k(x);
+  const ds = new Downsampler48to16();
+  const parts: number[] = [];
+  for (let off = 0; off < x.length; off += 441) parts.push(...ds.push(x.subarray(off, off + 441)));
+  check("streamed in 441-sample frames ≡ one whole-stream call", sameBits(parts, whole), `${parts.length} vs ${whole.length}`);
+  check("output is a third of the input", whole.length === Math.ceil(x.length / 3), String(whole.length));
+}
+
+if (failed) { console.error(`\n❌ audio-kernels: ${failed} checks FAILED.`); process.exit(1); }
+console.log(`\n✅ audio-kernels: all checks pass — ${kernelBackend} kernels bit-identical to the JS reference.`);
@@ -0,0 +1,82 @@
+/**
+ * The JS kernels — the fallback AND the definition. Each one fixes its exact
+ * arithmetic (accumulation order, rounding points) so the WASM SIMD build in
+ * wasm.ts reproduces it bit for bit; `kernels.test.ts` pins the two together.
+ */
+
+/** Float32 [-1, 1] → Int16 (clamped, asymmetric scale, rounded) — the one quantizer
+ *  (the same mapping the Whisper upload codec and the recording brick use). */
+export function quantize(x: number): number {
+  const s = Math.max(-1, Math.min(1, x));
+  return Math.round(s < 0 ? s * 0x8000 : s * 0x7FFF);
+}
+
+/** Sum of squares in four interleaved f64 lanes (sample i → lane i % 4) plus a
+ *  scalar tail, combined lane 0→3 then tail — the SIMD reduction order. */
+export function sumSquares(x: Float32Array): number {
+  const end4 = x.length & ~3;
+  let s0 = 0, s1 = 0, s2 = 0, s3 = 0, t = 0;
+  for (let i = 0; i < end4; i += 4) {
+    s0 += x[i] * x[i];
+    s1 += x[i + 1] * x[i + 1];
+    s2 += x[i + 2] * x[i + 2];
+    s3 += x[i + 3] * x[i + 3];
+  }
+  for (let i = end4; i < x.length; i++) t += x[i] * x[i];
+  return s0 + s1 + s2 + s3 + t;
+}
+
+export function floatToInt16(x: Float32Array, out: Int16Array): Int16Array {
+  for (let i = 0; i < x.length; i++) out[i] = quantize(x[i]);
+  return out;
+}
+
+/** Interleaved frames → mono mean. Stereo is (l + r) · 0.5, rounded once to f32. */
+export function downmix(x: Float32Array, channels: number, out: Float32Array): Float32Array {
+  if (channels === 2) {
+    for (let i = 0; i < out.length; i++) out[i] = (x[2 * i] + x[2 * i + 1]) * 0.5;
+    return out;
+  }
+  for (let i = 0; i < out.length; i++) {
+    let s = 0;
+    for (let c = 0; c < channels; c++) s += x[i * channels + c];
+    out[i] = s / channels;
+  }
+  return out;
+}
+
+/** FIR taps of the 48 kHz → 16 kHz decimator: a Blackman-windowed sinc low-pass at
+ *  7 kHz (under the 8 kHz output Nyquist), unity DC gain, rounded to f32. A multiple
+ *  of four long so the SIMD dot product has no tail. */
+export const DECIMATE3_TAPS: Float32Array = (() => {
+  const n = 48;
+  const fc = 7000 / 48000;
+  const h = new Float64Array(n);
+  let sum = 0;
+  for (let j = 0; j < n; j++) {
+    const m = j - (n - 1) / 2;
+    const sinc = m === 0 ? 2 * fc : Math.sin(2 * Math.PI * fc * m) / (Math.PI * m);
+    const w = 0.42 - 0.5 * Math.cos((2 * Math.PI * j) / (n - 1)) + 0.08 * Math.cos((4 * Math.PI * j) / (n - 1));
+    h[j] = sinc * w;
+    sum += h[j];
+  }
+  return Float32Array.from(h, (v) => v / sum);
+})();
+
+/** y[k] = Σ_j h[j] · x[3k + j] in f32, four lanes (tap j → lane j % 4), combined
+ *  (lane0 + lane1) + (lane2 + lane3) — the f32x4 dot product's exact rounding. */
+export function firDecimate3(x: Float32Array, h: Float32Array, out: Float32Array): Float32Array {
+  const f = Math.fround;
+  for (let k = 0; k < out.length; k++) {
+    const b = 3 * k;
+    let a0 = 0, a1 = 0, a2 = 0, a3 = 0;
+    for (let j = 0; j < h.length; j += 4) {
+      a0 = f(a0 + f(x[b + j] * h[j]));
+      a1 = f(a1 + f(x[b + j + 1] * h[j + 1]));
+      a2 = f(a2 + f(x[b + j + 2] * h[j + 2]));
+      a3 = f(a3 + f(x[b + j + 3] * h[j + 3]));
+    }
+    out[k] = f(f(a0 + a1) + f(a2 + a3));
+  }
+  return out;
+}
@@ -0,0 +1,263 @@
+/**
+ * The WASM SIMD build of the reference kernels, assembled at load time.
+ *
+ * There is no wasm toolchain in the build (and this brick stays zero-dep), so the
+ * module is emitted here from a minimal bytecode builder: four exported functions
+ * over one exported linear memory, each a v128 main loop plus a scalar tail that
+ * follows reference.ts's arithmetic exactly. Hosts without WASM SIMD (or a
+ * validation failure) get `null` and the caller stays on the JS kernels.
+ */
+
+// ── encoding ────────────────────────────────────────────────────────────────
+const I32 = 0x7f, F64 = 0x7c, V128 = 0x7b;
+const uleb = (n: number): number[] => {
+  const out: number[] = [];
+  do {
+    let b = n & 0x7f;
+    n >>>= 7;
+    if (n !== 0) b |= 0x80;
+    out.push(b);
+  } while (n !== 0);
+  return out;
+};
+const sleb = (n: number): number[] => {
+  const out: number[] = [];
+  for (;;) {
+    const b = n & 0x7f;
+    n >>= 7;
+    if ((n === 0 && (b & 0x40) === 0) || (n === -1 && (b & 0x40) !== 0)) { out.push(b); return out; }
+    out.push(b | 0x80);
+  }
+};
+const f32Bytes = (v: number) => [...new Uint8Array(Float32Array.of(v).buffer)];
+const f64Bytes = (v: number) => [...new Uint8Array(Float64Array.of(v).buffer)];
+const vec = (items: number[][]): number[] => [...uleb(items.length), ...items.flat()];
+const section = (id: number, body: number[]) => [id, ...uleb(body.length), ...body];
+const name = (s: string) => [...uleb(s.length), ...Array.from(s, (c) => c.charCodeAt(0))];
+
+// ── instructions ────────────────────────────────────────────────────────────
+const simd = (op: number, ...imm: number[]) => [0xfd, ...uleb(op), ...imm];
+const mem0 = [0, 0];                                        // memarg: align hint 0, offset 0
+const op = {
+  block: [0x02, 0x40], loop: [0x03, 0x40], end: [0x0b],
+  br: (d: number) => [0x0c, d], brIf: (d: number) => [0x0d, d],
+  get: (i: number) => [0x20, i], set: (i: number) => [0x21, i], tee: (i: number) => [0x22, i],
+  i32: (v: number) => [0x41, ...sleb(v)], f32: (v: number) => [0x43, ...f32Bytes(v)], f64: (v: number) => [0x44, ...f64Bytes(v)],
+  i32Add: [0x6a], i32Mul: [0x6c], i32And: [0x71], i32Shl: [0x74], i32GeS: [0x4e],
+  f32Load: (off = 0) => [0x2a, 0, ...uleb(off)], f32Store: [0x38, 0, 0], i32Store16: [0x3b, 0, 0],
+  f32Add: [0x92], f32Mul: [0x94],
+  f64Add: [0xa0], f64Mul: [0xa2], f64Min: [0xa4], f64Max: [0xa5], f64Lt: [0x63], f64Floor: [0x9c],
+  f64PromoteF32: [0xbb], i32TruncSatF64S: [0xfc, 0x02], select: [0x1b],
+  v128Load: (off = 0) => simd(0x00, 0, ...uleb(off)), v128Store: simd(0x0b, ...mem0),
+  v128Zero: simd(0x0c, ...new Array(16).fill(0)),
+  shuffle: (lanes: number[]) => simd(0x0d, ...lanes),
+  f32x4Splat: simd(0x13), f64x2Splat: simd(0x14),
+  f32x4Lane: (l: number) => simd(0x1f, l), f64x2Lane: (l: number) => simd(0x21, l),
+  f64x2Lt: simd(0x49), bitselect: simd(0x52),
+  f64x2PromoteLow: simd(0x5f), f64x2Floor: simd(0x75),
+  i16x8NarrowS: simd(0x85),
+  f32x4Add: simd(0xe4), f32x4Mul: simd(0xe6),
+  f64x2Add: simd(0xf0), f64x2Mul: simd(0xf2), f64x2Min: simd(0xf4), f64x2Max: simd(0xf5),
+  i32x4TruncSatF64x2SZero: simd(0xfc),
+};
+const range = (a: number, b: number) => Array.from({ length: b - a }, (_, i) => a + i);
+/** Bytes 8..15 then 0..7 — the high two f32 lanes moved low, for promote_low. */
+const HI_TO_LO = [...range(8, 16), ...range(0, 8)];
+
+/** `while (i < bound) { body; i += step }` */
+function forLoop(i: number, bound: number, step: number, body: number[]): number[] {
+  return [
+    ...op.block, ...op.loop,
+    ...op.get(i), ...op.get(bound), ...op.i32GeS, ...op.brIf(1),
+    ...body,
+    ...op.get(i), ...op.i32(step), ...op.i32Add, ...op.set(i),
+    ...op.br(0), ...op.end, ...op.end,
+  ];
+}
+/** base + (i << shift) */
+const addr = (base: number, i: number, shift: number) =>
+  [...op.get(base), ...op.get(i), ...op.i32(shift), ...op.i32Shl, ...op.i32Add];
+const fn = (locals: Array<[number, number]>, body: number[]) => {
+  const code = [...vec(locals.map(([n, t]) => [...uleb(n), t])), ...body, ...op.end];
+  return [...uleb(code.length), ...code];
+};
+
+// sum_squares(p, n) -> f64.  locals: 2 i, 3 end4, 4 v, 5 acc01, 6 acc23, 7 tail, 8 x, 9 tmp
+const sumSquares = fn([[2, I32], [3, V128], [2, F64], [1, V128]], [
+  ...op.get(1), ...op.i32(-4), ...op.i32And, ...op.set(3),
+  ...forLoop(2, 3, 4, [
+    ...addr(0, 2, 2), ...op.v128Load(), ...op.set(4),
+    ...op.get(4), ...op.f64x2PromoteLow, ...op.tee(9), ...op.get(9), ...op.f64x2Mul,
+    ...op.get(5), ...op.f64x2Add, ...op.set(5),
+    ...op.get(4), ...op.get(4), ...op.shuffle(HI_TO_LO), ...op.f64x2PromoteLow, ...op.tee(9), ...op.get(9), ...op.f64x2Mul,
+    ...op.get(6), ...op.f64x2Add, ...op.set(6),
+  ]),
+  ...forLoop(2, 1, 1, [
+    ...addr(0, 2, 2), ...op.f32Load(), ...op.f64PromoteF32, ...op.tee(8), ...op.get(8), ...op.f64Mul,
+    ...op.get(7), ...op.f64Add, ...op.set(7),
+  ]),
+  ...op.get(5), ...op.f64x2Lane(0), ...op.get(5), ...op.f64x2Lane(1), ...op.f64Add,
+  ...op.get(6), ...op.f64x2Lane(0), ...op.f64Add, ...op.get(6), ...op.f64x2Lane(1), ...op.f64Add,
+  ...op.get(7), ...op.f64Add,
+]);
+
+// to_int16(src, dst, n).  locals: 3 i, 4 end8, 5 v, 6 a, 7 b, 8 -1, 9 1, 10 32767, 11 32768,
+// 12 0.5, 13 zero, 14 tmp, 15 x (f64)
+const Q = [                                                  // f64x2 on stack → i32x4 [q0, q1, 0, 0]
+  ...op.get(8), ...op.f64x2Max, ...op.get(9), ...op.f64x2Min, ...op.tee(14),
+  ...op.get(11), ...op.get(10), ...op.get(14), ...op.get(13), ...op.f64x2Lt, ...op.bitselect,
+  ...op.f64x2Mul, ...op.get(12), ...op.f64x2Add, ...op.f64x2Floor, ...op.i32x4TruncSatF64x2SZero,
+];
+const quad = (off: number) => [                              // 4 samples at src + 4i + off → i32x4
+  ...addr(0, 3, 2), ...op.v128Load(off), ...op.set(5),
+  ...op.get(5), ...op.f64x2PromoteLow, ...Q,
+  ...op.get(5), ...op.get(5), ...op.shuffle(HI_TO_LO), ...op.f64x2PromoteLow, ...Q,
+  ...op.shuffle([...range(0, 8), ...range(16, 24)]),
+];
+const toInt16 = fn([[2, I32], [10, V128], [1, F64]], [
+  ...op.get(2), ...op.i32(-8), ...op.i32And, ...op.set(4),
+  ...op.f64(-1), ...op.f64x2Splat, ...op.set(8), ...op.f64(1), ...op.f64x2Splat, ...op.set(9),
+  ...op.f64(0x7fff), ...op.f64x2Splat, ...op.set(10), ...op.f64(0x8000), ...op.f64x2Splat, ...op.set(11),
+  ...op.f64(0.5), ...op.f64x2Splat, ...op.set(12),
+  ...forLoop(3, 4, 8, [
+    ...quad(0), ...op.set(6), ...quad(16), ...op.set(7),
+    ...addr(1, 3, 1), ...op.get(6), ...op.get(7), ...op.i16x8NarrowS, ...op.v128Store,
+  ]),
+  ...forLoop(3, 2, 1, [
+    ...addr(1, 3, 1),
+    ...addr(0, 3, 2), ...op.f32Load(), ...op.f64PromoteF32, ...op.f64(-1), ...op.f64Max, ...op.f64(1), ...op.f64Min, ...op.tee(15),
+    ...op.f64(0x8000), ...op.f64(0x7fff), ...op.get(15), ...op.f64(0), ...op.f64Lt, ...op.select,
+    ...op.f64Mul, ...op.f64(0.5), ...op.f64Add, ...op.f64Floor, ...op.i32TruncSatF64S, ...op.i32Store16,
+  ]),
+]);
+
+// downmix2(src, dst, frames).  locals: 3 i, 4 end4, 5 a, 6 b, 7 half
+const downmix2 = fn([[2, I32], [3, V128]], [
+  ...op.get(2), ...op.i32(-4), ...op.i32And, ...op.set(4),
+  ...op.f32(0.5), ...op.f32x4Splat, ...op.set(7),
+  ...forLoop(3, 4, 4, [
+    ...addr(1, 3, 2),
+    ...addr(0, 3, 3), ...op.v128Load(), ...op.set(5),
+    ...addr(0, 3, 3), ...op.v128Load(16), ...op.set(6),
+    ...op.get(5), ...op.get(6), ...op.shuffle([...range(0, 4), ...range(8, 12), ...range(16, 20), ...range(24, 28)]),
+    ...op.get(5), ...op.get(6), ...op.shuffle([...range(4, 8), ...range(12, 16), ...range(20, 24), ...range(28, 32)]),
+    ...op.f32x4Add, ...op.get(7), ...op.f32x4Mul, ...op.v128Store,
+  ]),
+  ...forLoop(3, 2, 1, [
+    ...addr(1, 3, 2),
+    ...addr(0, 3, 3), ...op.f32Load(), ...addr(0, 3, 3), ...op.f32Load(4), ...op.f32Add,
+    ...op.f32(0.5), ...op.f32Mul, ...op.f32Store,
+  ]),
+]);
+
+// fir_decimate3(src, taps, ntaps, dst, nout).  locals: 5 k, 6 j, 7 base, 8 acc
+const firDecimate3 = fn([[3, I32], [1, V128]], [
+  ...forLoop(5, 4, 1, [
+    ...op.get(0), ...op.get(5), ...op.i32(12), ...op.i32Mul, ...op.i32Add, ...op.set(7),
+    ...op.v128Zero, ...op.set(8),
+    ...op.i32(0), ...op.set(6),
+    ...forLoop(6, 2, 4, [
+      ...op.get(8), ...addr(7, 6, 2), ...op.v128Load(), ...addr(1, 6, 2), ...op.v128Load(),
+      ...op.f32x4Mul, ...op.f32x4Add, ...op.set(8),
+    ]),
+    ...addr(3, 5, 2),
+    ...op.get(8), ...op.f32x4Lane(0), ...op.get(8), ...op.f32x4Lane(1), ...op.f32Add,
+    ...op.get(8), ...op.f32x4Lane(2), ...op.get(8), ...op.f32x4Lane(3), ...op.f32Add, ...op.f32Add,
+    ...op.f32Store,
+  ]),
+]);
+
+const BYTES = new Uint8Array([
+  0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,
+  ...section(1, vec([
+    [0x60, ...vec([[I32], [I32]]), ...vec([[F64]])],
+    [0x60, ...vec([[I32], [I32], [I32]]), 0x00],
+    [0x60, ...vec([[I32], [I32], [I32], [I32], [I32]]), 0x00],
+  ])),
+  ...section(3, vec([[0], [1], [1], [2]])),
+  ...section(5, vec([[0x00, 1]])),
+  ...section(7, vec([
+    [...name('memory'), 0x02, 0],
+    [...name('sum_squares'), 0x00, 0],
+    [...name('to_int16'), 0x00, 1],
+    [...name('downmix2'), 0x00, 2],
+    [...name('fir_decimate3'), 0x00, 3],
+  ])),
+  ...section(10, [...uleb(4), ...sumSquares, ...toInt16, ...downmix2, ...firDecimate3]),
+]);
+
+// ── instance ────────────────────────────────────────────────────────────────
+interface WasmApi {
+  validate(bytes: Uint8Array): boolean;
+  Module: new (bytes: Uint8Array) => object;
+  Instance: new (module: object) => { exports: Record<string, unknown> };
+}
+interface Exports {
+  memory: { buffer: ArrayBuffer; grow(pages: number): number };
+  sum_squares(p: number, n: number): number;
+  to_int16(src: number, dst: number, n: number): void;
+  downmix2(src: number, dst: number, frames: number): void;
+  fir_decimate3(src: number, taps: number, ntaps: number, dst: number, nout: number): void;
+}
+
+/** The SIMD kernels over one instance. Inputs are copied into linear memory and
+ *  results copied out — the kernels never alias caller arrays. */
+export interface WasmKernels {
+  sumSquares(x: Float32Array): number;
+  floatToInt16(x: Float32Array, out: Int16Array): Int16Array;
+  downmix2(x: Float32Array, out: Float32Array): Float32Array;
+  firDecimate3(x: Float32Array, h: Float32Array, out: Float32Array): Float32Array;
+}
+
+const align16 = (n: number) => (n + 15) & ~15;
+
+export function loadWasmKernels(): WasmKernels | null {
+  const wa = (globalThis as { WebAssembly?: WasmApi }).WebAssembly;
+  if (!wa) return null;
+  let ex: Exports;
+  try {
+    if (!wa.validate(BYTES)) return null;
+    ex = new wa.Instance(new wa.Module(BYTES)).exports as unknown as Exports;
+  } catch {
+    return null;
+  }
+  /** Make the memory at least `bytes` long; returns it (growth replaces the buffer). */
+  const reserve = (bytes: number): ArrayBuffer => {
+    const have = ex.memory.buffer.byteLength;
+    if (bytes > have) ex.memory.grow(Math.ceil((bytes - have) / 65536));
+    return ex.memory.buffer;
+  };
+  return {
+    sumSquares(x) {
+      const buf = reserve(x.length * 4);
+      new Float32Array(buf, 0, x.length).set(x);
+      return ex.sum_squares(0, x.length);
+    },
+    floatToInt16(x, out) {
+      const dst = align16(x.length * 4);
+      const buf = reserve(dst + align16(x.length * 2));
+      new Float32Array(buf, 0, x.length).set(x);
+      ex.to_int16(0, dst, x.length);
+      out.set(new Int16Array(buf, dst, x.length));
+      return out;
+    },
+    downmix2(x, out) {
+      const dst = align16(out.length * 8);
+      const buf = reserve(dst + out.length * 4);
+      new Float32Array(buf, 0, out.length * 2).set(x.subarray(0, out.length * 2));
+      ex.downmix2(0, dst, out.length);
+      out.set(new Float32Array(buf, dst, out.length));
+      return out;
+    },
+    firDecimate3(x, h, out) {
+      const src = align16(h.length * 4);
+      const dst = src + align16(x.length * 4);
+      const buf = reserve(dst + out.length * 4);
+      new Float32Array(buf, 0, h.length).set(h);
+      new Float32Array(buf, src, x.length).set(x);
+      ex.fir_decimate3(src, 0, h.length, dst, out.length);
+      out.set(new Float32Array(buf, dst, out.length));
+      return out;
+    },
+  };
+}
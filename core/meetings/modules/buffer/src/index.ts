@@ -9,6 +9,11 @@
  * never strands pending text.
  *
  * Pure + deterministic; pinned by the confirm-loop golden (src/local-agreement.test.ts).
+ *
+ * PcmRing is the audio window the drivers cut those submissions from: a power-of-two
+ * mirrored ring with zero-copy window views, O(1) trimming and running-sum RMS
+ * (src/pcm-ring.test.ts).
  */
 export { localAgreement, words, longestCommonWordPrefix, commonWordPrefix } from './local-agreement.js';
 export type { AgreementSegment, AgreementResult } from './local-agreement.js';
+export { PcmRing } from './pcm-ring.js';
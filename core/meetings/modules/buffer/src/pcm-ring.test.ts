@@ -0,0 +1,93 @@
+/**
+ * PcmRing golden — the shared audio window: contiguous views across the wrap,
+ * O(1) trim, running-sum RMS ≡ a direct pass, growth that never drops retained audio.
+ * Run: npm test  (or npx tsx src/pcm-ring.test.ts)
+ */
+import { PcmRing } from "./index.js";
+
+let failed = 0;
+const check = (name: string, cond: boolean, detail = "") => {
+  console.log(`  ${cond ? "✅" : "❌"} ${name}${cond ? "" : "  — " + detail}`);
+  if (!cond) failed++;
+};
+
+/** Deterministic PCM: sample p = a small sine of its absolute position. */
+const sample = (p: number) => Math.fround(0.5 * Math.sin(p * 0.013) + 0.001 * (p % 7));
+const frame = (at: number, n: number) => Float32Array.from({ length: n }, (_, i) => sample(at + i));
+const same = (v: Float32Array, from: number) => v.every((x, i) => x === sample(from + i));
+const directRms = (from: number, to: number) => {
+  let s = 0;
+  for (let p = from; p < to; p++) s += sample(p) * sample(p);
+  return to > from ? Math.sqrt(s / (to - from)) : 0;
+};
+const close = (a: number, b: number) => Math.abs(a - b) <= 1e-9 + 1e-6 * Math.abs(b);
+
+// ── capacity + contiguous views across the wrap ──────────────────────────────
+{
+  const ring = new PcmRing(1000);
+  check("capacity rounds up to a power of two", ring.capacity === 1024, String(ring.capacity));
+  let pos = 0;
+  for (let i = 0; i < 40; i++) {                       // ~3 laps of 1024, 20ms-ish frames
+    ring.push(frame(pos, 97)); pos += 97;
+    ring.trimTo(pos - 900);
+  }
+  const v = ring.view(pos - 900, pos);
+  check("a view spanning the wrap is one contiguous array", v.length === 900 && same(v, pos - 900));
+  check("view is zero-copy (aliases the ring)", v.buffer === ring.view(pos - 10, pos).buffer);
+  check("view clamps to the retained range", ring.view(0, pos + 50).length === 900);
+  check("capacity held steady under trimming (no growth)", ring.capacity === 1024, String(ring.capacity));
+}
+
+// ── RMS from running sums ≡ a direct pass ────────────────────────────────────
+{
+  const ring = new PcmRing(4096);
+  let pos = 0;
+  for (let i = 0; i < 120; i++) { ring.push(frame(pos, 160)); pos += 160; ring.trimTo(pos - 4000); }
+  const windows: Array<[number, number]> = [
+    [pos - 4000, pos], [pos - 3999, pos - 1], [pos - 300, pos - 10], [pos - 1024, pos - 512], [pos - 5, pos],
+  ];
+  check("window RMS matches a direct pass (block edges, partial blocks, short windows)",
+    windows.every(([a, b]) => close(ring.rms(a, b), directRms(a, b))),
+    JSON.stringify(windows.map(([a, b]) => [ring.rms(a, b), directRms(a, b)])));
+  check("empty window → 0", ring.rms(pos, pos) === 0);
+}
+
+// ── truncate: the next push continues there, sums stay exact ─────────────────
+{
+  const ring = new PcmRing(2048);
+  ring.push(frame(0, 1500));
+  ring.truncate(1100);
+  check("truncate drops the tail", ring.end === 1100 && ring.length === 1100);
+  const at = ring.push(frame(1100, 600));
+  check("push continues at the truncation point", at === 1100 && same(ring.view(0, 1700), 0));
+  check("RMS exact after truncate + re-push", close(ring.rms(200, 1700), directRms(200, 1700)));
+  ring.trimTo(1300);
+  ring.truncate(1310);                                  // no block boundary inside [start, pos]
+  ring.push(frame(1310, 700));
+  check("RMS exact after a truncate inside the first block",
+    close(ring.rms(1300, 2010), directRms(1300, 2010)));
+}
+
+// ── growth: a push past capacity keeps every retained sample ─────────────────
+{
+  const ring = new PcmRing(256);
+  ring.push(frame(0, 200));
+  ring.trimTo(50);
+  ring.push(frame(200, 500));                           // retained 650 > 256
+  check("grows to the next power of two", ring.capacity === 1024, String(ring.capacity));
+  check("retained audio survives growth", same(ring.view(50, 700), 50));
+  check("RMS exact across growth", close(ring.rms(50, 700), directRms(50, 700)));
+}
+
+// ── clear: O(1), positions keep counting ─────────────────────────────────────
+{
+  const ring = new PcmRing(512);
+  ring.push(frame(0, 300));
+  ring.clear();
+  check("clear leaves an empty ring at the same position", ring.length === 0 && ring.start === 300);
+  const at = ring.push(frame(300, 100));
+  check("push after clear continues the absolute position", at === 300 && same(ring.view(300, 400), 300));
+}
+
+if (failed) { console.error(`\n❌ pcm-ring: ${failed} checks FAILED.`); process.exit(1); }
+console.log(`\n✅ pcm-ring: all checks pass — contiguous views across the wrap, O(1) trim, running-sum RMS ≡ direct.`);
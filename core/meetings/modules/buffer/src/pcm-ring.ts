@@ -0,0 +1,168 @@
+/**
+ * PcmRing — the shared audio window both lanes cut Whisper submissions from.
+ *
+ * A power-of-two circular Float32 buffer addressed by ABSOLUTE sample position
+ * (samples ever pushed), so callers keep plain integer offsets instead of chunk
+ * lists:
+ *
+ *   - mirrored storage (every sample is written at `p % cap` and `p % cap + cap`),
+ *     so any retained range is ONE contiguous `subarray` view — no copy, no wrap
+ *     split;
+ *   - `trimTo` / `truncate` / `clear` only move the retained bounds — O(1), no
+ *     sample is moved or freed;
+ *   - energy is kept as running sums of squares at BLOCK granularity, so a
+ *     window's RMS costs O(BLOCK) however long the window is (the near-silent
+ *     gates run on every submission).
+ *
+ * A push never overwrites a retained sample: if the retained span would exceed
+ * the capacity the ring doubles (copying the retained span once). Callers bound
+ * memory by trimming; a ring trimmed to a steady window never reallocates.
+ *
+ * View lifetime: a view aliases the ring. It stays valid while its range is
+ * retained; once trimmed (or truncated) past, later pushes may overwrite it —
+ * `slice()` it to keep a copy.
+ */
+
+/** Samples per energy block (power of two). */
+const BLOCK = 256;
+
+function pow2AtLeast(n: number): number {
+  let cap = BLOCK;
+  while (cap < n) cap *= 2;
+  return cap;
+}
+
+export class PcmRing {
+  private cap: number;
+  private buf: Float32Array;
+  /** cum[k % cum.length] = sum of squares of every sample before position k·BLOCK */
+  private cum: Float64Array;
+  /** Sum of squares of every sample before `end` */
+  private total = 0;
+  private head = 0;
+  private tail = 0;
+
+  /** @param capacity samples retained without reallocating (rounded up to a power of two) */
+  constructor(capacity: number) {
+    this.cap = pow2AtLeast(capacity);
+    this.buf = new Float32Array(this.cap * 2);
+    this.cum = new Float64Array((this.cap / BLOCK) * 2);
+  }
+
+  /** Absolute position of the oldest retained sample. */
+  get start(): number { return this.head; }
+  /** Absolute position one past the newest sample. */
+  get end(): number { return this.tail; }
+  /** Retained samples. */
+  get length(): number { return this.tail - this.head; }
+  get capacity(): number { return this.cap; }
+
+  /** Append samples; returns the absolute position of the first one. */
+  push(pcm: Float32Array): number {
+    const at = this.tail;
+    const n = pcm.length;
+    if (n === 0) return at;
+    if (this.length + n > this.cap) this.grow(this.length + n);
+
+    let total = this.total;
+    for (let i = 0; i < n; i++) {
+      const p = at + i;
+      if (p % BLOCK === 0) this.cum[(p / BLOCK) % this.cum.length] = total;
+      total += pcm[i] * pcm[i];
+    }
+    this.total = total;
+
+    const idx = at % this.cap;
+    const first = Math.min(n, this.cap - idx);
+    const lead = pcm.subarray(0, first);
+    this.buf.set(lead, idx);
+    this.buf.set(lead, idx + this.cap);
+    if (first < n) {
+      const rest = pcm.subarray(first);
+      this.buf.set(rest, 0);
+      this.buf.set(rest, this.cap);
+    }
+    this.tail = at + n;
+    return at;
+  }
+
+  /** Zero-copy view of [from, to), clamped to the retained range. */
+  view(from: number, to: number): Float32Array {
+    const a = Math.max(from, this.head);
+    const b = Math.min(to, this.tail);
+    if (b <= a) return this.buf.subarray(0, 0);
+    const s = a % this.cap;
+    return this.buf.subarray(s, s + (b - a));
+  }
+
+  /** Drop every sample before `pos` — O(1). */
+  trimTo(pos: number): void {
+    this.head = Math.min(this.tail, Math.max(this.head, pos));
+  }
+
+  /** Drop every sample at or after `pos` — the next push continues from there. */
+  truncate(pos: number): void {
+    const p = Math.max(this.head, Math.min(this.tail, pos));
+    if (p === this.tail) return;
+    const b = Math.floor(p / BLOCK) * BLOCK;
+    this.total = b >= this.head
+      ? this.cumAt(b) + this.directSum(b, p)
+      : this.total - this.directSum(p, this.tail);
+    this.tail = p;
+  }
+
+  /** Drop everything; positions keep counting from `end`. */
+  clear(): void {
+    this.head = this.tail;
+  }
+
+  /** Sum of squares over [from, to) (clamped to the retained range). */
+  sumSquares(from: number, to: number): number {
+    const a = Math.max(from, this.head);
+    const b = Math.min(to, this.tail);
+    if (b <= a) return 0;
+    if (b - a < 2 * BLOCK) return this.directSum(a, b);
+    const ab = Math.ceil(a / BLOCK) * BLOCK;
+    const bb = Math.floor(b / BLOCK) * BLOCK;
+    const sum = this.directSum(a, ab) + (this.cumAt(bb) - this.cumAt(ab)) + this.directSum(bb, b);
+    return sum > 0 ? sum : 0;
+  }
+
+  /** Root-mean-square energy of [from, to); 0 for an empty range. */
+  rms(from: number, to: number): number {
+    const n = Math.min(to, this.tail) - Math.max(from, this.head);
+    return n > 0 ? Math.sqrt(this.sumSquares(from, to) / n) : 0;
+  }
+
+  /** Running sum at a block boundary inside [start, end]. */
+  private cumAt(pos: number): number {
+    return pos >= this.tail ? this.total : this.cum[(pos / BLOCK) % this.cum.length];
+  }
+
+  private directSum(a: number, b: number): number {
+    if (b <= a) return 0;
+    const v = this.view(a, b);
+    let sum = 0;
+    for (let i = 0; i < v.length; i++) sum += v[i] * v[i];
+    return sum;
+  }
+
+  private grow(need: number): void {
+    const oldCum = this.cum;
+    const kept = this.view(this.head, this.tail).slice();
+    this.cap = pow2AtLeast(need);
+    this.buf = new Float32Array(this.cap * 2);
+    this.cum = new Float64Array((this.cap / BLOCK) * 2);
+    for (let k = Math.ceil(this.head / BLOCK); k * BLOCK < this.tail; k++) {
+      this.cum[k % this.cum.length] = oldCum[k % oldCum.length];
+    }
+    const idx = this.head % this.cap;
+    const first = Math.min(kept.length, this.cap - idx);
+    this.buf.set(kept.subarray(0, first), idx);
+    this.buf.set(kept.subarray(0, first), idx + this.cap);
+    if (first < kept.length) {
+      this.buf.set(kept.subarray(first), 0);
+      this.buf.set(kept.subarray(first), this.cap);
+    }
+  }
+}
@@ -0,0 +1,109 @@
+/**
+ * capture.v2 container + binary events + in-place PCM views. A container written
+ * record-by-record must walk back into the exact wire frames (audio verbatim, REC1
+ * chunks recognised, events binary only when lossless), keep every audio frame's PCM
+ * 4-byte aligned so viewAudioFrame reads it IN PLACE, and drop a truncated tail.
+ * Run: npm test  (or npx tsx src/capture-v2.test.ts)
+ */
+import {
+  encodeAudioFrame, decodeAudioFrame, viewAudioFrame, encodeEvent, encodeRecordingChunk, decodeRecordingChunk,
+  encodeEventBinary, decodeEventBinary, encodeCaptureV2Header, encodeCaptureV2Binary, encodeCaptureV2Text,
+  readCaptureV2Header, captureV2Records, CAPTURE_V2_KIND, type MeetingEvent,
+} from "./index.js";
+
+let failed = 0;
+const check = (name: string, cond: boolean, detail = "") => {
+  console.log(`  ${cond ? "✅" : "❌"} ${name}${cond ? "" : "  — " + detail}`);
+  if (!cond) failed++;
+};
+const eqF32 = (a: Float32Array, b: Float32Array) => a.length === b.length && a.every((x, i) => Object.is(x, b[i]));
+const pcm = (n: number, seed: number) => Float32Array.from({ length: n }, (_, i) => ((((seed * 7 + i * 3) % 256) - 128) / 256));
+const concat = (parts: ArrayBuffer[]) => {
+  const out = new Uint8Array(parts.reduce((n, p) => n + p.byteLength, 0));
+  let o = 0;
+  for (const p of parts) { out.set(new Uint8Array(p), o); o += p.byteLength; }
+  return out.buffer;
+};
+
+// ── binary events ──
+{
+  const events: MeetingEvent[] = [
+    { kind: "active-speaker", ts: 1718000000123, speaker: "Zoë", detail: { hint: "dom-active", isEnd: false } },
+    { kind: "chat", ts: 1718000000200.5, speaker: "Bob", text: "hi — 👋" },
+    { kind: "lifecycle", ts: 1 },
+  ];
+  for (const ev of events) {
+    const bin = encodeEventBinary(ev);
+    const back = bin && decodeEventBinary(bin);
+    check(`binary ${ev.kind} round-trips to the same JSON`, !!back && encodeEvent(back) === encodeEvent(ev), JSON.stringify(back));
+    check(`binary ${ev.kind} is smaller than its JSON`, !!bin && bin.byteLength < new TextEncoder().encode(encodeEvent(ev)).length);
+  }
+  check("an unknown kind does not encode", encodeEventBinary({ kind: "nope", ts: 1 } as unknown as MeetingEvent) === null);
+  const bin = encodeEventBinary(events[1])!;
+  check("a truncated binary event decodes to null", decodeEventBinary(bin.slice(0, bin.byteLength - 2)) === null);
+}
+
+// ── decodeAudioFrame copies, viewAudioFrame views ──
+{
+  const frame = encodeAudioFrame(2, 1718000000000, pcm(6, 1), "Alice");
+  const copy = decodeAudioFrame(frame)!;
+  const view = viewAudioFrame(frame)!;
+  check("decodeAudioFrame owns its samples", copy.samples.buffer !== frame);
+  check("viewAudioFrame views the frame's PCM in place", view.samples.buffer === frame && eqF32(view.samples, copy.samples));
+  const odd = new Uint8Array(frame.byteLength + 1);
+  odd.set(new Uint8Array(frame), 1);
+  const shifted = viewAudioFrame(odd.buffer, 1, frame.byteLength)!;
+  check("an unaligned frame still decodes (one copy)", eqF32(shifted.samples, copy.samples) && shifted.speakerName === "Alice");
+}
+
+// ── container: write record by record, walk back ──
+const meta = { platform: "teams", native: "abc", language: null, startedAt: "2026-10-14T00:00:00.000Z" };
+const audio = [
+  encodeAudioFrame(999, 1718000000000, pcm(160, 2)),
+  encodeAudioFrame(3, 1718000000010, pcm(7, 3), "Zoë"),
+  encodeAudioFrame(1000, 1718000000020, pcm(0, 4)),
+];
+const hint = encodeEvent({ kind: "active-speaker", ts: 1718000000015, speaker: "Zoë", detail: { hint: "dom-active", isEnd: true } });
+const odd = '{"ts":5,"kind":"chat","tMs":5}';                  // not a lossless event → kept as text
+const rec = encodeRecordingChunk(0, false, "webm", Uint8Array.from([0x1a, 0x45, 0xdf]));
+const container = concat([
+  encodeCaptureV2Header(meta),
+  encodeCaptureV2Binary(0, audio[0]),
+  encodeCaptureV2Text(4.5, hint),
+  encodeCaptureV2Binary(9, new Uint8Array(audio[1])),
+  encodeCaptureV2Text(12, odd),
+  encodeCaptureV2Binary(15, rec),
+  encodeCaptureV2Binary(20, audio[2]),
+]);
+{
+  const header = readCaptureV2Header(container);
+  check("header carries the version and session meta", !!header && header.version === 2 && JSON.stringify(header.meta) === JSON.stringify(meta));
+  const records = [...captureV2Records(container)];
+  check("one record per appended frame, in order, with arrival t",
+    JSON.stringify(records.map((r) => [r.kind, r.t])) === JSON.stringify([
+      [CAPTURE_V2_KIND.audio, 0], [CAPTURE_V2_KIND.event, 4.5], [CAPTURE_V2_KIND.audio, 9],
+      [CAPTURE_V2_KIND.text, 12], [CAPTURE_V2_KIND.recording, 15], [CAPTURE_V2_KIND.audio, 20],
+    ]), JSON.stringify(records));
+  check("every record payload is 4-byte aligned", records.every((r) => r.byteOffset % 4 === 0));
+  const audioRecs = records.filter((r) => r.kind === CAPTURE_V2_KIND.audio);
+  audioRecs.forEach((r, i) => {
+    const bytes = new Uint8Array(container, r.byteOffset, r.byteLength);
+    const f = viewAudioFrame(container, r.byteOffset, r.byteLength)!;
+    const want = decodeAudioFrame(audio[i])!;
+    check(`audio ${i}: verbatim wire bytes, PCM viewed in place`,
+      Buffer.compare(Buffer.from(bytes), Buffer.from(audio[i])) === 0 && f.samples.buffer === container
+        && f.speakerIndex === want.speakerIndex && f.ts === want.ts && f.speakerName === want.speakerName && eqF32(f.samples, want.samples));
+  });
+  const ev = records[1], txt = records[3], chunk = records[4];
+  check("the event record replays as the exact original text", encodeEvent(decodeEventBinary(container, ev.byteOffset, ev.byteLength)!) === hint);
+  check("a non-lossless text frame is kept verbatim",
+    new TextDecoder().decode(new Uint8Array(container, txt.byteOffset, txt.byteLength)) === odd);
+  check("the REC1 chunk is a recording record", decodeRecordingChunk(container, chunk.byteOffset, chunk.byteLength)?.seq === 0);
+
+  const cut = container.slice(0, container.byteLength - 3);
+  check("a truncated tail record is dropped, earlier records kept", [...captureV2Records(cut)].length === records.length - 1);
+  check("a non-container yields no header and no records", readCaptureV2Header(audio[0]) === null && [...captureV2Records(audio[0])].length === 0);
+}
+
+if (failed) { console.error(`\n❌ capture-v2: ${failed} checks FAILED.`); process.exit(1); }
+console.log(`\n✅ capture-v2: all checks pass — records walk back verbatim, aligned, PCM viewed in place.`);
@@ -0,0 +1,59 @@
+/**
+ * Audio frame BATCH framing — encodeAudioFrameBatch/splitAudioFrameBatch must split
+ * back into the exact encoded frames, keep every frame's PCM 4-byte aligned (so a
+ * reader can view it in place), and drop a truncated tail instead of mis-decoding it.
+ * Run: npm test  (or npx tsx src/frame-batch.test.ts)
+ */
+import { encodeAudioFrame, decodeAudioFrame, encodeAudioFrameBatch, splitAudioFrameBatch } from "./index.js";
+
+let failed = 0;
+const check = (name: string, cond: boolean, detail = "") => {
+  console.log(`  ${cond ? "✅" : "❌"} ${name}${cond ? "" : "  — " + detail}`);
+  if (!cond) failed++;
+};
+const eqF32 = (a: Float32Array, b: Float32Array) =>
+  a.length === b.length && a.every((x, i) => Object.is(x, b[i]));
+const pcm = (n: number, seed: number) => Float32Array.from({ length: n }, (_, i) => ((((seed * 5 + i * 3) % 256) - 128) / 256));
+
+const inputs = [
+  { speakerIndex: 0, ts: 1718000000123, samples: pcm(8, 1), speakerName: "Alice" },
+  { speakerIndex: 3, ts: 1718000000200, samples: pcm(5, 2) },
+  { speakerIndex: 7, ts: 1718000000300, samples: pcm(0, 3), speakerName: "Zoë" },   // empty PCM, multi-byte name
+];
+const frames = inputs.map((f) => encodeAudioFrame(f.speakerIndex, f.ts, f.samples, f.speakerName));
+const batch = encodeAudioFrameBatch(frames);
+
+{
+  const parts = splitAudioFrameBatch(batch);
+  check("split returns one entry per frame", parts.length === inputs.length, `n=${parts.length}`);
+  check("every frame lands 4-byte aligned", parts.every(([off]) => off % 4 === 0), JSON.stringify(parts));
+  parts.forEach(([off, len], i) => {
+    const dec = decodeAudioFrame(batch, off, len);
+    const want = inputs[i];
+    check(`frame ${i} decodes to its input (index/ts/name/pcm)`,
+      !!dec && dec.speakerIndex === want.speakerIndex && dec.ts === want.ts
+        && dec.speakerName === want.speakerName && eqF32(dec.samples, want.samples),
+      JSON.stringify(dec));
+  });
+}
+
+// A batch embedded in a larger buffer: offsets come back absolute.
+{
+  const big = new Uint8Array(8 + batch.byteLength);
+  big.set(new Uint8Array(batch), 8);
+  const parts = splitAudioFrameBatch(big.buffer, 8, batch.byteLength);
+  const dec = parts.length ? decodeAudioFrame(big.buffer, parts[0][0], parts[0][1]) : null;
+  check("split honors byteOffset/byteLength (absolute offsets)", parts.length === 3 && dec?.speakerName === "Alice", JSON.stringify(parts));
+}
+
+// A truncated tail (a frame whose length prefix overruns the payload) is dropped.
+{
+  const cut = batch.slice(0, batch.byteLength - 6);
+  const parts = splitAudioFrameBatch(cut);
+  check("truncated tail frame is dropped, earlier frames kept", parts.length === 2, JSON.stringify(parts));
+}
+
+check("empty batch splits to nothing", splitAudioFrameBatch(encodeAudioFrameBatch([])).length === 0);
+
+if (failed) { console.error(`\n❌ frame-batch: ${failed} checks FAILED.`); process.exit(1); }
+console.log(`\n✅ frame-batch: all checks pass — batched audio frames split back exactly, aligned.`);
@@ -13,6 +13,10 @@
  *   source; mixed omits it and names downstream from hints.
  *
  *   event frame (text) : JSON.stringify(MeetingEvent)
+ *
+ *   capture.v2 container (storage, not the wire): a header + length-prefixed
+ *   records (audio frames verbatim, binary events, text, REC1 chunks), every
+ *   record 4-byte aligned so a reader walks one ArrayBuffer and views PCM in place.
  */
 
 /** A meeting event crossing the seam (no audio payload) — chat + lifecycle +
@@ -91,33 +95,105 @@ export function encodeAudioFrame(speakerIndex: number, ts: number, pcm: Float32A
   return buf;
 }
 
+/** Float32Array over wire PCM is only valid on a little-endian host (every Node / browser
+ *  target); a big-endian host falls back to a DataView walk. */
+const HOST_LE = new Uint8Array(new Uint32Array([1]).buffer)[0] === 1;
+
+/** `n` Float32LE samples at absolute `start` of `buf`: a VIEW when `view` is set and the
+ *  samples are 4-byte aligned, else one bulk copy. */
+function pcmAt(buf: ArrayBufferLike, start: number, n: number, view: boolean): Float32Array {
+  if (HOST_LE && (start & 3) === 0) {
+    const v = new Float32Array(buf as ArrayBuffer, start, n);
+    return view ? v : v.slice();
+  }
+  if (HOST_LE) return new Float32Array((buf as ArrayBuffer).slice(start, start + n * 4));
+  const dv = new DataView(buf as ArrayBuffer, start, n * 4);
+  const samples = new Float32Array(n);
+  for (let i = 0; i < n; i++) samples[i] = dv.getFloat32(i * 4, true);
+  return samples;
+}
+
 /** Decode a wire audio frame. The receiver uses ts as-is — never Date.now().
- *  speakerName is present only for named (high-bit) frames. */
+ *  speakerName is present only for named (high-bit) frames. `samples` is the
+ *  caller's own copy. */
 export function decodeAudioFrame(buf: ArrayBufferLike, byteOffset = 0, byteLength?: number):
     { speakerIndex: number; ts: number; samples: Float32Array; speakerName?: string } | null {
+  return parseAudioFrame(buf, byteOffset, byteLength, false);
+}
+
+/** decodeAudioFrame without the copy: `samples` VIEWS the PCM inside `buf` when it is
+ *  4-byte aligned (batches and capture.v2 records keep it so), so it is only valid while
+ *  `buf` is — the batch / container readers' hot path. */
+export function viewAudioFrame(buf: ArrayBufferLike, byteOffset = 0, byteLength?: number):
+    { speakerIndex: number; ts: number; samples: Float32Array; speakerName?: string } | null {
+  return parseAudioFrame(buf, byteOffset, byteLength, true);
+}
+
+function parseAudioFrame(buf: ArrayBufferLike, byteOffset: number, byteLength: number | undefined, view: boolean):
+    { speakerIndex: number; ts: number; samples: Float32Array; speakerName?: string } | null {
   const len = byteLength ?? (buf as ArrayBuffer).byteLength - byteOffset;
   if (len < AUDIO_HEADER_BYTES) return null;
-  const view = new DataView(buf as ArrayBuffer, byteOffset, len);
-  const raw = view.getInt32(0, true);
-  const ts = view.getFloat64(4, true);
+  const header = new DataView(buf as ArrayBuffer, byteOffset, len);
+  const raw = header.getInt32(0, true);
+  const ts = header.getFloat64(4, true);
   if ((raw & NAME_FLAG) === 0) {                 // legacy/no-name frame — decode unchanged
     const n = (len - AUDIO_HEADER_BYTES) >> 2;
-    const samples = new Float32Array(n);
-    for (let i = 0; i < n; i++) samples[i] = view.getFloat32(AUDIO_HEADER_BYTES + i * 4, true);
-    return { speakerIndex: raw, ts, samples };
+    return { speakerIndex: raw, ts, samples: pcmAt(buf, byteOffset + AUDIO_HEADER_BYTES, n, view) };
   }
   if (len < NAMED_HEADER_BYTES) return null;     // named frame
   const speakerIndex = raw & 0x7fffffff;
-  const nameLen = view.getInt32(12, true);
+  const nameLen = header.getInt32(12, true);
   if (nameLen < 0) return null;
   const padded = (nameLen + 3) & ~3;
   const pcmStart = NAMED_HEADER_BYTES + padded;
   if (len < pcmStart) return null;
   const speakerName = new TextDecoder().decode(new Uint8Array(buf as ArrayBuffer, byteOffset + NAMED_HEADER_BYTES, nameLen));
   const n = (len - pcmStart) >> 2;
-  const samples = new Float32Array(n);
-  for (let i = 0; i < n; i++) samples[i] = view.getFloat32(pcmStart + i * 4, true);
-  return { speakerIndex, ts, samples, speakerName };
+  return { speakerIndex, ts, samples: pcmAt(buf, byteOffset + pcmStart, n, view), speakerName };
+}
+
+// ── audio frame BATCH — many encoded audio frames in ONE binary payload. ──
+//
+//   batch : ([Uint32LE frameLen][audio frame bytes])…
+//
+// Every audio frame is a multiple of 4 bytes (12/16+padded header, Float32 PCM),
+// so each frame — and therefore its PCM — stays 4-byte aligned inside the batch;
+// a reader can take Float32Array VIEWS over the one buffer instead of copying.
+// This is the page → Node transport of the bot's capture bridge: one binding call
+// per batching window instead of one boxed number[] per frame.
+
+const BATCH_LEN_BYTES = 4;
+
+/** Pack already-encoded audio frames (encodeAudioFrame output) into one batch. */
+export function encodeAudioFrameBatch(frames: ArrayBuffer[]): ArrayBuffer {
+  let total = 0;
+  for (const f of frames) total += BATCH_LEN_BYTES + f.byteLength;
+  const buf = new ArrayBuffer(total);
+  const view = new DataView(buf);
+  const out = new Uint8Array(buf);
+  let o = 0;
+  for (const f of frames) {
+    view.setUint32(o, f.byteLength, true);
+    out.set(new Uint8Array(f), o + BATCH_LEN_BYTES);
+    o += BATCH_LEN_BYTES + f.byteLength;
+  }
+  return buf;
+}
+
+/** Split a batch into the [byteOffset, byteLength] of each frame (absolute offsets into
+ *  `buf`), ready for decodeAudioFrame(buf, off, len). A truncated tail is dropped. */
+export function splitAudioFrameBatch(buf: ArrayBufferLike, byteOffset = 0, byteLength?: number): Array<[number, number]> {
+  const len = byteLength ?? (buf as ArrayBuffer).byteLength - byteOffset;
+  const view = new DataView(buf as ArrayBuffer, byteOffset, len);
+  const out: Array<[number, number]> = [];
+  let o = 0;
+  while (o + BATCH_LEN_BYTES <= len) {
+    const n = view.getUint32(o, true);
+    if (o + BATCH_LEN_BYTES + n > len) break;
+    out.push([byteOffset + o + BATCH_LEN_BYTES, n]);
+    o += BATCH_LEN_BYTES + n;
+  }
+  return out;
 }
 
 /** Encode / decode a meeting event for the wire (text frame). */
@@ -130,6 +206,68 @@ export function decodeEvent(json: string): MeetingEvent | null {
   } catch { return null; }
 }
 
+// ── binary event — the compact MeetingEvent encoding capture.v2 stores. ──
+//
+//   event : [Uint8 kind][Uint8 fields][Uint16LE 0][Float64LE ts]
+//           then per set `fields` bit, in order speaker(1) · text(2) · detail(4):
+//           [Uint32LE byteLen][UTF-8 bytes]   (detail is its JSON)
+//
+// `kind` is the index into EVENT_KINDS. The text wire keeps JSON (the sealed
+// capture.v1 event frame); this is the at-rest form a long capture is replayed from.
+
+const EVENT_KINDS: readonly MeetingEvent['kind'][] = [
+  'speaker-joined', 'speaker-left', 'active-speaker', 'caption', 'segment', 'lifecycle', 'track-lock', 'chat',
+];
+const EVENT_HEADER_BYTES = 12;
+const EV_SPEAKER = 1, EV_TEXT = 2, EV_DETAIL = 4;
+
+/** Encode an event compactly; null when its kind is outside the envelope. */
+export function encodeEventBinary(ev: MeetingEvent): ArrayBuffer | null {
+  const kind = EVENT_KINDS.indexOf(ev.kind);
+  if (kind < 0 || typeof ev.ts !== 'number') return null;
+  const enc = new TextEncoder();
+  const parts: Array<[number, Uint8Array]> = [];
+  if (typeof ev.speaker === 'string') parts.push([EV_SPEAKER, enc.encode(ev.speaker)]);
+  if (typeof ev.text === 'string') parts.push([EV_TEXT, enc.encode(ev.text)]);
+  if (ev.detail !== undefined) parts.push([EV_DETAIL, enc.encode(JSON.stringify(ev.detail))]);
+  let total = EVENT_HEADER_BYTES;
+  for (const [, b] of parts) total += 4 + b.length;
+  const buf = new ArrayBuffer(total);
+  const view = new DataView(buf);
+  const out = new Uint8Array(buf);
+  view.setUint8(0, kind);
+  view.setUint8(1, parts.reduce((f, [bit]) => f | bit, 0));
+  view.setFloat64(4, ev.ts, true);
+  let o = EVENT_HEADER_BYTES;
+  for (const [, b] of parts) { view.setUint32(o, b.length, true); out.set(b, o + 4); o += 4 + b.length; }
+  return buf;
+}
+
+/** Decode a binary event; null (never throws) on a short, unknown-kind or corrupt record. */
+export function decodeEventBinary(buf: ArrayBufferLike, byteOffset = 0, byteLength?: number): MeetingEvent | null {
+  const len = byteLength ?? (buf as ArrayBuffer).byteLength - byteOffset;
+  if (len < EVENT_HEADER_BYTES) return null;
+  const view = new DataView(buf as ArrayBuffer, byteOffset, len);
+  const kind = EVENT_KINDS[view.getUint8(0)];
+  if (!kind) return null;
+  const fields = view.getUint8(1);
+  const ev: MeetingEvent = { kind, ts: view.getFloat64(4, true) };
+  const dec = new TextDecoder();
+  let o = EVENT_HEADER_BYTES;
+  for (const bit of [EV_SPEAKER, EV_TEXT, EV_DETAIL]) {
+    if (!(fields & bit)) continue;
+    if (o + 4 > len) return null;
+    const n = view.getUint32(o, true);
+    if (o + 4 + n > len) return null;
+    const str = dec.decode(new Uint8Array(buf as ArrayBuffer, byteOffset + o + 4, n));
+    o += 4 + n;
+    if (bit === EV_SPEAKER) ev.speaker = str;
+    else if (bit === EV_TEXT) ev.text = str;
+    else { try { ev.detail = JSON.parse(str); } catch { return null; } }
+  }
+  return ev;
+}
+
 // ───────────────────────────────────────────────────────────────────────
 // recording-chunk frame (binary) — recording.v1 over the same ingest WS.
 //
@@ -180,3 +318,110 @@ export function decodeRecordingChunk(buf: ArrayBufferLike, byteOffset = 0, byteL
   const bytes = new Uint8Array(buf as ArrayBuffer, byteOffset + REC_HEADER_BYTES, len - REC_HEADER_BYTES);
   return { seq, isFinal, format, bytes };
 }
+
+// ───────────────────────────────────────────────────────────────────────
+// capture.v2 container — a long capture AT REST (desktop tape, eval replays).
+//
+//   container : [Uint32LE magic 'CAP2'][Uint32LE version = 2][Uint32LE metaLen][Uint32LE 0]
+//               [meta UTF-8 JSON, zero-padded to 4B] record…
+//   record    : [Uint32LE kind][Uint32LE byteLen][Float64LE t][payload, zero-padded to 4B]
+//   kind      : 1 audio (a capture.v1 audio frame, verbatim) · 2 event (binary event)
+//               · 3 text (a text frame that is not a lossless event) · 4 recording (REC1)
+//
+// `t` is the record's arrival ms relative to the capture start (the replay pacing);
+// the audio frame still carries its own CAPTURE `ts`. A record's payload starts on a
+// 4-byte boundary and every audio frame is a multiple of 4 bytes, so a reader holding
+// the container in one ArrayBuffer walks the length prefixes and views each frame's
+// PCM in place (viewAudioFrame) — no base64, no JSON, no per-sample copy. Records are
+// appended one at a time (a writer never seeks); a truncated tail is dropped.
+// ───────────────────────────────────────────────────────────────────────
+
+const CAPTURE_V2_MAGIC = 0x32504143;   // 'CAP2'
+const CAPTURE_V2_VERSION = 2;
+const CAPTURE_V2_HEADER_BYTES = 16;
+const CAPTURE_V2_RECORD_BYTES = 16;
+export const CAPTURE_V2_KIND = { audio: 1, event: 2, text: 3, recording: 4 } as const;
+export type CaptureV2Kind = typeof CAPTURE_V2_KIND[keyof typeof CAPTURE_V2_KIND];
+
+/** One record's place in a container: absolute payload offsets, ready for the decoders. */
+export interface CaptureV2Record { kind: CaptureV2Kind; t: number; byteOffset: number; byteLength: number }
+
+const pad4 = (n: number) => (n + 3) & ~3;
+const asBytes = (b: ArrayBuffer | Uint8Array) => (b instanceof Uint8Array ? b : new Uint8Array(b));
+
+/** The container header, carrying the session meta (platform, native id, language, …). */
+export function encodeCaptureV2Header(meta: Record<string, unknown>): ArrayBuffer {
+  const json = new TextEncoder().encode(JSON.stringify(meta));
+  const buf = new ArrayBuffer(CAPTURE_V2_HEADER_BYTES + pad4(json.length));
+  const view = new DataView(buf);
+  view.setUint32(0, CAPTURE_V2_MAGIC, true);
+  view.setUint32(4, CAPTURE_V2_VERSION, true);
+  view.setUint32(8, json.length, true);
+  new Uint8Array(buf, CAPTURE_V2_HEADER_BYTES).set(json);
+  return buf;
+}
+
+/** One length-prefixed record, for appending after the header. */
+export function encodeCaptureV2Record(kind: CaptureV2Kind, t: number, payload: ArrayBuffer | Uint8Array): ArrayBuffer {
+  const bytes = asBytes(payload);
+  const buf = new ArrayBuffer(CAPTURE_V2_RECORD_BYTES + pad4(bytes.length));
+  const view = new DataView(buf);
+  view.setUint32(0, kind, true);
+  view.setUint32(4, bytes.length, true);
+  view.setFloat64(8, t, true);
+  new Uint8Array(buf, CAPTURE_V2_RECORD_BYTES).set(bytes);
+  return buf;
+}
+
+/** A binary wire frame as a record: a REC1 chunk, else an audio frame. */
+export function encodeCaptureV2Binary(t: number, frame: ArrayBuffer | Uint8Array): ArrayBuffer {
+  const b = asBytes(frame);
+  const kind = decodeRecordingChunk(b.buffer, b.byteOffset, b.byteLength) ? CAPTURE_V2_KIND.recording : CAPTURE_V2_KIND.audio;
+  return encodeCaptureV2Record(kind, t, b);
+}
+
+/** A text wire frame as a record: a binary event when it decodes back to the exact same
+ *  text (so a replay stays verbatim), else the text itself. */
+export function encodeCaptureV2Text(t: number, text: string): ArrayBuffer {
+  const ev = decodeEvent(text);
+  const bin = ev && encodeEventBinary(ev);
+  if (bin) {
+    const back = decodeEventBinary(bin);
+    if (back && encodeEvent(back) === text) return encodeCaptureV2Record(CAPTURE_V2_KIND.event, t, bin);
+  }
+  return encodeCaptureV2Record(CAPTURE_V2_KIND.text, t, new TextEncoder().encode(text));
+}
+
+/** Parse the container header; null when `buf` is not a capture.v2 container. */
+export function readCaptureV2Header(buf: ArrayBufferLike, byteOffset = 0, byteLength?: number):
+    { version: number; meta: Record<string, unknown>; recordsOffset: number } | null {
+  const len = byteLength ?? (buf as ArrayBuffer).byteLength - byteOffset;
+  if (len < CAPTURE_V2_HEADER_BYTES) return null;
+  const view = new DataView(buf as ArrayBuffer, byteOffset, len);
+  if (view.getUint32(0, true) !== CAPTURE_V2_MAGIC) return null;
+  const version = view.getUint32(4, true);
+  if (version !== CAPTURE_V2_VERSION) return null;
+  const metaLen = view.getUint32(8, true);
+  if (CAPTURE_V2_HEADER_BYTES + metaLen > len) return null;
+  let meta: Record<string, unknown>;
+  try { meta = JSON.parse(new TextDecoder().decode(new Uint8Array(buf as ArrayBuffer, byteOffset + CAPTURE_V2_HEADER_BYTES, metaLen))); }
+  catch { return null; }
+  return { version, meta, recordsOffset: byteOffset + CAPTURE_V2_HEADER_BYTES + pad4(metaLen) };
+}
+
+/** Walk a container's records in order (absolute offsets into `buf`). Nothing for a
+ *  non-container; a truncated tail record — a writer cut off mid-append — is dropped. */
+export function* captureV2Records(buf: ArrayBufferLike, byteOffset = 0, byteLength?: number): Generator<CaptureV2Record> {
+  const len = byteLength ?? (buf as ArrayBuffer).byteLength - byteOffset;
+  const header = readCaptureV2Header(buf, byteOffset, len);
+  if (!header) return;
+  const end = byteOffset + len;
+  const view = new DataView(buf as ArrayBuffer);
+  let o = header.recordsOffset;
+  while (o + CAPTURE_V2_RECORD_BYTES <= end) {
+    const n = view.getUint32(o + 4, true);
+    if (o + CAPTURE_V2_RECORD_BYTES + n > end) return;
+    yield { kind: view.getUint32(o, true) as CaptureV2Kind, t: view.getFloat64(o + 8, true), byteOffset: o + CAPTURE_V2_RECORD_BYTES, byteLength: n };
+    o += CAPTURE_V2_RECORD_BYTES + pad4(n);
+  }
+}
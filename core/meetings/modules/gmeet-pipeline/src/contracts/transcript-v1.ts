@@ -21,6 +21,19 @@ export interface TimestampedWord {
   probability?: number;
 }
 
+/** Latency trace stamps — schema $defs/Trace. Epoch ms, except the stt_* durations (ms).
+ *  The pipeline stamps capture → STT; the host and later hops add theirs. */
+export interface SegmentTrace {
+  captured_ms?: number;
+  submitted_ms?: number;
+  stt_queue_ms?: number;
+  stt_decode_ms?: number;
+  transcribed_ms?: number;
+  published_ms?: number;
+  ingested_ms?: number;
+  mutable_ms?: number;
+}
+
 /** One speaker-attributed utterance — schema $defs/TranscriptSegment.
  *  Required: segment_id, speaker, text, start, end, completed. */
 export interface TranscriptSegment {
@@ -42,6 +55,8 @@ export interface TranscriptSegment {
   /** 1.0 for glow-bound, 0 for provisional. */
   confidence?: number;
   words?: TimestampedWord[];
+  /** How long this segment took to get here, hop by hop. */
+  trace?: SegmentTrace;
 }
 
 /** Per-meeting meta the host carries alongside the segment stream. */
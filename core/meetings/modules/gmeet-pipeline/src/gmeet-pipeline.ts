@@ -20,8 +20,8 @@
  * derived. No diarizer, no post-hoc window-match.
  */
 import { SpeakerStreamManager, type SpeakerStreamManagerConfig } from './speaker-streams.js';
-import type { TranscriptionResult } from '@vexa/transcribe-whisper';
-import type { TranscriptSegment, TranscriptSink } from './contracts/transcript-v1.js';
+import type { TranscriptionResult, TranscriptionTiming } from '@vexa/transcribe-whisper';
+import type { SegmentTrace, TranscriptSegment, TranscriptSink } from './contracts/transcript-v1.js';
 
 export interface GmeetPipelineOptions {
   /** One Whisper round-trip (stt.v1). language is baked into the closure by the host. */
@@ -48,6 +48,17 @@ export interface GmeetPipeline {
   dispose(): Promise<void>;
 }
 
+/** The lane's share of a segment's transcript.v1 trace: the capture time of the newest audio the
+ *  STT window held, when it went out, what the service reported, and when it came back. */
+function sttTrace(capturedMs: number | undefined, submittedMs: number, transcribedMs: number, timing?: TranscriptionTiming): SegmentTrace {
+  return {
+    ...(capturedMs !== undefined ? { captured_ms: Math.round(capturedMs) } : {}),
+    submitted_ms: submittedMs,
+    ...(timing ? { stt_queue_ms: timing.queue_ms, stt_decode_ms: timing.decode_ms } : {}),
+    transcribed_ms: transcribedMs,
+  };
+}
+
 export function createGmeetPipeline(opts: GmeetPipelineOptions): GmeetPipeline {
   const UNKNOWN = opts.unknownLabel ?? 'Speaker';
   const ONSET_GAP = opts.onsetGapMs ?? 1000;
@@ -55,12 +66,17 @@ export function createGmeetPipeline(opts: GmeetPipelineOptions): GmeetPipeline {
   const inflight = new Set<Promise<void>>();
   // Per channel: the CURRENT turn's stream key, bound name, last-audio time, turn counter.
   const chan = new Map<number, { key: string; name: string; lastMs: number; turn: number }>();
+  // Per stream: the capture time its fed audio reaches (frame ts + duration), and the trace of the
+  // STT pass its latest result came from — every segment that result confirms or drafts carries it.
+  const capturedTo = new Map<string, number>();
+  const traces = new Map<string, SegmentTrace>();
 
   // Emit the SEALED transcript.v1 shape (snake_case, segment_id + completed, source
   // in the contract's enum) — the pipeline IS the transcript.v1 producer, so its
   // output conforms to meetings/contracts/transcript.v1 (pinned by the replay golden).
   const segOf = (speakerName: string, key: string, text: string, startMs: number, endMs: number, completed: boolean, lang?: string): TranscriptSegment => {
     const named = speakerName !== UNKNOWN;
+    const trace = traces.get(key);
     return {
       segment_id: `${key}:${Math.round(startMs)}`,
       speaker: speakerName, speaker_key: key, text,
@@ -68,6 +84,7 @@ export function createGmeetPipeline(opts: GmeetPipelineOptions): GmeetPipeline {
       language: lang ?? null,
       source: named ? 'glow-bound' : 'provisional-cluster-id',
       confidence: named ? 1 : 0,
+      ...(trace ? { trace: { ...trace } } : {}),
     };
   };
 
@@ -80,7 +97,10 @@ export function createGmeetPipeline(opts: GmeetPipelineOptions): GmeetPipeline {
   mgr.onSegmentReady = (speakerId, _name, audio) => {
     const p = (async () => {
       try {
+        const captured = capturedTo.get(speakerId);
+        const submitted = Date.now();
         const r = await opts.transcribe(audio, mgr.getLastConfirmedText(speakerId) || undefined);
+        traces.set(speakerId, sttTrace(captured, submitted, Date.now(), r?.timing));
         const segs = r?.segments;
         mgr.handleTranscriptionResult(speakerId, (r?.text || '').trim(), segs?.[segs.length - 1]?.end, segs, langOf(r?.language));
       } catch (e) {
@@ -105,7 +125,7 @@ export function createGmeetPipeline(opts: GmeetPipelineOptions): GmeetPipeline {
   // transcribe can't be mislabeled), then free the stream after it has long settled.
   const closeTurn = (key: string) => {
     void mgr.flushSpeaker(key, true).catch(() => { /* nothing owed */ });
-    const t = setTimeout(() => mgr.removeSpeaker(key), 12000);
+    const t = setTimeout(() => { mgr.removeSpeaker(key); capturedTo.delete(key); traces.delete(key); }, 12000);
     (t as { unref?: () => void }).unref?.();   // don't keep the process alive for cleanup
   };
 
@@ -134,6 +154,7 @@ export function createGmeetPipeline(opts: GmeetPipelineOptions): GmeetPipeline {
         mgr.updateSpeakerName(st.key, glowName);
       }
       st.lastMs = tsMs;
+      capturedTo.set(st.key, tsMs + (pcm.length / 16_000) * 1000);
       mgr.feedAudio(st.key, pcm, tsMs);
     },
     flush: async () => { for (const st of chan.values()) await mgr.flushSpeaker(st.key, true); await settle(); },
@@ -141,6 +162,8 @@ export function createGmeetPipeline(opts: GmeetPipelineOptions): GmeetPipeline {
       for (const st of chan.values()) await mgr.flushSpeaker(st.key, true);
       await settle();
       mgr.removeAll();
+      capturedTo.clear();
+      traces.clear();
       await opts.sink.finalize();
     },
   };
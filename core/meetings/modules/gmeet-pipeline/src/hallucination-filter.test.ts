@@ -2,7 +2,7 @@
  * Hallucination-filter golden — pins the phrase-list + structural junk rules.
  * Run: npm test  (chained)  or  npx tsx src/hallucination-filter.test.ts
  */
-import { readFileSync } from "node:fs";
+import { readdirSync, readFileSync } from "node:fs";
 import { dirname, resolve } from "node:path";
 import { fileURLToPath } from "node:url";
 import { isHallucination } from "./index.js";
@@ -39,5 +39,20 @@ check('tr: case/punctuation-insensitive ("abone olmayı unutmayın.")', isHalluc
 check("real Spanish speech still kept (no over-filter)",
   isHallucination("empecemos con el bounded context de facturacion") === false);
 
+// One-pass matcher: every listed phrase still drops on its own, and a segment MADE of hallucinations
+// (outro + sign-off, a phrase repeated) drops too — a Set lookup of the whole string missed these.
+const allPhrases = readdirSync(resolve(here, "hallucinations")).filter((f) => f.endsWith(".txt"))
+  .flatMap((f) => readFileSync(resolve(here, "hallucinations", f), "utf-8").split("\n"))
+  .map((l) => l.trim()).filter((l) => l && !l.startsWith("#"));
+check(`every listed phrase (${allPhrases.length}) is filtered`, allPhrases.every((p) => isHallucination(p)));
+check("concatenated hallucinations → dropped", isHallucination("Thanks for watching! Bye.") === true);
+check("a repeated outro → dropped", isHallucination("Thanks for watching. Thanks for watching.") === true);
+check("ja outro pair, no separator → dropped", isHallucination("ご視聴ありがとうございました。次の動画でお会いしましょう") === true);
+check("real speech containing a listed phrase kept", isHallucination("Okay, thanks for watching the demo, we'll send the deck after.") === false);
+check("short real replies built of filler kept", isHallucination("Yes. Okay, thank you.") === false);
+check("a loop mid-segment (not at the start) → dropped",
+  isHallucination("so the plan is we will do it we will do it we will do it we will do it") === true);
+check("a single stutter is not a loop", isHallucination("we we need to ship the the release on friday") === false);
+
 if (failed) { console.error(`\n❌ hallucination-filter: ${failed} checks FAILED.`); process.exit(1); }
 console.log(`\n✅ hallucination-filter: all checks pass — phrase-list + short/repetition junk dropped, real speech kept.`);
@@ -5,38 +5,61 @@
  * reaches the transcript. Phrase files loaded from hallucinations/*.txt (shipped to
  * dist/ by the build). ESM: the dir is resolved from import.meta.url, so it works
  * the same run-from-src (tsx) and run-from-dist (built).
+ *
+ * The phrases are compiled ONCE, at module load, into one Aho-Corasick automaton
+ * (hallucination-matcher.ts), so a segment costs one pass whatever the list size. The
+ * build also writes the automaton precompiled (hallucinations/phrases.compiled.json);
+ * it is used only while its fingerprint matches the .txt files beside it, so a
+ * re-harvested list is never shadowed by a stale build.
  */
-import { existsSync, readdirSync, readFileSync } from 'node:fs';
+import { createHash } from 'node:crypto';
+import { existsSync, readdirSync, readFileSync, writeFileSync } from 'node:fs';
 import { resolve, join, dirname } from 'node:path';
-import { fileURLToPath } from 'node:url';
+import { fileURLToPath, pathToFileURL } from 'node:url';
+import { PhraseMatcher, longestTandemRepeat, normalizeForMatch, type CompiledPhraseMatcher } from './hallucination-matcher.js';
 import { log } from './log.js';
 
 const here = dirname(fileURLToPath(import.meta.url));
-let phrases: Set<string> | null = null;
+const dir = resolve(here, 'hallucinations');   // src/hallucinations (tsx) ‖ dist/hallucinations (built)
+const COMPILED = 'phrases.compiled.json';
 
-function loadPhrases(): Set<string> {
-  if (phrases) return phrases;
-  phrases = new Set();
+/** A tandem repeat this long (≥ 3 back-to-back copies, ≥ 9 words) is a decoding loop. */
+const LOOP_MIN_COPIES = 3;
+const LOOP_MIN_WORDS = 9;
 
-  const dir = resolve(here, 'hallucinations');   // src/hallucinations (tsx) ‖ dist/hallucinations (built)
+function loadMatcher(): PhraseMatcher {
+  const phrases: string[] = [];
+  const fingerprint = createHash('sha256');
   try {
     if (existsSync(dir)) {
-      for (const file of readdirSync(dir)) {
+      for (const file of readdirSync(dir).sort()) {
         if (!file.endsWith('.txt')) continue;
         const content = readFileSync(join(dir, file), 'utf-8');
+        fingerprint.update(`${file}\0${content}\0`);
         for (const line of content.split('\n')) {
           const t = line.trim();
-          if (t && !t.startsWith('#')) phrases.add(t.toLowerCase());
+          if (t && !t.startsWith('#')) phrases.push(t);
         }
       }
     }
-  } catch { /* fall through to the empty-set warning */ }
+  } catch { /* fall through to the empty-list warning */ }
+  const source = fingerprint.digest('hex');
+
+  let matcher: PhraseMatcher | null = null;
+  let how = 'compiled';
+  try {
+    const pre = JSON.parse(readFileSync(join(dir, COMPILED), 'utf-8')) as CompiledPhraseMatcher;
+    if (pre.source === source) { matcher = PhraseMatcher.fromJSON(pre); how = 'precompiled'; }
+  } catch { /* absent or unreadable → compile from the lists */ }
+  matcher ??= PhraseMatcher.compile(phrases, source);
 
-  if (phrases.size > 0) log(`[HallucinationFilter] Loaded ${phrases.size} phrases from ${dir}`);
+  if (matcher.phrases > 0) log(`[HallucinationFilter] Loaded ${matcher.phrases} phrases (${how}) from ${dir}`);
   else log('[HallucinationFilter] WARNING: No phrase files found');
-  return phrases;
+  return matcher;
 }
 
+const matcher = loadMatcher();
+
 /**
  * Returns true if the text is a hallucination and should be dropped.
  */
@@ -44,35 +67,32 @@ export function isHallucination(text: string): boolean {
   if (!text?.trim()) return true;
 
   const trimmed = text.trim();
-  const lower = trimmed.toLowerCase();
 
-  // Known phrase (exact match, then retry with normalized punctuation)
-  const db = loadPhrases();
-  if (db.has(lower)) return true;
-  const stripped = lower.replace(/[.!?…]+$/g, '').replace(/\.{2,}$/g, '');
-  if (stripped !== lower && db.has(stripped)) return true;
-  if (stripped !== lower && db.has(stripped + '...')) return true;
-  if (stripped !== lower && db.has(stripped + '.')) return true;
+  // Known phrases: the whole segment is one, or is made of them (case/punctuation-insensitive)
+  const normalized = normalizeForMatch(trimmed);
+  if (matcher.covers(normalized)) return true;
 
   // Too short (single word < 10 chars)
   const words = trimmed.split(/\s+/);
   if (words.length <= 1 && trimmed.length < 10) return true;
 
-  // Repetition loop: same 3-6 word phrase repeated 3+ times
-  if (words.length >= 9) {
-    for (let len = 3; len <= 6; len++) {
-      const phrase = words.slice(0, len).join(' ').toLowerCase();
-      let count = 0;
-      for (let i = 0; i <= words.length - len; i += len) {
-        if (words.slice(i, i + len).join(' ').toLowerCase() === phrase) count++;
-      }
-      if (count >= 3) return true;
-    }
-  }
+  // Repetition loop: the same 1-8 word n-gram back-to-back 3+ times, spanning 9+ words
+  const loop = longestTandemRepeat(normalized.split(' '), { minCopies: LOOP_MIN_COPIES });
+  if (loop.copies * loop.n >= LOOP_MIN_WORDS) return true;
 
   return false;
 }
 
+/** Build step: write the automaton for the lists it was loaded from (`node dist/hallucination-filter.js --compile`). */
+function writeCompiled(): void {
+  writeFileSync(join(dir, COMPILED), JSON.stringify(matcher.toJSON()) + '\n');
+  log(`[HallucinationFilter] Wrote ${join(dir, COMPILED)}`);
+}
+
+if (process.argv[1] && import.meta.url === pathToFileURL(process.argv[1]).href && process.argv.includes('--compile')) {
+  writeCompiled();
+}
+
 // The low-confidence STT-segment filter (isLowConfidenceSegment) lives in
 // @vexa/transcribe-whisper (src/confidence.ts) — it belongs at the stt.v1 egress,
 // applied to Whisper's raw output before the confirm loop. This module keeps only
@@ -0,0 +1,113 @@
+/**
+ * Hallucination-matcher golden — the Aho-Corasick automaton finds exactly what a naive
+ * every-phrase-at-every-position scan finds, survives the serialized (precompiled) round trip,
+ * covers only what phrases account for, and the tandem-repeat detector is exact and linear.
+ * Run: npm test  (chained)  or  npx tsx src/hallucination-matcher.test.ts
+ */
+import { readdirSync, readFileSync } from "node:fs";
+import { dirname, join, resolve } from "node:path";
+import { fileURLToPath } from "node:url";
+import { PhraseMatcher, longestTandemRepeat, normalizeForMatch, type PhraseMatch } from "./hallucination-matcher.js";
+
+const here = dirname(fileURLToPath(import.meta.url));
+
+let failed = 0;
+const check = (name: string, cond: boolean, detail = "") => {
+  console.log(`  ${cond ? "✅" : "❌"} ${name}${cond ? "" : "  — " + detail}`);
+  if (!cond) failed++;
+};
+
+const dir = resolve(here, "hallucinations");
+const listed = readdirSync(dir).filter((f) => f.endsWith(".txt"))
+  .flatMap((f) => readFileSync(join(dir, f), "utf-8").split("\n"))
+  .map((l) => l.trim()).filter((l) => l && !l.startsWith("#"));
+const m = PhraseMatcher.compile(listed);
+
+/** Reference: every normalized phrase at every word-boundary position; longest per end. */
+function naive(phrases: string[], text: string): string {
+  const uniq = [...new Set(phrases.map(normalizeForMatch).filter(Boolean))];
+  const isB = (i: number) => i <= 0 || i >= text.length || text[i - 1] === " " || text[i] === " " ||
+    /[\p{sc=Han}\p{sc=Hiragana}\p{sc=Katakana}]/u.test(text[i - 1] + text[i]);
+  const best = new Map<number, number>();
+  for (const p of uniq) {
+    for (let at = text.indexOf(p); at >= 0; at = text.indexOf(p, at + 1)) {
+      const end = at + p.length;
+      if (isB(at) && isB(end) && (best.get(end) ?? Infinity) > at) best.set(end, at);
+    }
+  }
+  return [...best].sort((a, b) => a[0] - b[0]).map(([e, s]) => `${s}-${e}`).join(",");
+}
+const spans = (ms: PhraseMatch[]) => ms.map((x) => `${x.start}-${x.end}`).join(",");
+
+// ── normalization ───────────────────────────────────────────────────────────
+check("normalize: case, punctuation runs, dashes, ellipses collapse", normalizeForMatch("  Bye-bye… THANK you!! ") === "bye bye thank you");
+check("normalize: apostrophes inside words survive, curly folded", normalizeForMatch("I’ll see you 'next' time.") === "i'll see you next time");
+
+// ── the automaton ≡ the naive scan ──────────────────────────────────────────
+{
+  const texts = [
+    "thank you for watching please subscribe bye",
+    "so thank you everyone for joining the call",
+    "goodbye and thank you",
+    "no no no no no",
+    "ご視聴ありがとうございました次の動画でお会いしましょう",
+    "yes okay thank you",
+    normalizeForMatch(listed.slice(0, 40).join(" ")),
+  ];
+  check("matches() ≡ naive scan over the shipped lists (longest per end, on boundaries)",
+    texts.every((t) => spans(m.matches(t)) === naive(listed, t)),
+    texts.map((t) => `${spans(m.matches(t))} | ${naive(listed, t)}`).join(" ; "));
+  check("no match inside a word (\"bye\" is not in \"goodbye\")", !m.matches("goodbye").some((x) => x.end === 7 && x.start > 0));
+}
+
+// ── serialized form ─────────────────────────────────────────────────────────
+{
+  const json = JSON.parse(JSON.stringify(m.toJSON()));
+  const back = PhraseMatcher.fromJSON(json);
+  const probe = normalizeForMatch(listed.join(" . ") + " and some real words in between");
+  check("toJSON → fromJSON round trip matches identically", spans(back.matches(probe)) === spans(m.matches(probe)) && back.phrases === m.phrases);
+  let rejected = 0;
+  for (const bad of [{ ...json, version: 2 }, { ...json, fail: json.fail.slice(0, 8) }]) {
+    try { PhraseMatcher.fromJSON(bad); } catch { rejected++; }
+  }
+  check("a foreign or inconsistent compiled form is rejected, not trusted", rejected === 2);
+}
+
+// ── coverage ────────────────────────────────────────────────────────────────
+{
+  const cov = (s: string) => m.covers(normalizeForMatch(s));
+  check("covers: the whole text is one listed phrase (short filler included)", cov("Thank you.") && cov("Okay."));
+  check("covers: several hallucinations back to back, one distinctive", cov("Thanks for watching! Bye.") && cov("I'll see you next time. Thank you."));
+  check("uncovered: short filler only, not whole-text", !cov("Yes. Okay. Thank you.") && !cov("Okay, thank you. I don't know."));
+  check("uncovered: real speech around a listed phrase", !cov("thank you for watching the demo we will send the deck"));
+  check("covers: not fooled by an empty string", !m.covers(""));
+}
+
+// ── tandem repeats ──────────────────────────────────────────────────────────
+{
+  const w = (s: string) => s.split(" ");
+  const r = longestTandemRepeat(w("okay so i love it i love it i love it and then"));
+  check("finds a mid-segment loop: n=3 × 3 at word 2", r.n === 3 && r.copies === 3 && r.at === 2, JSON.stringify(r));
+  check("no loop in plain speech", longestTandemRepeat(w("the quick brown fox jumps over the lazy dog")).copies === 0);
+  check("two copies are not a loop (minCopies 3)", longestTandemRepeat(w("we can we can do it")).copies === 0);
+  check("prefers the longest span", longestTandemRepeat(w("a a a b c d b c d b c d b c d")).n === 3);
+  const big = Array.from({ length: 200_000 }, (_, i) => `w${i % 7919}`);
+  const t0 = performance.now();
+  longestTandemRepeat(big);
+  const dt = performance.now() - t0;
+  check("linear: 200k tokens in well under a second", dt < 1000, `${dt.toFixed(0)} ms`);
+}
+
+// ── flat cost in the list size ──────────────────────────────────────────────
+{
+  const many = Array.from({ length: 20_000 }, (_, i) => `phrase number ${i} of the harvested list`);
+  const big = PhraseMatcher.compile([...listed, ...many]);
+  const segment = normalizeForMatch("so let's go over the roadmap for the next quarter and then wrap up ".repeat(4));
+  const time = (mm: PhraseMatcher) => { const t0 = performance.now(); for (let i = 0; i < 2000; i++) mm.covers(segment); return performance.now() - t0; };
+  time(m); time(big);
+  const small = time(m), large = time(big);
+  check("per-segment cost is flat as the list grows 100×", large < small * 3 + 5, `small=${small.toFixed(1)}ms large=${large.toFixed(1)}ms`);
+}
+
+if (failed) { console.error(`\n❌ hallucination-matcher: ${failed} checks FAILED.`); process.exit(1); }
+console.log(`\n✅ hallucination-matcher: all checks pass — one-pass automaton ≡ naive scan, precompiled round trip, linear loops.`);
@@ -0,0 +1,240 @@
+/**
+ * Hallucination matcher — the phrase lists compiled into ONE Aho-Corasick automaton, plus a
+ * linear-time repeated-n-gram (tandem repeat) detector.
+ *
+ * A segment is scanned once, whatever the number of phrases: every known phrase occurring anywhere
+ * in it (on word boundaries) is found in the same pass. The filter uses that to catch segments made
+ * ENTIRELY of hallucinations — "Thank you for watching. Please subscribe. Bye." — not just the exact
+ * one-phrase strings a Set lookup sees. Real speech that merely contains a list phrase is never
+ * covered, so it is kept.
+ *
+ * The automaton flattens to typed arrays (`toJSON` / `fromJSON`), so the build ships it precompiled
+ * next to the lists and a bot loads it without rebuilding the trie.
+ */
+
+/**
+ * The match form: NFKC, lower-case, every run of non-letter/digit characters (punctuation, dashes,
+ * ellipses, whitespace) collapsed to one space. "Bye-bye…" and "bye bye" are the same string.
+ */
+export function normalizeForMatch(text: string): string {
+  return text.normalize('NFKC').toLowerCase().replace(/’/g, "'")
+    .replace(/[^\p{L}\p{N}\p{M}']+/gu, ' ').replace(/(^| )'+|'+(?= |$)/g, '$1').trim();
+}
+
+/** Scripts written without spaces — a phrase there may start or end next to any character. */
+const UNSPACED = /[\p{sc=Han}\p{sc=Hiragana}\p{sc=Katakana}\p{sc=Thai}\p{sc=Lao}\p{sc=Khmer}\p{sc=Myanmar}]/u;
+
+/**
+ * A phrase is DISTINCTIVE — evidence on its own that the segment is a hallucination — when it has
+ * three or more words and 16+ characters ("thanks for watching"), or six or more characters of an
+ * unspaced script. Short filler the lists also carry ("yes", "okay thank you", "i don't know") only
+ * counts when it is the whole segment, so "Yes. Okay, thank you." stays.
+ */
+function distinctive(phrase: string): boolean {
+  return (phrase.split(' ').length >= 3 && phrase.length >= 16) || (UNSPACED.test(phrase) && phrase.length >= 6);
+}
+
+/** Word boundary between code units a and b (either may be undefined at the string's edges). */
+function boundary(a: string | undefined, b: string | undefined): boolean {
+  return a === undefined || b === undefined || a === ' ' || b === ' ' || UNSPACED.test(a) || UNSPACED.test(b);
+}
+
+export interface PhraseMatch { start: number; end: number; distinctive: boolean }
+
+export interface CompiledPhraseMatcher {
+  version: 1;
+  /** Fingerprint of the sources it was compiled from (the loader's staleness check). */
+  source: string;
+  phrases: number;
+  /** base64 little-endian typed arrays, one entry per state (edge arrays: per edge). */
+  edgeStart: string; edgeChar: string; edgeTo: string; fail: string; out: string; depth: string; flags: string;
+}
+
+const FLAG_TERMINAL = 1;
+const FLAG_DISTINCTIVE = 2;
+
+const b64 = (a: Int32Array | Uint16Array | Uint8Array) => Buffer.from(a.buffer, a.byteOffset, a.byteLength).toString('base64');
+function unb64<T>(s: string, Ctor: { new (b: ArrayBuffer): T; BYTES_PER_ELEMENT: number }): T {
+  const bytes = Buffer.from(s, 'base64');
+  if (bytes.length % Ctor.BYTES_PER_ELEMENT) throw new Error('compiled matcher: truncated array');
+  const copy = new ArrayBuffer(bytes.length);                    // aligned, owned
+  new Uint8Array(copy).set(bytes);
+  return new Ctor(copy);
+}
+
+/**
+ * Multi-pattern matcher over normalized text. State 0 is the root; state s's outgoing edges are
+ * `edgeChar/edgeTo[edgeStart[s] .. edgeStart[s+1])`, sorted by char. `out[s]` is the deepest
+ * terminal on s's fail chain (s itself included), or -1 — so every phrase ending at a position is
+ * reached by following `out` / `fail` without visiting non-terminal states.
+ */
+export class PhraseMatcher {
+  private constructor(
+    readonly phrases: number,
+    readonly source: string,
+    private readonly edgeStart: Int32Array,
+    private readonly edgeChar: Uint16Array,
+    private readonly edgeTo: Int32Array,
+    private readonly fail: Int32Array,
+    private readonly out: Int32Array,
+    private readonly depth: Int32Array,
+    private readonly flags: Uint8Array,
+  ) {}
+
+  /** Compile phrases (any form — each is normalized; blanks and duplicates are dropped). */
+  static compile(phrases: Iterable<string>, source = ''): PhraseMatcher {
+    const children: Map<number, number>[] = [new Map()];
+    const flagList: number[] = [0];
+    const depthList: number[] = [0];
+    let count = 0;
+    for (const raw of phrases) {
+      const p = normalizeForMatch(raw);
+      if (!p) continue;
+      let s = 0;
+      for (let i = 0; i < p.length; i++) {
+        const c = p.charCodeAt(i);
+        let next = children[s].get(c);
+        if (next === undefined) {
+          next = children.length;
+          children.push(new Map());
+          flagList.push(0);
+          depthList.push(depthList[s] + 1);
+          children[s].set(c, next);
+        }
+        s = next;
+      }
+      if (!(flagList[s] & FLAG_TERMINAL)) count++;
+      flagList[s] |= FLAG_TERMINAL | (distinctive(p) ? FLAG_DISTINCTIVE : 0);
+    }
+
+    const n = children.length;
+    const fail = new Int32Array(n);
+    const out = new Int32Array(n).fill(-1);
+    const order: number[] = [0];                                  // BFS: parents before children
+    for (let head = 0; head < order.length; head++) {
+      const s = order[head];
+      if (flagList[s] & FLAG_TERMINAL) out[s] = s;
+      else if (s !== 0) out[s] = out[fail[s]];
+      for (const [c, t] of children[s]) {
+        let f = fail[s];
+        while (s !== 0 && f !== 0 && !children[f].has(c)) f = fail[f];
+        fail[t] = s === 0 ? 0 : (children[f].get(c) ?? 0);
+        order.push(t);
+      }
+    }
+
+    const edgeStart = new Int32Array(n + 1);
+    let edges = 0;
+    for (let s = 0; s < n; s++) { edgeStart[s] = edges; edges += children[s].size; }
+    edgeStart[n] = edges;
+    const edgeChar = new Uint16Array(edges);
+    const edgeTo = new Int32Array(edges);
+    for (let s = 0; s < n; s++) {
+      const sorted = [...children[s]].sort((a, b) => a[0] - b[0]);
+      sorted.forEach(([c, t], k) => { edgeChar[edgeStart[s] + k] = c; edgeTo[edgeStart[s] + k] = t; });
+    }
+    return new PhraseMatcher(count, source, edgeStart, edgeChar, edgeTo, fail, out,
+      Int32Array.from(depthList), Uint8Array.from(flagList));
+  }
+
+  static fromJSON(c: CompiledPhraseMatcher): PhraseMatcher {
+    if (c?.version !== 1) throw new Error(`compiled matcher: unsupported version ${c?.version}`);
+    const m = new PhraseMatcher(c.phrases, c.source,
+      unb64(c.edgeStart, Int32Array), unb64(c.edgeChar, Uint16Array), unb64(c.edgeTo, Int32Array),
+      unb64(c.fail, Int32Array), unb64(c.out, Int32Array), unb64(c.depth, Int32Array), unb64(c.flags, Uint8Array));
+    const states = m.fail.length;
+    if (m.edgeStart.length !== states + 1 || m.out.length !== states || m.depth.length !== states ||
+        m.flags.length !== states || m.edgeChar.length !== m.edgeTo.length || m.edgeStart[states] !== m.edgeTo.length) {
+      throw new Error('compiled matcher: inconsistent arrays');
+    }
+    return m;
+  }
+
+  toJSON(): CompiledPhraseMatcher {
+    return {
+      version: 1, source: this.source, phrases: this.phrases,
+      edgeStart: b64(this.edgeStart), edgeChar: b64(this.edgeChar), edgeTo: b64(this.edgeTo),
+      fail: b64(this.fail), out: b64(this.out), depth: b64(this.depth), flags: b64(this.flags),
+    };
+  }
+
+  private step(s: number, c: number): number {
+    for (;;) {
+      let lo = this.edgeStart[s], hi = this.edgeStart[s + 1] - 1;
+      while (lo <= hi) {
+        const mid = (lo + hi) >> 1;
+        const m = this.edgeChar[mid];
+        if (m === c) return this.edgeTo[mid];
+        if (m < c) lo = mid + 1; else hi = mid - 1;
+      }
+      if (s === 0) return 0;
+      s = this.fail[s];
+    }
+  }
+
+  /**
+   * Every known phrase in `normalized` (a `normalizeForMatch` string) that sits on word
+   * boundaries — at each end position only the longest such phrase (shorter ones ending there
+   * lie inside it). One pass; cost is the text length plus the matches, not the list size.
+   */
+  matches(normalized: string): PhraseMatch[] {
+    const found: PhraseMatch[] = [];
+    let s = 0;
+    for (let i = 0; i < normalized.length; i++) {
+      s = this.step(s, normalized.charCodeAt(i));
+      if (!boundary(normalized[i], normalized[i + 1])) continue;
+      for (let t = this.out[s]; t >= 0; t = this.out[this.fail[t]]) {
+        const start = i + 1 - this.depth[t];
+        if (boundary(normalized[start - 1], normalized[start])) {
+          found.push({ start, end: i + 1, distinctive: (this.flags[t] & FLAG_DISTINCTIVE) !== 0 });
+          break;
+        }
+      }
+    }
+    return found;
+  }
+
+  /**
+   * True when known phrases account for ALL of `normalized`: either one phrase is the whole text,
+   * or the matches cover every character and at least one of them is distinctive.
+   */
+  covers(normalized: string): boolean {
+    const found = this.matches(normalized);
+    if (found.some((m) => m.start === 0 && m.end === normalized.length)) return true;
+    if (!found.some((m) => m.distinctive)) return false;
+    let reach = 0;
+    for (const m of found.sort((a, b) => a.start - b.start)) {
+      if (m.start > reach && normalized.slice(reach, m.start) !== ' ') return false;   // uncovered text
+      reach = Math.max(reach, m.end);
+    }
+    return reach === normalized.length;
+  }
+}
+
+/**
+ * Longest tandem repeat in `tokens`: the n-gram (n ≤ maxN) repeated back-to-back at least
+ * `minCopies` times that spans the most tokens, as { n, copies, at } (copies 0 when none). Linear —
+ * for each n one pass counts how long `tokens[i] === tokens[i-n]` has held, which is exactly a run
+ * of consecutive copies. Tokens are interned so the comparison is an integer compare.
+ */
+export function longestTandemRepeat(
+  tokens: readonly string[], { maxN = 8, minCopies = 3 }: { maxN?: number; minCopies?: number } = {},
+): { n: number; copies: number; at: number } {
+  const ids = new Int32Array(tokens.length);
+  const intern = new Map<string, number>();
+  tokens.forEach((t, i) => {
+    let id = intern.get(t);
+    if (id === undefined) { id = intern.size; intern.set(t, id); }
+    ids[i] = id;
+  });
+  let best = { n: 0, copies: 0, at: 0 };
+  for (let n = 1; n <= maxN && minCopies * n <= ids.length; n++) {
+    let run = 0;
+    for (let i = n; i < ids.length; i++) {
+      run = ids[i] === ids[i - n] ? run + 1 : 0;
+      const copies = Math.floor((run + n) / n);
+      if (copies >= minCopies && copies * n > best.copies * best.n) best = { n, copies, at: i + 1 - (run + n) };
+    }
+  }
+  return best;
+}
@@ -1,6 +1,7 @@
 import { log } from './log.js';
 import { isHallucination } from './hallucination-filter.js';
-import { longestCommonWordPrefix } from '@vexa/transcribe-buffer';
+import { longestCommonWordPrefix, PcmRing } from '@vexa/transcribe-buffer';
+import { rms as kernelRms } from '@vexa/audio-kernels';
 
 /**
  * Per-speaker audio buffer with offset-based sliding window.
@@ -13,8 +14,24 @@ import { longestCommonWordPrefix } from '@vexa/transcribe-buffer';
  * On confirmation, confirmedSamples advances — audio is trimmed from the front.
  * Buffer never fully resets during continuous speech. Full reset only on speaker
  * change or idle timeout.
+ *
+ * Windowed mode (maxSubmitWindowSec > 0): while LocalAgreement has not confirmed a
+ * prefix, the unconfirmed window regrows on every submit, so a long monologue is
+ * re-transcribed O(n²). Windowed mode caps each draft submission at maxSubmitWindowSec
+ * of unconfirmed audio, led by contextSec of already-confirmed audio as acoustic
+ * context; results are stitched back by segment timestamps (segments inside the
+ * lead-in are dropped, the rest shifted onto the window's timeline). STT cost then
+ * grows linearly with speech time — getSubmitStats() reports it.
+ *
+ * Audio lives in a per-speaker PcmRing: buffer sample i is ring position ring.start + i,
+ * so trimming confirmed audio is O(1), a submission is one contiguous copy out of the
+ * ring, and the silence gate reads the window's RMS from the ring's running sums before
+ * anything is allocated.
  */
 
+/** Initial per-speaker ring capacity (seconds) — rounded up to a power of two. */
+const RING_INITIAL_SEC = 8;
+
 interface WhisperSegment {
   text: string;
   start: number;
@@ -24,7 +41,8 @@ interface WhisperSegment {
 interface SpeakerBuffer {
   speakerId: string;
   speakerName: string;
-  chunks: Float32Array[];
+  /** Buffered audio — [ring.start, ring.end) is this buffer's sample 0..totalSamples */
+  ring: PcmRing;
   totalSamples: number;
   /** Samples already confirmed and emitted — next submission starts here */
   confirmedSamples: number;
@@ -67,6 +85,16 @@ interface SpeakerBuffer {
    *  upsert-by-id replaces the pending row (rather than appending a new id and
    *  leaving the draft dangling). */
   pendingDraftStartMs: number;
+  /** Windowed mode: the last contextSec of confirmed audio, re-sent ahead of the next window */
+  contextTail: Float32Array;
+  /** Seconds of contextTail leading the in-flight submission (stripped when stitching) */
+  submitContextSec: number;
+  /** The latest submission was cut at maxSubmitWindowSec: its last segment abuts the cut, and
+   *  lastTranscript does not cover the audio past it */
+  submitCapped: boolean;
+  /** Samples fed / samples sent to Whisper for this speaker (getSubmitStats) */
+  fedSamples: number;
+  submittedSamples: number;
 }
 
 export interface SpeakerStreamManagerConfig {
@@ -86,14 +114,42 @@ export interface SpeakerStreamManagerConfig {
    *  yields "YouTube-outro" hallucinations. Conservative default (well under speech) so it only
    *  drops true silence; the phrase-list filter is the language-agnostic backstop. Default: 0.0025 */
   silenceRmsThreshold?: number;
+  /** Windowed resubmission: cap each draft submission at this much unconfirmed audio
+   *  (seconds). Final (idle/flush) submissions stay whole. 0 = unbounded. Default: 0 */
+  maxSubmitWindowSec?: number;
+  /** Windowed mode only: confirmed audio re-sent ahead of each window as context (seconds).
+   *  Default: 1 */
+  contextSec?: number;
+}
+
+/** Whisper load of a SpeakerStreamManager: audio-seconds submitted vs audio-seconds fed.
+ *  Whisper compute scales with submitted audio, so the ratio is GPU-seconds per
+ *  audio-second up to the model's realtime factor. */
+export interface SubmitStats {
+  audioSec: number;
+  submittedSec: number;
+  submittedPerAudioSec: number;
 }
 
-/** Root-mean-square energy of a PCM window in [-1,1]; the near-silent oracle (#617). */
+/** Root-mean-square energy of a PCM window in [-1,1]; the near-silent oracle (#617).
+ *  The shared @vexa/audio-kernels RMS (WASM SIMD when the host has it). */
 export function rms(samples: Float32Array): number {
-  if (samples.length === 0) return 0;
-  let sum = 0;
-  for (let i = 0; i < samples.length; i++) sum += samples[i] * samples[i];
-  return Math.sqrt(sum / samples.length);
+  return kernelRms(samples);
+}
+
+/** Windowed stitching: a segment that starts inside the context lead-in re-transcribes the end
+ *  of the last confirmed text — drop the longest leading word run echoing that tail (compared
+ *  case- and punctuation-insensitively). */
+export function stripEchoedLead(text: string, confirmedText: string): string {
+  const words = text.trim().split(/\s+/).filter(w => w.length > 0);
+  const tail = confirmedText.trim().split(/\s+/).filter(w => w.length > 0);
+  const norm = (w: string) => w.toLowerCase().replace(/[^\p{L}\p{N}']/gu, '');
+  for (let k = Math.min(words.length, tail.length); k > 0; k--) {
+    let echoed = true;
+    for (let i = 0; i < k && echoed; i++) echoed = norm(words[i]) === norm(tail[tail.length - k + i]);
+    if (echoed) return words.slice(k).join(' ');
+  }
+  return words.join(' ');
 }
 
 export class SpeakerStreamManager {
@@ -106,6 +162,11 @@ export class SpeakerStreamManager {
   private idleTimeoutSec: number;
   private sampleRate: number;
   private silenceRmsThreshold: number;
+  private maxSubmitWindowSec: number;
+  private contextSec: number;
+  /** Manager-wide totals behind getSubmitStats() — survive speaker removal */
+  private fedSamples = 0;
+  private submittedSamples = 0;
   /** Audio carried forward from a flushed short segment — prepended to the next feedAudio call */
   private carryForward: Float32Array[] = [];
   /** Generation at time of last submission — used to detect stale responses after fullReset */
@@ -131,6 +192,8 @@ export class SpeakerStreamManager {
     this.idleTimeoutSec = config?.idleTimeoutSec ?? 15;
     this.sampleRate = config?.sampleRate ?? 16000;
     this.silenceRmsThreshold = config?.silenceRmsThreshold ?? 0.0025;
+    this.maxSubmitWindowSec = config?.maxSubmitWindowSec ?? 0;
+    this.contextSec = config?.contextSec ?? 1;
   }
 
   addSpeaker(speakerId: string, speakerName: string): void {
@@ -140,7 +203,7 @@ export class SpeakerStreamManager {
     this.buffers.set(speakerId, {
       speakerId,
       speakerName,
-      chunks: [],
+      ring: this.newRing(),
       totalSamples: 0,
       confirmedSamples: 0,
       lastTranscript: '',
@@ -158,6 +221,11 @@ export class SpeakerStreamManager {
       lastConfirmedText: '',
       pendingDraftText: '',
       pendingDraftStartMs: now,
+      contextTail: new Float32Array(0),
+      submitContextSec: 0,
+      submitCapped: false,
+      fedSamples: 0,
+      submittedSamples: 0,
     });
 
     const timer = setInterval(() => this.trySubmit(speakerId), this.submitInterval * 1000);
@@ -189,9 +257,10 @@ export class SpeakerStreamManager {
       if (atMs - bufferedEndMs > 2000) {
         // Detach the buffered stretch and finish it asynchronously on the
         // snapshot, then reset the live buffer NOW — the new turn must never
-        // append to (or race with) the old stretch. fullReset() assigns fresh
-        // arrays, so the snapshot keeps the old chunks untouched.
+        // append to (or race with) the old stretch. The snapshot keeps the old
+        // ring; the live buffer continues on a fresh one.
         const detached: SpeakerBuffer = { ...buffer };
+        buffer.ring = this.newRing();
         this.fullReset(buffer);
         if (detached.lastTranscript) {
           this.emitSegment(detached, detached.lastTranscript);
@@ -216,8 +285,10 @@ export class SpeakerStreamManager {
       buffer.bufferStartMs = atMs ?? Date.now();
     }
 
-    buffer.chunks.push(audioData);
+    buffer.ring.push(audioData);
     buffer.totalSamples += audioData.length;
+    buffer.fedSamples += audioData.length;
+    this.fedSamples += audioData.length;
     buffer.lastAudioTimestamp = Date.now();
     buffer.idleSubmitted = false;
   }
@@ -242,6 +313,9 @@ export class SpeakerStreamManager {
     if (!buffer) return false;
 
     buffer.inFlight = false;
+    const contextSec = buffer.submitContextSec;
+    const capped = buffer.submitCapped;
+    buffer.submitContextSec = 0;
 
     // Discard stale responses: if the buffer was reset (generation bumped)
     // while a Whisper request was in flight, this response is for audio that
@@ -256,6 +330,28 @@ export class SpeakerStreamManager {
     // now — before any emit path below — so the very confirm this result triggers carries it.
     if (language) buffer.lastLanguage = language;
 
+    // Windowed mode: the submission led with contextSec of already-confirmed audio. Stitch the
+    // result onto the window's own timeline — a segment whose midpoint falls in the lead-in was
+    // already emitted (drop it); the rest shift back by the lead-in, and one that straddles it
+    // loses the leading words echoing the last confirmed text. Without segments only the end
+    // offset can be corrected.
+    if (contextSec > 0) {
+      if (segments && segments.length > 0) {
+        segments = segments
+          .filter(s => (s.start + s.end) / 2 > contextSec)
+          .map(s => ({
+            text: s.start < contextSec ? stripEchoedLead(s.text, buffer.lastConfirmedText) : s.text,
+            start: Math.max(0, s.start - contextSec),
+            end: Math.max(0, s.end - contextSec),
+          }))
+          .filter(s => s.text.trim().length > 0);
+        transcript = segments.map(s => s.text.trim()).filter(t => t.length > 0).join(' ');
+        segmentEndSec = segments.length > 0 ? segments[segments.length - 1].end : undefined;
+      } else if (segmentEndSec !== undefined) {
+        segmentEndSec = Math.max(0, segmentEndSec - contextSec);
+      }
+    }
+
     // Segmentation closed this buffer while this request was in flight: the
     // text covers the pre-trim window (may include the next segment's audio).
     // Discard it and submit the owned audio as the final window.
@@ -327,8 +423,11 @@ export class SpeakerStreamManager {
       // Confirm if prefix covers at least 1 word but NOT all current words
       // (trailing words are still forming and may change next submission).
       // With confirmThreshold=2, having a common prefix between 2 consecutive
-      // submissions already satisfies the threshold.
-      if (prefixLen > 0 && prefixLen < currentWords.length) {
+      // submissions already satisfies the threshold. A window cut at
+      // maxSubmitWindowSec resends the same audio until it confirms, so a fully
+      // stable capped result confirms too — minus its last segment (it abuts the
+      // cut) unless that segment is all there is.
+      if (prefixLen > 0 && (prefixLen < currentWords.length || capped)) {
         // Map confirmed prefix words back to full Whisper segments for timestamps.
         // Only emit segments whose words are entirely within the confirmed prefix.
         let wordsRemaining = prefixLen;
@@ -342,6 +441,7 @@ export class SpeakerStreamManager {
             break; // Partial segment — don't emit partial
           }
         }
+        if (capped && confirmedSegCount === segments.length && confirmedSegCount > 1) confirmedSegCount--;
 
         if (confirmedSegCount > 0) {
           const baseWindowMs = buffer.windowStartMs;
@@ -400,6 +500,10 @@ export class SpeakerStreamManager {
 
     const buffer = this.buffers.get(speakerId);
     if (buffer) {
+      if (buffer.fedSamples > 0) {
+        log(`[SpeakerStreams] STT load for "${buffer.speakerName}": ${(buffer.submittedSamples / this.sampleRate).toFixed(1)}s submitted / ` +
+            `${(buffer.fedSamples / this.sampleRate).toFixed(1)}s audio = ${(buffer.submittedSamples / buffer.fedSamples).toFixed(2)} GPU-s per audio-s`);
+      }
       if (this.unconfirmedSamples(buffer) > 0 && buffer.lastTranscript) {
         this.emitSegment(buffer, buffer.lastTranscript);
       }
@@ -445,6 +549,13 @@ export class SpeakerStreamManager {
     return this.buffers.get(speakerId)?.lastConfirmedText ?? '';
   }
 
+  /** Whisper load so far across every speaker (see SubmitStats). */
+  getSubmitStats(): SubmitStats {
+    const audioSec = this.fedSamples / this.sampleRate;
+    const submittedSec = this.submittedSamples / this.sampleRate;
+    return { audioSec, submittedSec, submittedPerAudioSec: audioSec > 0 ? submittedSec / audioSec : 0 };
+  }
+
   removeAll(): void {
     for (const speakerId of Array.from(this.buffers.keys())) {
       this.removeSpeaker(speakerId);
@@ -483,8 +594,9 @@ export class SpeakerStreamManager {
     // speaker's buffer start, which makes the speaker-mapper unable to attribute
     // carried words correctly. Direct submission preserves correct timing.
 
-    // Have transcript — emit and reset
-    if (buffer.lastTranscript) {
+    // Have transcript — emit and reset (unless it only covers a capped window: the
+    // final submit below then transcribes everything owned)
+    if (buffer.lastTranscript && !buffer.submitCapped) {
       this.emitSegment(buffer, buffer.lastTranscript);
       this.fullReset(buffer);
       return;
@@ -609,6 +721,8 @@ export class SpeakerStreamManager {
   /**
    * Submit only the UNCONFIRMED portion of the buffer to Whisper.
    * Audio before confirmedSamples has already been transcribed and emitted.
+   * In windowed mode a draft submission is capped at maxSubmitWindowSec and led by the
+   * context tail; final (idle/flush) submissions still send everything unconfirmed.
    * Near-silent windows (RMS < silenceRmsThreshold) are NOT submitted (#617) — silence yields
    * hallucinated boilerplate, so it never reaches Whisper.
    */
@@ -616,22 +730,12 @@ export class SpeakerStreamManager {
     const unconfirmed = this.unconfirmedSamples(buffer);
     if (unconfirmed === 0 || !this.onSegmentReady) return;
 
-    // Build audio from confirmedSamples onward
-    const combined = new Float32Array(unconfirmed);
-    let dstOffset = 0;
-    let samplesToSkip = buffer.confirmedSamples;
-
-    for (const chunk of buffer.chunks) {
-      if (samplesToSkip >= chunk.length) {
-        samplesToSkip -= chunk.length;
-        continue;
-      }
-      const start = samplesToSkip;
-      samplesToSkip = 0;
-      const toCopy = chunk.length - start;
-      combined.set(chunk.subarray(start), dstOffset);
-      dstOffset += toCopy;
-    }
+    const windowed = this.maxSubmitWindowSec > 0;
+    const take = windowed && !buffer.idleSubmitted
+      ? Math.min(unconfirmed, Math.floor(this.maxSubmitWindowSec * this.sampleRate))
+      : unconfirmed;
+    const context = windowed ? buffer.contextTail : new Float32Array(0);
+    const from = buffer.ring.start + buffer.confirmedSamples;
 
     // #617: near-silent guard. faster-whisper emits "YouTube-outro" boilerplate on silence
     // (ご視聴… / Abone… / "thanks for watching"), which then rides a phantom speaker with
@@ -639,13 +743,23 @@ export class SpeakerStreamManager {
     // it was never implemented. Skip the submission (never set inFlight): the buffer stays, so a
     // later louder window submits normally, and the idle path (trySubmit) still emits any earlier
     // lastTranscript and resets. The phrase-list filter remains the language-agnostic backstop.
-    if (rms(combined) < this.silenceRmsThreshold) {
-      log(`[SpeakerStreams] [SILENT-SKIP] "${buffer.speakerName}" ${(unconfirmed / this.sampleRate).toFixed(1)}s window ` +
+    if (buffer.ring.rms(from, from + take) < this.silenceRmsThreshold) {
+      log(`[SpeakerStreams] [SILENT-SKIP] "${buffer.speakerName}" ${(take / this.sampleRate).toFixed(1)}s window ` +
           `below RMS ${this.silenceRmsThreshold} — not submitting (no hallucination surface)`);
       return;
     }
 
+    // Build audio from confirmedSamples onward (after the context lead-in, if any). A copy,
+    // not a ring view: the consumer owns it across the STT call while the ring keeps moving.
+    const combined = new Float32Array(context.length + take);
+    combined.set(context);
+    this.copySamples(buffer, buffer.confirmedSamples, take, combined, context.length);
+
     buffer.inFlight = true;
+    buffer.submitContextSec = context.length / this.sampleRate;
+    buffer.submitCapped = take < unconfirmed;
+    buffer.submittedSamples += combined.length;
+    this.submittedSamples += combined.length;
     this.submitGeneration.set(buffer.speakerId, buffer.generation);
 
     try {
@@ -729,7 +843,10 @@ export class SpeakerStreamManager {
       buffer.confirmedSamples = buffer.totalSamples;
     }
 
-    // Trim confirmed chunks from the front to free memory
+    // Windowed mode: keep the tail of the just-confirmed audio as the next window's lead-in
+    if (this.maxSubmitWindowSec > 0) this.keepContextTail(buffer);
+
+    // Trim confirmed audio from the front (O(1) — the ring start advances)
     this.trimBuffer(buffer);
 
     // Reset confirmation state for the next segment window
@@ -743,7 +860,7 @@ export class SpeakerStreamManager {
     // the next submission republishes the forming draft under the new id, and turn-close finalizes it.
     buffer.pendingDraftText = '';
 
-    log(`[SpeakerStreams] Offset advanced for "${buffer.speakerName}" (confirmed=${buffer.confirmedSamples}, total=${buffer.totalSamples}, trimmed to ${buffer.chunks.length} chunks)`);
+    log(`[SpeakerStreams] Offset advanced for "${buffer.speakerName}" (confirmed=${buffer.confirmedSamples}, total=${buffer.totalSamples}, retained ${(buffer.ring.length / this.sampleRate).toFixed(1)}s)`);
   }
 
   /**
@@ -764,18 +881,8 @@ export class SpeakerStreamManager {
       log(`[SpeakerStreams] trimTailAfter skipped for "${buffer.speakerName}": boundary ${tMs} <= windowStart ${buffer.windowStartMs}`);
       return;
     }
-    let excess = buffer.totalSamples - keep;
-    const droppedSec = excess / this.sampleRate;
-    while (excess > 0 && buffer.chunks.length > 0) {
-      const last = buffer.chunks[buffer.chunks.length - 1];
-      if (last.length <= excess) {
-        excess -= last.length;
-        buffer.chunks.pop();
-      } else {
-        buffer.chunks[buffer.chunks.length - 1] = last.subarray(0, last.length - excess);
-        excess = 0;
-      }
-    }
+    const droppedSec = (buffer.totalSamples - keep) / this.sampleRate;
+    buffer.ring.truncate(buffer.ring.start + keep);
     buffer.totalSamples = keep;
     if (buffer.confirmedSamples > keep) buffer.confirmedSamples = keep;
     buffer.lastTranscript = '';
@@ -785,39 +892,50 @@ export class SpeakerStreamManager {
   }
 
   /**
-   * Trim confirmed audio chunks from the front of the buffer.
+   * Copy `count` buffered samples starting at sample `from` into `dst` at `dstOffset`.
+   */
+  private copySamples(buffer: SpeakerBuffer, from: number, count: number, dst: Float32Array, dstOffset: number): void {
+    const at = buffer.ring.start + from;
+    dst.set(buffer.ring.view(at, at + count), dstOffset);
+  }
+
+  /**
+   * Refresh contextTail to the last contextSec of audio before confirmedSamples. A short
+   * confirmation tops up from the previous tail so the lead-in stays contextSec long.
+   */
+  private keepContextTail(buffer: SpeakerBuffer): void {
+    const want = Math.floor(this.contextSec * this.sampleRate);
+    if (want <= 0) return;
+    const freshLen = Math.min(want, buffer.confirmedSamples);
+    const keepOld = Math.min(want - freshLen, buffer.contextTail.length);
+    const tail = new Float32Array(keepOld + freshLen);
+    tail.set(buffer.contextTail.subarray(buffer.contextTail.length - keepOld));
+    this.copySamples(buffer, buffer.confirmedSamples - freshLen, freshLen, tail, keepOld);
+    buffer.contextTail = tail;
+  }
+
+  /**
+   * Trim confirmed audio from the front of the buffer — O(1), the ring start moves.
    * Keeps all unconfirmed audio intact.
    */
   private trimBuffer(buffer: SpeakerBuffer): void {
     if (buffer.confirmedSamples === 0) return;
 
-    let samplesToTrim = buffer.confirmedSamples;
-    const newChunks: Float32Array[] = [];
-
-    for (const chunk of buffer.chunks) {
-      if (samplesToTrim >= chunk.length) {
-        samplesToTrim -= chunk.length;
-        continue;
-      }
-      if (samplesToTrim > 0) {
-        // Partial chunk — keep the tail
-        newChunks.push(chunk.subarray(samplesToTrim));
-        samplesToTrim = 0;
-      } else {
-        newChunks.push(chunk);
-      }
-    }
-
-    buffer.chunks = newChunks;
+    buffer.ring.trimTo(buffer.ring.start + buffer.confirmedSamples);
     buffer.totalSamples -= buffer.confirmedSamples;
     buffer.confirmedSamples = 0;
   }
 
+  /** A speaker's ring starts small (most turns are a few seconds) and doubles on demand. */
+  private newRing(): PcmRing {
+    return new PcmRing(RING_INITIAL_SEC * this.sampleRate);
+  }
+
   /**
    * Full reset — discard everything. Used on speaker change and idle cleanup.
    */
   private fullReset(buffer: SpeakerBuffer): void {
-    buffer.chunks = [];
+    buffer.ring.clear();
     buffer.totalSamples = 0;
     buffer.confirmedSamples = 0;
     buffer.lastTranscript = '';
@@ -830,6 +948,9 @@ export class SpeakerStreamManager {
     buffer.idleSubmitted = false;
     buffer.pendingFinal = false;
     buffer.carryForwardSamples = 0;
+    buffer.contextTail = new Float32Array(0);
+    buffer.submitContextSec = 0;
+    buffer.submitCapped = false;
     buffer.generation++;
   }
 }
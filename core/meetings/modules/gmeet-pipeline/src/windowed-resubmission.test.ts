@@ -0,0 +1,142 @@
+/**
+ * Windowed resubmission — a long monologue must cost Whisper LINEAR audio, not O(n²).
+ *
+ * The legacy engine resends everything after confirmedSamples on every submit; while LocalAgreement
+ * has not confirmed a prefix (Whisper returning one growing segment), each pass is longer than the
+ * last. With maxSubmitWindowSec every draft pass is capped at the window plus its context lead-in,
+ * results are stitched back by segment timestamps, and nothing is dropped or duplicated.
+ *
+ * Deterministic, OFFLINE: the counting oracle of count-channelswitch.test.ts (number K = a constant
+ * PCM run of K/1000), driven through the REAL SpeakerStreamManager with the submit tick stepped by
+ * hand every submitInterval of fed audio (no timers). Two mock-Whisper shapes:
+ *   • phrase segments (faithful timing) — the stitching oracle;
+ *   • ONE growing segment per pass — the shape that never confirms a prefix, the O(n²) case.
+ *
+ *   tsx src/windowed-resubmission.test.ts
+ */
+import { SpeakerStreamManager, stripEchoedLead, type SpeakerStreamManagerConfig } from './speaker-streams.js';
+
+const SR = 16000;
+const FRAME = 4800;                      // 0.3 s per number
+const N = 200;                           // 60 s monologue
+
+let failed = 0;
+const check = (name: string, cond: boolean, detail = '') => {
+  console.log(`  ${cond ? '✅' : '❌'} ${name}${cond ? '' : '  — ' + detail}`);
+  if (!cond) failed++;
+};
+
+type Seg = { start: number; end: number; text: string };
+/** Decode the marker runs back to numbers with sample-accurate timing. */
+const runs = (pcm: Float32Array): Seg[] => {
+  const out: Seg[] = [];
+  let i = 0;
+  while (i < pcm.length) {
+    const v = Math.round(pcm[i] * 1000);
+    if (v === 0) { i++; continue; }
+    const s = i;
+    while (i < pcm.length && Math.round(pcm[i] * 1000) === v) i++;
+    out.push({ start: s / SR, end: i / SR, text: String(v) });
+  }
+  return out;
+};
+/** Phrase-sized segments (three numbers each — a lone short token reads as a hallucination). */
+const phrases = (pcm: Float32Array): Seg[] => {
+  const r = runs(pcm);
+  const out: Seg[] = [];
+  for (let i = 0; i < r.length; i += 3) {
+    const g = r.slice(i, i + 3);
+    out.push({ start: g[0].start, end: g[g.length - 1].end, text: g.map((x) => x.text).join(' ') });
+  }
+  return out;
+};
+const oneSegment = (pcm: Float32Array): Seg[] => {
+  const r = runs(pcm);
+  return r.length ? [{ start: r[0].start, end: r[r.length - 1].end, text: r.map((x) => x.text).join(' ') }] : [];
+};
+
+async function monologue(config: SpeakerStreamManagerConfig, stt: (pcm: Float32Array) => Seg[]) {
+  const SID = 'ch-0:1';
+  const mgr = new SpeakerStreamManager({ submitInterval: 3600, ...config });   // tick stepped by hand
+  const confirmed: { text: string; startMs: number }[] = [];
+  const submitted: number[] = [];
+  let pending: Float32Array | null = null;
+  mgr.onSegmentReady = (_id, _name, audio) => { pending = audio; submitted.push(audio.length); };
+  mgr.onSegmentConfirmed = (_id, _name, text, startMs) => confirmed.push({ text, startMs });
+  const answer = () => {
+    const audio = pending;
+    if (!audio) return;
+    pending = null;
+    const segs = stt(audio);
+    mgr.handleTranscriptionResult(SID, segs.map((s) => s.text).join(' '), segs[segs.length - 1]?.end, segs, 'en');
+  };
+  mgr.addSpeaker(SID, 'Alice');
+  const t0 = 1_700_000_000_000;
+  const tick = (mgr as unknown as { trySubmit(id: string): Promise<void> }).trySubmit.bind(mgr);
+  const perTick = Math.round((2 * SR) / FRAME);     // a submit every ~2 s of fed audio
+  for (let k = 1; k <= N; k++) {
+    mgr.feedAudio(SID, new Float32Array(FRAME).fill(k / 1000), t0 + ((k - 1) * FRAME * 1000) / SR);
+    if (k % perTick === 0) { await tick(SID); answer(); }
+  }
+  const finalFrom = submitted.length;
+  await mgr.flushSpeaker(SID, true);
+  answer();
+  const drafts = submitted.slice(0, finalFrom);
+  const stats = mgr.getSubmitStats();
+  mgr.removeAll();
+  return { confirmed, drafts, stats };
+}
+
+const numsOf = (c: { text: string }[]) => c.flatMap((s) => (s.text.match(/\d+/g) || []).map(Number));
+
+async function run() {
+  const W = 4, CTX = 1;
+  const capSamples = (W + CTX) * SR;
+
+  // ── 1) stitching oracle: phrase segments, windowed ──
+  {
+    const { confirmed, drafts, stats } = await monologue({ maxSubmitWindowSec: W, contextSec: CTX }, phrases);
+    const nums = numsOf(confirmed);
+    const missing = Array.from({ length: N }, (_, i) => i + 1).filter((k) => !nums.includes(k));
+    check('windowed: every number confirmed (no drop)', missing.length === 0, `missing ${missing.slice(0, 20).join(',')}`);
+    check('windowed: no number duplicated by the context lead-in', nums.length === new Set(nums).size, `n=${nums.length}`);
+    check('windowed: numbers stay in order', nums.every((v, i) => i === 0 || v > nums[i - 1]));
+    const starts = confirmed.map((c) => c.startMs);
+    check('windowed: stitched segment times are monotonic', starts.every((v, i) => i === 0 || v >= starts[i - 1]));
+    check('windowed: every draft submission ≤ window + context', drafts.every((n) => n <= capSamples), `max=${Math.max(...drafts) / SR}s`);
+    check('windowed: GPU-s per audio-s is reported and bounded', stats.audioSec === (N * FRAME) / SR && stats.submittedPerAudioSec > 0 && stats.submittedPerAudioSec < W + CTX,
+      JSON.stringify(stats));
+  }
+
+  // ── 2) the O(n²) shape: one growing segment per pass never confirms a prefix ──
+  {
+    const legacy = await monologue({ maxBufferDuration: 30 }, oneSegment);
+    const windowed = await monologue({ maxBufferDuration: 30, maxSubmitWindowSec: W, contextSec: CTX }, oneSegment);
+    console.log(`  legacy ${legacy.stats.submittedPerAudioSec.toFixed(2)} vs windowed ${windowed.stats.submittedPerAudioSec.toFixed(2)} GPU-s per audio-s`);
+    check('legacy draft passes regrow past the window (the O(n²) baseline)', Math.max(...legacy.drafts) > capSamples * 2);
+    check('windowed draft passes stay ≤ window + context', windowed.drafts.every((n) => n <= capSamples), `max=${Math.max(...windowed.drafts) / SR}s`);
+    check('windowed costs materially less STT audio than legacy', windowed.stats.submittedSec < legacy.stats.submittedSec / 2,
+      `${windowed.stats.submittedSec}s vs ${legacy.stats.submittedSec}s`);
+    const nums = numsOf(windowed.confirmed);
+    const missing = Array.from({ length: N }, (_, i) => i + 1).filter((k) => !nums.includes(k));
+    check('windowed (coarse segments): no drop', missing.length === 0, `missing ${missing.slice(0, 20).join(',')}`);
+    check('windowed (coarse segments): the echoed lead-in is stripped (no dup)', nums.length === new Set(nums).size,
+      `dupes ${nums.filter((v, i) => nums.indexOf(v) !== i).slice(0, 20).join(',')}`);
+  }
+
+  // ── 3) off by default: no cap, legacy submissions byte-for-byte ──
+  {
+    const a = await monologue({}, phrases);
+    const b = await monologue({ contextSec: CTX }, phrases);
+    check('maxSubmitWindowSec unset ⇒ identical submissions (contextSec alone is inert)', JSON.stringify(a.drafts) === JSON.stringify(b.drafts));
+  }
+
+  // ── 4) echo stripping ──
+  check('stripEchoedLead drops the re-transcribed tail', stripEchoedLead('over there. And then we', 'we went over there') === 'And then we');
+  check('stripEchoedLead keeps text with no echo', stripEchoedLead('brand new words', 'old text') === 'brand new words');
+
+  if (failed) { console.error(`\n❌ windowed-resubmission: ${failed} check(s) FAILED`); process.exit(1); }
+  console.log('\n✅ windowed-resubmission: draft passes are bounded, stitched without drop/dup, and STT cost is linear.');
+}
+
+run().catch((e) => { console.error(e); process.exit(1); });
@@ -48,13 +48,15 @@ import { PyannoteSegmenter, type BoundaryEvent } from './pyannote-segmenter.js';
 import { env as transformersEnv } from '@huggingface/transformers';
 import { ClusterNameBinder, type HintKind } from './cluster-name-binder.js';
 import type { TranscriptionResult } from '@vexa/transcribe-whisper';
-import { localAgreement } from '@vexa/transcribe-buffer';
+import { localAgreement, PcmRing } from '@vexa/transcribe-buffer';
+import { rms } from '@vexa/audio-kernels';
 
 const SAMPLE_RATE = 16000;
 /** Near-silent spans are dropped before Whisper (desktop's DROP_RMS). */
 const DROP_RMS = 0.006;
 /** Ring capacity — must hold a full unconfirmed window plus segmenter lag. */
 const RING_MS = 120_000;
+const RING_SAMPLES = (RING_MS / 1000) * SAMPLE_RATE;
 /** Cap on the prompt fed to the next call (Whisper prompt window is small). */
 const PROMPT_TAIL_CHARS = 200;
 /** Unresolved turns kept for late hint renames. */
@@ -110,6 +112,17 @@ export interface ChunkSegment {
   language: string;
   /** Stable suffix — host prefixes its session uid. Same id on rename. */
   segmentId: string;
+  /** The STT pass this text came from (transcript.v1 Trace fields; the host adds the later hops). */
+  trace?: ChunkTrace;
+}
+
+/** Epoch-ms stamps of one STT pass; stt_* are the service's own queue/decode durations. */
+export interface ChunkTrace {
+  captured_ms: number;
+  submitted_ms: number;
+  stt_queue_ms?: number;
+  stt_decode_ms?: number;
+  transcribed_ms: number;
 }
 
 /** The cut source: streams frames, emits boundaries via the sink set at
@@ -152,7 +165,8 @@ export interface ChunkedTranscriberCallbacks {
   onHintOutcome?: (o: { name: string; kind: HintKind; tMs: number; outcome: 'matched' | 'missed' }) => void;
 }
 
-interface RingFrame { pcm: Float32Array; tMs: number }
+/** One fed frame's place in the ring: samples [at, at+n) were spoken from tMs. */
+interface RingFrame { at: number; n: number; tMs: number }
 /** Segmentation lifecycle items on the serialized queue: a boundary opens a turn
  *  (speech start / speaker change) or closes the open one (speaker change / end). */
 type SegItem =
@@ -199,21 +213,20 @@ interface Turn {
  *  clusterSegments, so only the window + key are kept here. */
 interface UnresolvedTurn { clusterId: string; t0: number; t1: number; blockedNames?: Set<string> }
 
-function rms(s: Float32Array): number {
-  if (s.length === 0) return 0;
-  let sum = 0;
-  for (let i = 0; i < s.length; i++) sum += s[i] * s[i];
-  return Math.sqrt(sum / s.length);
-}
-
 export class ChunkedTranscriber {
   private segmenter: BoundarySource | null = null;
   private segCounter = 0;
   private readonly binder = new ClusterNameBinder({});
   private readonly log: (msg: string) => void;
 
-  private ring: RingFrame[] = [];
-  private ringMs = 0;
+  /** Preallocated ring (next power of two ≥ RING_MS), cut by zero-copy views. */
+  private readonly ring = new PcmRing(RING_SAMPLES);
+  /** Frame index over the ring — `frames[framesHead..]` are the retained frames. */
+  private frames: RingFrame[] = [];
+  private framesHead = 0;
+  /** Ring position a cut handed to the in-flight transcribe call: retention never
+   *  trims past it, so the view stays valid for the whole call. */
+  private pinnedAt: number | null = null;
 
   /** First audio frame's timestamp — the FIRST turn back-extends to here
    *  (bounded): the model needs seconds to lock on, but speech from t=0 is
@@ -313,12 +326,8 @@ export class ChunkedTranscriber {
     if (this.disposed) return;
     if (this.firstAudioMs === null) this.firstAudioMs = tsMs;
     this.latestAudioMs = Math.max(this.latestAudioMs, tsMs + (pcm.length / SAMPLE_RATE) * 1000);
-    this.ring.push({ pcm, tMs: tsMs });
-    this.ringMs += (pcm.length / SAMPLE_RATE) * 1000;
-    while (this.ring.length > 0 && this.ringMs > RING_MS) {
-      const f = this.ring.shift()!;
-      this.ringMs -= (f.pcm.length / SAMPLE_RATE) * 1000;
-    }
+    if (pcm.length > 0) this.frames.push({ at: this.ring.push(pcm), n: pcm.length, tMs: tsMs });
+    this.retain();
     this.segmenter?.appendFrame(pcm, tsMs).catch((e: any) =>
       this.log(`[ChunkedTranscriber] segmenter error: ${e?.message}`));
   }
@@ -444,24 +453,55 @@ export class ChunkedTranscriber {
     void this.pump();
   }
 
+  /** Keep at most RING_MS of frames (never past a pinned in-flight cut). O(1) per
+   *  dropped frame; the index compacts once its dead head outweighs the live part. */
+  private retain(): void {
+    const end = this.ring.end;
+    while (this.framesHead < this.frames.length) {
+      const f = this.frames[this.framesHead];
+      if (end - f.at <= RING_SAMPLES) break;
+      if (this.pinnedAt !== null && f.at + f.n > this.pinnedAt) break;
+      this.framesHead++;
+    }
+    if (this.framesHead > 1024 && this.framesHead * 2 > this.frames.length) {
+      this.frames = this.frames.slice(this.framesHead);
+      this.framesHead = 0;
+    }
+    this.ring.trimTo(this.framesHead < this.frames.length ? this.frames[this.framesHead].at : end);
+  }
+
   /** Exact retroactive cut from the ring (frames are contiguous per source;
-   *  partial frames at the edges are sliced by sample offset). */
-  private cut(t0: number, t1: number): Float32Array {
-    const parts: Float32Array[] = [];
+   *  partial frames at the edges are sliced by sample offset). Contiguous frames
+   *  — the normal case — come back as ONE zero-copy ring view with its RMS from
+   *  the ring's running sums; `at` is its ring position (null for a copied cut). */
+  private cut(t0: number, t1: number): { pcm: Float32Array; rms: number; at: number | null } {
+    const parts: Array<[number, number]> = [];
     let total = 0;
-    for (const f of this.ring) {
+    let contiguous = true;
+    for (let i = this.framesHead; i < this.frames.length; i++) {
+      const f = this.frames[i];
       const fStart = f.tMs;
-      const fEnd = f.tMs + (f.pcm.length / SAMPLE_RATE) * 1000;
+      const fEnd = f.tMs + (f.n / SAMPLE_RATE) * 1000;
       if (fEnd <= t0) continue;
       if (fStart >= t1) break;
       const from = Math.max(0, Math.round(((t0 - fStart) / 1000) * SAMPLE_RATE));
-      const to = Math.min(f.pcm.length, Math.round(((t1 - fStart) / 1000) * SAMPLE_RATE));
-      if (to > from) { parts.push(f.pcm.subarray(from, to)); total += to - from; }
+      const to = Math.min(f.n, Math.round(((t1 - fStart) / 1000) * SAMPLE_RATE));
+      if (to > from) {
+        if (parts.length > 0 && parts[parts.length - 1][1] !== f.at + from) contiguous = false;
+        parts.push([f.at + from, f.at + to]);
+        total += to - from;
+      }
+    }
+    if (parts.length === 0) return { pcm: new Float32Array(0), rms: 0, at: null };
+    if (contiguous) {
+      const a = parts[0][0];
+      const b = parts[parts.length - 1][1];
+      return { pcm: this.ring.view(a, b), rms: this.ring.rms(a, b), at: a };
     }
     const out = new Float32Array(total);
     let off = 0;
-    for (const p of parts) { out.set(p, off); off += p.length; }
-    return out;
+    for (const [a, b] of parts) { out.set(this.ring.view(a, b), off); off += b - a; }
+    return { pcm: out, rms: rms(out), at: null };
   }
 
   // ── Serialized pipeline ────────────────────────────────────────
@@ -563,20 +603,25 @@ export class ChunkedTranscriber {
     if (!closing && spanEnd - turn.lastSubmitEndMs < 500) return;
     turn.lastSubmitEndMs = spanEnd;
 
-    const pcm = this.cut(spanStart, spanEnd);
-    if (pcm.length < SAMPLE_RATE * 0.2 || rms(pcm) < DROP_RMS) {
+    const { pcm, rms: energy, at } = this.cut(spanStart, spanEnd);
+    if (pcm.length < SAMPLE_RATE * 0.2 || energy < DROP_RMS) {
       if (closing) await this.closeOut(turn);
       return;
     }
 
     const prompt = this.lastConfirmedText ? this.lastConfirmedText.slice(-PROMPT_TAIL_CHARS) : undefined;
     let result: TranscriptionResult | null = null;
+    this.pinnedAt = at;
+    const submittedMs = Date.now();
     try {
       result = await this.cb.transcribe(pcm, prompt);
     } catch (e: any) {
       this.cb.onError?.(e);                                            // P18: surface the fault…
       this.log(`[ChunkedTranscriber] transcribe failed: ${e?.message}`);   // …keep the local log too
+    } finally {
+      this.pinnedAt = null;
     }
+    const transcribedMs = Date.now();
     const gated = result ? this.applyGates(result, spanEnd - spanStart) : null;
     if (!gated || gated.length === 0) {
       if (closing) await this.closeOut(turn);
@@ -613,6 +658,12 @@ export class ChunkedTranscriber {
       return;
     }
     turn.lastVoicedWallMs = Date.now();   // voiced update arrived — resets the TTL idle-finalize
+    const timing = result!.timing;
+    const trace: ChunkTrace = {
+      captured_ms: Math.round(spanEnd), submitted_ms: submittedMs,
+      ...(timing ? { stt_queue_ms: timing.queue_ms, stt_decode_ms: timing.decode_ms } : {}),
+      transcribed_ms: transcribedMs,
+    };
 
     // LocalAgreement-N (shared confirm core, @vexa/transcribe-buffer): confirm whole
     // leading segments whose words are stable across N (default 3) consecutive
@@ -626,13 +677,13 @@ export class ChunkedTranscriber {
 
     const tail: ChunkSegment[] = mapped.slice(confirmCount).map((s, i) => ({
       text: s.text, startMs: s.startMs, endMs: s.endMs, language: s.language,
-      segmentId: `turn:${turn.turnId}:p${i}`,
+      segmentId: `turn:${turn.turnId}:p${i}`, trace: { ...trace },
     }));
 
     if (confirmCount > 0) {
       const confirmed: ChunkSegment[] = mapped.slice(0, confirmCount).map(s => ({
         text: s.text, startMs: s.startMs, endMs: s.endMs, language: s.language,
-        segmentId: `turn:${turn.turnId}:${turn.seq++}`,
+        segmentId: `turn:${turn.turnId}:${turn.seq++}`, trace: { ...trace },
       }));
       // ONE bundle: confirmed + surviving tail. Splitting them deletes the
       // client's pending block for seconds (the "vanishing transcript" bug).
@@ -3,6 +3,7 @@
  *
  *   mixed-capture.v1 (audio + hints) ─► ChunkedTranscriber
  *        ├─ PyannoteSegmenter        cut-only (the only ONNX; no diarization)
+ *        │    └─ SegmentationEngine  process-wide worker pool, shared weights, batched passes
  *        ├─ shared/buffer            LocalAgreement-2 confirm
  *        ├─ shared/whisper           stt.v1 transcribe (injected)
  *        └─ ClusterNameBinder        the namer — hints by time window, no clustering
@@ -12,8 +13,10 @@
  * segmentation id is the key. There is NO speaker clustering.
  */
 export { ChunkedTranscriber } from './chunked-transcriber.js';
-export type { ChunkedTranscriberCallbacks, ChunkSegment, BoundarySource } from './chunked-transcriber.js';
+export type { ChunkedTranscriberCallbacks, ChunkSegment, ChunkTrace, BoundarySource } from './chunked-transcriber.js';
 export { PyannoteSegmenter } from './pyannote-segmenter.js';
 export type { BoundaryEvent, PyannoteSegmenterConfig } from './pyannote-segmenter.js';
+export { createSegmentationEngine, sharedSegmentationEngine } from './segmentation-engine.js';
+export type { SegmentationEngine, SegmentationEngineOptions, SegmentationLogits, BatchRunner } from './segmentation-engine.js';
 export { ClusterNameBinder } from './cluster-name-binder.js';
 export type { HintKind, HintEvent } from './cluster-name-binder.js';
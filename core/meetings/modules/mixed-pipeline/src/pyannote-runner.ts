@@ -0,0 +1,67 @@
+/**
+ * The pyannote-segmentation-3.0 BatchRunner a segmentation worker loads
+ * (segmentation-engine.ts). Loads the ONNX model + feature extractor once and runs a
+ * batch of 10s windows as ONE forward pass — the processor's per-window tensors are
+ * stacked on the batch axis — falling back to one pass per window if the model
+ * rejects the stacked input. A worker has its own @huggingface/transformers env, so
+ * the cache settings ChunkedTranscriber applies on the main thread are re-applied here.
+ */
+import {
+  AutoModel,
+  AutoProcessor,
+  Tensor,
+  env as transformersEnv,
+} from '@huggingface/transformers';
+import type { BatchRunner, SegmentationLogits } from './segmentation-engine.js';
+
+const PYANNOTE_MODEL_ID = 'onnx-community/pyannote-segmentation-3.0';
+const SAMPLE_RATE = 16_000;
+
+type Inputs = Record<string, Tensor>;
+
+/** Stack single-item model inputs on the batch axis, or null if any isn't [1, …]. */
+function stack(inputs: Inputs[]): Inputs | null {
+  const out: Inputs = {};
+  for (const key of Object.keys(inputs[0])) {
+    const parts = inputs.map((i) => i[key]);
+    if (parts.some((t) => !t?.dims || t.dims[0] !== 1)) return null;
+    const each = (parts[0].data as Float32Array).length;
+    const data = new (parts[0].data.constructor as Float32ArrayConstructor)(each * parts.length);
+    parts.forEach((t, k) => data.set(t.data as Float32Array, k * each));
+    out[key] = new Tensor(parts[0].type, data, [parts.length, ...parts[0].dims.slice(1)]);
+  }
+  return out;
+}
+
+function logitsOf(outputs: Record<string, Tensor>): Tensor {
+  return outputs.logits ?? outputs[Object.keys(outputs)[0]];
+}
+
+/** Split a [B, frames, classes] logits tensor into per-window blocks (copies; transferable). */
+function split(logits: Tensor, batch: number): SegmentationLogits[] {
+  const [, frames, classes] = logits.dims as number[];
+  const data = logits.data as Float32Array;
+  const per = frames * classes;
+  return Array.from({ length: batch }, (_, b) => ({ data: data.slice(b * per, (b + 1) * per), frames, classes }));
+}
+
+export async function load(): Promise<BatchRunner> {
+  transformersEnv.allowLocalModels = true;
+  transformersEnv.allowRemoteModels = true; // first run downloads from HF; cached after
+  if (process.env.VEXA_HF_CACHE) transformersEnv.cacheDir = process.env.VEXA_HF_CACHE;
+  const model = await AutoModel.from_pretrained(PYANNOTE_MODEL_ID, { device: 'cpu' });
+  const processor = await AutoProcessor.from_pretrained(PYANNOTE_MODEL_ID);
+
+  const one = async (inputs: Inputs) => split(logitsOf(await model(inputs) as Record<string, Tensor>), 1)[0];
+  return async (windows) => {
+    const inputs: Inputs[] = await Promise.all(windows.map((w) => processor(w, { sampling_rate: SAMPLE_RATE })));
+    const stacked = inputs.length > 1 ? stack(inputs) : null;
+    if (stacked) {
+      try { return split(logitsOf(await model(stacked) as Record<string, Tensor>), inputs.length); }
+      catch { /* model exported without a dynamic batch axis — one pass per window */ }
+    }
+    const out: SegmentationLogits[] = [];
+    for (const i of inputs) out.push(await one(i));
+    return out;
+  };
+}
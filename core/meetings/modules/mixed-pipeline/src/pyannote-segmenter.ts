@@ -20,18 +20,21 @@
  *   - segmentation = per-frame multi-speaker (pyannote)
  *   - embedding    = utterance-level (wespeaker)
  *   - clustering   = online cosine-distance (our OnlineSpeakerClustering)
+ *
+ * The forward pass itself runs out of band, on the process-wide
+ * SegmentationEngine (segmentation-engine.ts): one set of weights shared by every
+ * segmenter, windows from concurrent bots batched into one ONNX call, and the
+ * event loop free while it runs. This class keeps only the per-stream state —
+ * the ring, the cadence, boundary extraction and overlap intervals.
  */
 
 import {
-  AutoModel,
-  AutoProcessor,
-  type PreTrainedModel,
-  type Processor,
-  type Tensor,
-} from '@huggingface/transformers';
+  sharedSegmentationEngine,
+  type SegmentationEngine,
+  type SegmentationLogits,
+} from './segmentation-engine.js';
 
 const SAMPLE_RATE = 16_000;
-const PYANNOTE_MODEL_ID = 'onnx-community/pyannote-segmentation-3.0';
 const WINDOW_SAMPLES = 10 * SAMPLE_RATE;            // 160_000
 const DEFAULT_INFER_INTERVAL_MS = 500;
 /** Frames per 10s window — the model emits [1, 767, 7]. */
@@ -115,6 +118,8 @@ export interface PyannoteSegmenterConfig {
   /** Optional callback fired when a boundary is detected, in absolute
    *  audio time (the same timebase the caller fed via appendFrame). */
   onBoundary?: (ev: BoundaryEvent) => void;
+  /** Where the forward pass runs. Default: the process-wide shared engine. */
+  engine?: SegmentationEngine;
 }
 
 export interface BoundaryEvent {
@@ -127,8 +132,11 @@ export interface BoundaryEvent {
 }
 
 export class PyannoteSegmenter {
-  private model!: PreTrainedModel;
-  private processor!: Processor;
+  private readonly engine: SegmentationEngine;
+  /** One pass in flight at a time — a late result never races a newer one. */
+  private inferring = false;
+  /** Bumped by reset(); a pass started before it is discarded on return. */
+  private generation = 0;
 
   // Audio ring buffer (10s).
   private ringBuffer = new Float32Array(WINDOW_SAMPLES);
@@ -162,16 +170,19 @@ export class PyannoteSegmenter {
     this.inferIntervalSamples = Math.floor(((cfg.inferIntervalMs ?? DEFAULT_INFER_INTERVAL_MS) / 1000) * SAMPLE_RATE);
     this.freshWindowSamples = Math.floor(((cfg.freshWindowMs ?? 1200) / 1000) * SAMPLE_RATE);
     this.onBoundary = cfg.onBoundary;
+    this.engine = cfg.engine ?? sharedSegmentationEngine();
   }
 
+  /** Resolves once the engine has a model loaded (the first segmenter pays the load;
+   *  later ones share it). Rejects if the model cannot load. */
   static async create(cfg: PyannoteSegmenterConfig = {}): Promise<PyannoteSegmenter> {
     const inst = new PyannoteSegmenter(cfg);
-    inst.model = await AutoModel.from_pretrained(PYANNOTE_MODEL_ID, { device: 'cpu' });
-    inst.processor = await AutoProcessor.from_pretrained(PYANNOTE_MODEL_ID);
+    await inst.engine.ready();
     return inst;
   }
 
   reset(): void {
+    this.generation++;
     this.ringBuffer.fill(0);
     this.ringWriteIdx = 0;
     this.totalSamplesFed = 0;
@@ -205,6 +216,9 @@ export class PyannoteSegmenter {
     this.samplesSinceLastInfer += frame.length;
 
     if (this.samplesSinceLastInfer < this.inferIntervalSamples) return [];
+    // A pass is still out: keep accumulating — the first frame after it returns
+    // triggers the next one over the freshest window.
+    if (this.inferring) return [];
     // Need at least freshWindowSamples of audio before we can scan for
     // boundaries; less than that, pyannote's predictions in the recent
     // region are dominated by zero-pad and unreliable.
@@ -213,7 +227,12 @@ export class PyannoteSegmenter {
       return [];
     }
     this.samplesSinceLastInfer = 0;
-    return await this.runInference(tsMs);
+    this.inferring = true;
+    try {
+      return await this.runInference(tsMs);
+    } finally {
+      this.inferring = false;
+    }
   }
 
   private readRingLinear(): Float32Array {
@@ -238,22 +257,22 @@ export class PyannoteSegmenter {
 
   private async runInference(latestTsMs: number): Promise<BoundaryEvent[]> {
     const window = this.readRingLinear();
+    // Snapshot the fill level with the window — frames keep arriving during the pass.
+    const samplesInWindow = Math.min(this.totalSamplesFed, WINDOW_SAMPLES);
     // Absolute time of the OLDEST sample in this window:
-    const windowStartMs = latestTsMs - (Math.min(this.totalSamplesFed, WINDOW_SAMPLES) / SAMPLE_RATE) * 1000;
-    let logits: Tensor | null = null;
+    const windowStartMs = latestTsMs - (samplesInWindow / SAMPLE_RATE) * 1000;
+    const generation = this.generation;
+    let logits: SegmentationLogits;
     try {
-      const inputs = await this.processor(window, { sampling_rate: SAMPLE_RATE });
-      const outputs = (await this.model(inputs)) as { [k: string]: Tensor };
-      logits = outputs.logits ?? outputs[Object.keys(outputs)[0]];
+      logits = await this.engine.infer(window);
     } catch (err: any) {
       console.error(`[pyannote-segmenter] inference failed: ${err.message}`);
       return [];
     }
-    if (!logits) return [];
-    const dims = logits.dims as number[];
-    const numFrames = dims[1];
-    const numClasses = dims[2];
-    const data = logits.data as Float32Array;
+    if (generation !== this.generation) return [];                 // reset() during the pass
+    const numFrames = logits.frames;
+    const numClasses = logits.classes;
+    const data = logits.data;
     const frameClasses: number[] = new Array(numFrames);
     const frameConfidence: number[] = new Array(numFrames);
     for (let f = 0; f < numFrames; f++) {
@@ -272,7 +291,7 @@ export class PyannoteSegmenter {
       frameConfidence[f] = 1 / sumExp;
     }
     const smoothed = despeckle(medianFilter3(frameClasses), MIN_RUN_FRAMES);
-    const frameMs = (window.length / SAMPLE_RATE) * 1000 / numFrames; // ≈13.04
+    const frameMs = (WINDOW_SAMPLES / SAMPLE_RATE) * 1000 / numFrames; // ≈13.04
     // pack-msteams-diarization-cutover (#394): scan the ENTIRE window
     // every time, not just the last freshWindowSamples worth. The fresh-
     // only scan missed boundaries when speech started >freshWindowMs ago
@@ -290,7 +309,7 @@ export class PyannoteSegmenter {
     // samplesIntoUtterance is beyond the buffered samples.
     const realFrames = Math.min(
       numFrames,
-      Math.ceil((Math.min(this.totalSamplesFed, WINDOW_SAMPLES) / SAMPLE_RATE) * 1000 / frameMs),
+      Math.ceil((samplesInWindow / SAMPLE_RATE) * 1000 / frameMs),
     );
     const scanEnd = realFrames;
     const events: BoundaryEvent[] = [];
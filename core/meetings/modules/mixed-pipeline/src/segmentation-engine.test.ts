@@ -0,0 +1,137 @@
+/**
+ * segmentation-engine — the shared, out-of-band pyannote engine. A model-free runner
+ * (a data: URL module, loaded inside each worker exactly as the pyannote runner is)
+ * stands in for ONNX: it turns each window into logits and reports which thread ran
+ * it, the batch it rode in, and how many times its worker loaded the "weights".
+ * Pins: passes run off the event loop, concurrent windows batch into one pass, each
+ * worker loads once however many segmenters share it, results route back to their
+ * caller, a failed load / pass surfaces instead of hanging, and PyannoteSegmenter
+ * turns engine logits into the same BoundaryEvents. No network, no model.
+ */
+import { createSegmentationEngine, PyannoteSegmenter, type BoundaryEvent, type SegmentationLogits } from './index.js';
+
+let failed = 0;
+const check = (name: string, cond: boolean, detail = '') => {
+  console.log(`  ${cond ? '✅' : '❌'} ${name}${cond ? '' : '  — ' + detail}`);
+  if (!cond) failed++;
+};
+
+/** Classes per frame from the window itself: sample value v ≈ class v (0 = silence). */
+const FAKE_RUNNER = 'data:text/javascript,' + encodeURIComponent(`
+  import { threadId } from 'node:worker_threads';
+  globalThis.__loads = (globalThis.__loads ?? 0) + 1;
+  const loads = globalThis.__loads;
+  export async function load() {
+    if (process.env.FAKE_RUNNER_FAIL_LOAD === '1') throw new Error('no weights');
+    return async (windows) => {
+      if (windows.some((w) => w[0] === -1)) throw new Error('bad window');
+      const burn = windows[0][1] > 100 ? windows[0][1] : 0;             // synchronous CPU, like a forward pass
+      const t0 = Date.now(); while (Date.now() - t0 < burn) { /* spin */ }
+      const frames = 767, classes = 7;
+      return windows.map((w) => {
+        const data = new Float32Array(frames * classes).fill(-5);
+        for (let f = 0; f < frames; f++) data[f * classes + Math.min(6, Math.max(0, Math.round(w[Math.floor(f * w.length / frames)])))] = 5;
+        return { data, frames, classes, meta: { tag: w[0], threadId, batch: windows.length, loads } };
+      });
+    };
+  }`);
+
+const meta = (l: SegmentationLogits) => (l as unknown as { meta: { tag: number; threadId: number; batch: number; loads: number } }).meta;
+const tagged = (tag: number, burnMs = 0) => { const w = new Float32Array(160_000); w[0] = tag; w[1] = burnMs; return w; };
+
+async function main() {
+  // ── off the event loop, batched, weights loaded once per worker ────────────
+  {
+    const engine = createSegmentationEngine({ workers: 2, maxBatch: 8, batchWindowMs: 20, runner: FAKE_RUNNER });
+    await engine.ready();
+    const out = await Promise.all(Array.from({ length: 6 }, (_, i) => engine.infer(tagged(i + 0.25))));
+    check('each caller gets ITS window\'s logits back', out.every((l, i) => meta(l).tag === Math.fround(i + 0.25)), JSON.stringify(out.map((l) => meta(l).tag)));
+    check('concurrent windows ride one batched pass', out.every((l) => meta(l).batch === 6), JSON.stringify(out.map((l) => meta(l).batch)));
+    check('the pass runs on a worker thread, not the main thread', out.every((l) => meta(l).threadId !== 0));
+
+    const many = await Promise.all(Array.from({ length: 40 }, (_, i) => engine.infer(tagged(i, i % 3 === 0 ? 120 : 0))));
+    const threads = new Set(many.map((l) => meta(l).threadId));
+    check('batches never exceed maxBatch', many.every((l) => meta(l).batch <= 8), JSON.stringify([...new Set(many.map((l) => meta(l).batch))]));
+    check('two workers, each loaded the weights exactly once (40 windows)', threads.size <= 2 && many.every((l) => meta(l).loads === 1),
+      JSON.stringify({ threads: [...threads], loads: [...new Set(many.map((l) => meta(l).loads))] }));
+
+    let ticks = 0;
+    const tick = setInterval(() => { ticks++; }, 10);
+    await engine.infer(tagged(9, 400));
+    clearInterval(tick);
+    check('a 400ms forward pass leaves the event loop free (timer keeps ticking)', ticks >= 20, `ticks=${ticks}`);
+
+    let rejected = false;
+    await engine.infer(tagged(-1)).catch(() => { rejected = true; });
+    const after = await engine.infer(tagged(3));
+    check('a failed pass rejects its callers; the engine keeps serving', rejected && meta(after).tag === 3);
+    await engine.close();
+    let closedRejects = false;
+    await engine.infer(tagged(1)).catch(() => { closedRejects = true; });
+    check('a closed engine rejects instead of hanging', closedRejects);
+  }
+
+  // ── in-thread mode keeps the old cost profile (the contrast) ───────────────
+  {
+    const engine = createSegmentationEngine({ workers: 0, runner: FAKE_RUNNER });
+    await engine.ready();
+    let ticks = 0;
+    const tick = setInterval(() => { ticks++; }, 10);
+    const l = await engine.infer(tagged(2, 300));
+    clearInterval(tick);
+    check('workers: 0 runs in-thread (and blocks the loop, as before)', meta(l).threadId === 0 && ticks <= 2, `thread=${meta(l).threadId} ticks=${ticks}`);
+    await engine.close();
+  }
+
+  // ── a model that cannot load surfaces at create(), not as silent no-cuts ────
+  {
+    process.env.FAKE_RUNNER_FAIL_LOAD = '1';
+    const engine = createSegmentationEngine({ workers: 1, runner: FAKE_RUNNER });
+    let err = '';
+    await PyannoteSegmenter.create({ engine }).catch((e) => { err = String(e?.message ?? e); });
+    check('load failure rejects PyannoteSegmenter.create', /no weights/.test(err), err);
+    let inferErr = '';
+    await engine.infer(tagged(1)).catch((e) => { inferErr = String(e?.message ?? e); });
+    check('…and infer() rejects rather than queueing forever', /no weights/.test(inferErr), inferErr);
+    delete process.env.FAKE_RUNNER_FAIL_LOAD;
+    await engine.close();
+  }
+
+  // ── PyannoteSegmenter over the shared engine: same BoundaryEvents ──────────
+  {
+    const engine = createSegmentationEngine({ workers: 1, batchWindowMs: 5, runner: FAKE_RUNNER });
+    const seen: [BoundaryEvent[], BoundaryEvent[]] = [[], []];
+    const segs = await Promise.all([0, 1].map((k) => PyannoteSegmenter.create({ engine, inferIntervalMs: 500, onBoundary: (ev) => seen[k].push(ev) })));
+    // 4s silence → speaker 1 for 2s → speaker 2 for 2s, in 100ms frames, fed to both streams.
+    const FRAME = 1600;
+    for (let i = 0; i < 80; i++) {
+      const v = i < 40 ? 0 : i < 60 ? 1 : 2;
+      const tsMs = 1_000 + i * 100;
+      await Promise.all(segs.map((s) => s.appendFrame(new Float32Array(FRAME).fill(v), tsMs)));
+    }
+    const near = (evs: BoundaryEvent[], kind: BoundaryEvent['kind'], tMs: number) => evs.some((e) => e.kind === kind && Math.abs(e.tMs - tMs) < 120);
+    check('silence→speaker boundary at the onset (≈5.0s)', near(seen[0], 'silence→speaker', 5_000), JSON.stringify(seen[0]));
+    check('speaker→speaker boundary at the handoff (≈7.0s)', near(seen[0], 'speaker→speaker', 7_000), JSON.stringify(seen[0]));
+    check('two segmenters sharing one engine see identical boundaries', JSON.stringify(seen[0]) === JSON.stringify(seen[1]));
+
+    // reset() during a pass: the stale result must not emit into the new session.
+    const s = segs[0];
+    s.reset();
+    seen[0].length = 0;
+    const slow = new Float32Array(32_000).fill(1, 16_000);          // 1s silence → 1s speech: one onset
+    slow[1] = 300;                                                  // the fake runner burns on sample 1
+    const control = await s.appendFrame(slow.slice(), 0);
+    s.reset();
+    seen[0].length = 0;
+    const pass = s.appendFrame(slow, 0);
+    s.reset();
+    const stale = await pass;
+    check('a pass that straddles reset() emits nothing (the same pass undisturbed emits its onset)',
+      control.length === 1 && stale.length === 0 && seen[0].length === 0, JSON.stringify({ control, stale }));
+    await engine.close();
+  }
+
+  if (failed) { console.error(`\n❌ segmentation-engine: ${failed} checks FAILED.`); process.exit(1); }
+  console.log('\n✅ segmentation-engine: all checks pass — off-loop, batched, weights once per worker, same boundaries.');
+}
+main().catch((e) => { console.error(e); process.exit(1); });
@@ -0,0 +1,224 @@
+/**
+ * SegmentationEngine — the process-wide, out-of-band pyannote inference service.
+ *
+ * Every PyannoteSegmenter used to load its own copy of the segmentation model and
+ * run the 10s-window forward pass on the bot's event loop. The engine owns the model
+ * instead: a small pool of worker_threads, each loading the weights ONCE, shared by
+ * every segmenter in the process. `infer(window)` queues a window and resolves with
+ * its logits; windows that arrive together (many bots, or one bot's cadence meeting
+ * another's) are micro-batched into one ONNX call of batch size up to `maxBatch`.
+ * Audio handling never waits on a forward pass — only the awaiting segmenter does.
+ *
+ *   segmenter A ─┐                     ┌─ worker 1 (model) ─ run([w_A, w_C])
+ *   segmenter B ─┼─► queue ─ batcher ──┤
+ *   segmenter C ─┘                     └─ worker 2 (model) ─ run([w_B])
+ *
+ * `workers: 0` runs the same batcher in-thread (no worker_threads; the old cost
+ * profile, one model per engine). The runner is a module (default
+ * `pyannote-runner`) exporting `load(): Promise<BatchRunner>`, so tests swap in a
+ * model-free one. The interface is what a node-level sidecar would also serve.
+ */
+import { Worker } from 'node:worker_threads';
+import { availableParallelism } from 'node:os';
+import { extname } from 'node:path';
+import { fileURLToPath } from 'node:url';
+
+/** One window's model output: row-major [frames × classes] logits. */
+export interface SegmentationLogits {
+  data: Float32Array;
+  frames: number;
+  classes: number;
+}
+
+/** A loaded model: windows in, one logits block per window out (same order). */
+export type BatchRunner = (windows: Float32Array[]) => Promise<SegmentationLogits[]>;
+
+export interface SegmentationEngine {
+  /** Resolves once at least one model instance is loaded; rejects if none can load. */
+  ready(): Promise<void>;
+  infer(window: Float32Array): Promise<SegmentationLogits>;
+  /** Model instances (worker_threads; 0 = in-thread). */
+  readonly workers: number;
+  close(): Promise<void>;
+}
+
+export interface SegmentationEngineOptions {
+  /** worker_threads, each with its own copy of the weights. 0 = run in-thread. Default 1. */
+  workers?: number;
+  /** Most windows per forward pass. Default 8. */
+  maxBatch?: number;
+  /** How long a lone window waits for company before dispatch. Default 5ms. */
+  batchWindowMs?: number;
+  /** Runner module specifier (URL/href) exporting `load()`. Default: the pyannote runner. */
+  runner?: string;
+}
+
+/** Unexpected worker exits tolerated (per slot, before any successful load) before giving up. */
+const MAX_RESPAWNS = 3;
+
+const ext = extname(fileURLToPath(import.meta.url));             // .ts under tsx, .js built
+const DEFAULT_RUNNER = new URL(`./pyannote-runner${ext}`, import.meta.url).href;
+const WORKER_SCRIPT = new URL(`./segmentation-worker${ext}`, import.meta.url);
+
+interface Job {
+  window: Float32Array;
+  resolve: (l: SegmentationLogits) => void;
+  reject: (e: unknown) => void;
+}
+
+/** One model instance the batcher can hand a batch to. */
+interface Slot {
+  busy: boolean;
+  run(windows: Float32Array[]): Promise<SegmentationLogits[]>;
+  loaded: Promise<void>;
+  close(): Promise<void>;
+}
+
+function inThreadSlot(runner: string): Slot {
+  const runP = import(runner).then((m: { load: () => Promise<BatchRunner> }) => m.load());
+  return {
+    busy: false,
+    loaded: runP.then(() => undefined),
+    run: async (windows) => (await runP)(windows),
+    close: async () => { /* nothing owned */ },
+  };
+}
+
+function workerSlot(runner: string, onDead: (s: Slot, err: Error) => void): Slot {
+  let worker!: Worker;
+  let seq = 0;
+  let respawns = 0;
+  let closing = false;
+  let everLoaded = false;
+  const pending = new Map<number, { resolve: (o: SegmentationLogits[]) => void; reject: (e: unknown) => void }>();
+  let markLoaded!: () => void;
+  let failLoad!: (e: unknown) => void;
+  const loaded = new Promise<void>((res, rej) => { markLoaded = res; failLoad = rej; });
+  loaded.catch(() => { /* observed via ready() */ });
+
+  const failAll = (err: Error) => {
+    for (const p of pending.values()) p.reject(err);
+    pending.clear();
+  };
+  const spawn = () => {
+    worker = new Worker(WORKER_SCRIPT, { workerData: { runner } });
+    worker.unref();
+    worker.on('message', (m: { type: 'ready' } | { type: 'load-error'; message: string } |
+      { type: 'result'; id: number; out: SegmentationLogits[] } | { type: 'error'; id: number; message: string }) => {
+      if (m.type === 'ready') { everLoaded = true; respawns = 0; markLoaded(); return; }
+      if (m.type === 'load-error') { closing = true; void worker.terminate(); fail(new Error(`segmentation model failed to load: ${m.message}`)); return; }
+      const p = pending.get(m.id);
+      if (!p) return;
+      pending.delete(m.id);
+      if (pending.size === 0) worker.unref();
+      if (m.type === 'result') p.resolve(m.out);
+      else p.reject(new Error(m.message));
+    });
+    worker.on('error', (err) => failAll(err));
+    worker.on('exit', (code) => {
+      failAll(new Error(`segmentation worker exited (code ${code})`));
+      if (closing) return;
+      if (++respawns > MAX_RESPAWNS && !everLoaded) { fail(new Error(`segmentation worker keeps exiting (code ${code})`)); return; }
+      spawn();
+    });
+  };
+  const fail = (err: Error) => { failAll(err); failLoad(err); onDead(slot, err); };
+
+  const slot: Slot = {
+    busy: false,
+    loaded,
+    run(windows) {
+      return new Promise((resolve, reject) => {
+        const id = ++seq;
+        pending.set(id, { resolve, reject });
+        worker.ref();                                               // hold the process while a pass is owed
+        worker.postMessage({ type: 'run', id, windows }, windows.map((w) => w.buffer as ArrayBuffer));
+      });
+    },
+    async close() { closing = true; failAll(new Error('segmentation engine closed')); await worker.terminate(); },
+  };
+  spawn();
+  return slot;
+}
+
+export function createSegmentationEngine(opts: SegmentationEngineOptions = {}): SegmentationEngine {
+  const workers = Math.max(0, Math.floor(opts.workers ?? 1));
+  const maxBatch = Math.max(1, Math.floor(opts.maxBatch ?? 8));
+  const batchWindowMs = Math.max(0, opts.batchWindowMs ?? 5);
+  const runner = opts.runner ?? DEFAULT_RUNNER;
+
+  const queue: Job[] = [];
+  let timer: ReturnType<typeof setTimeout> | null = null;
+  let closed = false;
+  let deadError: Error | null = null;
+
+  const onDead = (s: Slot, err: Error) => {
+    const i = slots.indexOf(s);
+    if (i >= 0) slots.splice(i, 1);
+    if (slots.length === 0) {
+      deadError = err;
+      for (const j of queue.splice(0)) j.reject(err);
+    }
+  };
+  const slots: Slot[] = workers === 0
+    ? [inThreadSlot(runner)]
+    : Array.from({ length: workers }, () => workerSlot(runner, onDead));
+  const readyP = Promise.any(slots.map((s) => s.loaded)).catch((e: AggregateError) => { throw e.errors?.[0] ?? e; });
+  readyP.catch(() => { /* surfaced by ready() / infer() */ });
+
+  const dispatch = () => {
+    if (timer) { clearTimeout(timer); timer = null; }
+    for (const slot of slots) {
+      if (queue.length === 0) return;
+      if (slot.busy) continue;
+      const batch = queue.splice(0, maxBatch);
+      slot.busy = true;
+      slot.loaded
+        .then(() => slot.run(batch.map((j) => j.window)))
+        .then((out) => batch.forEach((j, k) => (out[k] ? j.resolve(out[k]) : j.reject(new Error('segmentation: runner returned too few outputs')))))
+        .catch((err) => batch.forEach((j) => j.reject(err)))
+        .finally(() => { slot.busy = false; dispatch(); });
+    }
+  };
+
+  return {
+    workers,
+    ready: () => readyP,
+    infer(window: Float32Array): Promise<SegmentationLogits> {
+      if (closed) return Promise.reject(new Error('segmentation engine closed'));
+      if (deadError) return Promise.reject(deadError);
+      // Own the buffer: it is transferred to the worker.
+      const owned = window.byteOffset === 0 && window.byteLength === window.buffer.byteLength ? window : window.slice();
+      return new Promise((resolve, reject) => {
+        queue.push({ window: owned, resolve, reject });
+        if (queue.length >= maxBatch || batchWindowMs === 0) dispatch();
+        else timer ??= setTimeout(dispatch, batchWindowMs);
+      });
+    },
+    async close() {
+      closed = true;
+      if (timer) clearTimeout(timer);
+      for (const j of queue.splice(0)) j.reject(new Error('segmentation engine closed'));
+      await Promise.all(slots.map((s) => s.close()));
+    },
+  };
+}
+
+let shared: SegmentationEngine | null = null;
+
+/**
+ * The process-wide engine every segmenter uses by default. Sized from the env:
+ * VEXA_SEG_WORKERS (default 1; 0 = in-thread), VEXA_SEG_MAX_BATCH (8),
+ * VEXA_SEG_BATCH_MS (5). Capped at the machine's parallelism.
+ */
+export function sharedSegmentationEngine(): SegmentationEngine {
+  if (!shared) {
+    const num = (v: string | undefined, d: number) => (v !== undefined && v !== '' && Number.isFinite(Number(v)) ? Number(v) : d);
+    shared = createSegmentationEngine({
+      workers: Math.min(num(process.env.VEXA_SEG_WORKERS, 1), availableParallelism()),
+      maxBatch: num(process.env.VEXA_SEG_MAX_BATCH, 8),
+      batchWindowMs: num(process.env.VEXA_SEG_BATCH_MS, 5),
+    });
+  }
+  return shared;
+}
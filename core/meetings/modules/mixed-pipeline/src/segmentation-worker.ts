@@ -0,0 +1,29 @@
+/**
+ * Segmentation worker — one model instance in a worker_thread (see segmentation-engine.ts).
+ * Loads the runner module named in workerData once, says `ready`, then serves batched
+ * `run` requests; logits come back as transferred buffers. Messages that arrive while
+ * the model is still loading queue on the port until the listener attaches.
+ */
+import { parentPort, workerData } from 'node:worker_threads';
+import type { BatchRunner } from './segmentation-engine.js';
+
+const port = parentPort!;
+const { runner } = workerData as { runner: string };
+
+let run: BatchRunner;
+try {
+  run = await (await import(runner) as { load: () => Promise<BatchRunner> }).load();
+} catch (err: any) {
+  port.postMessage({ type: 'load-error', message: String(err?.message ?? err) });
+  throw err;
+}
+port.postMessage({ type: 'ready' });
+
+port.on('message', async (m: { type: 'run'; id: number; windows: Float32Array[] }) => {
+  try {
+    const out = await run(m.windows);
+    port.postMessage({ type: 'result', id: m.id, out }, out.map((o) => o.data.buffer as ArrayBuffer));
+  } catch (err: any) {
+    port.postMessage({ type: 'error', id: m.id, message: String(err?.message ?? err) });
+  }
+});
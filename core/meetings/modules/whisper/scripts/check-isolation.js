@@ -1,8 +1,8 @@
 #!/usr/bin/env node
 // gate:isolation (P2) — every import must stay inside the package: intra-package,
 // a Node builtin, or a DECLARED dep. @vexa/transcribe-whisper is the stt.v1 egress;
-// it uses only Node/Web globals (fetch, Buffer, AbortController) — no external dep,
-// no brick internals, no monolith back-import.
+// it uses only Node/Web globals (fetch, Buffer, AbortController) plus the sibling
+// @vexa/audio-kernels package — no external dep, no brick internals, no monolith back-import.
 // ESM (the package is "type":"module"); the gate runs `node scripts/check-isolation.js`.
 import { readFileSync, readdirSync } from "node:fs";
 import { join, relative, dirname } from "node:path";
@@ -12,8 +12,11 @@ export type {
   TranscriptionWord,
   TranscriptionSegment,
   TranscriptionResult,
+  TranscriptionTiming,
   TranscriptionClientConfig,
   TranscriptionFaultKind,
 } from './transcription-client.js';
+export { encodeFlac, encodeWav, encodeUpload, parseUploadCodec } from './upload-codec.js';
+export type { UploadCodec } from './upload-codec.js';
 export { isLowConfidenceSegment } from './confidence.js';
 export { setLogger } from './log.js';
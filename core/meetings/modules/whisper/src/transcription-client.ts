@@ -1,5 +1,6 @@
 import { log } from './log.js';
 import { isLowConfidenceSegment } from './confidence.js';
+import { encodeUpload, UPLOAD_CODEC_MIME, type UploadCodec } from './upload-codec.js';
 
 export interface TranscriptionWord {
   word: string;
@@ -18,12 +19,20 @@ export interface TranscriptionSegment {
   words?: TranscriptionWord[];
 }
 
+/** Where the service spent the request (its `timing` field): waiting for decode capacity vs
+ *  working on it. Absent on a backend that does not report it. */
+export interface TranscriptionTiming {
+  queue_ms: number;
+  decode_ms: number;
+}
+
 export interface TranscriptionResult {
   text: string;
   language: string;
   language_probability?: number;
   duration: number;
   segments: TranscriptionSegment[];
+  timing?: TranscriptionTiming;
 }
 
 export interface TranscriptionClientConfig {
@@ -44,9 +53,13 @@ export interface TranscriptionClientConfig {
    *  Default: server default (160ms). Use ~100ms for more granular segments. */
   minSilenceDurationMs?: number;
   /** STT model id sent as the OpenAI-compatible `model` form part. Backends that validate it
-   *  (Groq, vLLM, gateways) need their served name; the bundled unit ignores it (its model is
-   *  the unit's own MODEL_SIZE). Default: "whisper-1". */
+   *  (Groq, vLLM, gateways) need their served name; the bundled unit runs it when it is one of
+   *  its SERVED_MODELS, else its own MODEL_SIZE. Default: "whisper-1". */
   model?: string;
+  /** Body codec for the `file` part: 'wav' (16-bit PCM, every backend) or 'flac' (the same
+   *  samples, lossless, ~half the bytes). Negotiated: a backend that answers a FLAC upload with
+   *  400/415 is downgraded to WAV for the rest of this client's life. Default: 'wav'. */
+  uploadCodec?: UploadCodec;
 }
 
 /** The STT boundary's FAILURE vocabulary (P5 + P18: an adapter must translate the
@@ -85,9 +98,21 @@ function classifyHttp(status: number, detail?: string): TranscriptionError {
   return new TranscriptionError('unknown', status, detail, false);
 }
 
+/** A 400 detail naming the body's codec/format ("Failed to decode audio file", "unsupported format"). */
+const CODEC_REJECTION_DETAIL = /codec|format|decod|flac|audio file|media type/i;
+
+/**
+ * Whether a fault is the backend refusing the upload's codec: a 415, or a 400 whose detail says
+ * so. Any other 400 (bad model id, oversized prompt, …) is a real error, not a negotiation cue.
+ */
+function isCodecRejection(err: TranscriptionError): boolean {
+  if (err.status === 415) return true;
+  return err.status === 400 && CODEC_REJECTION_DETAIL.test(err.detail ?? '');
+}
+
 /**
  * HTTP client for the transcription-service.
- * Converts Float32Array audio to WAV, sends as multipart form,
+ * Encodes Float32Array audio (WAV or FLAC, see upload-codec.ts), sends as multipart form,
  * and returns transcription results.
  */
 export class TranscriptionClient {
@@ -99,6 +124,7 @@ export class TranscriptionClient {
   private maxSpeechDurationSec: number | undefined;
   private minSilenceDurationMs: number | undefined;
   private model: string;
+  private uploadCodec: UploadCodec;
   constructor(config: TranscriptionClientConfig) {
     // Ensure serviceUrl ends with the transcriptions endpoint
     this.serviceUrl = config.serviceUrl.replace(/\/+$/, '');
@@ -112,21 +138,35 @@ export class TranscriptionClient {
     this.maxSpeechDurationSec = config.maxSpeechDurationSec;
     this.minSilenceDurationMs = config.minSilenceDurationMs;
     this.model = config.model ?? 'whisper-1';
+    this.uploadCodec = config.uploadCodec ?? 'wav';
   }
 
+  /** The codec the next upload will use (after any negotiation downgrade). */
+  get negotiatedUploadCodec(): UploadCodec { return this.uploadCodec; }
+
   /**
    * Transcribe a Float32Array audio buffer.
-   * Converts to WAV, POSTs to transcription-service, returns parsed result.
+   * Encodes with the negotiated upload codec, POSTs to transcription-service, returns parsed result.
    * Retries on transient failures (503, network errors).
    */
   async transcribe(audioData: Float32Array, language?: string, prompt?: string): Promise<TranscriptionResult> {
-    const wavBuffer = this.float32ToWav(audioData);
+    let upload = encodeUpload(audioData, this.sampleRate, this.uploadCodec);
 
     for (let attempt = 0; attempt <= this.maxRetries; attempt++) {
       try {
-        const result = await this.sendRequest(wavBuffer, language, prompt);
+        const result = await this.sendRequest(upload.bytes, upload.codec, language, prompt);
         return result;
       } catch (err: any) {
+        // Codec negotiation: a backend that can't read the compressed body rejects it (415, or a
+        // 400 naming the format). Downgrade to WAV once (sticky for this client) and resend
+        // without burning a retry; an unrelated 400 still surfaces as a bad_request.
+        if (err instanceof TranscriptionError && upload.codec !== 'wav' && isCodecRejection(err)) {
+          log(`[TranscriptionClient] ${upload.codec} upload rejected (HTTP ${err.status}); falling back to wav for this client`);
+          this.uploadCodec = 'wav';
+          upload = encodeUpload(audioData, this.sampleRate, 'wav');
+          attempt--;
+          continue;
+        }
         // Normalize anything non-HTTP (abort/network) into a typed fault too, so the
         // thrown value is ALWAYS a TranscriptionError the consumer can attribute (P18).
         const fault: TranscriptionError = err instanceof TranscriptionError
@@ -152,9 +192,9 @@ export class TranscriptionClient {
   }
 
   /**
-   * Send the WAV buffer to the transcription-service as multipart form data.
+   * Send the encoded audio to the transcription-service as multipart form data.
    */
-  private async sendRequest(wavBuffer: Buffer, language?: string, prompt?: string): Promise<TranscriptionResult> {
+  private async sendRequest(audio: Buffer, codec: UploadCodec, language?: string, prompt?: string): Promise<TranscriptionResult> {
     // Build multipart form data manually (no external dependency needed)
     const boundary = `----FormBoundary${Date.now().toString(36)}`;
 
@@ -163,10 +203,10 @@ export class TranscriptionClient {
     // File part
     parts.push(Buffer.from(
       `--${boundary}\r\n` +
-      `Content-Disposition: form-data; name="file"; filename="audio.wav"\r\n` +
-      `Content-Type: audio/wav\r\n\r\n`
+      `Content-Disposition: form-data; name="file"; filename="${UPLOAD_CODEC_MIME[codec].filename}"\r\n` +
+      `Content-Type: ${UPLOAD_CODEC_MIME[codec].contentType}\r\n\r\n`
     ));
-    parts.push(wavBuffer);
+    parts.push(audio);
     parts.push(Buffer.from('\r\n'));
 
     // Model part (required by OpenAI-compatible API; validating backends reject unknown ids)
@@ -281,55 +321,11 @@ export class TranscriptionClient {
         language_probability: data.language_probability ?? 0,
         duration: data.duration || 0,
         segments,
+        ...(Number.isFinite(data.timing?.queue_ms) && Number.isFinite(data.timing?.decode_ms)
+          ? { timing: { queue_ms: data.timing.queue_ms, decode_ms: data.timing.decode_ms } } : {}),
       };
     } finally {
       clearTimeout(timeoutId);
     }
   }
-
-  /**
-   * Convert Float32Array audio samples to a WAV file buffer.
-   * Output: 16-bit PCM, mono, at this.sampleRate (default 16kHz).
-   */
-  private float32ToWav(samples: Float32Array): Buffer {
-    const numChannels = 1;
-    const bitsPerSample = 16;
-    const bytesPerSample = bitsPerSample / 8;
-    const dataSize = samples.length * bytesPerSample;
-    const headerSize = 44;
-    const buffer = Buffer.alloc(headerSize + dataSize);
-
-    // RIFF header
-    buffer.write('RIFF', 0);
-    buffer.writeUInt32LE(36 + dataSize, 4);
-    buffer.write('WAVE', 8);
-
-    // fmt sub-chunk
-    buffer.write('fmt ', 12);
-    buffer.writeUInt32LE(16, 16);              // Sub-chunk size
-    buffer.writeUInt16LE(1, 20);               // PCM format
-    buffer.writeUInt16LE(numChannels, 22);     // Mono
-    buffer.writeUInt32LE(this.sampleRate, 24);  // Sample rate
-    buffer.writeUInt32LE(this.sampleRate * numChannels * bytesPerSample, 28); // Byte rate
-    buffer.writeUInt16LE(numChannels * bytesPerSample, 32); // Block align
-    buffer.writeUInt16LE(bitsPerSample, 34);   // Bits per sample
-
-    // data sub-chunk
-    buffer.write('data', 36);
-    buffer.writeUInt32LE(dataSize, 40);
-
-    // Convert Float32 [-1, 1] to Int16
-    let offset = headerSize;
-    for (let i = 0; i < samples.length; i++) {
-      let sample = samples[i];
-      // Clamp to [-1, 1]
-      sample = Math.max(-1, Math.min(1, sample));
-      // Convert to 16-bit integer
-      const int16 = sample < 0 ? sample * 0x8000 : sample * 0x7FFF;
-      buffer.writeInt16LE(Math.round(int16), offset);
-      offset += 2;
-    }
-
-    return buffer;
-  }
 }
@@ -0,0 +1,183 @@
+/**
+ * Upload codec gate: FLAC is LOSSLESS against the WAV baseline (same 16-bit samples, bit-exact),
+ * every frame carries valid CRC-8/CRC-16, it is materially smaller on speech-like audio, and the
+ * client NEGOTIATES — a backend that rejects FLAC (415, or a 400 naming the format) is downgraded
+ * to WAV, sticky; an unrelated 400 stays a bad_request on the configured codec.
+ * The decoder below is a minimal reference reader of exactly the subset the encoder emits
+ * (STREAMINFO, CONSTANT/FIXED subframes, partitioned Rice), written from the FLAC format spec.
+ * Run: npm test (chained)  or  npx tsx src/upload-codec.test.ts
+ */
+import { TranscriptionClient, encodeFlac, encodeWav, encodeUpload, parseUploadCodec } from './index.js';
+
+let failed = 0;
+const check = (name: string, cond: boolean, detail = '') => {
+  console.log(`  ${cond ? '✅' : '❌'} ${name}${cond ? '' : '  — ' + detail}`);
+  if (!cond) failed++;
+};
+
+function crc(bytes: Uint8Array, from: number, to: number, poly: number, width: 8 | 16): number {
+  const top = 1 << (width - 1);
+  const mask = (1 << width) - 1;
+  let c = 0;
+  for (let i = from; i < to; i++) {
+    c ^= bytes[i] << (width - 8);
+    for (let b = 0; b < 8; b++) c = (c & top) ? ((c << 1) ^ poly) & mask : (c << 1) & mask;
+  }
+  return c;
+}
+
+/** Reference FLAC reader → { sampleRate, samples } or throws naming the first violation. */
+function decodeFlac(b: Uint8Array): { sampleRate: number; samples: number[] } {
+  let p = 0;
+  const bit = () => (b[p >> 3] >> (7 - (p++ & 7))) & 1;
+  const u = (n: number) => { let v = 0; for (let i = 0; i < n; i++) v = v * 2 + bit(); return v; };
+  const s = (n: number) => { const v = u(n); return v >= 2 ** (n - 1) ? v - 2 ** n : v; };
+  if (Buffer.from(b.subarray(0, 4)).toString('latin1') !== 'fLaC') throw new Error('magic');
+  p = 32;
+  if (u(1) !== 1 || u(7) !== 0 || u(24) !== 34) throw new Error('streaminfo header');
+  u(16); u(16); u(24); u(24);
+  const sampleRate = u(20);
+  if (u(3) !== 0 || u(5) !== 15) throw new Error('mono/16-bit');
+  const total = u(36);
+  u(128);
+  const out: number[] = [];
+  for (let frame = 0; (p >> 3) < b.length; frame++) {
+    const start = p >> 3;
+    if (u(16) !== 0xfff8) throw new Error(`frame ${frame} sync`);
+    if (u(4) !== 7 || u(4) !== 0 || u(4) !== 0 || u(3) !== 4 || u(1) !== 0) throw new Error(`frame ${frame} header`);
+    let n = u(8);
+    if (n >= 0x80) {
+      let extra = 0;
+      for (let m = 0x40; n & m; m >>= 1) extra++;
+      n &= (0x3f >> extra);
+      for (let i = 0; i < extra; i++) n = (n << 6) | (u(8) & 0x3f);
+    }
+    if (n !== frame) throw new Error(`frame number ${n} != ${frame}`);
+    const size = u(16) + 1;
+    if (u(8) !== crc(b, start, (p >> 3) - 1, 0x07, 8)) throw new Error(`frame ${frame} crc8`);
+    if (u(1) !== 0) throw new Error('subframe pad');
+    const type = u(6);
+    if (u(1) !== 0) throw new Error('wasted bits');
+    const x: number[] = [];
+    if (type === 0) { const v = s(16); for (let i = 0; i < size; i++) x.push(v); }
+    else if (type >= 8 && type <= 12) {
+      const order = type - 8;
+      for (let i = 0; i < order; i++) x.push(s(16));
+      if (u(2) !== 0) throw new Error('rice method');
+      const porder = u(4);
+      const res: number[] = [];
+      for (let j = 0; j < 1 << porder; j++) {
+        const k = u(4);
+        const count = (size >> porder) - (j === 0 ? order : 0);
+        for (let i = 0; i < count; i++) {
+          let q = 0;
+          while (bit() === 0) q++;
+          const v = q * 2 ** k + u(k);
+          res.push(v % 2 ? -(v + 1) / 2 : v / 2);
+        }
+      }
+      const coef = [[], [1], [2, -1], [3, -3, 1], [4, -6, 4, -1]][order];
+      for (const e of res) {
+        let pred = 0;
+        coef.forEach((c, i) => { pred += c * x[x.length - 1 - i]; });
+        x.push(e + pred);
+      }
+    } else throw new Error(`unexpected subframe type ${type}`);
+    p = (p + 7) & ~7;
+    if (u(16) !== crc(b, start, (p >> 3) - 2, 0x8005, 16)) throw new Error(`frame ${frame} crc16`);
+    out.push(...x);
+  }
+  if (out.length !== total) throw new Error(`total ${out.length} != ${total}`);
+  return { sampleRate, samples: out };
+}
+const wavSamples = (w: Buffer): number[] => Array.from({ length: (w.length - 44) / 2 }, (_, i) => w.readInt16LE(44 + i * 2));
+
+async function run() {
+  const SR = 16000;
+  // Speech-like: two tones with a slow envelope + a little noise, 10.25s (non-multiple of the block).
+  const speech = Float32Array.from({ length: SR * 10 + 4000 }, (_, i) =>
+    0.4 * Math.sin(i * 0.045) * Math.sin(i * 0.0007) + 0.1 * Math.sin(i * 0.31) + ((i * 7919) % 101 - 50) / 5000);
+  {
+    const flac = encodeFlac(speech, SR)!;
+    const wav = encodeWav(speech, SR);
+    let dec: { sampleRate: number; samples: number[] } | null = null;
+    try { dec = decodeFlac(flac); } catch (e) { check('FLAC stream parses (sync, CRC-8, CRC-16, totals)', false, String(e)); }
+    if (dec) {
+      check('FLAC stream parses (sync, CRC-8, CRC-16, totals)', true);
+      check('FLAC carries the sample rate', dec.sampleRate === SR, String(dec.sampleRate));
+      const want = wavSamples(wav);
+      check('FLAC is lossless vs the WAV 16-bit samples (bit-exact)', dec.samples.length === want.length && dec.samples.every((v, i) => v === want[i]));
+    }
+    check('FLAC is materially smaller than WAV on speech-like audio', flac.length < wav.length * 0.8, `flac=${flac.length} wav=${wav.length}`);
+    // The shared kernel quantizer writes exactly what the per-sample clamp-scale-round did.
+    const q = (x: number) => { const s = Math.max(-1, Math.min(1, x)); return Math.round(s < 0 ? s * 0x8000 : s * 0x7FFF); };
+    check('WAV samples are the clamp-scale-round quantizer, sample for sample', wavSamples(wav).every((v, i) => v === q(speech[i])));
+  }
+  // Digital silence → CONSTANT subframes; clipping → clamped identically to WAV.
+  {
+    const silence = encodeFlac(new Float32Array(SR), SR)!;
+    check('digital silence collapses to a few bytes', silence.length < 100, `len=${silence.length}`);
+    const clip = Float32Array.from({ length: 300 }, (_, i) => (i % 2 ? 1.7 : -3));
+    const dec = decodeFlac(encodeFlac(clip, SR)!);
+    const want = wavSamples(encodeWav(clip, SR));
+    check('out-of-range samples clamp exactly as WAV does', dec.samples.every((v, i) => v === want[i]), JSON.stringify(dec.samples.slice(0, 4)));
+  }
+  // Windows FLAC cannot frame (<16 samples) fall back to WAV.
+  check('a sub-16-sample window falls back to WAV', encodeUpload(new Float32Array(8), SR, 'flac').codec === 'wav');
+  check('codec knob: flac parses, anything else is wav', parseUploadCodec(' FLAC ') === 'flac' && parseUploadCodec('opus') === 'wav' && parseUploadCodec(undefined) === 'wav');
+
+  // Negotiation: the backend rejects FLAC once → the client resends as WAV and stays on WAV.
+  {
+    const realFetch = globalThis.fetch;
+    const seen: string[] = [];
+    (globalThis as any).fetch = async (_url: unknown, init: { body: Buffer }) => {
+      const body = Buffer.from(init.body).toString('latin1');
+      const type = body.match(/Content-Type: (audio\/[a-z]+)/)?.[1] ?? '?';
+      seen.push(type);
+      if (type === 'audio/flac') return new Response('{"detail":"Failed to decode audio file"}', { status: 415 });
+      return new Response(JSON.stringify({ text: 'ok', language: 'en', duration: 1, segments: [] }), { status: 200 });
+    };
+    const client = new TranscriptionClient({ serviceUrl: 'http://stt.test', uploadCodec: 'flac', maxRetries: 0, retryDelayMs: 1 });
+    const r1 = await client.transcribe(speech.subarray(0, SR), 'en');
+    const r2 = await client.transcribe(speech.subarray(0, SR), 'en');
+    check('a FLAC rejection is resent as WAV without failing the call (even at maxRetries=0)', r1.text === 'ok' && r2.text === 'ok');
+    check('the downgrade is sticky: flac, wav, wav', JSON.stringify(seen) === JSON.stringify(['audio/flac', 'audio/wav', 'audio/wav']), JSON.stringify(seen));
+    check('negotiatedUploadCodec reports the downgrade', client.negotiatedUploadCodec === 'wav');
+
+    seen.length = 0;
+    (globalThis as any).fetch = async (_url: unknown, init: { body: Buffer }) => {
+      seen.push(Buffer.from(init.body).toString('latin1').match(/filename="([^"]+)"/)?.[1] ?? '?');
+      return new Response(JSON.stringify({ text: 'ok', language: 'en', duration: 1, segments: [] }), { status: 200 });
+    };
+    await new TranscriptionClient({ serviceUrl: 'http://stt.test', uploadCodec: 'flac' }).transcribe(speech.subarray(0, SR), 'en');
+    await new TranscriptionClient({ serviceUrl: 'http://stt.test' }).transcribe(speech.subarray(0, SR), 'en');
+    check('a FLAC-capable backend keeps FLAC; unset stays audio.wav byte-for-byte', JSON.stringify(seen) === JSON.stringify(['audio.flac', 'audio.wav']), JSON.stringify(seen));
+
+    // A 400 that names the format negotiates too; one about something else (model id) does not.
+    seen.length = 0;
+    (globalThis as any).fetch = async (_url: unknown, init: { body: Buffer }) => {
+      const type = Buffer.from(init.body).toString('latin1').match(/Content-Type: (audio\/[a-z]+)/)?.[1] ?? '?';
+      seen.push(type);
+      if (type === 'audio/flac') return new Response('{"detail":"Unsupported audio format: flac"}', { status: 400 });
+      return new Response(JSON.stringify({ text: 'ok', language: 'en', duration: 1, segments: [] }), { status: 200 });
+    };
+    const named = await new TranscriptionClient({ serviceUrl: 'http://stt.test', uploadCodec: 'flac', maxRetries: 0 }).transcribe(speech.subarray(0, SR), 'en');
+    check('a 400 naming the format downgrades to WAV', named.text === 'ok' && JSON.stringify(seen) === JSON.stringify(['audio/flac', 'audio/wav']), JSON.stringify(seen));
+
+    seen.length = 0;
+    (globalThis as any).fetch = async (_url: unknown, init: { body: Buffer }) => {
+      seen.push(Buffer.from(init.body).toString('latin1').match(/Content-Type: (audio\/[a-z]+)/)?.[1] ?? '?');
+      return new Response('{"detail":"Unknown model: whisper-9"}', { status: 400 });
+    };
+    const other = new TranscriptionClient({ serviceUrl: 'http://stt.test', uploadCodec: 'flac', maxRetries: 0 });
+    let fault: any;
+    try { await other.transcribe(speech.subarray(0, SR), 'en'); } catch (e) { fault = e; }
+    check('an unrelated 400 surfaces as bad_request without a WAV resend', fault?.kind === 'bad_request' && fault?.status === 400 && JSON.stringify(seen) === JSON.stringify(['audio/flac']), JSON.stringify(seen));
+    check('…and leaves the negotiated codec on FLAC', other.negotiatedUploadCodec === 'flac');
+    (globalThis as any).fetch = realFetch;
+  }
+
+  if (failed) { console.error(`\n❌ upload codec: ${failed} check(s) FAILED.`); process.exit(1); }
+  console.log('\n✅ upload codec: FLAC is lossless + CRC-valid + smaller; a rejecting backend negotiates down to WAV.');
+}
+run().catch((e) => { console.error(e); process.exit(1); });
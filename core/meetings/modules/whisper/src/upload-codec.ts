@@ -0,0 +1,285 @@
+/**
+ * Upload codecs for the STT request body — Float32 PCM → the bytes the `file` part carries.
+ *
+ *   wav  — 16-bit PCM RIFF/WAVE (the universal baseline every OpenAI-compatible backend reads).
+ *   flac — the SAME 16-bit samples, losslessly compressed (fixed-predictor subframes + partitioned
+ *          Rice residuals). Speech windows land at roughly half the WAV size, and every backend
+ *          that reads WAV through libsndfile/ffmpeg reads FLAC in memory too.
+ *
+ * Both codecs quantize identically (`floatToInt16`, the shared @vexa/audio-kernels quantizer —
+ * WASM SIMD when the host has it), so switching codec never changes what the model hears — only
+ * how many bytes cross the wire. Pure.
+ */
+import { floatToInt16 } from '@vexa/audio-kernels';
+
+export type UploadCodec = 'wav' | 'flac';
+
+/** Per-codec form-part metadata (filename extension + Content-Type). */
+export const UPLOAD_CODEC_MIME: Record<UploadCodec, { filename: string; contentType: string }> = {
+  wav: { filename: 'audio.wav', contentType: 'audio/wav' },
+  flac: { filename: 'audio.flac', contentType: 'audio/flac' },
+};
+
+/** WAV samples are little-endian: a little-endian host quantizes straight into the file. */
+const LITTLE_ENDIAN = new Uint8Array(Uint16Array.of(1).buffer)[0] === 1;
+
+/** Float32 PCM → a 16-bit mono RIFF/WAVE file. */
+export function encodeWav(samples: Float32Array, sampleRate: number): Buffer {
+  const dataSize = samples.length * 2;
+  const buffer = Buffer.alloc(44 + dataSize);
+  buffer.write('RIFF', 0);
+  buffer.writeUInt32LE(36 + dataSize, 4);
+  buffer.write('WAVE', 8);
+  buffer.write('fmt ', 12);
+  buffer.writeUInt32LE(16, 16);              // fmt chunk size
+  buffer.writeUInt16LE(1, 20);               // PCM
+  buffer.writeUInt16LE(1, 22);               // mono
+  buffer.writeUInt32LE(sampleRate, 24);
+  buffer.writeUInt32LE(sampleRate * 2, 28);  // byte rate
+  buffer.writeUInt16LE(2, 32);               // block align
+  buffer.writeUInt16LE(16, 34);              // bits per sample
+  buffer.write('data', 36);
+  buffer.writeUInt32LE(dataSize, 40);
+  if (LITTLE_ENDIAN && (buffer.byteOffset + 44) % 2 === 0) {
+    floatToInt16(samples, new Int16Array(buffer.buffer, buffer.byteOffset + 44, samples.length));
+  } else {
+    const pcm = floatToInt16(samples);
+    for (let i = 0; i < pcm.length; i++) buffer.writeInt16LE(pcm[i], 44 + i * 2);
+  }
+  return buffer;
+}
+
+// ── FLAC ─────────────────────────────────────────────────────────────────────────────────────
+
+const FLAC_BLOCK = 4096;
+const MAX_FIXED_ORDER = 4;
+const MAX_PARTITION_ORDER = 4;
+const MAX_RICE_PARAM = 14;          // 15 is the escape code — never emitted
+
+/** MSB-first bit writer over a growable byte buffer. */
+class BitWriter {
+  private buf = new Uint8Array(1 << 14);
+  private len = 0;
+  private acc = 0;
+  private nacc = 0;
+
+  get byteLength(): number { return this.len; }
+
+  /** Write the low `n` bits of `v` (n ≤ 32). */
+  bits(v: number, n: number): void {
+    while (n > 16) { n -= 16; this.bits16((v >>> n) & 0xffff, 16); }
+    this.bits16(v & ((1 << n) - 1), n);
+  }
+
+  /** `q` zero bits then a one — FLAC's unary quotient. */
+  unary(q: number): void {
+    while (q >= 16) { this.bits16(0, 16); q -= 16; }
+    this.bits16(1, q + 1);
+  }
+
+  /** Zero-pad to the next byte boundary. */
+  align(): void { if (this.nacc) this.bits16(0, 8 - this.nacc); }
+
+  bytes(): Uint8Array { return this.buf.subarray(0, this.len); }
+
+  private bits16(v: number, n: number): void {
+    if (n === 0) return;
+    this.acc = (this.acc << n) | v;
+    this.nacc += n;
+    while (this.nacc >= 8) {
+      this.nacc -= 8;
+      this.push((this.acc >>> this.nacc) & 0xff);
+    }
+    this.acc &= (1 << this.nacc) - 1;
+  }
+
+  private push(b: number): void {
+    if (this.len === this.buf.length) {
+      const grown = new Uint8Array(this.buf.length * 2);
+      grown.set(this.buf);
+      this.buf = grown;
+    }
+    this.buf[this.len++] = b;
+  }
+}
+
+const CRC8 = new Uint8Array(256);
+const CRC16 = new Uint16Array(256);
+for (let i = 0; i < 256; i++) {
+  let c8 = i;
+  let c16 = i << 8;
+  for (let b = 0; b < 8; b++) {
+    c8 = (c8 & 0x80) ? ((c8 << 1) ^ 0x07) & 0xff : (c8 << 1) & 0xff;
+    c16 = (c16 & 0x8000) ? ((c16 << 1) ^ 0x8005) & 0xffff : (c16 << 1) & 0xffff;
+  }
+  CRC8[i] = c8;
+  CRC16[i] = c16;
+}
+function crc8(b: Uint8Array, from: number, to: number): number {
+  let c = 0;
+  for (let i = from; i < to; i++) c = CRC8[c ^ b[i]];
+  return c;
+}
+function crc16(b: Uint8Array, from: number, to: number): number {
+  let c = 0;
+  for (let i = from; i < to; i++) c = ((c << 8) & 0xffff) ^ CRC16[((c >>> 8) ^ b[i]) & 0xff];
+  return c;
+}
+
+/** Fixed-predictor residual of order `order` at sample i (i ≥ order). */
+function fixedResidual(x: Int32Array, i: number, order: number): number {
+  switch (order) {
+    case 0: return x[i];
+    case 1: return x[i] - x[i - 1];
+    case 2: return x[i] - 2 * x[i - 1] + x[i - 2];
+    case 3: return x[i] - 3 * x[i - 1] + 3 * x[i - 2] - x[i - 3];
+    default: return x[i] - 4 * x[i - 1] + 6 * x[i - 2] - 4 * x[i - 3] + x[i - 4];
+  }
+}
+
+/** Exact Rice-coded size (bits) of zig-zagged residuals u[from..to) with parameter k. */
+function riceBits(u: Uint32Array, from: number, to: number, k: number): number {
+  let bits = (to - from) * (k + 1);
+  for (let i = from; i < to; i++) bits += u[i] >>> k;
+  return bits;
+}
+
+/** Best Rice parameter for a partition: start from the mean's log2 and probe its neighbours. */
+function bestRice(u: Uint32Array, from: number, to: number): { k: number; bits: number } {
+  const n = to - from;
+  let sum = 0;
+  for (let i = from; i < to; i++) sum += u[i];
+  const guess = n > 0 && sum > n ? Math.min(MAX_RICE_PARAM, Math.floor(Math.log2(sum / n))) : 0;
+  let best = { k: guess, bits: riceBits(u, from, to, guess) };
+  for (const k of [guess - 1, guess + 1]) {
+    if (k < 0 || k > MAX_RICE_PARAM) continue;
+    const bits = riceBits(u, from, to, k);
+    if (bits < best.bits) best = { k, bits };
+  }
+  return best;
+}
+
+/** Encode one subframe (mono, 16-bit): CONSTANT for digital silence, else the cheapest
+ *  FIXED order 0..4 with the cheapest Rice partition order. */
+function writeSubframe(w: BitWriter, x: Int32Array): void {
+  const n = x.length;
+  let constant = true;
+  for (let i = 1; i < n && constant; i++) constant = x[i] === x[0];
+  if (constant) {
+    w.bits(0b00000000, 8);                      // pad + CONSTANT + no wasted bits
+    w.bits(x[0] & 0xffff, 16);
+    return;
+  }
+
+  // Pick the fixed order with the smallest absolute residual sum (the usual FLAC heuristic).
+  const maxOrder = Math.min(MAX_FIXED_ORDER, n - 1);
+  let order = 0;
+  let bestSum = Infinity;
+  for (let o = 0; o <= maxOrder; o++) {
+    let s = 0;
+    for (let i = o; i < n; i++) s += Math.abs(fixedResidual(x, i, o));
+    if (s < bestSum) { bestSum = s; order = o; }
+  }
+  const u = new Uint32Array(n);
+  for (let i = order; i < n; i++) {
+    const r = fixedResidual(x, i, order);
+    u[i] = r >= 0 ? r * 2 : -r * 2 - 1;
+  }
+
+  // Partition order: the block must split evenly and the first partition must outlast the warm-up.
+  let best = { porder: 0, params: [] as number[], bits: Infinity };
+  for (let p = 0; p <= MAX_PARTITION_ORDER; p++) {
+    const parts = 1 << p;
+    if (n % parts !== 0 || (n >> p) <= order) break;
+    const size = n >> p;
+    const params: number[] = [];
+    let bits = 0;
+    for (let j = 0; j < parts; j++) {
+      const r = bestRice(u, j === 0 ? order : j * size, (j + 1) * size);
+      params.push(r.k);
+      bits += 4 + r.bits;
+    }
+    if (bits < best.bits) best = { porder: p, params, bits };
+  }
+
+  w.bits(0b00010000 | (order << 1), 8);         // pad + FIXED(order) + no wasted bits
+  for (let i = 0; i < order; i++) w.bits(x[i] & 0xffff, 16);
+  w.bits(0b00, 2);                              // residual coding: Rice, 4-bit parameters
+  w.bits(best.porder, 4);
+  const size = n >> best.porder;
+  best.params.forEach((k, j) => {
+    w.bits(k, 4);
+    for (let i = j === 0 ? order : j * size; i < (j + 1) * size; i++) {
+      w.unary(u[i] >>> k);
+      if (k) w.bits(u[i] & ((1 << k) - 1), k);
+    }
+  });
+}
+
+/** The frame number in FLAC's UTF-8-style variable-length coding. */
+function writeFrameNumber(w: BitWriter, n: number): void {
+  if (n < 0x80) { w.bits(n, 8); return; }
+  if (n < 0x800) { w.bits(0xc0 | (n >>> 6), 8); w.bits(0x80 | (n & 0x3f), 8); return; }
+  if (n < 0x10000) { w.bits(0xe0 | (n >>> 12), 8); w.bits(0x80 | ((n >>> 6) & 0x3f), 8); w.bits(0x80 | (n & 0x3f), 8); return; }
+  w.bits(0xf0 | (n >>> 18), 8);
+  w.bits(0x80 | ((n >>> 12) & 0x3f), 8);
+  w.bits(0x80 | ((n >>> 6) & 0x3f), 8);
+  w.bits(0x80 | (n & 0x3f), 8);
+}
+
+/** Float32 PCM → a 16-bit mono FLAC stream. Returns null when the window is too short for a
+ *  valid STREAMINFO (FLAC's minimum block is 16 samples) — the caller sends WAV instead. */
+export function encodeFlac(samples: Float32Array, sampleRate: number): Buffer | null {
+  const total = samples.length;
+  if (total < 16 || sampleRate <= 0 || sampleRate >= 1 << 20) return null;
+  const pcm = Int32Array.from(floatToInt16(samples));
+
+  const w = new BitWriter();
+  const block = Math.min(FLAC_BLOCK, total);
+  // "fLaC" + the one (last) metadata block: STREAMINFO, 34 bytes.
+  w.bits(0x664c6143, 32);
+  w.bits(0x80, 8);                              // last-metadata-block flag + type 0
+  w.bits(34, 24);
+  w.bits(block, 16);                            // min block size
+  w.bits(block, 16);                            // max block size
+  w.bits(0, 24);                                // min frame size (unknown)
+  w.bits(0, 24);                                // max frame size (unknown)
+  w.bits(sampleRate, 20);
+  w.bits(0, 3);                                 // channels - 1
+  w.bits(15, 5);                                // bits per sample - 1
+  w.bits(0, 4);                                 // total samples, high 4 of 36 bits
+  w.bits(total >>> 0, 32);
+  for (let i = 0; i < 4; i++) w.bits(0, 32);    // MD5 (unset is allowed)
+
+  for (let start = 0, frame = 0; start < total; start += block, frame++) {
+    const n = Math.min(block, total - start);
+    const head = w.byteLength;
+    w.bits(0xfff8, 16);                         // sync + reserved + fixed blocking
+    w.bits(0b0111, 4);                          // block size: 16-bit (n-1) follows the header
+    w.bits(0b0000, 4);                          // sample rate: from STREAMINFO
+    w.bits(0b0000, 4);                          // mono
+    w.bits(0b100, 3);                           // 16 bits per sample
+    w.bits(0, 1);
+    writeFrameNumber(w, frame);
+    w.bits(n - 1, 16);
+    w.bits(crc8(w.bytes(), head, w.byteLength), 8);
+    writeSubframe(w, pcm.subarray(start, start + n));
+    w.align();
+    w.bits(crc16(w.bytes(), head, w.byteLength), 16);
+  }
+  return Buffer.from(w.bytes());
+}
+
+/** Encode `samples` for upload with `codec`; a window FLAC can't frame falls back to WAV. */
+export function encodeUpload(samples: Float32Array, sampleRate: number, codec: UploadCodec): { codec: UploadCodec; bytes: Buffer } {
+  if (codec === 'flac') {
+    const flac = encodeFlac(samples, sampleRate);
+    if (flac) return { codec: 'flac', bytes: flac };
+  }
+  return { codec: 'wav', bytes: encodeWav(samples, sampleRate) };
+}
+
+/** Parse an upload-codec knob (env / config string); anything unknown is the WAV baseline. */
+export function parseUploadCodec(raw: string | undefined | null): UploadCodec {
+  return String(raw ?? '').trim().toLowerCase() === 'flac' ? 'flac' : 'wav';
+}
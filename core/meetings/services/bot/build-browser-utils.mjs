@@ -12,13 +12,14 @@
  * bot import (gate:isolation) — it is a BROWSER bundle loaded into the meeting page
  * at runtime. capture-bridge.ts injects this file via addInitScript so that
  * `window.VexaBrowserUtils.*` is present on every navigation; the Node side imports
- * nothing from those packages (PCM crosses the Playwright boundary as plain
- * `(speakerIndex, number[])` over page.exposeFunction).
+ * nothing from those packages (PCM crosses the Playwright boundary as base64
+ * capture.v1 frame batches over page.exposeFunction — see src/frame-transport.ts).
  *
  * THE CONTRACT (what capture-bridge.ts calls on window.VexaBrowserUtils):
  *   • createGmeetCapture({ log, onAudio })        — gmeet lane per-channel PCM
  *   • createGmeetSpeakers({ log })                — gmeet lane glow → litNames()
  *   • createMixedAudioCapture(stream, onPcm)      — mixed lane (zoom/teams)
+ *   • encodeAudioFrame / encodeAudioFrameBatch    — the binary page → Node frame transport
  * We additionally expose the rest of the gmeet capture surface
  * (GmeetChannelBinder, createPcmCaptureNode, createGmeetCaptureV1, pickBoundName,
  * installRemoteAudioHook) so the global mirrors production's shape and the same
@@ -55,6 +56,7 @@ const RECORD = moduleEntry('record-chunker');     // @vexa/record-chunker (Media
 const JITSI = moduleEntry('jitsi-capture');       // @vexa/jitsi-capture (dominant-speaker hints + chat)
 const TEAMS = moduleEntry('teams-capture');       // @vexa/teams-capture (voice-level-outline speaker hints)
 const ZOOM = moduleEntry('zoom-capture');         // @vexa/zoom-capture (active-speaker DOM watcher → 'dom-active' hints)
+const CODEC = moduleEntry('capture-codec');       // @vexa/capture-codec (binary frame + batch layout for the bridge transport)
 
 // In-memory entry: import the bricks and hang them on window.VexaBrowserUtils with
 // the EXACT names capture-bridge.ts reaches for. esbuild bundles the relative
@@ -86,6 +88,10 @@ import {
 import {
   createZoomSpeakers,
 } from ${JSON.stringify(ZOOM)};
+import {
+  encodeAudioFrame,
+  encodeAudioFrameBatch,
+} from ${JSON.stringify(CODEC)};
 
 const VexaBrowserUtils = {
   // ── gmeet lane (per-participant capture + glow attribution) ──
@@ -108,6 +114,9 @@ const VexaBrowserUtils = {
   createTeamsSpeakers,       // capture-bridge.ts: w.VexaBrowserUtils.createTeamsSpeakers
   // ── zoom lane (active-speaker DOM watcher → 'dom-active' naming hints) ──
   createZoomSpeakers,        // capture-bridge.ts: w.VexaBrowserUtils.createZoomSpeakers
+  // ── capture transport (page → Node binary frame batches) ──
+  encodeAudioFrame,          // capture-bridge.ts: codec.encodeAudioFrame (one frame, codec layout)
+  encodeAudioFrameBatch,     // capture-bridge.ts: codec.encodeAudioFrameBatch (one binding call per window)
 };
 
 (globalThis).VexaBrowserUtils = VexaBrowserUtils;
@@ -154,4 +163,5 @@ console.log('  - GmeetChannelBinder / createPcmCaptureNode');
 console.log('  - createMixedAudioCapture / installRemoteAudioHook');
 console.log('  - createJitsiSpeakers / createJitsiChat / sendJitsiChatMessage');
 console.log('  - createTeamsSpeakers / createZoomSpeakers');
+console.log('  - encodeAudioFrame / encodeAudioFrameBatch');
 console.log('  - window.performLeaveAction');
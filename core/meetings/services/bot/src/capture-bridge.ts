@@ -21,8 +21,10 @@
  * NOT a bot dependency (gate:isolation) — it is a BROWSER bundle loaded into the page at runtime
  * (production's `window.VexaBrowserUtils`, installed via addInitScript of the prebuilt
  * browser-utils.global.js). The Node side here imports nothing from those packages; PCM frames
- * cross as plain `(speakerIndex: number, samples: number[])` over `page.exposeFunction`, exactly
- * as production does, so the bot's import surface stays within the gate.
+ * cross as capture.v1 audio frame BATCHES (base64 of the codec's binary layout, one binding call
+ * per batching window — frame-transport.ts reads it), so the bot's import surface stays within
+ * the gate. A page without the codec in its bundle falls back to production's plain
+ * `(speakerIndex: number, samples: number[])` bindings.
  */
 import {
   launchPersistentBrowser,
@@ -37,12 +39,13 @@ import {
 } from '@vexa/remote-browser';
 import { getJoinBrowserArgs } from '@vexa/join';
 import type { RecordingMasterFormat } from '@vexa/recording';
-import { isMixedLanePlatform, type Invocation } from './config.js';
+import { isMixedLanePlatform, type Invocation, type Platform } from './config.js';
 import type { BotPipeline } from './pipeline.js';
 import type { BotRecordingSink } from './recording.js';
-import type { TelemetrySink } from './ports.js';
+import type { CaptureLatencyTap, TelemetrySink } from './ports.js';
 import type { RemoteAudioActivityTap } from './aloneness.js';
 import { createTtsPlayback } from './tts-playback.js';
+import { captureBatchMs, makeFrameBatchSink } from './frame-transport.js';
 
 /** Float32 PCM → base64 of its little-endian bytes — the EXACT codec wire payload, so a stored
  *  captured-signal.v1 frame round-trips through @vexa/capture-codec (encode→decode→same PCM). */
@@ -142,18 +145,39 @@ export interface BrowserSession {
  * what @vexa/join expects.  // L4 (O6/VM): live-validated against a real meeting.
  */
 export async function launchBrowser(inv: Invocation): Promise<BrowserSession> {
+  return openBrowser(inv.platform, inv);
+}
+
+/**
+ * Warm pool (warm.ts): launch the guest browser for `platform` BEFORE any invocation exists — the
+ * same context, args, capture bundle and page hooks launchBrowser installs, minus the per-meeting
+ * bits. `bindPrelaunchedBrowser` adds those once the claim lands. Authenticated bots never come from
+ * here: their profile dir is restored from S3 before launch, per identity.
+ */
+export async function prelaunchBrowser(platform: Platform): Promise<BrowserSession> {
+  return openBrowser(platform, undefined);
+}
+
+/** Finish a prelaunched session for the claimed invocation. Init scripts run on every later
+ *  navigation, so the voice-agent gate is in place before the join navigates to the meeting. */
+export async function bindPrelaunchedBrowser(session: BrowserSession, inv: Invocation): Promise<void> {
+  await session.context.addInitScript(`window.__vexa_voice_agent_enabled = ${!!inv.voiceAgentEnabled};`);
+}
+
+async function openBrowser(platform: Platform, inv: Invocation | undefined): Promise<BrowserSession> {
   // Every bot gets its OWN profile dir — concurrent bots sharing one dir die on Chromium's
   // SingletonLock (#478: joining → failed <1s, "Opening in existing browser session").
   // Authenticated: restore the S3 userdata into this bot's dir before launch (index.ts:2313–2347).
   const dataDir = makeEphemeralProfileDir();
   const s3Config = {
-    userdataS3Path: inv.userdataS3Path,
-    s3Endpoint: inv.s3Endpoint,
-    s3Bucket: inv.s3Bucket,
-    s3AccessKey: inv.s3AccessKey,
-    s3SecretKey: inv.s3SecretKey,
+    userdataS3Path: inv?.userdataS3Path,
+    s3Endpoint: inv?.s3Endpoint,
+    s3Bucket: inv?.s3Bucket,
+    s3AccessKey: inv?.s3AccessKey,
+    s3SecretKey: inv?.s3SecretKey,
   };
-  if (inv.authenticated && inv.userdataS3Path) {
+  const authenticated = !!(inv?.authenticated && inv.userdataS3Path);
+  if (authenticated) {
     // Fail-loud restore: an unreachable/misconfigured store surfaces as a typed SessionSyncError
     // naming the session-restore step (the composition root drives it to a clean terminal failed)
     // — an authenticated bot never silently proceeds to join signed-out on a failed restore.
@@ -168,7 +192,8 @@ export async function launchBrowser(inv: Invocation): Promise<BrowserSession> {
   const { context, page } = await launchPersistentBrowser({ dataDir, args });
 
   // Voice-agent gate the page reads to decide whether to keep the mic hot (production parity).
-  await context.addInitScript(`window.__vexa_voice_agent_enabled = ${!!inv.voiceAgentEnabled};`);
+  // A prelaunched (warm) session gets it from bindPrelaunchedBrowser once it is claimed.
+  if (inv) await context.addInitScript(`window.__vexa_voice_agent_enabled = ${!!inv.voiceAgentEnabled};`);
   // Inject the page-side capture bundle on every navigation (defines window.VexaBrowserUtils).
   await context.addInitScript({ path: BROWSER_UTILS_PATH }).catch(() => {
     // The bundle may be loaded by other means in some images; capture wiring degrades to the
@@ -209,7 +234,7 @@ export async function launchBrowser(inv: Invocation): Promise<BrowserSession> {
   // tracks, and hooking RTCPeerConnection is version-proof where its DOM <audio> ids are not.
   // MUST run before the page builds its RTCPeerConnections; addInitScript
   // runs at document-start, after the bundle above has defined window.VexaBrowserUtils. (L4 — Zoom/Teams.)
-  if (isMixedLanePlatform(inv.platform)) {
+  if (isMixedLanePlatform(platform)) {
     await context.addInitScript(
       `try { window.VexaBrowserUtils && window.VexaBrowserUtils.installRemoteAudioHook && window.VexaBrowserUtils.installRemoteAudioHook({}); } catch (e) {}`,
     ).catch(() => { /* non-fatal */ });
@@ -235,7 +260,7 @@ export async function launchBrowser(inv: Invocation): Promise<BrowserSession> {
       // spawn restores the freshest state instead of a decaying snapshot. Clean teardown only:
       // a SIGKILL never reaches close(), so a hard-killed meeting keeps the last durable copy.
       // Failures are attributed warnings, bounded per upload — teardown never hangs on S3.
-      if (inv.authenticated && inv.userdataS3Path) {
+      if (authenticated) {
         try {
           syncBrowserDataToS3(s3Config, dataDir);
         } catch (e) {
@@ -248,8 +273,9 @@ export async function launchBrowser(inv: Invocation): Promise<BrowserSession> {
 }
 
 /**
- * Wire the page-side capture to pipeline.feedAudio. Exposes the Node bridge binding
- * `__vexaPerSpeakerAudioData(speakerIndex, samples[], tsMs?)` and starts the in-page capture
+ * Wire the page-side capture to pipeline.feedAudio. Exposes the Node bridge bindings —
+ * `__vexaAudioBatch(base64)` (binary frame batches, see frame-transport.ts) and the legacy
+ * `__vexaPerSpeakerAudioData(speakerIndex, samples[], tsMs?)` — and starts the in-page capture
  * (preferring the shared VexaBrowserUtils module, with production's inline fallback). For the
  * mixed lane (Zoom/Teams) it instead pumps the single mixed stream + active-speaker hints.
  * Returns a stop fn that tears the page-side capture down.
@@ -266,6 +292,8 @@ export async function startCaptureBridge(
   onChat?: (sender: string, text: string) => void,
   /** Active-phase silence signal. It remains unavailable until page capture reports ready. */
   activity?: RemoteAudioActivityTap,
+  /** Capture→bridge latency, per frame, from the frame's capture ts (telemetry.ts createLatencyTracer). */
+  latency?: CaptureLatencyTap,
 ): Promise<() => Promise<void>> {
   const mixed = isMixedLanePlatform(inv.platform);
   const jitsi = inv.platform === 'jitsi';
@@ -280,25 +308,28 @@ export async function startCaptureBridge(
   const observeRemoteAudio = makeRemoteAudioEnergyTap(activity);
 
   // ── Node-side frame sink: one capture.v1 frame crossing the Playwright boundary. ──
-  // The page serializes PCM as a plain number[] (Array.from(Float32Array)); we restore the
-  // Float32Array and stamp the capture time if the page didn't supply one (production stamps
-  // Date.now() on the Node side — index.ts:1598–1605).
-  const onPerSpeakerAudio = (speakerIndex: number, samples: number[], tsMs?: number): void => {
-    const pcm = new Float32Array(samples);
-    const ts = tsMs ?? Date.now();
+  // Every transport lands here with a Float32Array and the capture time; the legacy number[]
+  // bindings stamp it Node-side when the page didn't supply one (production stamps Date.now()
+  // on the Node side — index.ts:1598–1605).
+  const onFrame = (channel: number, glowName: string | undefined, pcm: Float32Array, ts: number): void => {
     observeRemoteAudio(pcm);
-    tee(speakerIndex, pcm, ts);                                 // O-TEL-1: tap BEFORE the pipeline
+    latency?.observeCapture(ts);
+    tee(channel, pcm, ts, glowName);                            // O-TEL-1: tap BEFORE the pipeline
     if (mixed) pipeline.feedMixedAudio(pcm, ts);
-    else pipeline.feedAudio(speakerIndex, undefined, pcm, ts); // glow name is bound page-side in the v1 producer; channel index here
+    else pipeline.feedAudio(channel, glowName, pcm, ts);       // glow name is bound page-side in the v1 producer; channel index here
   };
+  const onPerSpeakerAudio = (speakerIndex: number, samples: number[], tsMs?: number): void =>
+    onFrame(speakerIndex, undefined, new Float32Array(samples), tsMs ?? Date.now());
   // gmeet: the v1 producer stamps the glow name page-side; this named variant carries it through.
-  const onNamedAudio = (channel: number, glowName: string | undefined, samples: number[], tsMs?: number): void => {
-    const pcm = new Float32Array(samples);
-    const ts = tsMs ?? Date.now();
-    observeRemoteAudio(pcm);
-    tee(channel, pcm, ts, glowName);                            // O-TEL-1: tap BEFORE the pipeline
-    pipeline.feedAudio(channel, glowName, pcm, ts);
-  };
+  const onNamedAudio = (channel: number, glowName: string | undefined, samples: number[], tsMs?: number): void =>
+    onFrame(channel, glowName, new Float32Array(samples), tsMs ?? Date.now());
+  // The binary path: one base64 capture.v1 frame batch per page batching window, PCM viewed in place.
+  const batchSink = makeFrameBatchSink((f) => onFrame(f.speakerIndex, f.speakerName, f.samples, f.ts));
+  const transportTimer = setInterval(() => {
+    const r = batchSink.rates();
+    console.log(`[bot] capture-transport frames/s=${r.framesPerSec.toFixed(1)} bytes/s=${Math.round(r.bytesPerSec)} batches/s=${r.batchesPerSec.toFixed(1)} total-frames=${batchSink.stats().frames}`);
+  }, 30_000);
+  transportTimer.unref?.();   // observability only — never holds the process open
   // mixed lane "who is lit" hint (Zoom/Teams active-speaker → the namer's time window).
   // Epoch-clock-guarded + counted; see makeSpeakerHintSink for the clock contract.
   const { sink: onSpeakerHint, crossed: hintsBridgeCrossed } = makeSpeakerHintSink(pipeline, undefined, telemetry);
@@ -315,6 +346,7 @@ export async function startCaptureBridge(
     if (!String(e.message).includes('already registered')) throw e;
   });
   await page.exposeFunction('__vexaNamedAudioData', onNamedAudio).catch(() => { /* optional */ });
+  await page.exposeFunction('__vexaAudioBatch', batchSink.sink).catch(() => { /* optional — number[] fallback */ });
   await page.exposeFunction('__vexaSpeakerHint', onSpeakerHint).catch(() => { /* optional */ });
   await page.exposeFunction('__vexaRemoteAudioReady', (): void => activity?.ready()).catch((e: Error) => {
     if (!String(e.message).includes('already registered')) throw e;
@@ -327,8 +359,42 @@ export async function startCaptureBridge(
   // ── Start the page-side capture (VexaBrowserUtils preferred; production inline fallback). ──
   // The body of this callback runs IN THE BROWSER (Playwright serializes it); DOM globals are
   // reached via globalThis (this file type-checks against the Node lib — no DOM types here).
-  await page.evaluate(async ({ isMixed, isJitsi, isTeams, isZoom, botName }) => {
+  await page.evaluate(async ({ isMixed, isJitsi, isTeams, isZoom, botName, batchMs }) => {
     const w = (globalThis as any) as Record<string, any>;
+    // The page half of the binary transport: encode each frame in the codec layout, hold it for
+    // up to batchMs (or until the batch is large), then ship the whole batch as ONE base64 string.
+    // Without the codec in the bundle (or the batch binding) it falls back to the number[] bindings.
+    const codec = w.VexaBrowserUtils;
+    const binary = typeof codec?.encodeAudioFrame === 'function' && typeof codec?.encodeAudioFrameBatch === 'function'
+      && typeof w.__vexaAudioBatch === 'function';
+    const MAX_BATCH_BYTES = 256 * 1024;
+    let pending: ArrayBuffer[] = [];
+    let pendingBytes = 0;
+    let flushTimer: any = null;
+    const flush = (): void => {
+      if (flushTimer) { (globalThis as any).clearTimeout(flushTimer); flushTimer = null; }
+      if (!pending.length) return;
+      const bytes = new Uint8Array(codec.encodeAudioFrameBatch(pending));
+      pending = [];
+      pendingBytes = 0;
+      let bin = '';
+      for (let i = 0; i < bytes.length; i += 0x8000) bin += (String.fromCharCode as any).apply(null, bytes.subarray(i, i + 0x8000));
+      w.__vexaAudioBatch((globalThis as any).btoa(bin));
+    };
+    const sendFrame = (index: number, name: string | undefined, pcm: Float32Array, ts: number): void => {
+      if (!binary) {
+        if (name) w.__vexaNamedAudioData(index, name, Array.from(pcm), ts);
+        else w.__vexaPerSpeakerAudioData(index, Array.from(pcm), ts);
+        return;
+      }
+      const frame: ArrayBuffer = codec.encodeAudioFrame(index, ts, pcm, name);
+      pending.push(frame);
+      pendingBytes += frame.byteLength;
+      if (batchMs <= 0 || pendingBytes >= MAX_BATCH_BYTES) flush();
+      else if (!flushTimer) flushTimer = (globalThis as any).setTimeout(flush, batchMs);
+    };
+    w.__vexaFlushAudioBatch = flush;
+    w.logBot?.('[capture] transport=' + (binary ? 'binary batch=' + batchMs + 'ms' : 'number[]'));
     if (isMixed) {
       // Zoom/Teams: installRemoteAudioHook (installed pre-nav) mirrors each remote WebRTC audio
       // track into w.__vexaCapturedRemoteAudioStreams. Combine them into ONE live stream (an
@@ -353,7 +419,7 @@ export async function startCaptureBridge(
         }
         if (!w.__vexaMixedCapture && w.__vexaMixSeen.size && w.VexaBrowserUtils?.createMixedAudioCapture) {
           w.__vexaMixedCapture = true; // guard re-entry while the async create resolves
-          Promise.resolve(w.VexaBrowserUtils.createMixedAudioCapture(w.__vexaMixDest.stream, (pcm: Float32Array) => w.__vexaPerSpeakerAudioData(0, Array.from(pcm))))
+          Promise.resolve(w.VexaBrowserUtils.createMixedAudioCapture(w.__vexaMixDest.stream, (pcm: Float32Array) => sendFrame(0, undefined, pcm, Date.now())))
             .then((cap: any) => { w.__vexaMixedCapture = cap; return cap?.start?.(); })
             .then(async () => {
               await w.__vexaRemoteAudioReady?.();
@@ -431,23 +497,24 @@ export async function startCaptureBridge(
           // Bind the glow name at capture time (the v1 producer's inversion): exactly-one-lit ⇒ name.
           const lit: string[] = w.__vexaGmeetSpeakers?.litNames?.() ?? [];
           const glow = lit.length === 1 ? lit[0] : undefined;
-          if (glow) w.__vexaNamedAudioData(index, glow, Array.from(pcm), Date.now());
-          else w.__vexaPerSpeakerAudioData(index, Array.from(pcm), Date.now());
+          sendFrame(index, glow, pcm, Date.now());
         },
       });
       await w.__vexaGmeetCapture.start();
       await w.__vexaRemoteAudioReady?.();
     }
-  }, { isMixed: mixed, isJitsi: jitsi, isTeams: inv.platform === 'teams', isZoom: inv.platform === 'zoom', botName: inv.botName }).catch((e) => {
+  }, { isMixed: mixed, isJitsi: jitsi, isTeams: inv.platform === 'teams', isZoom: inv.platform === 'zoom', botName: inv.botName, batchMs: captureBatchMs() }).catch((e) => {
     console.error(`[bot] capture bridge: page-side start failed: ${String(e)}`); // L4: surfaces only on the VM
   });
 
   // Stop fn: tear the page-side capture down on teardown (best-effort; the page may be closing).
   return async () => {
     if (countersTimer) clearInterval(countersTimer);
+    clearInterval(transportTimer);
     activity?.unavailable();
     await page.evaluate(() => {
       const w = (globalThis as any) as Record<string, any>;
+      try { w.__vexaFlushAudioBatch?.(); } catch { /* best-effort — deliver the last window */ }
       try { w.__vexaGmeetCapture?.stop?.(); } catch { /* best-effort */ }
       try { w.__vexaTeamsSpeakers?.destroy?.(); w.__vexaTeamsSpeakers = null; } catch { /* best-effort */ }
       try { w.__vexaJitsiSpeakers?.destroy?.(); w.__vexaJitsiSpeakers = null; } catch { /* best-effort */ }
@@ -80,8 +80,11 @@ console.log('\n✅ config (L1/L2): the goldens parse, the env helper round-trips
     BOT_SPEAKER_CONFIRM_THRESHOLD: '1',
     BOT_SPEAKER_MAX_BUFFER_SEC: '30',
     BOT_SPEAKER_IDLE_TIMEOUT_SEC: '15',
+    BOT_SPEAKER_MAX_WINDOW_SEC: '8',
+    BOT_SPEAKER_CONTEXT_SEC: '0.5',
   }, (message) => warnings.push(message));
-  check('speaker-stream env values reach the config', config?.minAudioDuration === 1 && config.submitInterval === 1.5 && config.confirmThreshold === 1 && config.maxBufferDuration === 30 && config.idleTimeoutSec === 15);
+  check('speaker-stream env values reach the config', config?.minAudioDuration === 1 && config.submitInterval === 1.5 && config.confirmThreshold === 1 && config.maxBufferDuration === 30 && config.idleTimeoutSec === 15
+    && config.maxSubmitWindowSec === 8 && config.contextSec === 0.5);
   check('valid speaker-stream env emits no warnings', warnings.length === 0, warnings.join('; '));
 
   const invalidWarnings: string[] = [];
@@ -143,6 +143,8 @@ const SPEAKER_STREAM_ENV: Array<[keyof SpeakerStreamManagerConfig, string]> = [
   ['confirmThreshold', 'BOT_SPEAKER_CONFIRM_THRESHOLD'],
   ['maxBufferDuration', 'BOT_SPEAKER_MAX_BUFFER_SEC'],
   ['idleTimeoutSec', 'BOT_SPEAKER_IDLE_TIMEOUT_SEC'],
+  ['maxSubmitWindowSec', 'BOT_SPEAKER_MAX_WINDOW_SEC'],
+  ['contextSec', 'BOT_SPEAKER_CONTEXT_SEC'],
 ];
 
 /** Read optional Meet speaker-stream tuning knobs from the bot environment. */
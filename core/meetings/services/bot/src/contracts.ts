@@ -133,4 +133,18 @@ export interface TranscriptSegment {
   source?: Source;
   confidence?: number;
   words?: { word: string; start: number; end: number; probability?: number }[];
+  trace?: Trace;
+}
+
+/** Per-hop latency stamps (epoch ms; `stt_*` are durations). The lane fills capture→transcribed,
+ *  the bot adds `published_ms`. Mirrors transcript.v1 `#/$defs/Trace`. */
+export interface Trace {
+  captured_ms?: number;
+  submitted_ms?: number;
+  stt_queue_ms?: number;
+  stt_decode_ms?: number;
+  transcribed_ms?: number;
+  published_ms?: number;
+  ingested_ms?: number;
+  mutable_ms?: number;
 }
@@ -0,0 +1,88 @@
+/**
+ * Binary capture transport — the page → Node frame batch. OFFLINE, NO browser.
+ *
+ * Encodes frames with the REAL @vexa/capture-codec (the same functions the page bundle runs),
+ * feeds the base64 batch through the EXACT `__vexaAudioBatch` closure the bridge exposes, and
+ * asserts:
+ *   • every frame arrives in order with its index, capture ts, glow name and bit-exact PCM;
+ *   • the PCM is a VIEW over the one decoded buffer (no per-frame copy);
+ *   • a misaligned source buffer still decodes (copied once, not mis-viewed);
+ *   • the counters report frames / bytes / batches, and rates() is per-second since last read;
+ *   • the batching window knob parses like its neighbours (invalid → default).
+ * Run: npx tsx src/frame-transport.test.ts
+ */
+import { encodeAudioFrame, encodeAudioFrameBatch } from '@vexa/capture-codec';
+import { captureBatchMs, decodeFrameBatch, makeFrameBatchSink, type DecodedFrame } from './frame-transport.js';
+
+let failed = 0;
+const check = (name: string, cond: boolean, detail = ''): void => {
+  console.log(`  ${cond ? '✅' : '❌'} ${name}${cond ? '' : '  — ' + detail}`);
+  if (!cond) failed++;
+};
+const pcm = (n: number, seed: number): Float32Array =>
+  Float32Array.from({ length: n }, (_, i) => ((((seed * 5 + i * 3) % 256) - 128) / 256));
+const eqF32 = (a: Float32Array, b: Float32Array): boolean => a.length === b.length && a.every((x, i) => Object.is(x, b[i]));
+
+function main(): void {
+  const inputs = [
+    { speakerIndex: 0, ts: 1718000000123, samples: pcm(4096, 1), speakerName: 'Alice' },
+    { speakerIndex: 2, ts: 1718000000124, samples: pcm(4096, 2) },
+    { speakerIndex: 999, ts: 1718000000125, samples: pcm(7, 3), speakerName: 'Zoë Ünïcode' },
+  ];
+  const batch = new Uint8Array(encodeAudioFrameBatch(inputs.map((f) => encodeAudioFrame(f.speakerIndex, f.ts, f.samples, f.speakerName))));
+  const b64 = Buffer.from(batch).toString('base64');
+
+  // ── 1) the bridge closure delivers every frame, in order, bit-exact ──
+  {
+    let t = 1_000;
+    const got: DecodedFrame[] = [];
+    const s = makeFrameBatchSink((f) => got.push(f), () => t);
+    s.sink(b64);
+    check('every frame in the batch was delivered', got.length === inputs.length, `n=${got.length}`);
+    got.forEach((f, i) => {
+      const want = inputs[i];
+      check(`frame ${i} · index/ts/name/pcm survive the transport`,
+        f.speakerIndex === want.speakerIndex && f.ts === want.ts && f.speakerName === want.speakerName && eqF32(f.samples, want.samples),
+        JSON.stringify({ i: f.speakerIndex, ts: f.ts, name: f.speakerName, n: f.samples.length }));
+    });
+    check('PCM is a view over one shared buffer (no per-frame copy)',
+      got.length === 3 && got[0].samples.buffer === got[1].samples.buffer && got[1].samples.buffer === got[2].samples.buffer);
+
+    const st = s.stats();
+    check('counters: batches / frames / decoded bytes', st.batches === 1 && st.frames === 3 && st.bytes === batch.byteLength, JSON.stringify(st));
+    t += 2_000;
+    s.sink(b64);
+    const r = s.rates();
+    check('rates() is per-second since the last read', Math.abs(r.framesPerSec - 3) < 1e-9 && Math.abs(r.batchesPerSec - 1) < 1e-9
+      && Math.abs(r.bytesPerSec - batch.byteLength) < 1e-6, JSON.stringify(r));
+    t += 1_000;
+    const r2 = s.rates();
+    check('rates() resets its window after each read', r2.framesPerSec === 0 && r2.bytesPerSec === 0, JSON.stringify(r2));
+  }
+
+  // ── 2) a misaligned source still decodes (copied once, never mis-viewed) ──
+  {
+    const shifted = new Uint8Array(batch.byteLength + 1);
+    shifted.set(batch, 1);
+    const frames = decodeFrameBatch(shifted.subarray(1));
+    check('misaligned batch decodes bit-exact', frames.length === 3 && eqF32(frames[0].samples, inputs[0].samples) && frames[2].speakerName === 'Zoë Ünïcode');
+  }
+
+  // ── 3) a truncated tail and an empty payload are dropped, never thrown ──
+  {
+    check('truncated tail frame dropped', decodeFrameBatch(batch.subarray(0, batch.byteLength - 3)).length === 2);
+    let n = 0;
+    makeFrameBatchSink(() => n++).sink('');
+    check('empty payload delivers nothing', n === 0);
+  }
+
+  // ── 4) the batching window knob ──
+  check('batch window defaults to 50ms', captureBatchMs(undefined) === 50 && captureBatchMs('') === 50);
+  check('batch window honors 0 (per-frame) and explicit values', captureBatchMs('0') === 0 && captureBatchMs('20') === 20);
+  check('invalid batch window falls back to the default', captureBatchMs('-5') === 50 && captureBatchMs('abc') === 50);
+
+  if (failed) { console.error(`\n❌ frame-transport: ${failed} check(s) FAILED`); process.exit(1); }
+  console.log('\n✅ frame-transport: codec-encoded frame batches cross as one base64 payload and land as in-place Float32 views, counted.');
+}
+
+main();
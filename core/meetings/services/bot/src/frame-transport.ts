@@ -0,0 +1,113 @@
+/**
+ * Binary capture transport — the Node half of the page → Node PCM path.
+ *
+ * The page batches its capture frames over a short window and sends ONE base64 string per
+ * batch over a CDP binding (`__vexaAudioBatch`). The payload is a capture.v1 audio frame batch
+ * (@vexa/capture-codec `encodeAudioFrameBatch`): `([Uint32LE frameLen][audio frame])…`, each
+ * frame in the codec's `encodeAudioFrame` layout. Nothing is boxed per sample on either side —
+ * the page copies Float32 bytes into the batch, Node base64-decodes once and hands the pipeline
+ * Float32Array VIEWS over that one buffer.
+ *
+ * Isolation: the codec is a BROWSER-bundle dependency, not a bot import (gate:isolation), so
+ * the layout is read here directly; frame-transport.test.ts pins it against the real codec.
+ */
+
+/** One decoded capture frame, ready for pipeline.feedAudio / feedMixedAudio. */
+export interface DecodedFrame {
+  speakerIndex: number;
+  ts: number;
+  samples: Float32Array;     // a view into the batch buffer (copied only if misaligned)
+  speakerName?: string;
+}
+
+const LEN_BYTES = 4;
+const AUDIO_HEADER_BYTES = 12;
+const NAMED_HEADER_BYTES = 16;
+const NAME_FLAG = 0x80000000 | 0;
+const utf8 = new TextDecoder();
+
+/** Decode one capture.v1 audio frame batch. Malformed frames are skipped; a truncated
+ *  tail is dropped. PCM is viewed in place when the buffer offset is 4-byte aligned. */
+export function decodeFrameBatch(bytes: Uint8Array): DecodedFrame[] {
+  // Buffer.from(base64) may hand back a pooled slice; PCM views need a 4-aligned base.
+  const src = bytes.byteOffset % 4 === 0 ? bytes : new Uint8Array(bytes);
+  const view = new DataView(src.buffer, src.byteOffset, src.byteLength);
+  const out: DecodedFrame[] = [];
+  let o = 0;
+  while (o + LEN_BYTES <= src.byteLength) {
+    const len = view.getUint32(o, true);
+    const start = o + LEN_BYTES;
+    o = start + len;
+    if (o > src.byteLength) break;
+    if (len < AUDIO_HEADER_BYTES) continue;
+    const raw = view.getInt32(start, true);
+    const ts = view.getFloat64(start + 4, true);
+    let pcmStart = start + AUDIO_HEADER_BYTES;
+    let speakerName: string | undefined;
+    if ((raw & NAME_FLAG) !== 0) {
+      if (len < NAMED_HEADER_BYTES) continue;
+      const nameLen = view.getInt32(start + 12, true);
+      pcmStart = start + NAMED_HEADER_BYTES + ((nameLen + 3) & ~3);
+      if (nameLen < 0 || pcmStart > o) continue;
+      speakerName = utf8.decode(src.subarray(start + NAMED_HEADER_BYTES, start + NAMED_HEADER_BYTES + nameLen)) || undefined;
+    }
+    const samples = new Float32Array(src.buffer, src.byteOffset + pcmStart, (o - pcmStart) >> 2);
+    out.push({ speakerIndex: raw & 0x7fffffff, ts, samples, speakerName });
+  }
+  return out;
+}
+
+/** Cumulative transport counters — the bridge logs their per-second rates periodically. */
+export interface FrameTransportStats {
+  batches: number;
+  frames: number;
+  bytes: number;              // decoded payload bytes (not base64 characters)
+}
+
+/**
+ * Build the Node-side `__vexaAudioBatch` binding — the EXACT closure the capture bridge exposes,
+ * factored out so it is offline-provable WITHOUT a Playwright page. Each decoded frame goes to
+ * `deliver` in batch order. `rates()` returns frames/s and bytes/s since the previous call (the
+ * bridge's counter line); `stats()` is cumulative.
+ */
+export function makeFrameBatchSink(
+  deliver: (frame: DecodedFrame) => void,
+  now: () => number = Date.now,
+): {
+  sink: (base64: string) => void;
+  stats: () => FrameTransportStats;
+  rates: () => { framesPerSec: number; bytesPerSec: number; batchesPerSec: number };
+} {
+  const stats: FrameTransportStats = { batches: 0, frames: 0, bytes: 0 };
+  let mark = { at: now(), ...stats };
+  return {
+    sink: (base64: string): void => {
+      const bytes = Buffer.from(base64, 'base64');
+      const frames = decodeFrameBatch(bytes);
+      stats.batches++;
+      stats.frames += frames.length;
+      stats.bytes += bytes.byteLength;
+      for (const f of frames) deliver(f);
+    },
+    stats: () => ({ ...stats }),
+    rates: () => {
+      const t = now();
+      const dt = Math.max(1, t - mark.at) / 1000;
+      const r = {
+        framesPerSec: (stats.frames - mark.frames) / dt,
+        bytesPerSec: (stats.bytes - mark.bytes) / dt,
+        batchesPerSec: (stats.batches - mark.batches) / dt,
+      };
+      mark = { at: t, ...stats };
+      return r;
+    },
+  };
+}
+
+/** Page-side batching window (ms) for the binary transport. 0 sends every frame as its own
+ *  batch (still binary, no per-sample boxing). Env-overridable (VEXA_CAPTURE_BATCH_MS);
+ *  invalid / negative values fall back to the default. */
+export function captureBatchMs(raw = process.env.VEXA_CAPTURE_BATCH_MS): number {
+  const n = raw !== undefined && raw !== '' ? Number(raw) : NaN;
+  return Number.isFinite(n) && n >= 0 ? n : 50;
+}
@@ -32,9 +32,10 @@ import { createRedisActsSource, redisActsClientFrom } from './adapters/acts-redi
 import { createBrowserJoinDriver } from './join-driver.js';
 import { createBotPipeline, createLivePipeline, createTranscribe, serr, type BotPipeline } from './pipeline.js';
 import { createBotRecordingSink } from './recording.js';
-import { createCaptureSignalRecorder, wrapTranscribeWithTap, type CaptureSignalRecorder } from './telemetry.js';
+import { createCaptureSignalRecorder, createLatencyTracer, wrapTranscribeWithTap, type CaptureSignalRecorder } from './telemetry.js';
 import { createSttFaultReporter } from './stt-faults.js';
-import { launchBrowser, startCaptureBridge, startRecording, createSpeakController, type BrowserSession, type SpeakController } from './capture-bridge.js';
+import { launchBrowser, prelaunchBrowser, bindPrelaunchedBrowser, startCaptureBridge, startRecording, createSpeakController, type BrowserSession, type SpeakController } from './capture-bridge.js';
+import { awaitBind, bindClientFrom, warmSlotFromEnv, type WarmSlot } from './warm.js';
 import { createRemoteAudioActivityTap, createSilenceAlonenessSource, resolveAloneSilenceWindowMs } from './aloneness.js';
 import { installSignalHandlers } from './signals.js';
 import type {
@@ -144,12 +145,44 @@ async function pingRedis(redisUrl: string, timeoutMs = 3000): Promise<boolean> {
   }
 }
 
+/** Keep the warm (prelaunched) browser for the claimed invocation when it fits — the platform it
+ *  was warmed for, a guest join — else close it so the claim launches cold. */
+async function claimWarmSession(session: BrowserSession | null, slot: WarmSlot | null, inv: Invocation): Promise<BrowserSession | null> {
+  if (!session || !slot) return null;
+  if (inv.platform === slot.platform && !inv.authenticated) {
+    try {
+      await bindPrelaunchedBrowser(session, inv);
+      console.log(`[bot] warm: claimed — joining on the prelaunched ${slot.platform} browser`);
+      return session;
+    } catch (e) {
+      console.error(`[bot] warm: binding the prelaunched browser failed — launching cold: ${String(e)}`);
+    }
+  } else {
+    console.log(`[bot] warm: claimed for ${inv.platform}${inv.authenticated ? ' (authenticated)' : ''} — prelaunched ${slot.platform} browser discarded, launching cold`);
+  }
+  await session.close().catch(() => { /* best-effort */ });
+  return null;
+}
+
 export async function main(env: NodeJS.ProcessEnv = process.env): Promise<number> {
+  // ── warm pool (warm.ts): launch for the slot's platform first, then wait to be claimed ──
+  const warm = warmSlotFromEnv(env);
+  let warmSession: BrowserSession | null = null;
+  if (warm) {
+    warmSession = await prelaunchBrowser(warm.platform).catch((e) => {
+      console.error(`[bot] warm: prelaunch failed — the claim will launch cold: ${String(e)}`);
+      return null;
+    });
+    console.log(`[bot] warm: idle for ${warm.platform}, waiting to be claimed`);
+  }
+
   // ── validate config (P14: fail fast) ──
   let inv: Invocation;
   try {
+    if (warm) env = { ...env, ...(await awaitBind(warm, bindClientFrom(warm.redisUrl))) };
     inv = loadInvocation(env);
   } catch (e) {
+    if (warmSession) await warmSession.close().catch(() => { /* best-effort */ });
     if (e instanceof InvocationError) {
       // No valid connection_id to attribute the failure to → emit a best-effort terminal
       // event and exit non-zero. We have no validated callbackUrl yet, so this goes to the
@@ -175,9 +208,11 @@ export async function main(env: NodeJS.ProcessEnv = process.env): Promise<number
   // subscribe surfaces the error and the orchestrator drives to a clean terminal `failed`.
   const transcriptClient = redisClientFrom(inv.redisUrl);
   const actsClient = redisActsClientFrom(inv.redisUrl);
-  const transcript: TranscriptSink = createRedisTranscriptSink({
+  // transcript.v1 trace: stamp published_ms on the way out and log per-hop latency every 30s.
+  const latency = createLatencyTracer();
+  const transcript: TranscriptSink = latency.traceSink(createRedisTranscriptSink({
     client: transcriptClient, meetingId, nativeMeetingId: inv.nativeMeetingId,
-  });
+  }));
   const liveActs = createRedisActsSource({ client: actsClient, meetingId });
 
   // ── 2b: launch the browser + wire join / capture / recording / speak (L4-gated). ──
@@ -208,7 +243,7 @@ export async function main(env: NodeJS.ProcessEnv = process.env): Promise<number
   if (speakerStreamConfig) console.log(`[bot] speaker-stream tuning enabled: ${JSON.stringify(speakerStreamConfig)}`);
 
   try {
-    session = await launchBrowser(inv);                                   // L4 (O6/VM)
+    session = (await claimWarmSession(warmSession, warm, inv)) ?? (await launchBrowser(inv));  // L4 (O6/VM)
     join = createBrowserJoinDriver(session.page, inv);
     botPipeline = createBotPipeline(inv, transcript, {
       // When recording, tee every STT round-trip to <session>.stt.jsonl (the capture/STT/assembly bisect).
@@ -248,7 +283,7 @@ export async function main(env: NodeJS.ProcessEnv = process.env): Promise<number
     // each failure surfaces LOUD via onFault (console with a full-fidelity serr(e)) instead of
     // throwing into the orchestrator's leave-on-fail backstop (which would hang the bot up).
     pipeline = createLivePipeline({
-      startCapture: () => startCaptureBridge(sess.page, inv, bp, signalRecorder?.sink, publishChat, remoteAudioActivity),   // on the live meeting page
+      startCapture: () => startCaptureBridge(sess.page, inv, bp, signalRecorder?.sink, publishChat, remoteAudioActivity, latency),   // on the live meeting page
       startRecording: rec ? () => startRecording(sess.page, inv, rec) : undefined,          // MediaRecorder → recording.v1
       engine: bp,
       onFault: (stage, e) => {
@@ -300,6 +335,7 @@ export async function main(env: NodeJS.ProcessEnv = process.env): Promise<number
     // path that skipped the orchestrator's teardown. (#593)
     await pipeline.stop().catch(() => { /* best-effort */ });
     await signalRecorder?.close().catch(() => { /* best-effort */ });
+    latency.close();
     if (session) await session.close().catch(() => { /* best-effort */ });
     // Quit the redis connections on teardown (best-effort — a quit failure must not change the
     // exit code; they may never have connected if redis was unreachable).
@@ -62,7 +62,7 @@ async function main(): Promise<void> {
     let calls = 0;
     const transcribe = async (): Promise<TranscriptionResult> => {
       calls++;
-      return { text: 'hello world', language: 'en', duration: 0.2, segments: [{ start: 0, end: 0.2, text: 'hello world' }] };
+      return { text: 'hello world', language: 'en', duration: 0.2, segments: [{ start: 0, end: 0.2, text: 'hello world' }], timing: { queue_ms: 5, decode_ms: 30 } };
     };
     const sink = captureSink();
     const pipe = createBotPipeline(baseInv(), sink, { transcribe, config: FAST });
@@ -90,6 +90,12 @@ async function main(): Promise<void> {
       !!seg?.absolute_start_time &&
         Math.abs(new Date(seg.absolute_start_time).getTime() / 1000 - (seg.start ?? 0)) < 1,
       `${seg?.absolute_start_time} vs start=${seg?.start}`);
+    // transcript.v1 trace: the lane stamps its STT pass (the bot adds published_ms at the egress).
+    const t = seg?.trace;
+    check('segment carries the lane trace (captured ≤ fed audio, submitted ≤ transcribed, server timing)',
+      !!t && t.captured_ms !== undefined && t.captured_ms > 1000 && t.captured_ms <= ts &&
+        (t.submitted_ms ?? 0) <= (t.transcribed_ms ?? -1) && t.stt_queue_ms === 5 && t.stt_decode_ms === 30,
+      JSON.stringify(t));
   }
 
   // ── 2) two channels, overlapping turns: each transcribes independently, names stay bound ──
@@ -196,6 +202,17 @@ async function main(): Promise<void> {
         !!s.absolute_start_time &&
         Math.abs(new Date(s.absolute_start_time).getTime() / 1000 - (s.start ?? 0)) < 1),
       JSON.stringify(sink.published.map((s) => ({ id: s.segment_id, abs: s.absolute_start_time, start: s.start }))));
+
+    // transcript.v1 trace: a fresh STT pass carries its trace through; a repaint (rename) does not.
+    const trace = { captured_ms: 3000, submitted_ms: 3100, stt_queue_ms: 4, stt_decode_ms: 80, transcribed_ms: 3200 };
+    cb!.publish('Alice', [{ text: 'traced', startMs: 2500, endMs: 3000, language: 'en', segmentId: 'turn:56:0', trace }], []);
+    cb!.rename('seg_54', 'Bob', [{ text: 'hello there', startMs: 1000, endMs: 2000, language: 'en', segmentId: 'turn:54:0', trace }]);
+    await sleep(20);
+    const fresh = sink.published.find((s) => s.segment_id === 'turn:56:0');
+    const repaint = sink.published.find((s) => s.segment_id === 'turn:54:0' && s.speaker === 'Bob');
+    check('mixed lane: a confirmed segment carries its STT trace (and stays schema-valid)',
+      JSON.stringify(fresh?.trace) === JSON.stringify(trace) && !!validateSeg(fresh), JSON.stringify(fresh));
+    check('mixed lane: a rename repaint carries no trace (not a fresh transcription)', !!repaint && repaint.trace === undefined, JSON.stringify(repaint));
   }
 
   if (failed) { console.error(`\n❌ pipeline (L3): ${failed} check(s) FAILED.`); process.exit(1); }
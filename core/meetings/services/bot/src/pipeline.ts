@@ -30,7 +30,7 @@ import {
   type ChunkedTranscriberCallbacks,
   type HintKind,
 } from '@vexa/mixed-pipeline';
-import { TranscriptionClient, type TranscriptionResult } from '@vexa/transcribe-whisper';
+import { TranscriptionClient, parseUploadCodec, type TranscriptionResult } from '@vexa/transcribe-whisper';
 import { isMixedLanePlatform, type Invocation, type Platform } from './config.js';
 import type { TranscriptSegment } from './contracts.js';
 import type { Pipeline, TranscriptSink } from './ports.js';
@@ -105,6 +105,7 @@ function toBotSegment(seg: LaneSegment): TranscriptSegment {
     source: seg.source,
     confidence: seg.confidence,
     words: seg.words,
+    ...(seg.trace ? { trace: seg.trace } : {}),
   };
 }
 
@@ -156,6 +157,7 @@ function chunkToBotSegment(speaker: string, c: ChunkSegment, completed: boolean)
     absolute_start_time: isoFromEpochSeconds(c.startMs / 1000),
     absolute_end_time: isoFromEpochSeconds(c.endMs / 1000),
     source: 'merged',
+    ...(c.trace ? { trace: c.trace } : {}),
   };
 }
 
@@ -210,7 +212,8 @@ function createMixedBotPipeline(
         publish: (speaker, confirmed, pending) => { publish(speaker, confirmed, true); publish(speaker, pending, false); },
         publishPending: (speaker, segments) => publish(speaker, segments, false),
         clearPending: () => { /* the bot's transcript.v1 egress is append-only; drafts self-replace by id */ },
-        rename: (_oldSpeaker, newSpeaker, segments) => publish(newSpeaker, segments, true),
+        // A repaint republishes old text under a new name — not a fresh transcription, so no trace.
+        rename: (_oldSpeaker, newSpeaker, segments) => publish(newSpeaker, segments.map(({ trace: _t, ...c }) => c), true),
         language,
         onError,
         // C1 hop 4: the binder's instantaneous verdict per hint — a hint with no
@@ -239,8 +242,10 @@ function createMixedBotPipeline(
 
 /** Build the real STT transcribe closure from invocation.v1 — language baked into the call so
  *  the lane never knows about config. transcribeEnabled=false ⇒ a no-op transcribe (the engine
- *  still runs turn gating but emits empty text; recording-only meetings need no STT). */
-export function createTranscribe(inv: Invocation): Transcribe {
+ *  still runs turn gating but emits empty text; recording-only meetings need no STT). The upload
+ *  body codec is a deployment knob (VEXA_STT_UPLOAD_CODEC=flac), not a per-meeting one — the
+ *  client negotiates back down to WAV on a backend that can't read FLAC. */
+export function createTranscribe(inv: Invocation, env: NodeJS.ProcessEnv = process.env): Transcribe {
   if (inv.transcribeEnabled === false || !inv.transcriptionServiceUrl) {
     return async () => ({ text: '', language: inv.language ?? 'en', duration: 0, segments: [] });
   }
@@ -248,6 +253,7 @@ export function createTranscribe(inv: Invocation): Transcribe {
     serviceUrl: inv.transcriptionServiceUrl,
     apiToken: inv.transcriptionServiceToken,
     model: inv.transcriptionModel ?? undefined,
+    uploadCodec: parseUploadCodec(env.VEXA_STT_UPLOAD_CODEC),
   });
   const language = inv.language ?? undefined;
   return (pcm, prompt) => client.transcribe(pcm, language, prompt);
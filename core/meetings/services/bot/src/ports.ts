@@ -152,3 +152,9 @@ export interface TelemetrySink {
    *  fire-and-forget contract as captureFrame. */
   captureHint?(hint: HintEvent): void;
 }
+
+/** Capture-latency tap — the bridge reports each frame's CAPTURE ts as it lands Node-side, so the
+ *  page→Node hop is measured on the frame's own clock. Same fire-and-forget contract as TelemetrySink. */
+export interface CaptureLatencyTap {
+  observeCapture(tsMs: number): void;
+}
@@ -8,7 +8,9 @@
  *   • the frame's pcm ROUND-TRIPS through @vexa/capture-codec (encode→decode→same Float32 PCM) —
  *     proving the stored signal replays through the same wire shape (O-TEL-2);
  *   • the tap is ZERO-OVERHEAD when the sink is unset (no captureFrame calls, no PCM work) — the
- *     proven O6 live-capture path is never altered.
+ *     proven O6 live-capture path is never altered;
+ *   • the latency tracer stamps `published_ms` on traced segments only (a copy — the lane's object is
+ *     untouched) and buckets each hop of the transcript.v1 trace.
  * Run: npx tsx src/telemetry.test.ts
  */
 import Ajv2020, { type ValidateFunction } from 'ajv/dist/2020.js';
@@ -18,6 +20,8 @@ import { dirname, join } from 'node:path';
 import { fileURLToPath } from 'node:url';
 import { encodeAudioFrame, decodeAudioFrame } from '@vexa/capture-codec';
 import { makeRemoteAudioEnergyTap, makeTelemetryTap, pcmToBase64, rmsOf } from './capture-bridge.js';
+import { createLatencyTracer } from './telemetry.js';
+import type { TranscriptSegment } from './contracts.js';
 import type { CapturedFrame, TelemetrySink } from './ports.js';
 
 let failed = 0;
@@ -139,6 +143,31 @@ function main(): void {
       JSON.stringify(energies));
   }
 
+  // ── 5) transcript.v1 trace: the bot's hops, stamped on the way out ──
+  {
+    let clock = 1_000_000;
+    const tracer = createLatencyTracer({ now: () => clock, intervalMs: 0 });
+    const out: TranscriptSegment[] = [];
+    const sink = tracer.traceSink({ async publish(s) { out.push(s); } });
+    const base: TranscriptSegment = { segment_id: 's1', speaker: 'Alice', text: 'hi there', start: 1, end: 2, completed: true };
+    const trace = { captured_ms: clock - 900, submitted_ms: clock - 700, stt_queue_ms: 20, stt_decode_ms: 300, transcribed_ms: clock - 40 };
+    const traced = { ...base, trace };
+    void sink.publish(traced);
+    void sink.publish({ ...base, segment_id: 's2' });
+    tracer.observeCapture(clock - 60);
+    const snap = tracer.snapshot();
+    check('published_ms stamped at egress, on a copy', out[0].trace?.published_ms === clock && !('published_ms' in trace) && out[0] !== traced,
+      JSON.stringify(out[0].trace));
+    check('an untraced segment passes through untouched', out[1].trace === undefined && out[1].segment_id === 's2');
+    check('each hop lands in its stage', snap.capture_to_submit?.sum_ms === 200 && snap.stt_round_trip?.sum_ms === 660 &&
+      snap.stt_queue?.sum_ms === 20 && snap.stt_decode?.sum_ms === 300 && snap.result_to_publish?.sum_ms === 40 &&
+      snap.capture_to_publish?.sum_ms === 900 && snap.capture_to_bridge?.sum_ms === 60, JSON.stringify(snap));
+    const h = snap.capture_to_publish;
+    check('buckets are cumulative (900ms → le=1000 and up, not le=500)',
+      h.buckets['500'] === 0 && h.buckets['1000'] === 1 && h.buckets['10000'] === 1 && h.buckets['+Inf'] === 1, JSON.stringify(h.buckets));
+    tracer.close();
+  }
+
   if (failed) { console.error(`\n❌ telemetry (O-TEL-1): ${failed} check(s) FAILED.`); process.exit(1); }
   console.log('\n✅ telemetry (O-TEL-1): the capture-bridge tap tees raw frames into the TelemetrySink BEFORE the pipeline; each frame is captured-signal.v1-valid + round-trips through @vexa/capture-codec; the tap is zero-overhead when the sink is unset.');
 }
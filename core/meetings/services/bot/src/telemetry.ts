@@ -13,13 +13,17 @@
  *
  * The writer is a port: the local file writer here is the dev/self-host default; an S3
  * chunked writer plugs in behind the same SignalWriter shape without touching the sink.
+ *
+ * The latency tracer (createLatencyTracer) is the bot's share of transcript.v1 `trace`: it stamps
+ * `published_ms` as a segment leaves and keeps per-hop histograms of everything up to there.
  */
 import { appendFileSync, mkdirSync } from 'node:fs';
 import { appendFile } from 'node:fs/promises';
 import { join } from 'node:path';
 import { isMixedLanePlatform, type Invocation } from './config.js';
 import { rmsOf } from './capture-bridge.js';
-import type { CapturedFrame, HintEvent, TelemetrySink } from './ports.js';
+import type { Trace, TranscriptSegment } from './contracts.js';
+import type { CaptureLatencyTap, CapturedFrame, HintEvent, TelemetrySink, TranscriptSink } from './ports.js';
 
 /** Where a session's JSONL lines land. append() receives whole lines (newline-terminated). */
 export interface SignalWriter {
@@ -217,3 +221,99 @@ export function createCaptureSignalRecorder(inv: Invocation, opts: RecorderOptio
     },
   };
 }
+
+// ── transcript.v1 trace: the bot's hops ─────────────────────────────────────────────────
+
+/** Histogram upper bounds (ms). Cumulative: `buckets[le]` counts observations ≤ le. */
+export const LATENCY_BUCKETS_MS = [10, 25, 50, 100, 250, 500, 1000, 2500, 5000, 10000] as const;
+
+export interface LatencyHistogram {
+  count: number;
+  sum_ms: number;
+  max_ms: number;
+  /** Cumulative counts keyed by upper bound, plus `+Inf`. */
+  buckets: Record<string, number>;
+}
+
+export interface LatencyTracer extends CaptureLatencyTap {
+  /** Wrap the transcript egress: stamp `published_ms` on traced segments and observe their hops. */
+  traceSink(sink: TranscriptSink): TranscriptSink;
+  /** Per-stage histograms so far (capture_to_bridge, capture_to_submit, stt_round_trip, stt_queue,
+   *  stt_decode, result_to_publish, capture_to_publish). */
+  snapshot(): Record<string, LatencyHistogram>;
+  /** Stop the periodic log line. Idempotent. */
+  close(): void;
+}
+
+export interface LatencyTracerOptions {
+  now?: () => number;
+  log?: (m: string) => void;
+  /** Periodic `[bot] latency …` line cadence; 0 disables it. Default 30s (the capture-transport cadence). */
+  intervalMs?: number;
+}
+
+function emptyHistogram(): LatencyHistogram {
+  const buckets: Record<string, number> = {};
+  for (const le of LATENCY_BUCKETS_MS) buckets[String(le)] = 0;
+  buckets['+Inf'] = 0;
+  return { count: 0, sum_ms: 0, max_ms: 0, buckets };
+}
+
+/** Smallest bucket bound holding quantile q (a histogram gives an upper bound, not the value). */
+function quantileBound(h: LatencyHistogram, q: number): string {
+  const want = Math.ceil(h.count * q);
+  for (const le of LATENCY_BUCKETS_MS) if (h.buckets[String(le)] >= want) return String(le);
+  return '+Inf';
+}
+
+export function createLatencyTracer(opts: LatencyTracerOptions = {}): LatencyTracer {
+  const now = opts.now ?? Date.now;
+  const log = opts.log ?? ((m: string) => console.log(`[bot] latency ${m}`));
+  const stages = new Map<string, LatencyHistogram>();
+
+  const observe = (stage: string, ms: number | undefined): void => {
+    if (ms === undefined || !Number.isFinite(ms)) return;
+    const v = Math.max(0, ms);
+    let h = stages.get(stage);
+    if (!h) { h = emptyHistogram(); stages.set(stage, h); }
+    h.count++;
+    h.sum_ms += v;
+    h.max_ms = Math.max(h.max_ms, v);
+    for (const le of LATENCY_BUCKETS_MS) if (v <= le) h.buckets[String(le)]++;
+    h.buckets['+Inf']++;
+  };
+  const span = (a?: number, b?: number): number | undefined => (a !== undefined && b !== undefined ? b - a : undefined);
+
+  const observeTrace = (t: Trace): void => {
+    observe('capture_to_submit', span(t.captured_ms, t.submitted_ms));
+    observe('stt_round_trip', span(t.submitted_ms, t.transcribed_ms));
+    observe('stt_queue', t.stt_queue_ms);
+    observe('stt_decode', t.stt_decode_ms);
+    observe('result_to_publish', span(t.transcribed_ms, t.published_ms));
+    observe('capture_to_publish', span(t.captured_ms, t.published_ms));
+  };
+
+  const timer = opts.intervalMs === 0 ? null : setInterval(() => {
+    const parts = [...stages].map(([k, h]) => `${k}=n:${h.count} p50<=${quantileBound(h, 0.5)} p95<=${quantileBound(h, 0.95)} max=${Math.round(h.max_ms)}`);
+    if (parts.length) log(parts.join(' '));
+  }, opts.intervalMs ?? 30_000);
+  timer?.unref?.();   // observability only — never holds the process open
+
+  return {
+    observeCapture(tsMs: number): void {
+      try { observe('capture_to_bridge', now() - tsMs); } catch { /* must never throw into capture */ }
+    },
+    traceSink(sink: TranscriptSink): TranscriptSink {
+      return {
+        publish(segment: TranscriptSegment): Promise<void> {
+          if (!segment.trace) return sink.publish(segment);
+          const trace: Trace = { ...segment.trace, published_ms: now() };
+          observeTrace(trace);
+          return sink.publish({ ...segment, trace });
+        },
+      };
+    },
+    snapshot: () => Object.fromEntries([...stages].map(([k, h]) => [k, { ...h, buckets: { ...h.buckets } }])),
+    close(): void { if (timer) clearInterval(timer); },
+  };
+}
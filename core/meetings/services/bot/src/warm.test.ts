@@ -0,0 +1,78 @@
+/**
+ * L2 — warm-pool boot (warm.ts), offline against a fake BLPOP client.
+ *
+ * Asserts:
+ *   • a workload is warm only with VEXA_WARM_POOL=1 + a bind key + a redis URL + a known platform,
+ *     and a spawn that already carries VEXA_BOT_CONFIG is always cold;
+ *   • awaitBind blocks on the slot's key, returns the claimed spec's env overlay (which then parses
+ *     as invocation.v1 exactly like a cold spawn's env) and quits the client;
+ *   • an off-contract bind payload is an InvocationError (fail fast, P14).
+ * No browser / redis. Run: npx tsx src/warm.test.ts
+ */
+import { readFileSync } from 'node:fs';
+import { dirname, join } from 'node:path';
+import { fileURLToPath } from 'node:url';
+import { InvocationError, loadInvocation } from './config.js';
+import { awaitBind, parseBind, warmSlotFromEnv, type BindClient } from './warm.js';
+
+const HERE = dirname(fileURLToPath(import.meta.url));
+const MINIMAL = readFileSync(
+  join(HERE, '..', '..', '..', 'contracts', 'invocation.v1', 'golden', 'Invocation.minimal.json'), 'utf8');
+
+let failed = 0;
+const check = (name: string, cond: boolean, detail = '') => {
+  console.log(`  ${cond ? '✅' : '❌'} ${name}${cond ? '' : '  — ' + detail}`);
+  if (!cond) failed++;
+};
+
+const WARM = {
+  VEXA_WARM_POOL: '1',
+  VEXA_WARM_VARIANT: 'google_meet',
+  VEXA_WARM_BIND_KEY: 'runtime:warm:bind:warm-meeting-bot-google-meet-1',
+  VEXA_WARM_REDIS_URL: 'redis://redis:6379',
+};
+
+// ── slot detection ──
+{
+  const slot = warmSlotFromEnv(WARM);
+  check('warm env → a slot', slot?.platform === 'google_meet' && slot.bindKey === WARM.VEXA_WARM_BIND_KEY, JSON.stringify(slot));
+  check('no VEXA_WARM_POOL → cold', warmSlotFromEnv({ ...WARM, VEXA_WARM_POOL: undefined }) === null);
+  check('config in hand → cold', warmSlotFromEnv({ ...WARM, VEXA_BOT_CONFIG: MINIMAL }) === null);
+  check('unknown platform → cold', warmSlotFromEnv({ ...WARM, VEXA_WARM_VARIANT: 'webex' }) === null);
+  check('no redis → cold', warmSlotFromEnv({ ...WARM, VEXA_WARM_REDIS_URL: '' }) === null);
+}
+
+// ── the bind wait ──
+{
+  const calls: string[] = [];
+  let pops = 0;
+  const client: BindClient = {
+    async connect() { calls.push('connect'); },
+    async blPop(key, timeoutSec) {
+      calls.push(`blPop ${key} ${timeoutSec}`);
+      pops++;
+      // the first wait returns empty-handed (a reconnect), the second carries the claim
+      return pops === 1 ? null : { key, element: JSON.stringify({ workloadId: 'mtg-1-abcd', env: { VEXA_BOT_CONFIG: MINIMAL } }) };
+    },
+    async quit() { calls.push('quit'); },
+  };
+  const overlay = await awaitBind(warmSlotFromEnv(WARM)!, client);
+  check('blocks on the slot key until claimed', calls.filter((c) => c === `blPop ${WARM.VEXA_WARM_BIND_KEY} 0`).length === 2, calls.join(', '));
+  check('quits the bind client', calls[calls.length - 1] === 'quit');
+  const inv = loadInvocation({ ...WARM, ...overlay });
+  check('the overlay parses as invocation.v1', typeof inv.botName === 'string' && typeof inv.platform === 'string');
+}
+
+// ── off-contract payloads ──
+for (const [name, raw] of [
+  ['non-JSON', 'nope'],
+  ['no env', '{"workloadId": "x"}'],
+  ['non-string env', '{"env": {"VEXA_BOT_CONFIG": 1}}'],
+] as const) {
+  let err: unknown = null;
+  try { parseBind(raw); } catch (e) { err = e; }
+  check(`${name} bind → InvocationError`, err instanceof InvocationError, String(err));
+}
+
+if (failed) { console.error(`\n❌ warm (L2): ${failed} check(s) FAILED.`); process.exit(1); }
+console.log('\n✅ warm (L2): a pre-started bot waits on its bind key and boots from the claimed spec exactly like a cold spawn.');
@@ -0,0 +1,82 @@
+/**
+ * Warm-pool boot (the runtime kernel's `RUNTIME_WARM_POOL`) — a bot started BEFORE its meeting exists.
+ *
+ * A pre-warmed workload boots with no `VEXA_BOT_CONFIG`. Instead it carries `VEXA_WARM_POOL=1`, its
+ * pool slot's `VEXA_WARM_VARIANT` (the platform it was warmed for), and a private
+ * `VEXA_WARM_BIND_KEY` on `VEXA_WARM_REDIS_URL`. The composition root launches the browser and
+ * injects the capture bundle for that platform up front, then BLPOPs the bind key. When a request
+ * claims the workload, the kernel RPUSHes `{workloadId, env}` there — the claimed spec's env, i.e.
+ * the same `VEXA_BOT_CONFIG` a cold spawn would have booted with — and the bot continues exactly as
+ * a cold one would, minus the launch it already paid for.
+ *
+ * An off-contract bind payload is an InvocationError like a bad VEXA_BOT_CONFIG (fail fast, P14).
+ * The payload carries secrets — never logged (P14/P15).
+ */
+import { createClient } from 'redis';
+import { InvocationError, type Platform } from './config.js';
+
+/** The warm-pool identity a pre-started workload boots with. */
+export interface WarmSlot {
+  bindKey: string;
+  redisUrl: string;
+  platform: Platform;
+}
+
+/** The minimal blocking-pop surface the bind wait needs — injected so it is offline-provable.
+ *  node-redis v4 `blPop(key, 0)` resolves `{ key, element }` (0 = block until a push). */
+export interface BindClient {
+  connect(): Promise<unknown>;
+  blPop(key: string, timeoutSec: number): Promise<{ key: string; element: string } | null>;
+  quit(): Promise<unknown>;
+}
+
+const PLATFORMS: readonly Platform[] = ['google_meet', 'zoom', 'teams', 'jitsi'];
+
+/** The warm slot, or null for a normal (cold) boot. A spawn that already carries VEXA_BOT_CONFIG is
+ *  cold regardless of the warm vars — the config in hand always wins. */
+export function warmSlotFromEnv(env: NodeJS.ProcessEnv = process.env): WarmSlot | null {
+  if (env.VEXA_WARM_POOL !== '1' || (env.VEXA_BOT_CONFIG ?? '').trim()) return null;
+  const bindKey = env.VEXA_WARM_BIND_KEY;
+  const redisUrl = env.VEXA_WARM_REDIS_URL;
+  const platform = env.VEXA_WARM_VARIANT as Platform;
+  if (!bindKey || !redisUrl || !PLATFORMS.includes(platform)) return null;
+  return { bindKey, redisUrl, platform };
+}
+
+/** Parse a bind payload into the env overlay the claimed spec carries. */
+export function parseBind(raw: string): Record<string, string> {
+  let data: unknown;
+  try {
+    data = JSON.parse(raw);
+  } catch (e) {
+    throw new InvocationError(`warm bind: payload is not valid JSON — ${(e as Error).message}`);
+  }
+  const env = (data as { env?: unknown } | null)?.env;
+  if (!env || typeof env !== 'object' || Array.isArray(env)
+      || !Object.values(env).every((v) => typeof v === 'string')) {
+    throw new InvocationError('warm bind: payload has no {env: {string: string}}');
+  }
+  return env as Record<string, string>;
+}
+
+/** Block until the workload is claimed; resolve the claimed spec's env overlay. */
+export async function awaitBind(slot: WarmSlot, client: BindClient): Promise<Record<string, string>> {
+  await client.connect();
+  try {
+    for (;;) {
+      const popped = await client.blPop(slot.bindKey, 0);
+      if (popped) return parseBind(popped.element);
+    }
+  } finally {
+    await client.quit().catch(() => { /* best-effort */ });
+  }
+}
+
+/** The live bind client for a slot's redis. */
+export function bindClientFrom(redisUrl: string): BindClient {
+  const client = createClient({ url: redisUrl });
+  client.on('error', (err: unknown) => {
+    console.error(`[bot] redis (warm bind) error: ${(err as Error)?.message ?? String(err)}`);
+  });
+  return client as unknown as BindClient;
+}
@@ -26,7 +26,7 @@ import { WebSocketServer, WebSocket } from 'ws';
 import { TranscriptionClient } from '@vexa/transcribe-whisper';
 import { createGmeetPipeline, type TranscriptSegment } from '@vexa/gmeet-pipeline';
 import { ChunkedTranscriber, type ChunkSegment, type HintKind } from '@vexa/mixed-pipeline';
-import { decodeAudioFrame, decodeRecordingChunk } from '@vexa/capture-codec';
+import { decodeAudioFrame, decodeRecordingChunk, encodeCaptureV2Header, encodeCaptureV2Binary, encodeCaptureV2Text } from '@vexa/capture-codec';
 import { createRecordingSink, type RecordingMaster } from './recording-sink.js';
 import { ownerOnly, type CanAccess } from './access.js';
 
@@ -345,18 +345,23 @@ export async function startDesktop(opts: DesktopOptions = {}): Promise<Desktop>
     // (ch999 mix / ch1000 mic / per-channel gmeet) + text event hints (active-speaker)
     // — to a JSONL tape, so any live bug can be replayed deterministically with no
     // meeting (eval.sh replay <tape>). A SECOND 'message' listener that never touches
-    // the pipeline path. Off unless VEXA_RECORD_TAPE is set.
+    // the pipeline path. Off unless VEXA_RECORD_TAPE is set. VEXA_TAPE_FORMAT=v2 writes the
+    // binary capture.v2 container (.cap2) instead of base64 JSONL — the same frames, verbatim,
+    // that replay walks in place rather than parsing line by line.
     let tape: ReturnType<typeof createWriteStream> | null = null;
     if (process.env.VEXA_RECORD_TAPE) {
       const stamp = new Date().toISOString().replace(/[:.]/g, '-');
-      const tapePath = `${process.env.VEXA_RECORD_TAPE}/tape-${platform}-${native}-${stamp}.jsonl`;
+      const v2 = process.env.VEXA_TAPE_FORMAT === 'v2';
+      const tapePath = `${process.env.VEXA_RECORD_TAPE}/tape-${platform}-${native}-${stamp}.${v2 ? 'cap2' : 'jsonl'}`;
+      const head = { platform, native, language: lang ?? null, startedAt: new Date().toISOString() };
       tape = createWriteStream(tapePath);
-      tape.write(JSON.stringify({ v: 1, platform, native, language: lang ?? null, startedAt: new Date().toISOString() }) + '\n');
+      tape.write(v2 ? Buffer.from(encodeCaptureV2Header(head)) : JSON.stringify({ v: 1, ...head }) + '\n');
       const tape0 = Date.now();
       ws.on('message', (data: any, isBinary: boolean) => {
         if (!tape) return;
         const t = Date.now() - tape0;
-        if (isBinary) { const b = Buffer.from(data); tape.write(JSON.stringify({ t, bin: true, d: b.toString('base64') }) + '\n'); }
+        if (v2) tape.write(Buffer.from(isBinary ? encodeCaptureV2Binary(t, Buffer.from(data)) : encodeCaptureV2Text(t, data.toString())));
+        else if (isBinary) { const b = Buffer.from(data); tape.write(JSON.stringify({ t, bin: true, d: b.toString('base64') }) + '\n'); }
         else tape.write(JSON.stringify({ t, bin: false, d: data.toString() }) + '\n');
       });
       log(`[desktop] ⏺ recording raw tape → ${tapePath}`);
@@ -109,6 +109,7 @@ def build_production_app():
         endpoint_url=os.getenv("S3_ENDPOINT") or _minio_endpoint_url(),
         access_key=os.getenv("S3_ACCESS_KEY") or os.getenv("MINIO_ACCESS_KEY"),
         secret_key=os.getenv("S3_SECRET_KEY") or os.getenv("MINIO_SECRET_KEY"),
+        public_endpoint_url=os.getenv("S3_PUBLIC_ENDPOINT"),
     )
 
     # Per-user webhook delivery (WebhookSink: SSRF-guard → event-filter → sign → POST → enqueue-retry).
@@ -116,14 +117,21 @@ def build_production_app():
     # WH2: the transport is IP-PINNED — it re-resolves + re-validates the host at connect time and
     # dials the validated IP (preserving Host + TLS SNI), closing the DNS-rebinding TOCTOU window
     # between submit-time validate_webhook_url and the actual socket connect.
-    from .webhooks import RetryQueue, WebhookSink
+    # WEBHOOK_DELIVERY_POOLED: a DeliveryEngine instead — per-endpoint keep-alive pools (still
+    # pinned), bounded per-endpoint + global concurrency, shared with the retry drain below.
+    from .webhooks import RetryQueue, WebhookSink, delivery_engine_from_env
     from .webhooks.ssrf import build_pinned_transport
 
+    webhook_engine = delivery_engine_from_env()
+
     async def _webhook_transport(url: str, body: bytes, headers: dict):
         async with httpx.AsyncClient(timeout=10.0, transport=build_pinned_transport()) as client:
             return await client.post(url, content=body, headers=headers)
 
-    webhook_sink = WebhookSink(_webhook_transport, queue=RetryQueue(redis_client))
+    webhook_sink = WebhookSink(
+        webhook_engine.transport if webhook_engine is not None else _webhook_transport,
+        queue=RetryQueue(redis_client),
+    )
 
     # #841: the per-user delivery ledger — the queryable record GET /webhooks/deliveries serves.
     # A per-user capped Redis list; the lifecycle callback records each delivery outcome so the
@@ -194,6 +202,8 @@ def build_production_app():
         calendar_sync_status=_calendar_sync_status,
     )
 
+    app.state.webhook_engine = webhook_engine  # /health pipeline.webhooks; closed by the lifespan
+
     _attach_background_loops(
         app, transcript_store, segment_bus, redis_client, meeting_repo, runtime_client,
         session_factory=session_factory,
@@ -223,7 +233,9 @@ def _attach_background_loops(
     is DELIBERATELY left unguarded — it is a Redis competing consumer (``XREADGROUP … ">"``) whose
     single-delivery is already exact, and guarding it would needlessly serialize the replicas' reads.
     """
-    from .collector.ingest import RECLAIM_MIN_IDLE_MS, consume_segments, reclaim_segments
+    from .collector.ingest import (
+        INGEST_BATCH_COUNT, INGEST_BATCHED, RECLAIM_MIN_IDLE_MS, consume_segments, ingest_stats, reclaim_segments,
+    )
     from .sweeps.single_flight import PgAdvisoryLock, run_single_flight, sweep_lock_key
 
     # One shared advisory-lock backend across the guarded loops (each keyed by its own loop name).
@@ -241,6 +253,8 @@ def _attach_background_loops(
     # (RECLAIM_MIN_IDLE_MS) ensures a live peer's in-flight batch is never stolen.
     seg_reclaim_every = max(1, int(os.getenv("SEGMENT_RECLAIM_EVERY_N_TICKS", "120")))
     webhook_interval = float(os.getenv("WEBHOOK_DRAIN_INTERVAL", "5"))
+    webhook_engine = getattr(app.state, "webhook_engine", None)
+    webhook_endpoint_budget = int(os.getenv("WEBHOOK_DRAIN_ENDPOINT_BUDGET", "16"))
     # The db-writer cadence — the parent's BACKGROUND_TASK_INTERVAL (10s); either env name works.
     db_writer_interval = float(
         os.getenv("DB_WRITER_INTERVAL_S", os.getenv("BACKGROUND_TASK_INTERVAL", "10"))
@@ -280,6 +294,28 @@ def _attach_background_loops(
     # presumed lost (runtime restart on the process backend / external removal) and advanced to
     # `failed` with the evidence note, instead of retrying an error + dead DELETE every sweep forever.
     untracked_grace = float(os.getenv("MEETING_UNTRACKED_GRACE_SEC", "600"))
+    # Reconcile deadline index (lifecycle/deadlines.py): a redis sorted set of each non-terminal
+    # meeting's next-check time, armed on every persisted status change and woken by the runtime's
+    # workload-exit callback. The loop then reads only what is due every RECONCILE_DUE_INTERVAL_S —
+    # no DB query when nothing is — instead of listing + probing every non-terminal meeting each
+    # STOP_RECONCILE_INTERVAL_S. A meeting whose workload is alive is re-probed every
+    # RECONCILE_ALIVE_RECHECK_S (its exit event wakes it sooner). The full sweep stays as the backstop,
+    # on startup + every RECONCILE_FULL_SWEEP_INTERVAL_S, and re-derives the index from the rows.
+    # RECONCILE_DEADLINE_INDEX=0 restores the full sweep on every tick.
+    use_deadline_index = (
+        os.getenv("RECONCILE_DEADLINE_INDEX", "1").lower() not in ("0", "false", "no")
+        and redis_client is not None
+    )
+    reconcile_due_interval = float(os.getenv("RECONCILE_DUE_INTERVAL_S", "5"))
+    reconcile_full_interval = float(os.getenv("RECONCILE_FULL_SWEEP_INTERVAL_S", "300"))
+    reconcile_alive_recheck = float(os.getenv("RECONCILE_ALIVE_RECHECK_S", "300"))
+    if use_deadline_index:
+        from .lifecycle.deadlines import ReconcileDeadlines
+
+        app.state.reconcile_deadlines = ReconcileDeadlines(
+            redis_client, stop_grace=stop_grace, active_grace=active_grace,
+            preactive_grace=preactive_grace,
+        )
 
     # #527: per-loop liveness heartbeats. A loop hung inside an await stops stamping, so /health can
     # SEE a dead consumer that would otherwise look alive (live WS keeps flowing on a SEPARATE path —
@@ -300,15 +336,24 @@ def _attach_background_loops(
     app.state.pipeline_lag_alarm = int(os.getenv("PIPELINE_LAG_ALARM", "500"))
     # #636: group PEL depth (delivered-but-un-acked) alarm. Steady state acks within a tick, so a
     # SUSTAINED total above this threshold is an orphaned batch (a crashed replica's un-reclaimed
-    # PEL) → /health degrades + 503. Default headroom over one in-flight batch (count=10 default).
-    app.state.pipeline_pending_alarm = int(os.getenv("PIPELINE_PENDING_ALARM", "100"))
+    # PEL) → /health degrades + 503. Default headroom over one in-flight batch (count=10 default;
+    # the batched ingest's larger reads raise the default to twice COLLECTOR_INGEST_BATCH_COUNT).
+    from .collector.ingest import INGEST_BATCH_COUNT as _SEG_BATCH, INGEST_BATCHED as _SEG_BATCHED
+
+    _pending_default = max(100, 2 * _SEG_BATCH) if _SEG_BATCHED else 100
+    app.state.pipeline_pending_alarm = int(os.getenv("PIPELINE_PENDING_ALARM", str(_pending_default)))
 
     async def _segment_consumer_loop() -> None:
         # Drain the transcription_segments stream → persist + publish tc:…:mutable.
         tick_n = 0
         while True:
+            behind = False
             try:
+                read_before = ingest_stats.messages
                 await consume_segments(transcript_store, segment_bus)
+                # Batched ingest: a FULL read means the stream is backing up — re-read at once
+                # instead of paying the poll sleep between batches.
+                behind = INGEST_BATCHED and ingest_stats.messages - read_before >= INGEST_BATCH_COUNT
                 # #636: every N ticks, reclaim any ORPHANED (crashed-replica) un-acked batch idle
                 # past RECLAIM_MIN_IDLE_MS and drain it through the same ingest→ack path. Bounded to
                 # one XAUTOCLAIM per pass (its cursor continues next time) — never a hang surface.
@@ -322,7 +367,7 @@ def _attach_background_loops(
             except Exception:
                 log.exception("segment consumer tick failed")
             ticks["segment-consumer"] = _time.monotonic()  # #527: alive this iteration
-            await asyncio.sleep(seg_interval)
+            await asyncio.sleep(0 if behind else seg_interval)
 
     async def _db_writer_loop() -> None:
         # The RESTORED parent db-writer (0.10 process_redis_to_postgres): each tick, flush every
@@ -373,6 +418,19 @@ def _attach_background_loops(
                 return await client.post(url, content=body, headers=headers)
 
         async def _tick():
+            if webhook_engine is not None:
+                # Pooled: the due entries resolve concurrently through the shared engine, so a slow
+                # receiver only queues on its own endpoint bound; each endpoint gets at most
+                # WEBHOOK_DRAIN_ENDPOINT_BUDGET deliveries per sweep (the rest wait a tick). A sweep
+                # claims no more than the engine can start at once (its process and per-endpoint
+                # bounds), so no claimed entry queues for a slot until its lease runs out.
+                await drain_retry_queue(
+                    redis_client, webhook_engine.retry_transport,
+                    parallel=True,
+                    endpoint_budget=min(webhook_endpoint_budget, webhook_engine.max_per_endpoint),
+                    max_inflight=webhook_engine.max_concurrency,
+                )
+                return
             await drain_retry_queue(redis_client, _transport)
 
         while True:
@@ -392,6 +450,7 @@ def _attach_background_loops(
             return
         from .lifecycle.machine import TransitionSource as _TS
         from .lifecycle.reconcile import (
+            reconcile_due_nonterminal_sweep,
             reconcile_stale_nonterminal_sweep,
             reconcile_stale_stopping_sweep,
         )
@@ -416,9 +475,23 @@ def _attach_background_loops(
         # The general sweep (any stale non-terminal status whose bot is gone) subsumes the stale-
         # stopping sweep, but we keep the latter as the guaranteed orphan-kill backstop for `stopping`.
         has_general = hasattr(meeting_repo, "list_stale_nonterminal")
-
-        async def _tick():
-            if has_general:
+        deadlines = getattr(app.state, "reconcile_deadlines", None)
+        indexed = deadlines is not None and hasattr(meeting_repo, "list_reconcile_candidates")
+
+        async def _tick(full: bool):
+            if indexed:
+                # Due pass every tick; on a full tick it lists every non-terminal row instead and
+                # re-derives the index. Re-arm retries one tick out — the cadence of this loop.
+                await reconcile_due_nonterminal_sweep(
+                    meeting_repo, runtime, _post_lifecycle, deadlines,
+                    stop_grace=stop_grace, active_grace=active_grace, log=log,
+                    preactive_grace=preactive_grace, untracked_grace=untracked_grace,
+                    full=full, retry_after=reconcile_due_interval,
+                    alive_recheck=reconcile_alive_recheck,
+                )
+                if not full:
+                    return
+            elif has_general:
                 await reconcile_stale_nonterminal_sweep(
                     meeting_repo, runtime, _post_lifecycle,
                     stop_grace=stop_grace, active_grace=active_grace, log=log,
@@ -428,14 +501,20 @@ def _attach_background_loops(
                 meeting_repo, runtime, _post_lifecycle, stop_grace=stop_grace, log=log,
             )
 
+        last_full = [0.0]  # 0 ⇒ the first tick is a full pass (seeds the index on boot)
         while True:
+            now = _time.monotonic()
+            do_full = not indexed or (now - last_full[0]) >= reconcile_full_interval
             try:
-                await _guarded("stop-reconcile", _tick)  # #637: one reconcile pass per interval
+                # #637: one reconcile pass per interval across replicas
+                await _guarded("stop-reconcile", lambda: _tick(do_full))
             except asyncio.CancelledError:
                 raise
             except Exception:
                 log.exception("stop-reconcile tick failed")
-            await asyncio.sleep(stop_interval)
+            if do_full:
+                last_full[0] = now  # bound the full-pass cadence per replica, run or guarded-skip
+            await asyncio.sleep(reconcile_due_interval if indexed else stop_interval)
 
     # Auto-join: "scheduled" means the bot joins. The sweep spawns a bot for every scheduled row
     # whose data.scheduled_at arrived (lead window) and whose auto_join toggle is on, through the
@@ -512,6 +591,42 @@ def _attach_background_loops(
                 log.exception("auto-join tick failed")
             await asyncio.sleep(auto_join_interval)
 
+    # Warm pool: size the runtime kernel's pre-started bot pool from the scheduled-meeting
+    # lookahead — a per-platform base floor plus one bot per auto-join meeting starting soon. The
+    # claim itself is request-time (bot_spawn.service); this loop only PUTs the targets. Off unless
+    # BOT_WARM_POOL=1 and the runtime client can set targets; a runtime without the pool answers 503
+    # and the PUT is a no-op.
+    async def _warm_pool_loop() -> None:
+        if not env_flag("BOT_WARM_POOL", default=False):
+            return
+        if meeting_repo is None or not hasattr(runtime, "set_warm_pool_targets") \
+                or not hasattr(meeting_repo, "list_scheduled_meetings"):
+            return
+        import json as _json
+        from datetime import datetime, timezone
+
+        from .scheduling import upcoming_by_platform, warm_targets
+
+        interval = float(os.getenv("BOT_WARM_POOL_INTERVAL_S", "60"))
+        horizon = float(os.getenv("BOT_WARM_POOL_LOOKAHEAD_S", "900"))
+        cap = int(os.getenv("BOT_WARM_POOL_MAX_PER_PLATFORM", "4"))
+        base = _json.loads(os.getenv("BOT_WARM_POOL_BASE") or "{}")
+
+        async def _tick():
+            rows = await meeting_repo.list_scheduled_meetings()
+            upcoming = upcoming_by_platform(rows, now=datetime.now(timezone.utc),
+                                            horizon_s=horizon, grace_s=auto_join_grace)
+            await runtime.set_warm_pool_targets(warm_targets(upcoming, base=base, max_per_platform=cap))
+
+        while True:
+            try:
+                await _guarded("warm-pool", _tick)  # #637: one targets PUT per interval
+            except asyncio.CancelledError:
+                raise
+            except Exception:
+                log.exception("warm-pool tick failed")
+            await asyncio.sleep(interval)
+
     # Calendar sync: each sweep discovers every user with a connected ICS feed (admin-api internal
     # edge), fetches it over the SSRF-pinned transport, and upserts planned meetings (one row per
     # calendar UID — next occurrence only). Per-user try/except: one bad feed never stalls the
@@ -564,6 +679,7 @@ def _attach_background_loops(
             asyncio.create_task(_stop_reconcile_loop(), name="stop-reconcile"),
             asyncio.create_task(_auto_join_loop(), name="auto-join"),
             asyncio.create_task(_calendar_sync_loop(), name="calendar-sync"),
+            asyncio.create_task(_warm_pool_loop(), name="warm-pool"),
         ]
         log.info("meeting-api background loops started: %s", [t.get_name() for t in tasks])
         try:
@@ -572,6 +688,8 @@ def _attach_background_loops(
             for t in tasks:
                 t.cancel()
             await asyncio.gather(*tasks, return_exceptions=True)
+            if webhook_engine is not None:
+                await webhook_engine.aclose()
 
     # FastAPI supports assigning .router.lifespan_context post-construction.
     app.router.lifespan_context = lifespan
@@ -72,7 +72,7 @@ async def _pipeline_health(app) -> "tuple[dict, bool]":
     stamping, so its tick_age_s climbs past PIPELINE_TICK_STALE_S even while the process and the
     live-WS path look healthy — the 2026-04-26 silent hang. A crashed replica's delivered-but-un-acked
     batch is NOT lag (it was delivered) and NOT a stale heartbeat on the survivor, so #636 surfaces it
-    as ``pending_depth``. Returns ``({loops, redis_reachable, consumer_lag, pending_depth}, degraded)``.
+    as ``pending_depth``. Returns ``({loops, redis_reachable, consumer_lag, pending_depth, ingest, db_writer}, degraded)``.
 
     #809 — Redis is a CACHE/QUEUE dependency, not the process's spine: an unreachable Redis is
     reported HONESTLY as ``redis_reachable: false`` but NEVER flips ``degraded`` (so it cannot 503 the
@@ -141,12 +141,22 @@ async def _pipeline_health(app) -> "tuple[dict, bool]":
         degraded = True
     if isinstance(pending_depth, int) and pending_depth > pending_alarm:
         degraded = True
-    return {
+    from .collector.db_writer import flush_stats
+    from .collector.ingest import ingest_stats
+
+    pipeline = {
         "loops": loops,
         "redis_reachable": redis_reachable,
         "consumer_lag": lag,
         "pending_depth": pending_depth,
-    }, degraded
+        "ingest": ingest_stats.snapshot(),  # batch-size histogram + read lag of the latest batch
+        "db_writer": flush_stats.snapshot(),  # tick duration + sink / updated_at→durable latency
+    }
+    webhook_engine = getattr(st, "webhook_engine", None)
+    if webhook_engine is not None:
+        # WEBHOOK_DELIVERY_POOLED: per-endpoint depth / p99 latency / time-to-first-attempt (host-only).
+        pipeline["webhooks"] = webhook_engine.stats()
+    return pipeline, degraded
 
 
 def create_app(
@@ -223,6 +233,10 @@ def create_app(
     sink = LifecycleSink(store=meeting_store if meeting_store is not None else MeetingStore())
     app.state.lifecycle_sink = sink
     app.state.lifecycle_store = sink.store
+    # The reconcile deadline index (lifecycle/deadlines.py) — attached by the composition root next to
+    # the reconcile loop it feeds (it shares that loop's graces). None → no index: the status writes
+    # below skip arming it and the loop falls back to the full sweep every tick.
+    app.state.reconcile_deadlines = None
     app.state.webhook_sink = webhook_sink
     # #841: the per-user delivery ledger the read endpoint serves. Default to the in-memory fake so
     # the app-factory / conformance path stands up without redis (same pattern as the other ports).
@@ -464,6 +478,15 @@ def _mount_lifecycle(
             except Exception as e:  # noqa: BLE001 — persistence is best-effort
                 log_event("lifecycle_persist_failed", audience="system", level="warning",
                           span="lifecycle.callback", fields={"error": str(e)})
+        # Re-arm the meeting's reconcile deadline off the status just persisted (a terminal drops it).
+        # Best-effort: a missed arm only waits for the reconcile loop's periodic full pass.
+        deadlines = getattr(app.state, "reconcile_deadlines", None)
+        if deadlines is not None and isinstance(meeting_row, dict) and meeting_row.get("id") is not None:
+            try:
+                await deadlines.note(meeting_row["id"], rec.status.value)
+            except Exception as e:  # noqa: BLE001 — the full reconcile pass re-derives the index
+                log_event("reconcile_deadline_arm_failed", audience="system", level="warning",
+                          span="lifecycle.callback", fields={"error": str(e)})
         # COMPLETION FINALIZATION — the moment the FSM lands on a terminal status, flush the
         # meeting's remaining live redis segments to the durable store (threshold 0: the mutable
         # tail included, no more updates are coming) and persist the processed doc into
@@ -729,7 +752,12 @@ def _mount_lifecycle(
             import logging as _logging
 
             from .lifecycle.machine import TransitionSource as _TS
-            from .lifecycle.reconcile import synthesize_terminal_for_dead_workload
+            from .lifecycle.reconcile import (
+                synthesize_terminal_for_dead_workload,
+                wake_for_exited_workload,
+            )
+
+            driven: list[int] = []
 
             async def _drive_terminal(event: dict):
                 # In-process — no network hop. The runtime-destroy source forces the terminal edge past
@@ -739,12 +767,21 @@ def _mount_lifecycle(
                     transition_source=_TS.RUNTIME_DESTROY,
                     force_terminal_on_destroy=True,
                 )
+                driven.append(status_code)
                 return status_code
 
-            await synthesize_terminal_for_dead_workload(
-                meeting_repo, workload_id, state, _drive_terminal,
-                log=_logging.getLogger("meeting_api.runtime.callback"),
+            cb_log = _logging.getLogger("meeting_api.runtime.callback")
+            landed = await synthesize_terminal_for_dead_workload(
+                meeting_repo, workload_id, state, _drive_terminal, log=cb_log,
             )
+            # The exit EVENT is the fast path of dead-bot detection: when it could not converge the
+            # meeting here, make the meeting due on the reconcile deadline index so the next due pass
+            # (seconds away) examines it, instead of waiting out its grace window.
+            if not (landed and driven and driven[-1] == 200):
+                await wake_for_exited_workload(
+                    meeting_repo, getattr(app.state, "reconcile_deadlines", None),
+                    workload_id, state, log=cb_log,
+                )
         except Exception as e:  # noqa: BLE001 — the runtime ACK must never fail on the terminal backstop
             log_event("runtime_callback_terminal_error", audience="system", level="warning",
                       span="runtime.callback", fields={"error": str(e)})
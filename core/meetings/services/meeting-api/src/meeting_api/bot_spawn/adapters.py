@@ -336,8 +336,25 @@ class SqlAlchemyMeetingRepo:
         everything else ``active_grace`` (a longer idle so a momentarily-quiet live bot is not
         reaped). Returns ``[(meeting_id, status, session_uid, bot_container_id, stop_requested), …]`` with
         the LATEST session_uid per meeting (mirrors ``list_stale_stopping``)."""
-        from datetime import datetime, timezone
-
+        now = datetime.now(timezone.utc).timestamp()
+        rows = await self.list_reconcile_candidates(
+            stop_grace=stop_grace, active_grace=active_grace, preactive_grace=preactive_grace
+        )
+        return [row[:5] for row in rows if row[5] <= now]
+
+    async def list_reconcile_candidates(
+        self,
+        *,
+        stop_grace: float,
+        active_grace: float,
+        preactive_grace: Optional[float] = None,
+        meeting_ids: Optional[list[int]] = None,
+    ) -> list[tuple[int, str, str, Optional[str], bool, float]]:
+        """Every non-terminal meeting — or only ``meeting_ids``, the deadline index's due batch — with
+        its reconcile DEADLINE: ``updated_at`` plus the row's per-status grace, as epoch seconds.
+        ``list_stale_nonterminal`` is the ``deadline <= now`` subset; the indexed sweep additionally
+        re-arms the not-yet-due rows at exactly this deadline. Returns ``[(meeting_id, status,
+        session_uid, bot_container_id, stop_requested, deadline), …]`` with the LATEST session_uid."""
         from sqlalchemy import select
 
         from ..sessions.models import Meeting, MeetingSession
@@ -345,27 +362,28 @@ class SqlAlchemyMeetingRepo:
         non_terminal = [
             "requested", "joining", "awaiting_admission", "needs_help", "active", "stopping",
         ]
+        stmt = (
+            select(Meeting.id, Meeting.status, Meeting.updated_at,
+                   MeetingSession.session_uid, Meeting.bot_container_id, Meeting.data)
+            .join(MeetingSession, MeetingSession.meeting_id == Meeting.id)
+            .where(Meeting.status.in_(non_terminal))
+            .order_by(MeetingSession.id.desc())
+        )
+        if meeting_ids is not None:
+            if not meeting_ids:
+                return []
+            stmt = stmt.where(Meeting.id.in_(list(meeting_ids)))
         async with self._session_factory() as db:
-            rows = (
-                await db.execute(
-                    select(Meeting.id, Meeting.status, Meeting.updated_at,
-                           MeetingSession.session_uid, Meeting.bot_container_id, Meeting.data)
-                    .join(MeetingSession, MeetingSession.meeting_id == Meeting.id)
-                    .where(Meeting.status.in_(non_terminal))
-                    .order_by(MeetingSession.id.desc())
-                )
-            ).all()
-        now = datetime.now(timezone.utc)
-        out: dict[int, tuple[str, str, Optional[str], bool]] = {}
+            rows = (await db.execute(stmt)).all()
+        out: dict[int, tuple[str, str, Optional[str], bool, float]] = {}
         for mid, status, upd, sid, bcid, data in rows:
             if mid in out or upd is None or not sid:
                 continue
             u = upd if upd.tzinfo else upd.replace(tzinfo=timezone.utc)
             grace = reconcile_grace_for_status(status, stop_grace, active_grace, preactive_grace)
-            if (now - u).total_seconds() >= grace:
-                stop_req = bool(isinstance(data, dict) and data.get("stop_requested"))
-                out[mid] = (status, sid, bcid, stop_req)
-        return [(mid, st, sid, bcid, sr) for mid, (st, sid, bcid, sr) in out.items()]
+            stop_req = bool(isinstance(data, dict) and data.get("stop_requested"))
+            out[mid] = (status, sid, bcid, stop_req, u.timestamp() + grace)
+        return [(mid, *rest) for mid, rest in out.items()]
 
     async def create_meeting(self, *, user_id, platform, native_meeting_id, data) -> dict:
         from ..sessions.models import Meeting
@@ -626,6 +644,34 @@ class HttpRuntimeClient:
             )
         return body
 
+    async def claim_warm_workload(self, spec: dict, *, variant: str) -> Optional[dict]:
+        """Bind ``spec`` onto an idle pre-started workload (``POST /warm-pool/claim``). 201 → the
+        claimed status; anything else — 404 (slot empty), 503 (no pool wired), a transport fault,
+        a dead body — is ``None``: the caller spawns cold with the same spec. 429 still raises, so
+        a warm claim never slips past the owner quota a cold spawn would hit."""
+        try:
+            resp = await self._client.post(
+                f"{self._url}/warm-pool/claim", json={"variant": variant, "spec": spec}, timeout=10.0,
+            )
+        except Exception:  # noqa: BLE001 — the warm path only ever removes latency
+            return None
+        if resp.status_code == 429:
+            raise QuotaExceeded("runtime kernel: owner quota exceeded")
+        if resp.status_code != 201:
+            return None
+        body = resp.json()
+        return None if body.get("state") in ("stopped", "destroyed") else body
+
+    async def set_warm_pool_targets(self, targets: dict) -> Optional[dict]:
+        """Resize the kernel's warm pool (``PUT /warm-pool/targets``); the pool stats, or ``None``
+        when the kernel has no pool wired."""
+        resp = await self._client.put(f"{self._url}/warm-pool/targets", json={"targets": targets}, timeout=10.0)
+        if resp.status_code == 503:
+            return None
+        if resp.status_code != 200:
+            raise SpawnFailed(f"runtime kernel set_warm_pool_targets returned {resp.status_code}")
+        return resp.json()
+
     async def delete_workload(self, workload_id: str) -> None:
         """Tear down a workload (``DELETE /workloads/{id}``) — teardown must be CONFIRMED.
 
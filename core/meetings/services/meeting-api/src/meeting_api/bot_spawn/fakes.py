@@ -272,15 +272,33 @@ class InMemoryMeetingRepo:
         stale; a row whose ``updated_at`` is recent is NOT listed."""
         from datetime import datetime, timezone
 
+        now = datetime.now(timezone.utc).timestamp()
+        rows = await self.list_reconcile_candidates(
+            stop_grace=stop_grace, active_grace=active_grace, preactive_grace=preactive_grace
+        )
+        return [row[:5] for row in rows if row[5] <= now]
+
+    async def list_reconcile_candidates(
+        self,
+        *,
+        stop_grace: float,
+        active_grace: float,
+        preactive_grace: Optional[float] = None,
+        meeting_ids=None,
+    ) -> list:
+        """In-memory mirror of the SQL adapter's candidate listing: every non-terminal row (or only
+        ``meeting_ids``) with its reconcile deadline ``updated_at + grace`` as epoch seconds."""
+        from datetime import datetime, timezone
+
         non_terminal = {
             "requested", "joining", "awaiting_admission", "needs_help", "active", "stopping",
         }
-        now = datetime.now(timezone.utc)
+        wanted = None if meeting_ids is None else set(meeting_ids)
         out: dict = {}
         # latest session per meeting (mirror the SQL adapter's MeetingSession.id desc)
         for s in reversed(self.sessions):
             mid = s["meeting_id"]
-            if mid in out:
+            if mid in out or (wanted is not None and mid not in wanted):
                 continue
             row = self._meetings.get(mid)
             if row is None or row["status"] not in non_terminal:
@@ -297,11 +315,10 @@ class InMemoryMeetingRepo:
             grace = reconcile_grace_for_status(
                 row["status"], stop_grace, active_grace, preactive_grace
             )
-            if (now - u).total_seconds() < grace:
-                continue
             stop_req = bool(row.get("data", {}).get("stop_requested"))
-            out[mid] = (row["status"], s["session_uid"], row.get("bot_container_id"), stop_req)
-        return [(mid, st, sid, bcid, sr) for mid, (st, sid, bcid, sr) in out.items()]
+            out[mid] = (row["status"], s["session_uid"], row.get("bot_container_id"), stop_req,
+                        u.timestamp() + grace)
+        return [(mid, *rest) for mid, rest in out.items()]
 
     # ── test affordances (not part of the port) ──────────────────────────────────────────────────
     def set_status(self, meeting_id: int, status: str) -> None:
@@ -314,7 +331,8 @@ class FakeRuntimeClient:
 
     def __init__(self, *, quota_exceeded: bool = False, fail: bool = False,
                  dead_on_arrival: bool = False,
-                 workloads: Optional[dict[str, dict]] = None):
+                 workloads: Optional[dict[str, dict]] = None,
+                 warm: Optional[dict[str, int]] = None):
         self._quota_exceeded = quota_exceeded
         self._fail = fail
         # dead_on_arrival models a kernel that (against #718 C1) still answers 201 but with a workload
@@ -328,6 +346,9 @@ class FakeRuntimeClient:
         # ABSENT from this map is treated as GONE (404 → None) by ``get_workload``. ``None`` defaults to
         # "every workload is alive and running" (back-compat for tests that don't care about liveness).
         self._workloads: Optional[dict[str, dict]] = workloads
+        self.warm: dict[str, int] = dict(warm or {})
+        self.claims: list[tuple[str, str]] = []       # (workload_id, variant) per warm claim attempt
+        self.warm_targets: list[dict] = []            # every PUT /warm-pool/targets body
 
     async def create_workload(self, spec: dict) -> dict[str, Any]:
         self.specs.append(spec)
@@ -339,6 +360,18 @@ class FakeRuntimeClient:
             return {"workloadId": spec["workloadId"], "state": "stopped", "stopReason": "start_failed"}
         return {"workloadId": spec["workloadId"], "state": "starting"}
 
+    async def claim_warm_workload(self, spec: dict, *, variant: str) -> Optional[dict[str, Any]]:
+        # ``warm`` = {variant: idle count}; a claim takes one, like the kernel's pool. No entry → miss.
+        self.claims.append((spec["workloadId"], variant))
+        if self.warm.get(variant, 0) <= 0:
+            return None
+        self.warm[variant] -= 1
+        return {"workloadId": spec["workloadId"], "state": "running"}
+
+    async def set_warm_pool_targets(self, targets: dict) -> Optional[dict]:
+        self.warm_targets.append(targets)
+        return {"targets": targets}
+
     async def delete_workload(self, workload_id: str) -> None:
         # Mirrors the HTTP adapter: an id the kernel doesn't track raises WorkloadUnknown (404) —
         # termination UNCONFIRMED. With the default (no map) every teardown is tracked + confirmed.
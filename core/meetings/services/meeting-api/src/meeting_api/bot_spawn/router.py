@@ -420,6 +420,18 @@ def build_router(repo: MeetingRepo, runtime: RuntimeClient) -> APIRouter:
         except SpawnFailed as e:
             raise HTTPException(status_code=502, detail=str(e) or "Failed to start bot workload")
 
+        # Arm the new meeting's reconcile deadline (`requested` → the pre-active grace), so a bot
+        # that never calls back is examined when it becomes a candidate, not on the next full pass.
+        deadlines = getattr(request.app.state, "reconcile_deadlines", None)
+        if deadlines is not None and meeting.get("id") is not None:
+            try:
+                await deadlines.note(meeting["id"], meeting.get("status") or "requested")
+            except Exception as e:  # noqa: BLE001 — the full reconcile pass re-derives the index
+                from ..obs import log_event
+
+                log_event("reconcile_deadline_arm_failed", audience="system", level="warning",
+                          span="bots.create", fields={"meeting_id": meeting["id"], "error": str(e)})
+
         return JSONResponse(status_code=201, content=meeting)
 
     return router
@@ -405,7 +405,15 @@ async def request_bot(
         callback_url=f"{meeting_api_url}/runtime/callback",
     )
     try:
-        result = await runtime.create_workload(spec)
+        # Warm pool (BOT_WARM_POOL): bind onto a pre-started bot of this platform when the kernel has
+        # one idle — browser already up, capture bundle injected. A miss (or any claim fault) spawns
+        # cold with the SAME spec; authenticated bots restore a per-identity profile and never claim.
+        result = None
+        claim = getattr(runtime, "claim_warm_workload", None)
+        if claim is not None and not authenticated and env_flag("BOT_WARM_POOL", False):
+            result = await claim(spec, variant=platform)
+        if result is None:
+            result = await runtime.create_workload(spec)
         # Defense in depth at the service/port seam (#718 C2): the adapter already refuses a dead
         # spawn (non-201, or a 201 whose body is state=stopped/destroyed), but the service must not
         # trust ANY port's optimism either — a returned non-live state is a spawn failure here too, so
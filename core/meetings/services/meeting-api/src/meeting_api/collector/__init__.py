@@ -30,13 +30,14 @@ the shipped collector; this package imports nothing from conformance.
 from __future__ import annotations
 
 from .app import create_app
-from .ingest import consume_segments, ingest
+from .ingest import consume_segments, ingest, ingest_batch
 from .ports import PubSub, RedisBus, TranscriptStore
 
 __all__ = [
     "create_app",
     "ingest",
     "consume_segments",
+    "ingest_batch",
     "TranscriptStore",
     "RedisBus",
     "PubSub",
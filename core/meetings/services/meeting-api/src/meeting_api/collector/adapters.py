@@ -25,6 +25,7 @@ import secrets
 from datetime import datetime, timezone
 from typing import Optional
 
+from .changes import index_segments
 from .ports import RedisBus, TranscriptStore
 
 log = logging.getLogger("meeting_api.collector.adapters")
@@ -185,6 +186,35 @@ def _upsert_processed_view(
     return out
 
 
+# Rows per multi-row transcriptions upsert: 9 binds a row keeps a statement far under the 32767
+# bind-parameter ceiling of the Postgres wire protocol.
+_UPSERT_CHUNK_ROWS = 500
+
+
+def _transcription_rows(meeting_id, segments) -> "list[dict]":
+    """Flushed segments → ``transcriptions`` upsert rows (a segment without an id or with
+    unusable times is skipped, not guessed)."""
+    rows = []
+    for seg in segments:
+        sid = seg.get("segment_id")
+        if not sid:
+            continue  # 0.12 ingest guarantees segment_id; a legacy stray is skipped, not guessed
+        try:
+            start = float(seg.get("start", seg.get("start_time", 0.0)) or 0.0)
+            end = float(seg.get("end", seg.get("end_time", start)) or start)
+        except (TypeError, ValueError):
+            continue
+        if end < start:
+            start, end = end, start
+        rows.append({
+            "mid": int(meeting_id), "start": start, "end": end,
+            "text": seg.get("text") or "", "speaker": seg.get("speaker"),
+            "lang": seg.get("language"), "uid": seg.get("session_uid"),
+            "segid": str(sid), "created": datetime.utcnow(),
+        })
+    return rows
+
+
 # A relative in-meeting offset never approaches this; anything at/above is an absolute epoch.
 _EPOCH_THRESHOLD_S = 1_000_000_000  # ~2001-09-09
 
@@ -232,6 +262,65 @@ def _segment_to_api(seg: dict) -> dict:
     return out
 
 
+def _meeting_snapshot(meeting) -> dict:
+    """Every meeting-row field the transcript response reads, copied to plain values while the
+    session is live (#508 — see ``SqlAlchemyTranscriptStore._transcript_pg_part``)."""
+    return {
+        "id": meeting.id,
+        "platform": meeting.platform,
+        "platform_specific_id": meeting.platform_specific_id,
+        "status": meeting.status,
+        "start_time": meeting.start_time,
+        "end_time": meeting.end_time,
+        "created_at": meeting.created_at,
+        "data": meeting.data if isinstance(meeting.data, dict) else {},
+    }
+
+
+def _merge_raw_segments(values, seg_by_id: dict, order: list) -> None:
+    """Merge raw live-hash values (JSON, bytes or str) over ``seg_by_id`` — the live copy wins."""
+    for v in values:
+        try:
+            seg = json.loads(v.decode() if isinstance(v, (bytes, bytearray)) else v)
+        except Exception:
+            continue
+        s = _segment_to_api(seg)
+        sid = s.get("segment_id") or f"rh-{len(order)}"
+        if sid not in seg_by_id:
+            order.append(sid)
+        seg_by_id[sid] = s
+
+
+def _transcript_doc(snap: dict, segments: list) -> dict:
+    """Sort + absolute-time the segments and assemble the api.v1 ``TranscriptionResponse``."""
+    data = snap["data"]
+    segments = sorted(segments, key=lambda s: (s.get("start") or 0.0))
+    # The dashboard's renderer SKIPS any segment without absolute_start_time
+    # (use-vexa-websocket.ts: `if (!seg.absolute_start_time) continue`). Derive it when a producer
+    # didn't supply it, so the historical transcript renders. See `_fill_absolute_times`.
+    _fill_absolute_times(segments, snap["start_time"] or snap["created_at"])
+    return {
+        "id": snap["id"],
+        "platform": snap["platform"],
+        "native_meeting_id": snap["platform_specific_id"],
+        "constructed_meeting_url": (data.get("constructed_meeting_url")),
+        "status": snap["status"],
+        "start_time": _iso_utc(snap["start_time"]),
+        "end_time": _iso_utc(snap["end_time"]),
+        "recordings": data.get("recordings", []),
+        "notes": data.get("notes"),
+        "data": data,
+        "segments": segments,
+    }
+
+
+def _unindexed(doc: dict, since) -> dict:
+    """No change index (flag off / no redis): a ``since`` read gets the full doc, ``delta: false``."""
+    if since is not None:
+        doc["delta"] = False
+    return doc
+
+
 class SqlAlchemyTranscriptStore:
     """``TranscriptStore`` over a SQLAlchemy-async ``session_factory`` (the ``meetings`` /
     ``transcriptions`` tables; recordings/notes live in ``meeting.data`` JSONB — NO separate
@@ -288,16 +377,20 @@ class SqlAlchemyTranscriptStore:
         The row fields are copied to a plain dict on purpose: after the session closes, touching an
         expired ORM attribute raises ``MissingGreenlet`` — the same reason ``bot_spawn/adapters.py``
         snapshots before returning (``:192-194``)."""
+        seg_by_id, order = await self._pg_segments(db, meeting.id)
+        return _meeting_snapshot(meeting), seg_by_id, order
+
+    async def _pg_segments(self, db, meeting_id, segment_ids=None) -> "tuple[dict, list]":
+        """The persisted segments of one meeting as api.v1 dicts — all of them, or only
+        ``segment_ids`` (the incremental read's already-flushed ids). DB-only (#508)."""
         from sqlalchemy import select
 
         from .models import Transcription
 
-        seg_rows = (
-            await db.execute(
-                select(Transcription).where(Transcription.meeting_id == meeting.id)
-            )
-        ).scalars().all()
-        data = meeting.data if isinstance(meeting.data, dict) else {}
+        stmt = select(Transcription).where(Transcription.meeting_id == meeting_id)
+        if segment_ids is not None:
+            stmt = stmt.where(Transcription.segment_id.in_(list(segment_ids)))
+        seg_rows = (await db.execute(stmt)).scalars().all()
         # Postgres-persisted segments (the background db-writer flush path).
         seg_by_id: dict = {}
         order: list = []
@@ -311,18 +404,7 @@ class SqlAlchemyTranscriptStore:
             if sid not in seg_by_id:
                 order.append(sid)
             seg_by_id[sid] = s
-        # Snapshot every field the response body reads, INSIDE the live session (see docstring).
-        snap = {
-            "id": meeting.id,
-            "platform": meeting.platform,
-            "platform_specific_id": meeting.platform_specific_id,
-            "status": meeting.status,
-            "start_time": meeting.start_time,
-            "end_time": meeting.end_time,
-            "created_at": meeting.created_at,
-            "data": data,
-        }
-        return snap, seg_by_id, order
+        return seg_by_id, order
 
     async def _merge_live_segments(self, pg: "tuple[dict, dict, list]") -> dict:
         """POST-SESSION half: merge the LIVE Redis in-flight hash, sort, derive absolute times, and
@@ -330,49 +412,68 @@ class SqlAlchemyTranscriptStore:
         is where the (possibly slow) Redis await happens, so it can never pin a pooled connection or
         hold a snapshot/transaction open (the #508 fix). Response is byte-identical to the old build."""
         snap, seg_by_id, order = pg
-        data = snap["data"]
         # Merge the LIVE Redis hash of in-flight segments (``meeting:{id}:segments``) — the source
         # of truth before/until the db-writer flush. The carve had dropped this merge, so a transcript
         # whose segments are still only in Redis (every short/just-finished meeting) read as EMPTY.
         if self._redis is not None:
             try:
                 raw = await self._redis.hgetall(f"meeting:{snap['id']}:segments")
-                for v in (raw.values() if isinstance(raw, dict) else []):
-                    try:
-                        seg = json.loads(v.decode() if isinstance(v, (bytes, bytearray)) else v)
-                    except Exception:
-                        continue
-                    s = _segment_to_api(seg)
-                    sid = s.get("segment_id") or f"rh-{len(order)}"
-                    if sid not in seg_by_id:
-                        order.append(sid)
-                    seg_by_id[sid] = s
+                _merge_raw_segments(raw.values() if isinstance(raw, dict) else [], seg_by_id, order)
             except Exception:
                 pass
-        segments = sorted((seg_by_id[k] for k in order), key=lambda s: (s.get("start") or 0.0))
-        # The dashboard's renderer SKIPS any segment without absolute_start_time
-        # (use-vexa-websocket.ts: `if (!seg.absolute_start_time) continue`). Derive it when a producer
-        # didn't supply it, so the historical transcript renders. See `_fill_absolute_times`.
-        _fill_absolute_times(segments, snap["start_time"] or snap["created_at"])
-        return {
-            "id": snap["id"],
-            "platform": snap["platform"],
-            "native_meeting_id": snap["platform_specific_id"],
-            "constructed_meeting_url": (data.get("constructed_meeting_url")),
-            "status": snap["status"],
-            "start_time": _iso_utc(snap["start_time"]),
-            "end_time": _iso_utc(snap["end_time"]),
-            "recordings": data.get("recordings", []),
-            "notes": data.get("notes"),
-            "data": data,
-            "segments": segments,
-        }
+        return _transcript_doc(snap, [seg_by_id[k] for k in order])
+
+    async def _live_transcript(self, snap: dict, since: Optional[float]) -> dict:
+        """POST-SESSION read of a meeting already authorized + snapshotted, through the change
+        index (``changes.py``): with ``since`` covered by the index, only the segments written
+        after it (``delta: true``); otherwise the full transcript (``delta: false``). Either way
+        the response carries the ``cursor`` for the next poll. Opens its own short session only
+        for the Postgres rows it needs — never while awaiting Redis (#508)."""
+        from .changes import changed_since, current_cursor, format_cursor
+        from .db_writer import segments_hash_key
+
+        mid = snap["id"]
+        if since is not None:
+            try:
+                window = await changed_since(self._redis, mid, since)
+                if window is not None:
+                    ids, cursor = window
+                    raw = await self._redis.hmget(segments_hash_key(mid), ids) if ids else []
+            except Exception:
+                window = None  # a redis blip degrades to the full read, never to a wrong delta
+            if window is not None:
+                seg_by_id, order = {}, []
+                flushed = [sid for sid, v in zip(ids, raw) if v is None]
+                if flushed:
+                    async with self._session_factory() as db:
+                        seg_by_id, order = await self._pg_segments(db, mid, flushed)
+                _merge_raw_segments([v for v in raw if v is not None], seg_by_id, order)
+                doc = _transcript_doc(snap, [seg_by_id[k] for k in order])
+                doc["cursor"] = format_cursor(cursor)
+                doc["delta"] = True
+                return doc
+        async with self._session_factory() as db:
+            seg_by_id, order = await self._pg_segments(db, mid)
+        doc = await self._merge_live_segments((snap, seg_by_id, order))
+        try:
+            cursor = await current_cursor(self._redis, mid)
+        except Exception:
+            cursor = None
+        if cursor is not None:
+            doc["cursor"] = format_cursor(cursor)
+        return _unindexed(doc, since)
 
-    async def get_transcript(self, user_id, platform, native_meeting_id) -> Optional[dict]:
+    def _indexed(self) -> bool:
+        from .changes import TRANSCRIPT_CHANGE_INDEX
+
+        return self._redis is not None and TRANSCRIPT_CHANGE_INDEX
+
+    async def get_transcript(self, user_id, platform, native_meeting_id, since=None) -> Optional[dict]:
         from sqlalchemy import select  # lazy: SQLAlchemy not needed for the in-memory fakes
 
         from .models import Meeting  # local re-export of the admin-api models
 
+        indexed = self._indexed()
         async with self._session_factory() as db:
             stmt = (
                 select(Meeting)
@@ -386,11 +487,16 @@ class SqlAlchemyTranscriptStore:
             meeting = (await db.execute(stmt)).scalars().first()
             if not meeting:
                 return None
-            pg = await self._transcript_pg_part(db, meeting)
+            if indexed:
+                snap = _meeting_snapshot(meeting)
+            else:
+                pg = await self._transcript_pg_part(db, meeting)
         # Session closed (transaction ended, connection returned to pool) BEFORE the Redis merge (#508).
-        return await self._merge_live_segments(pg)
+        if indexed:
+            return await self._live_transcript(snap, since)
+        return _unindexed(await self._merge_live_segments(pg), since)
 
-    async def get_transcript_by_id(self, user_id, meeting_id, member_workspaces=None) -> Optional[dict]:
+    async def get_transcript_by_id(self, user_id, meeting_id, member_workspaces=None, since=None) -> Optional[dict]:
         """Exact-row transcript for ``meeting.id == meeting_id``, authorized by the SAME three-way rule as
         authorize_subscribe: (a) owner, (b) member of the bound workspace, (c) redeemed a transcript-share
         link (``data.transcript_viewers``). Any other caller → ``None`` (→ 404), so it can never leak an
@@ -403,6 +509,7 @@ class SqlAlchemyTranscriptStore:
             mid = int(meeting_id)
         except (TypeError, ValueError):
             return None
+        indexed = self._indexed()
         async with self._session_factory() as db:
             meeting = (await db.execute(select(Meeting).where(Meeting.id == mid))).scalars().first()
             if not meeting:
@@ -415,9 +522,14 @@ class SqlAlchemyTranscriptStore:
             )
             if not authorized:
                 return None
-            pg = await self._transcript_pg_part(db, meeting)
+            if indexed:
+                snap = _meeting_snapshot(meeting)
+            else:
+                pg = await self._transcript_pg_part(db, meeting)
         # Session closed (transaction ended, connection returned to pool) BEFORE the Redis merge (#508).
-        return await self._merge_live_segments(pg)
+        if indexed:
+            return await self._live_transcript(snap, since)
+        return _unindexed(await self._merge_live_segments(pg), since)
 
     async def list_meetings(self, user_id, *, status=None, platform=None, limit=None, offset=None,
                             member_workspaces=None, list_view=False, meeting_id=None, slim=False):
@@ -682,14 +794,38 @@ class SqlAlchemyTranscriptStore:
         # hash cannot linger forever once its segments were flushed.
         if self._redis is None:
             return
-        from .db_writer import ACTIVE_MEETINGS_KEY, segments_hash_key
+        from .db_writer import ACTIVE_MEETINGS_KEY, SEGMENTS_BY_UPDATED_KEY, segment_index_entry, segments_hash_key
 
         hash_key = segments_hash_key(meeting_id)
         ttl = int(os.environ.get("REDIS_SEGMENT_TTL", "3600"))
+        index = segment_index_entry(meeting_id, segment)  # the batched flush's ripe index (opt-in)
         async with self._redis.pipeline(transaction=True) as pipe:
             pipe.sadd(ACTIVE_MEETINGS_KEY, str(meeting_id))
             pipe.hset(hash_key, segment["segment_id"], json.dumps(segment))
             pipe.expire(hash_key, ttl)
+            if index is not None:
+                pipe.zadd(SEGMENTS_BY_UPDATED_KEY, {index[0]: index[1]})
+            index_segments(pipe, meeting_id, [segment["segment_id"]], ttl)  # the ?since= read index (opt-in)
+            await pipe.execute()
+
+    async def append_segments(self, meeting_id, segments) -> None:
+        """The batched ingest's store write — every segment of one meeting's batch in ONE
+        transactional pipeline (one SADD, one multi-field HSET, one EXPIRE, one index ZADD), the
+        same keys ``append_segment`` writes one at a time."""
+        if self._redis is None or not segments:
+            return
+        from .db_writer import ACTIVE_MEETINGS_KEY, SEGMENTS_BY_UPDATED_KEY, segment_index_entry, segments_hash_key
+
+        hash_key = segments_hash_key(meeting_id)
+        ttl = int(os.environ.get("REDIS_SEGMENT_TTL", "3600"))
+        index = dict(e for e in (segment_index_entry(meeting_id, seg) for seg in segments) if e is not None)
+        async with self._redis.pipeline(transaction=True) as pipe:
+            pipe.sadd(ACTIVE_MEETINGS_KEY, str(meeting_id))
+            pipe.hset(hash_key, mapping={seg["segment_id"]: json.dumps(seg) for seg in segments})
+            pipe.expire(hash_key, ttl)
+            if index:
+                pipe.zadd(SEGMENTS_BY_UPDATED_KEY, index)
+            index_segments(pipe, meeting_id, [seg["segment_id"] for seg in segments], ttl)
             await pipe.execute()
 
     async def upsert_segments(self, meeting_id, segments) -> None:
@@ -698,42 +834,42 @@ class SqlAlchemyTranscriptStore:
         ``ix_transcription_meeting_segment`` in the admin-api authoritative schema), exactly the
         parent db-writer's ON CONFLICT statement: idempotent, a re-flushed rewrite lands as an
         UPDATE, never a duplicate row."""
-        from datetime import datetime as _dt
+        await self.upsert_segments_many({meeting_id: segments})
 
+    async def upsert_segments_many(self, batches) -> None:
+        """The batched flush's sink — every meeting's segments (``{meeting_id: [segment, ...]}``) as
+        multi-row ``INSERT … ON CONFLICT`` statements of up to ``_UPSERT_CHUNK_ROWS`` rows, all in
+        ONE transaction. A ``(meeting_id, segment_id)`` repeated in the input keeps its last copy:
+        one statement's ON CONFLICT DO UPDATE may not touch the same row twice."""
         from sqlalchemy import text as sql_text  # lazy: not needed for the in-memory fakes
 
-        rows = []
-        for seg in segments:
-            sid = seg.get("segment_id")
-            if not sid:
-                continue  # 0.12 ingest guarantees segment_id; a legacy stray is skipped, not guessed
-            try:
-                start = float(seg.get("start", seg.get("start_time", 0.0)) or 0.0)
-                end = float(seg.get("end", seg.get("end_time", start)) or start)
-            except (TypeError, ValueError):
-                continue
-            if end < start:
-                start, end = end, start
-            rows.append({
-                "mid": int(meeting_id), "start": start, "end": end,
-                "text": seg.get("text") or "", "speaker": seg.get("speaker"),
-                "lang": seg.get("language"), "uid": seg.get("session_uid"),
-                "segid": str(sid), "created": _dt.utcnow(),
-            })
-        if not rows:
+        rows_by_key: dict = {}
+        for meeting_id, segments in batches.items():
+            for row in _transcription_rows(meeting_id, segments):
+                rows_by_key[(row["mid"], row["segid"])] = row
+        if not rows_by_key:
             return
+        rows = list(rows_by_key.values())
         async with self._session_factory() as db:
-            for row in rows:
+            for i in range(0, len(rows), _UPSERT_CHUNK_ROWS):
+                chunk = rows[i:i + _UPSERT_CHUNK_ROWS]
+                params: dict = {}
+                values = []
+                for j, row in enumerate(chunk):
+                    values.append(
+                        f"(:mid{j}, :start{j}, :end{j}, :text{j}, :speaker{j}, :lang{j}, :uid{j}, :segid{j}, :created{j})"
+                    )
+                    params.update({f"{k}{j}": v for k, v in row.items()})
                 await db.execute(
-                    sql_text("""
+                    sql_text(f"""
                         INSERT INTO transcriptions (meeting_id, start_time, end_time, text, speaker, language, session_uid, segment_id, created_at)
-                        VALUES (:mid, :start, :end, :text, :speaker, :lang, :uid, :segid, :created)
+                        VALUES {", ".join(values)}
                         ON CONFLICT (meeting_id, segment_id) WHERE segment_id IS NOT NULL
                         DO UPDATE SET text = EXCLUDED.text, speaker = EXCLUDED.speaker,
                                       start_time = EXCLUDED.start_time, end_time = EXCLUDED.end_time,
                                       language = EXCLUDED.language, created_at = EXCLUDED.created_at
                     """),
-                    row,
+                    params,
                 )
             await db.commit()
 
@@ -5,7 +5,9 @@ v0.12 carve of the deployed ``services/meeting-api/meeting_api/collector/endpoin
 
   * **GET /transcripts/{platform}/{native_meeting_id}** — the meeting's transcript document,
     conforming to api.v1 ``#/components/schemas/TranscriptionResponse`` (sealed). 404 when the
-    caller owns no such meeting.
+    caller owns no such meeting. ``?since=<cursor>`` returns only the segments changed after a
+    prior response's ``cursor`` (``delta: true``; see ``changes.py``), and every transcript body
+    carries an ``ETag`` — a matching ``If-None-Match`` gets 304.
   * **GET /meetings** — the caller's meetings, conforming to api.v1
     ``#/components/schemas/MeetingListResponse`` (sealed). Optional ``status`` / ``platform`` /
     ``limit`` / ``offset`` filters (parent's ``get_meetings``).
@@ -36,6 +38,7 @@ from typing import Any, Callable, Optional
 from fastapi import APIRouter, FastAPI, Header, HTTPException, Query, Request, Response
 from fastapi.responses import JSONResponse
 
+from .changes import etag_matches, parse_cursor, transcript_etag
 from .meeting_link import parse_meeting_url
 from .obs import TraceMiddleware as _DefaultTraceMiddleware
 from .obs import log_event as _default_log_event
@@ -95,6 +98,29 @@ def _resolve_user_id(x_user_id: Optional[str]) -> int:
         raise HTTPException(status_code=401, detail="Invalid user identity")
 
 
+def _since(raw: Optional[str]) -> Optional[float]:
+    """The ``?since=`` cursor of an incremental transcript read (a prior response's ``cursor``)."""
+    if raw is None or raw == "":
+        return None
+    try:
+        return parse_cursor(raw)
+    except ValueError:
+        raise HTTPException(status_code=422, detail="Invalid since cursor")
+
+
+def _transcript_response(request: Request, doc: dict) -> Response:
+    """The transcript body with a strong ``ETag`` over its exact bytes; a matching
+    ``If-None-Match`` → 304 with no body. Serialized ONCE, the way ``JSONResponse`` renders."""
+    import json as _json
+
+    body = _json.dumps(doc, ensure_ascii=False, allow_nan=False, indent=None, separators=(",", ":")).encode("utf-8")
+    etag = transcript_etag(body)
+    headers = {"ETag": etag, "Cache-Control": "private, no-cache"}
+    if etag_matches(request.headers.get("if-none-match"), etag):
+        return Response(status_code=304, headers=headers)
+    return Response(content=body, media_type="application/json", headers=headers)
+
+
 def build_router(
     store: TranscriptStore,
     redis: RedisBus,
@@ -123,12 +149,13 @@ def build_router(
     async def get_transcript_by_id(
         meeting_id: int,
         request: Request,
+        since: Optional[str] = Query(default=None),
         x_user_id: Optional[str] = Header(default=None),
         x_user_workspaces: Optional[str] = Header(default=None),
     ):
         user_id = _resolve_user_id(x_user_id)
         member_workspaces = {w.strip() for w in (x_user_workspaces or "").split(",") if w.strip()}
-        doc = await store.get_transcript_by_id(user_id, meeting_id, member_workspaces)
+        doc = await store.get_transcript_by_id(user_id, meeting_id, member_workspaces, since=_since(since))
         if doc is None:
             log_event(
                 "transcript_not_found", audience="system", level="warning",
@@ -138,9 +165,9 @@ def build_router(
         log_event(
             "transcript_served", audience="user", span="transcripts.get_by_id",
             user_id=user_id, meeting_id=str(meeting_id),
-            fields={"segments": len(doc.get("segments", []))},
+            fields={"segments": len(doc.get("segments", [])), "delta": bool(doc.get("delta"))},
         )
-        return JSONResponse(content=doc)
+        return _transcript_response(request, doc)
 
     # --- GET /transcripts/{platform}/{native_meeting_id} → api.v1 TranscriptionResponse ---
     @router.get("/transcripts/{platform}/{native_meeting_id}")
@@ -148,10 +175,11 @@ def build_router(
         platform: str,
         native_meeting_id: str,
         request: Request,
+        since: Optional[str] = Query(default=None),
         x_user_id: Optional[str] = Header(default=None),
     ):
         user_id = _resolve_user_id(x_user_id)
-        doc = await store.get_transcript(user_id, platform, native_meeting_id)
+        doc = await store.get_transcript(user_id, platform, native_meeting_id, since=_since(since))
         if doc is None:
             log_event(
                 "transcript_not_found",
@@ -172,9 +200,9 @@ def build_router(
             span="transcripts.get",
             user_id=user_id,
             meeting_id=f"{platform}/{native_meeting_id}",
-            fields={"segments": len(doc.get("segments", []))},
+            fields={"segments": len(doc.get("segments", [])), "delta": bool(doc.get("delta"))},
         )
-        return JSONResponse(content=doc)
+        return _transcript_response(request, doc)
 
     # --- GET /meetings → api.v1 MeetingListResponse ---
     @router.get("/meetings")
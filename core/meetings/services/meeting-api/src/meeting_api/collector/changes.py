@@ -0,0 +1,110 @@
+"""The per-meeting change index behind incremental transcript reads (``GET /transcripts/…?since=``).
+
+A full ``get_transcript`` is O(total segments) per poll: SELECT every persisted row, HGETALL the
+live hash, JSON-parse and merge both, re-sort. Dashboards poll it for the whole of a long meeting.
+With ``TRANSCRIPT_CHANGE_INDEX`` on, every live segment write also ZADDs
+``meeting:{id}:segments:changes`` (member = ``segment_id``, score = the write time) in the SAME
+transactional pipeline as the hash HSET. A read carrying ``since=<cursor>`` answers from it:
+ZRANGEBYSCORE for the ids written after the cursor, HMGET of just those hash fields, and a
+Postgres lookup of only the ids the db-writer already flushed out of the hash.
+
+The cursor is opaque to clients — the highest index score the response covers, returned as
+``cursor`` on every indexed read. A ``since`` read re-covers the ``SINCE_OVERLAP_S`` before the
+cursor, so a write whose score was taken just before a read but which landed just after it is never
+skipped; clients merge by ``segment_id`` (``upsertSegments``), so a re-sent segment is a no-op.
+Segments are only ever rewritten, never removed, so a delta is upserts only.
+
+The index is trusted only when it provably covers the cursor: its ``__floor__`` member (ZADD NX on
+the first indexed write) records when indexing began for the meeting. No index (TTL-expired, or
+every write predates the flag) or a cursor older than the floor → the full transcript, marked
+``delta: false`` so the client replaces instead of merging.
+
+``transcript_etag`` / ``etag_matches`` are the ETag + ``If-None-Match`` → 304 half: the tag is the
+digest of the exact response bytes, so an unchanged poll costs the client nothing to re-parse.
+"""
+from __future__ import annotations
+
+import hashlib
+import os
+import time
+from typing import Iterable, Optional
+
+TRANSCRIPT_CHANGE_INDEX = os.environ.get("TRANSCRIPT_CHANGE_INDEX", "false").strip().lower() in ("1", "true", "yes", "on")
+FLOOR_MEMBER = "__floor__"
+# Covers the gap between a writer taking its score and its pipeline landing (plus replica clock
+# skew); re-sending a few seconds of segments is cheap, skipping one is a silent gap.
+SINCE_OVERLAP_S = 2.0
+
+
+def changes_key(meeting_id) -> str:
+    return f"meeting:{meeting_id}:segments:changes"
+
+
+def _s(v) -> str:
+    return v.decode() if isinstance(v, (bytes, bytearray)) else str(v)
+
+
+def index_segments(pipe, meeting_id, segment_ids: Iterable[str], ttl: int, now: Optional[float] = None) -> None:
+    """Queue the index writes for one meeting's segment write onto ``pipe`` (the same transaction
+    as the hash HSET). A no-op unless ``TRANSCRIPT_CHANGE_INDEX`` is on."""
+    if not TRANSCRIPT_CHANGE_INDEX:
+        return
+    ids = [str(sid) for sid in segment_ids if sid]
+    if not ids:
+        return
+    score = time.time() if now is None else now
+    key = changes_key(meeting_id)
+    pipe.zadd(key, {FLOOR_MEMBER: score}, nx=True)
+    pipe.zadd(key, {sid: score for sid in ids})
+    pipe.expire(key, ttl)
+
+
+def parse_cursor(raw: str) -> float:
+    """A client ``since`` → the index score it names; ``ValueError`` on anything else (→ 422)."""
+    value = float(raw)
+    if value != value or value < 0 or value == float("inf"):
+        raise ValueError(f"invalid cursor {raw!r}")
+    return value
+
+
+def format_cursor(score: float) -> str:
+    return f"{score:.6f}"
+
+
+async def current_cursor(redis_c, meeting_id) -> Optional[float]:
+    """The newest score in the meeting's index, or None when there is no index."""
+    top = await redis_c.zrevrange(changes_key(meeting_id), 0, 0, withscores=True)
+    return float(top[0][1]) if top else None
+
+
+async def changed_since(redis_c, meeting_id, since: float) -> "Optional[tuple[list[str], float]]":
+    """``(segment ids written at/after since − overlap, the cursor they bring the client to)``, or
+    None when the index does not cover ``since`` (the caller falls back to the full transcript)."""
+    key = changes_key(meeting_id)
+    floor = await redis_c.zscore(key, FLOOR_MEMBER)
+    if floor is None or float(floor) > since:
+        return None
+    entries = await redis_c.zrangebyscore(key, since - SINCE_OVERLAP_S, "+inf", withscores=True)
+    ids: list[str] = []
+    cursor = since
+    for member, score in entries:
+        member = _s(member)
+        if member == FLOOR_MEMBER:
+            continue
+        ids.append(member)
+        cursor = max(cursor, float(score))
+    return ids, cursor
+
+
+def transcript_etag(body: bytes) -> str:
+    return '"' + hashlib.sha256(body).hexdigest()[:32] + '"'
+
+
+def etag_matches(if_none_match: Optional[str], etag: str) -> bool:
+    """RFC 9110 §13.1.2 weak comparison of an ``If-None-Match`` header against our tag."""
+    if not if_none_match:
+        return False
+    candidates = [c.strip() for c in if_none_match.split(",")]
+    if "*" in candidates:
+        return True
+    return any((c[2:] if c.startswith("W/") else c) == etag for c in candidates)
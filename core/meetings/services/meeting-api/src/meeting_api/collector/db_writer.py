@@ -47,6 +47,15 @@ today the collector maintains the ONE meeting-scoped copilot view, upserted by `
 ride the sealed api.v1 responses' existing free-form ``data`` field (GET /transcripts +
 GET /meetings) — no new REST surface, no contract change.
 
+**Batched flush** (``DB_WRITER_BATCHED``, opt-in): the per-meeting sweep HGETALLs every active
+hash each tick and JSON-parses the still-mutable fields it then skips, one meeting at a time. In
+batched mode ``append_segment`` also ZADDs each field into ``segments_by_updated_at`` (member
+``{meeting_id}:{segment_id}``, score = its ``updated_at``) in the same transaction as the hash
+write, so a tick ZRANGEBYSCOREs only the RIPE fields across all meetings, HMGETs them in ONE
+pipeline, writes them through ONE multi-meeting sink call (``upsert_segments_many`` — multi-row
+upserts in one transaction), and trims hashes + index in one more pipeline. The per-meeting sweep
+still runs on reconcile ticks — the self-heal for fields written before the index existed.
+
 Everything here talks to redis through plain client calls (hgetall/hdel/smembers/scan/xrange) that
 both ``redis.asyncio`` and ``fakeredis.aioredis`` satisfy, and to the durable store through two
 getattr-guarded sink methods (``upsert_segments``, ``merge_processed_notes``) implemented by BOTH
@@ -58,6 +67,7 @@ from __future__ import annotations
 import json
 import logging
 import os
+import time
 from datetime import datetime, timedelta, timezone
 from typing import Optional
 
@@ -141,6 +151,12 @@ async def _trim_segments_stream(redis_c, retention_s: float, now_ms: int) -> Non
 # score = deadline) and every tick re-drains it until the marker is seen — or the deadline passes
 # (the P22 pairing: graceful marker, hard bounded guarantee for a worker that died markerless).
 PROC_PENDING_KEY = "processed_pending"
+
+# The batched flush's ripe-candidate index (see the module doc). Off by default; the same env gates
+# the write side (``segment_index_entry``) so a per-meeting-mode deployment never grows the zset.
+SEGMENTS_BY_UPDATED_KEY = "segments_by_updated_at"
+DB_WRITER_BATCHED = os.environ.get("DB_WRITER_BATCHED", "false").strip().lower() in ("1", "true", "yes", "on")
+DB_WRITER_BATCH_LIMIT = int(os.environ.get("DB_WRITER_BATCH_LIMIT", "5000"))  # ripe fields per tick
 PROC_PENDING_GRACE_SEC = float(os.environ.get("PROC_PENDING_GRACE_SEC", "120"))
 
 # The one processed view the collector maintains today: the copilot's 1:1 cleaned transcript.
@@ -150,6 +166,71 @@ PROC_VIEW_ID = "copilot-notes"
 PROC_VIEW_KIND = "cleaned_transcript"
 
 
+# Flush-latency histogram bounds (ms). ``durable_ms`` includes the IMMUTABILITY_THRESHOLD settle
+# wait, so its buckets run far past the sink-call ones.
+_SINK_MS_BUCKETS = (5, 10, 25, 50, 100, 250, 500, 1000, 2500, 5000)
+_DURABLE_MS_BUCKETS = (1000, 5000, 10000, 30000, 45000, 60000, 120000, 300000)
+
+
+class FlushStats:
+    """Process-wide db-writer counters served on ``/health`` (``pipeline.db_writer``): ticks,
+    segments stored, failed durable writes, the duration of the latest tick, and two cumulative
+    histograms — ``sink_ms`` (one durable write call) and ``durable_ms`` (a segment's last
+    ``updated_at`` → its confirmed durable write; the settle wait plus the tick cadence)."""
+
+    def __init__(self) -> None:
+        self.reset()
+
+    def reset(self) -> None:
+        self.ticks = 0
+        self.segments = 0
+        self.failures = 0
+        self.last_tick_ms: Optional[float] = None
+        self.max_tick_ms = 0.0
+        self._bounds = {"sink_ms": _SINK_MS_BUCKETS, "durable_ms": _DURABLE_MS_BUCKETS}
+        self._latency = {stage: [0] * len(b) for stage, b in self._bounds.items()}
+        self._latency_count = {stage: 0 for stage in self._bounds}
+
+    def _observe(self, stage: str, ms: float) -> None:
+        self._latency_count[stage] += 1
+        for i, le in enumerate(self._bounds[stage]):
+            if ms <= le:
+                self._latency[stage][i] += 1
+
+    def observe_tick(self, ms: float) -> None:
+        self.ticks += 1
+        self.last_tick_ms = round(ms, 1)
+        self.max_tick_ms = max(self.max_tick_ms, self.last_tick_ms)
+
+    def observe_write(self, started: float, segments: list, now: datetime) -> None:
+        """One confirmed durable write that began at monotonic ``started`` and stored ``segments``."""
+        self._observe("sink_ms", (time.monotonic() - started) * 1000)
+        self.segments += len(segments)
+        for seg in segments:
+            updated_at = _parse_updated_at(seg.get("updated_at"))
+            if updated_at is not None:
+                self._observe("durable_ms", max(0.0, (now - updated_at).total_seconds() * 1000))
+
+    def snapshot(self) -> dict:
+        return {
+            "ticks": self.ticks,
+            "segments": self.segments,
+            "failures": self.failures,
+            "last_tick_ms": self.last_tick_ms,
+            "max_tick_ms": self.max_tick_ms,
+            "latency_ms": {
+                stage: {
+                    "count": self._latency_count[stage],
+                    "buckets": {str(le): c for le, c in zip(self._bounds[stage], counts)},
+                }
+                for stage, counts in self._latency.items()
+            },
+        }
+
+
+flush_stats = FlushStats()
+
+
 def segments_hash_key(meeting_id) -> str:
     """The live Redis hash of in-flight segments (``ingest`` writes it; the read path merges it)."""
     return f"meeting:{meeting_id}:segments"
@@ -166,6 +247,20 @@ def _s(v) -> str:
     return v.decode() if isinstance(v, (bytes, bytearray)) else v
 
 
+def segment_index_member(meeting_id, segment_id) -> str:
+    return f"{meeting_id}:{_s(segment_id)}"
+
+
+def segment_index_entry(meeting_id, segment: dict) -> "Optional[tuple[str, float]]":
+    """The ``segments_by_updated_at`` (member, score) ``append_segment`` writes beside the hash
+    field — None unless the batched flush is on. No ``updated_at`` ⇒ score 0 (ripe at once), the
+    same as the per-meeting sweep, which flushes such a field on its first tick."""
+    if not DB_WRITER_BATCHED:
+        return None
+    updated_at = _parse_updated_at(segment.get("updated_at"))
+    return segment_index_member(meeting_id, segment["segment_id"]), (updated_at.timestamp() if updated_at else 0.0)
+
+
 def _parse_updated_at(raw: Optional[str]) -> Optional[datetime]:
     if not raw:
         return None
@@ -224,18 +319,25 @@ async def flush_meeting_segments(
         # re-arm the hash TTL before propagating: a completed meeting gets no more appends (nothing
         # re-arms the TTL), so a sink outage longer than the TTL would expire the tail unflushed
         # (#53 review, vector 2).
+        started = time.monotonic()
         try:
             await sink.upsert_segments(meeting_id, batch)
         except Exception:
+            flush_stats.failures += 1
             import os as _os
             try:
                 await redis_c.expire(hash_key, int(_os.environ.get("REDIS_SEGMENT_TTL", "3600")))
             except Exception:  # noqa: BLE001 — best-effort re-arm; the original error matters more
                 pass
             raise
-    if done_fields:
-        await redis_c.hdel(hash_key, *done_fields)
-    remaining = await redis_c.hlen(hash_key)
+        flush_stats.observe_write(started, batch, now)
+    # One round-trip for the trim: HDEL + the index members (a no-op when the index is off) + HLEN.
+    async with redis_c.pipeline(transaction=False) as pipe:
+        if done_fields:
+            pipe.hdel(hash_key, *done_fields)
+            pipe.zrem(SEGMENTS_BY_UPDATED_KEY, *(segment_index_member(meeting_id, f) for f in done_fields))
+        pipe.hlen(hash_key)
+        remaining = (await pipe.execute())[-1]
     if not remaining:
         try:
             await redis_c.srem(ACTIVE_MEETINGS_KEY, str(meeting_id))
@@ -244,6 +346,114 @@ async def flush_meeting_segments(
     return len(batch)
 
 
+async def _upsert_batches(sink, batches: "dict[int, list[dict]]") -> "set[int]":
+    """Write every meeting's batch durably; return the meeting ids whose write is CONFIRMED. One
+    ``upsert_segments_many`` transaction when the sink has it; if that fails (or the sink lacks
+    it), fall back to per-meeting writes so one poisoned meeting never blocks the rest."""
+    many = getattr(sink, "upsert_segments_many", None)
+    if many is not None:
+        try:
+            await many(batches)
+            return set(batches)
+        except Exception:  # noqa: BLE001 — retried per meeting below, failures isolated there
+            log.exception("db-writer batched upsert failed; retrying per meeting")
+    confirmed: set[int] = set()
+    for meeting_id, batch in batches.items():
+        try:
+            await sink.upsert_segments(meeting_id, batch)
+            confirmed.add(meeting_id)
+        except Exception:  # noqa: BLE001 — the hash stays intact for the next tick
+            log.exception("db-writer flush failed for meeting %s", meeting_id)
+    return confirmed
+
+
+async def flush_ripe_segments(
+    redis_c,
+    sink,
+    *,
+    immutability_threshold: Optional[float] = None,
+    now: Optional[datetime] = None,
+    limit: Optional[int] = None,
+) -> int:
+    """The batched flush: every meeting's RIPE fields (``updated_at`` older than the threshold, per
+    the ``segments_by_updated_at`` index) in a fixed number of round-trips — ZRANGEBYSCORE, one HMGET
+    pipeline, one multi-meeting sink write, one trim pipeline (+ SREM of drained meetings). Same
+    semantics as ``flush_meeting_segments``: trim only after a confirmed write, empty text dropped
+    unstored, a rewrite that raced the fetch (now younger than the cutoff) left for a later tick."""
+    threshold = IMMUTABILITY_THRESHOLD if immutability_threshold is None else immutability_threshold
+    now = now or datetime.now(timezone.utc)
+    cutoff = now - timedelta(seconds=threshold)
+    members = await redis_c.zrangebyscore(
+        SEGMENTS_BY_UPDATED_KEY, "-inf", f"({cutoff.timestamp()}" if threshold > 0 else "+inf",
+        start=0, num=limit or DB_WRITER_BATCH_LIMIT,
+    )
+    if not members:
+        return 0
+
+    fields_by_meeting: dict[int, list[str]] = {}
+    stale: list = []  # index members with no (parseable) meeting / hash field behind them
+    for member in members:
+        mid_s, _, field = _s(member).partition(":")
+        try:
+            fields_by_meeting.setdefault(int(mid_s), []).append(field)
+        except ValueError:
+            stale.append(member)
+    async with redis_c.pipeline(transaction=False) as pipe:
+        for meeting_id, fields in fields_by_meeting.items():
+            pipe.hmget(segments_hash_key(meeting_id), fields)
+        fetched = await pipe.execute()
+
+    batches: dict[int, list[dict]] = {}
+    done: dict[int, list[str]] = {}  # flushed OR discarded — trimmed only after a confirmed write
+    for (meeting_id, fields), values in zip(fields_by_meeting.items(), fetched):
+        for field, value in zip(fields, values):
+            if value is None:
+                stale.append(segment_index_member(meeting_id, field))  # hash field gone (flushed / expired)
+                continue
+            try:
+                seg = json.loads(_s(value))
+            except (json.JSONDecodeError, TypeError, ValueError):
+                done.setdefault(meeting_id, []).append(field)
+                continue
+            updated_at = _parse_updated_at(seg.get("updated_at"))
+            if threshold > 0 and updated_at is not None and updated_at >= cutoff:
+                continue  # rewritten since the index read — its re-ZADDed score defers it
+            done.setdefault(meeting_id, []).append(field)
+            if not (seg.get("text") or "").strip():
+                continue
+            if not seg.get("segment_id"):
+                seg = {**seg, "segment_id": field}
+            batches.setdefault(meeting_id, []).append(seg)
+
+    started = time.monotonic()
+    confirmed = await _upsert_batches(sink, batches) if batches else set()
+    failed = set(batches) - confirmed
+    if batches:
+        flush_stats.failures += len(failed)
+        flush_stats.observe_write(started, [seg for mid in confirmed for seg in batches[mid]], now)
+    trim = {mid: fields for mid, fields in done.items() if mid not in failed}
+    async with redis_c.pipeline(transaction=False) as pipe:
+        if stale:
+            pipe.zrem(SEGMENTS_BY_UPDATED_KEY, *stale)
+        for meeting_id in failed:
+            # Re-arm the TTL of a hash whose write failed (the flush_meeting_segments #53 guard).
+            pipe.expire(segments_hash_key(meeting_id), int(os.environ.get("REDIS_SEGMENT_TTL", "3600")))
+        for meeting_id, fields in trim.items():
+            pipe.hdel(segments_hash_key(meeting_id), *fields)
+            pipe.zrem(SEGMENTS_BY_UPDATED_KEY, *(segment_index_member(meeting_id, f) for f in fields))
+        for meeting_id in trim:
+            pipe.hlen(segments_hash_key(meeting_id))
+        results = await pipe.execute()
+    remaining = results[len(results) - len(trim):] if trim else []
+    drained = [str(mid) for mid, n in zip(trim, remaining) if not n]
+    if drained:
+        try:
+            await redis_c.srem(ACTIVE_MEETINGS_KEY, *drained)
+        except Exception:  # noqa: BLE001 — set upkeep is best-effort
+            pass
+    return sum(len(batches[mid]) for mid in confirmed)
+
+
 async def flush_meeting_processed(redis_c, sink, meeting_id: int) -> int:
     """Drain NEW entries of the meeting's processed-notes stream (``proc:meeting:{meeting_id}``,
     written by the agent worker) into the copilot view of the meeting row's
@@ -322,6 +532,7 @@ async def db_writer_tick(
     immutability_threshold: Optional[float] = None,
     now: Optional[datetime] = None,
     reconcile: bool = False,
+    batched: Optional[bool] = None,
 ) -> int:
     """ONE db-writer sweep (the loop body ``__main__`` polls): flush every discovered meeting's
     immutable segments to the durable sink, then drain its processed-notes stream. Returns the total
@@ -331,7 +542,20 @@ async def db_writer_tick(
     the meeting in the SAME transaction that writes its hash). ``reconcile=True`` ADDITIONALLY runs the
     O(keyspace) ``meeting:*:segments`` scan to self-heal a set/hash divergence or a pre-set (mid-upgrade)
     hash; it is OFF the per-tick hot path (``reconcile`` defaults False) because that scan saturated
-    Redis and starved the /health probe (#893) — the loop runs it only on startup + every N minutes."""
+    Redis and starved the /health probe (#893) — the loop runs it only on startup + every N minutes.
+
+    ``batched`` (default ``DB_WRITER_BATCHED``) swaps the per-meeting segment sweep for
+    ``flush_ripe_segments`` on non-reconcile ticks; a reconcile tick always runs the per-meeting
+    sweep (fields written before the index existed). Processed notes drain per meeting either way."""
+    batched = DB_WRITER_BATCHED if batched is None else batched
+    started = time.monotonic()
+    try:
+        return await _db_writer_sweep(redis_c, sink, immutability_threshold, now, reconcile, batched)
+    finally:
+        flush_stats.observe_tick((time.monotonic() - started) * 1000)
+
+
+async def _db_writer_sweep(redis_c, sink, immutability_threshold, now, reconcile, batched) -> int:
     ids: set[str] = set()
     try:
         members = await redis_c.smembers(ACTIVE_MEETINGS_KEY)
@@ -348,16 +572,25 @@ async def db_writer_tick(
             pass
 
     total = 0
+    per_meeting = reconcile or not batched
+    if not per_meeting:
+        try:
+            total += await flush_ripe_segments(
+                redis_c, sink, immutability_threshold=immutability_threshold, now=now,
+            )
+        except Exception:  # noqa: BLE001 — the processed drain below still runs; next tick retries
+            log.exception("db-writer batched flush failed")
     for raw_id in ids:
         try:
             meeting_id = int(raw_id)
         except (TypeError, ValueError):
             continue
         try:
-            total += await flush_meeting_segments(
-                redis_c, sink, meeting_id,
-                immutability_threshold=immutability_threshold, now=now,
-            )
+            if per_meeting:
+                total += await flush_meeting_segments(
+                    redis_c, sink, meeting_id,
+                    immutability_threshold=immutability_threshold, now=now,
+                )
             await flush_meeting_processed(redis_c, sink, meeting_id)
         except Exception:  # noqa: BLE001 — isolate per meeting; the next tick retries
             log.exception("db-writer flush failed for meeting %s", raw_id)
@@ -33,6 +33,13 @@ def _segment_to_api(seg: dict) -> dict:
     return out
 
 
+def _unindexed(doc: dict, since) -> dict:
+    """The fake keeps no change index: a ``since`` read is answered in full, ``delta: false``."""
+    if since is not None:
+        doc["delta"] = False
+    return doc
+
+
 class InMemoryTranscriptStore:
     """A dict-backed ``TranscriptStore``. Owner-scoped by ``user_id`` (the authorization
     boundary). Keyed internally by the synthetic ``meeting_id``.
@@ -51,6 +58,8 @@ class InMemoryTranscriptStore:
         # Optional live-segment redis (fakeredis in tests) — mirrors the prod adapter's split
         # between the in-flight hash (redis) and the durable rows (the dict standing in for PG).
         self._redis = redis_client
+        self.upsert_batches = 0  # upsert_segments_many calls (the batched flush's one-write-per-tick)
+        self.append_batches = 0  # append_segments calls (the batched ingest's one-write-per-meeting)
 
     def seed_meeting(
         self,
@@ -148,13 +157,13 @@ class InMemoryTranscriptStore:
             "segments": [_segment_to_api(s) for s in segments],
         }
 
-    async def get_transcript(self, user_id, platform, native_meeting_id) -> Optional[dict]:
+    async def get_transcript(self, user_id, platform, native_meeting_id, since=None) -> Optional[dict]:
         mid = self._find(user_id, platform, native_meeting_id)
         if mid is None:
             return None
-        return await self._transcript_doc(mid)
+        return _unindexed(await self._transcript_doc(mid), since)
 
-    async def get_transcript_by_id(self, user_id, meeting_id, member_workspaces=None) -> Optional[dict]:
+    async def get_transcript_by_id(self, user_id, meeting_id, member_workspaces=None, since=None) -> Optional[dict]:
         """Exact-row transcript authorized by owner OR transcript-viewer OR bound-workspace member (mirrors
         authorize_subscribe) — any other caller → ``None`` (a different tenant's row never leaks)."""
         try:
@@ -170,7 +179,7 @@ class InMemoryTranscriptStore:
             or user_id in (data.get("transcript_viewers") or [])
             or (bool(member_workspaces) and data.get("workspace_id") in member_workspaces)
         )
-        return await self._transcript_doc(mid) if authorized else None
+        return _unindexed(await self._transcript_doc(mid), since) if authorized else None
 
     async def list_meetings(self, user_id, *, status=None, platform=None, limit=None, offset=None,
                             member_workspaces=None, list_view=False, meeting_id=None, slim=False):
@@ -487,15 +496,25 @@ class InMemoryTranscriptStore:
             # Prod-topology mode: live segments land in the redis HASH (+ the db-writer's
             # active_meetings sweep set), exactly like SqlAlchemyTranscriptStore.append_segment;
             # only the db-writer tick moves them into the durable dict.
-            from .db_writer import ACTIVE_MEETINGS_KEY, segments_hash_key
+            from .db_writer import ACTIVE_MEETINGS_KEY, SEGMENTS_BY_UPDATED_KEY, segment_index_entry, segments_hash_key
 
             await self._redis.sadd(ACTIVE_MEETINGS_KEY, str(meeting_id))
             await self._redis.hset(
                 segments_hash_key(meeting_id), segment["segment_id"], json.dumps(segment)
             )
+            index = segment_index_entry(meeting_id, segment)
+            if index is not None:
+                await self._redis.zadd(SEGMENTS_BY_UPDATED_KEY, {index[0]: index[1]})
             return
         self._row_or_placeholder(meeting_id)["segments"][segment["segment_id"]] = segment
 
+    async def append_segments(self, meeting_id, segments) -> None:
+        """The batched ingest's one-write-per-meeting (``append_segment`` per segment here);
+        ``append_batches`` counts the calls for the ingest evals."""
+        self.append_batches += 1
+        for segment in segments:
+            await self.append_segment(meeting_id, segment)
+
     async def upsert_segments(self, meeting_id, segments) -> None:
         """The db-writer's durable sink (the dict stands in for the ``transcriptions`` table):
         upsert by ``segment_id`` — idempotent, a re-flush updates in place."""
@@ -505,6 +524,13 @@ class InMemoryTranscriptStore:
             if sid:
                 m["segments"][sid] = dict(seg)
 
+    async def upsert_segments_many(self, batches) -> None:
+        """The batched flush's sink — ``{meeting_id: [segment, ...]}`` in one call (one transaction
+        in the SQL store)."""
+        self.upsert_batches += 1
+        for meeting_id, segments in batches.items():
+            await self.upsert_segments(meeting_id, segments)
+
     async def processed_view_cursor(self, meeting_id, view_id) -> Optional[str]:
         from .adapters import _find_processed_view
 
@@ -13,6 +13,15 @@ This carve splits that into a pure, explicitly-driven core:
   * ``consume_segments(store, redis, ...)`` — drain a batch from the bus (``read_segments`` →
     ``ingest`` each → ``ack``). No background loop: the eval calls this explicitly, like the
     runtime scheduler's ``tick()`` — same in ⇒ same out.
+  * ``ingest_batch(store, redis, messages)`` — the micro-batched path (``COLLECTOR_INGEST_BATCHED``):
+    a whole XREADGROUP batch grouped by meeting — ONE store write (``append_segments``) and ONE
+    coalesced ``:mutable`` publish per meeting per batch, a rewrite of the same ``segment_id``
+    within the batch collapsing to its latest version — then one bulk ACK. ``ingest_stats``
+    carries the batch-size histogram and the read lag (age of the oldest entry in the batch).
+
+A segment's transcript.v1 ``trace`` rides THROUGH the collector, never into the store: it is
+stamped ``ingested_ms`` on decode and ``mutable_ms`` just before the ``:mutable`` publish, so the
+gateway can close the end-to-end latency at ``/ws``; the persisted rows are unchanged.
 
 The ``:mutable`` payload mirrors the bot's live publisher
 (``services/vexa-bot_new/src/adapters/transcript-redis.ts``):
@@ -48,6 +57,101 @@ RECLAIM_MIN_IDLE_MS = int(os.environ.get("COLLECTOR_RECLAIM_MIN_IDLE_MS", "60000
 # which re-registers on its very next XREADGROUP — is never mistaken for a ghost. The ``pending == 0``
 # guard is the load-bearing safety: a consumer still holding an in-flight batch is NEVER pruned.
 CONSUMER_TTL_MS = int(os.environ.get("COLLECTOR_CONSUMER_TTL_MS", str(30 * 60 * 1000)))
+# Micro-batched ingest (``ingest_batch``): off by default — the per-message path is the parent's.
+# When on, each consumer tick reads up to COLLECTOR_INGEST_BATCH_COUNT entries (vs the per-message
+# path's 10), and a FULL batch means the loop is behind, so it re-reads without the poll sleep.
+INGEST_BATCHED = os.environ.get("COLLECTOR_INGEST_BATCHED", "false").strip().lower() in ("1", "true", "yes", "on")
+INGEST_BATCH_COUNT = int(os.environ.get("COLLECTOR_INGEST_BATCH_COUNT", "200"))
+
+_BATCH_SIZE_BUCKETS = (1, 2, 5, 10, 25, 50, 100, 250, 500, 1000)
+_LATENCY_MS_BUCKETS = (5, 10, 25, 50, 100, 250, 500, 1000, 2500, 5000)
+# transcript.v1 ``Trace`` fields a producer may set (anything else on the object is dropped).
+_TRACE_FIELDS = ("captured_ms", "submitted_ms", "stt_queue_ms", "stt_decode_ms", "transcribed_ms", "published_ms")
+
+
+class IngestStats:
+    """Process-wide ingest counters served on ``/health`` (``pipeline.ingest``): batches, messages,
+    segments and ``:mutable`` publishes, a cumulative batch-size histogram (``le`` buckets), and
+    the read lag of the latest batch — how old its OLDEST entry was (from the stream id's ms).
+    Traced segments add two latency histograms: ``stream_ms`` (bot publish → collector decode) and
+    ``collector_ms`` (decode → ``:mutable`` publish)."""
+
+    def __init__(self) -> None:
+        self.reset()
+
+    def reset(self) -> None:
+        self.batches = 0
+        self.messages = 0
+        self.segments = 0
+        self.publishes = 0
+        self.last_batch_size = 0
+        self.last_lag_ms: Optional[int] = None
+        self.max_lag_ms = 0
+        self._buckets = [0] * len(_BATCH_SIZE_BUCKETS)
+        self._latency = {"stream_ms": [0] * len(_LATENCY_MS_BUCKETS), "collector_ms": [0] * len(_LATENCY_MS_BUCKETS)}
+        self._latency_count = {"stream_ms": 0, "collector_ms": 0}
+
+    def observe_batch(self, message_ids: list, now_ms: Optional[int] = None) -> None:
+        n = len(message_ids)
+        self.batches += 1
+        self.messages += n
+        self.last_batch_size = n
+        for i, le in enumerate(_BATCH_SIZE_BUCKETS):
+            if n <= le:
+                self._buckets[i] += 1
+        stamps = [ms for ms in map(_stream_id_ms, message_ids) if ms is not None]
+        if stamps:
+            now_ms = now_ms if now_ms is not None else int(datetime.now(timezone.utc).timestamp() * 1000)
+            self.last_lag_ms = max(0, now_ms - min(stamps))
+            self.max_lag_ms = max(self.max_lag_ms, self.last_lag_ms)
+
+    def observe_latency(self, stage: str, ms: float) -> None:
+        self._latency_count[stage] += 1
+        for i, le in enumerate(_LATENCY_MS_BUCKETS):
+            if ms <= le:
+                self._latency[stage][i] += 1
+
+    def observe_trace(self, trace: dict) -> None:
+        ingested = trace.get("ingested_ms")
+        if ingested is None:
+            return
+        if trace.get("published_ms") is not None:
+            self.observe_latency("stream_ms", max(0, ingested - trace["published_ms"]))
+        if trace.get("mutable_ms") is not None:
+            self.observe_latency("collector_ms", max(0, trace["mutable_ms"] - ingested))
+
+    def snapshot(self) -> dict:
+        return {
+            "batched": INGEST_BATCHED,
+            "batches": self.batches,
+            "messages": self.messages,
+            "segments": self.segments,
+            "publishes": self.publishes,
+            "last_batch_size": self.last_batch_size,
+            "batch_size": {str(le): c for le, c in zip(_BATCH_SIZE_BUCKETS, self._buckets)},
+            "last_lag_ms": self.last_lag_ms,
+            "max_lag_ms": self.max_lag_ms,
+            "latency_ms": {
+                stage: {
+                    "count": self._latency_count[stage],
+                    "buckets": {str(le): c for le, c in zip(_LATENCY_MS_BUCKETS, counts)},
+                }
+                for stage, counts in self._latency.items()
+            },
+        }
+
+
+ingest_stats = IngestStats()
+
+
+def _stream_id_ms(message_id) -> Optional[int]:
+    """The millisecond part of a stream id ``"<ms>-<seq>"`` (None when unparseable)."""
+    if isinstance(message_id, (bytes, bytearray)):
+        message_id = message_id.decode()
+    try:
+        return int(str(message_id).split("-", 1)[0])
+    except (TypeError, ValueError):
+        return None
 
 
 def _mutable_channel(meeting_id: int) -> str:
@@ -59,6 +163,30 @@ def _now_iso() -> str:
     return datetime.now(timezone.utc).isoformat().replace("+00:00", "Z")
 
 
+def _now_ms() -> int:
+    return int(datetime.now(timezone.utc).timestamp() * 1000)
+
+
+def _coerce_trace(raw) -> Optional[dict]:
+    """The producer's transcript.v1 ``trace`` (numeric fields only) stamped ``ingested_ms``; None
+    when the segment carries none."""
+    if not isinstance(raw, dict):
+        return None
+    trace = {
+        k: raw[k] for k in _TRACE_FIELDS
+        if isinstance(raw.get(k), (int, float)) and not isinstance(raw.get(k), bool)
+    }
+    trace["ingested_ms"] = _now_ms()
+    return trace
+
+
+def _stored(seg: dict) -> dict:
+    """The store's row for a segment — the live-only ``trace`` never reaches persistence."""
+    if "trace" not in seg:
+        return seg
+    return {k: v for k, v in seg.items() if k != "trace"}
+
+
 def _coerce_segment(raw: dict) -> Optional[dict]:
     """Validate + normalize one stream segment into the store's segment shape, or ``None`` when
     it is malformed (missing start/end/segment_id, or a zero-length COMPLETED segment) — the parent's
@@ -87,7 +215,7 @@ def _coerce_segment(raw: dict) -> Optional[dict]:
     segment_id = raw.get("segment_id")
     if not segment_id:
         return None
-    return {
+    seg = {
         "segment_id": segment_id,
         "start": start,
         "end": end,
@@ -100,6 +228,10 @@ def _coerce_segment(raw: dict) -> Optional[dict]:
         "absolute_end_time": raw.get("absolute_end_time"),
         "updated_at": _now_iso(),
     }
+    trace = _coerce_trace(raw.get("trace"))
+    if trace is not None:
+        seg["trace"] = trace
+    return seg
 
 
 def _transcript_stream(meeting_id: int) -> str:
@@ -153,117 +285,217 @@ def _log_publish_failure(meeting_id: int, e: Exception) -> None:
         pass
 
 
-async def ingest(store: TranscriptStore, redis: RedisBus, message: dict) -> int:
-    """Process ONE ``transcription_segments`` stream message.
-
-    ``message`` is the decoded stream fields (``{"payload": "<json>"}``). Parses the payload,
-    appends each valid segment to ``store``, then publishes one ``:mutable`` update per meeting
-    so the gateway ``/ws`` fan-in forwards it live. Returns the count of persisted segments.
-
-    Trusted internal stream (the bot is the producer): ``meeting_id`` comes from the payload.
-    """
+def _decode_payload(message: dict) -> Optional[dict]:
     payload_raw = message.get("payload")
     if not payload_raw:
-        return 0
+        return None
     try:
         data = json.loads(payload_raw) if isinstance(payload_raw, (str, bytes)) else payload_raw
     except (json.JSONDecodeError, ValueError):
-        return 0
+        return None
+    return data if isinstance(data, dict) else None
+
+
+def _session_end_meeting(data: dict) -> Optional[int]:
+    mid_raw = data.get("meeting_id")
+    try:
+        return int(mid_raw) if mid_raw is not None else None
+    except (TypeError, ValueError):
+        return None
+
 
-    msg_type = data.get("type", "transcription")
-    if msg_type == "session_end":
-        # P23/P0: the collector owns tc:meeting:{meeting_id} (the numeric ROW id, cross-tenant safe) —
-        # emit the session_end marker the copilot worker + terminal SSE read off it (the agent relay used
-        # to do this; the agent now only consumes). Key the marker by the numeric row id (never the
-        # native id, which collides across users/rows). The wire ``uid`` stays the native/session id for
-        # display. When no numeric id is present (an older bot that only sent a native/uid) there is no
-        # row to key on → skip; the copilot reaps on idle anyway.
-        mid_raw = data.get("meeting_id")
+async def _emit_session_end(redis: RedisBus, data: dict) -> None:
+    # P23/P0: the collector owns tc:meeting:{meeting_id} (the numeric ROW id, cross-tenant safe) —
+    # emit the session_end marker the copilot worker + terminal SSE read off it (the agent relay used
+    # to do this; the agent now only consumes). Key the marker by the numeric row id (never the
+    # native id, which collides across users/rows). The wire ``uid`` stays the native/session id for
+    # display. When no numeric id is present (an older bot that only sent a native/uid) there is no
+    # row to key on → skip; the copilot reaps on idle anyway.
+    meeting_id = _session_end_meeting(data)
+    if meeting_id is not None:
+        uid = data.get("native_meeting_id") or data.get("uid") or data.get("session_uid") or str(meeting_id)
         try:
-            meeting_id = int(mid_raw) if mid_raw is not None else None
-        except (TypeError, ValueError):
-            meeting_id = None
-        if meeting_id is not None:
-            uid = data.get("native_meeting_id") or data.get("uid") or data.get("session_uid") or str(meeting_id)
-            try:
-                await redis.xadd(_transcript_stream(meeting_id), {"type": "session_end", "uid": uid})
-            except Exception as e:  # noqa: BLE001 — best-effort; never abort the batch
-                _log_publish_failure(meeting_id, e)
-        return 0
-    if msg_type not in ("transcription", "transcript"):
-        # session_start / speaker events are out of scope for this segment unit.
-        return 0
+            await redis.xadd(_transcript_stream(meeting_id), {"type": "session_end", "uid": uid})
+        except Exception as e:  # noqa: BLE001 — best-effort; never abort the batch
+            _log_publish_failure(meeting_id, e)
 
+
+def _message_segments(data: dict) -> Optional["tuple[int, list[dict]]"]:
+    """A transcription message → ``(meeting_id, valid coerced segments)``; None for anything else
+    (session_start / speaker events are out of scope for this segment unit)."""
+    if data.get("type", "transcription") not in ("transcription", "transcript"):
+        return None
     try:
         meeting_id = int(data.get("meeting_id"))
     except (TypeError, ValueError):
-        return 0
-
+        return None
     raw_segments = data.get("segments")
     if not isinstance(raw_segments, list):
-        return 0
+        return None
+    return meeting_id, [seg for seg in (_coerce_segment(raw) for raw in raw_segments) if seg is not None]
 
-    persisted: list[dict] = []
-    for raw in raw_segments:
-        seg = _coerce_segment(raw)
-        if seg is None:
-            continue
-        await store.append_segment(meeting_id, seg)
-        persisted.append(seg)
 
-    if persisted:
-        # Publish a change-only mutable update (bot's live-path shape). ``confirmed`` carries the
-        # completed segments, ``pending`` the drafts — the dashboard renders both.
-        confirmed = [s for s in persisted if s["completed"]]
-        pending = [s for s in persisted if not s["completed"]]
-        speaker = persisted[0].get("speaker") or ""
-        # Stamp the NATIVE meeting id (and platform) so the agent-api live relay can re-key
-        # numeric→native WITHOUT a user-scoped /meetings lookup (which fails for any meeting not owned
-        # by the relay's bot key → segments never reach the terminal's native channel). The collector
-        # owns the mapping (it persists by meeting_id); best-effort — a miss leaves it numeric-only.
-        # PREFER the native id the producer STAMPED on the segment (P23: one writer, no re-derivation —
-        # and no DB lookup that can miss, which left tc:meeting:{native} empty and the copilot starved).
-        # Fall back to the store mapping only for older bots that don't stamp it.
-        native_id = data.get("native_meeting_id")
-        platform_native = data.get("platform")
-        if not native_id:
-            pair = await _resolve_native(store, meeting_id)
-            native_id, platform_native = pair if pair else (None, None)
-        # FAULT-ISOLATED (P18): the segments are already persisted (durable). A transient redis blip on
-        # the live publish must NOT propagate out of ingest() — that would abort the batch BEFORE
-        # consume_segments acks it. Surface it and return the persisted count.
-        try:
+async def _persist(store: TranscriptStore, meeting_id: int, segments: list[dict]) -> None:
+    """One store write for the meeting's segments when the store batches (``append_segments``),
+    else the per-segment ``append_segment`` calls."""
+    many = getattr(store, "append_segments", None)
+    if many is not None:
+        await many(meeting_id, [_stored(seg) for seg in segments])
+        return
+    for seg in segments:
+        await store.append_segment(meeting_id, _stored(seg))
+
+
+async def _publish_persisted(
+    store: TranscriptStore,
+    redis: RedisBus,
+    meeting_id: int,
+    persisted: list[dict],
+    native_id: Optional[str],
+    platform_native: Optional[str],
+) -> None:
+    # Publish change-only mutable updates (bot's live-path shape: ONE speaker per message, so a
+    # coalesced batch spanning speakers splits into one update per speaker, first-seen order).
+    # ``confirmed`` carries the completed segments, ``pending`` the drafts — the dashboard renders both.
+    by_speaker: dict[str, list[dict]] = {}
+    for seg in persisted:
+        by_speaker.setdefault(seg.get("speaker") or "", []).append(seg)
+    # Stamp the NATIVE meeting id (and platform) so the agent-api live relay can re-key
+    # numeric→native WITHOUT a user-scoped /meetings lookup (which fails for any meeting not owned
+    # by the relay's bot key → segments never reach the terminal's native channel). The collector
+    # owns the mapping (it persists by meeting_id); best-effort — a miss leaves it numeric-only.
+    # PREFER the native id the producer STAMPED on the segment (P23: one writer, no re-derivation —
+    # and no DB lookup that can miss, which left tc:meeting:{native} empty and the copilot starved).
+    # Fall back to the store mapping only for older bots that don't stamp it.
+    if not native_id:
+        pair = await _resolve_native(store, meeting_id)
+        native_id, platform_native = pair if pair else (None, None)
+    # FAULT-ISOLATED (P18): the segments are already persisted (durable). A transient redis blip on
+    # the live publish must NOT propagate out of ingest() — that would abort the batch BEFORE
+    # consume_segments acks it. Surface it and return the persisted count.
+    try:
+        # The trace's last collector hop, stamped as late as possible — right before the publish.
+        mutable_ms = _now_ms()
+        for seg in persisted:
+            if "trace" in seg:
+                seg["trace"]["mutable_ms"] = mutable_ms
+                ingest_stats.observe_trace(seg["trace"])
+        for speaker, segs in by_speaker.items():
             await redis.publish(
                 _mutable_channel(meeting_id),
                 json.dumps({
                     "type": "transcript",
                     "meeting": {"id": meeting_id, "native_id": native_id, "platform": platform_native},
                     "speaker": speaker,
-                    "confirmed": confirmed,
-                    "pending": pending,
+                    "confirmed": [s for s in segs if s["completed"]],
+                    "pending": [s for s in segs if not s["completed"]],
                     "ts": _now_iso(),
                 }),
             )
-        except Exception as e:  # noqa: BLE001 — publish is best-effort; persistence already succeeded
+            ingest_stats.publishes += 1
+    except Exception as e:  # noqa: BLE001 — publish is best-effort; persistence already succeeded
+        _log_publish_failure(meeting_id, e)
+    # P23/P0: the collector is the SINGLE writer of the transcript feed tc:meeting:{meeting_id}
+    # (the numeric ROW id — cross-tenant safe; the native id collided across users/rows). Append each
+    # persisted segment (confirmed + pending, in order) for the copilot worker + terminal SSE. Written
+    # unconditionally now (no longer gated on native resolution — the row id is always in scope). The
+    # native id still rides in the wire payload for DISPLAY. Empty-text segments are skipped.
+    stream = _transcript_stream(meeting_id)
+    wire_uid = native_id or str(meeting_id)
+    for seg in persisted:
+        if not (seg.get("text") or "").strip():
+            continue
+        try:
+            await redis.xadd(stream, _to_native_wire(wire_uid, seg))
+        except Exception as e:  # noqa: BLE001 — best-effort; persistence already succeeded
             _log_publish_failure(meeting_id, e)
-        # P23/P0: the collector is the SINGLE writer of the transcript feed tc:meeting:{meeting_id}
-        # (the numeric ROW id — cross-tenant safe; the native id collided across users/rows). Append each
-        # persisted segment (confirmed + pending, in order) for the copilot worker + terminal SSE. Written
-        # unconditionally now (no longer gated on native resolution — the row id is always in scope). The
-        # native id still rides in the wire payload for DISPLAY. Empty-text segments are skipped.
-        stream = _transcript_stream(meeting_id)
-        wire_uid = native_id or str(meeting_id)
-        for seg in persisted:
-            if not (seg.get("text") or "").strip():
-                continue
-            try:
-                await redis.xadd(stream, _to_native_wire(wire_uid, seg))
-            except Exception as e:  # noqa: BLE001 — best-effort; persistence already succeeded
-                _log_publish_failure(meeting_id, e)
 
+
+async def ingest(store: TranscriptStore, redis: RedisBus, message: dict) -> int:
+    """Process ONE ``transcription_segments`` stream message.
+
+    ``message`` is the decoded stream fields (``{"payload": "<json>"}``). Parses the payload,
+    appends each valid segment to ``store``, then publishes one ``:mutable`` update per meeting
+    so the gateway ``/ws`` fan-in forwards it live. Returns the count of persisted segments.
+
+    Trusted internal stream (the bot is the producer): ``meeting_id`` comes from the payload.
+    """
+    data = _decode_payload(message)
+    if data is None:
+        return 0
+    if data.get("type") == "session_end":
+        await _emit_session_end(redis, data)
+        return 0
+    parsed = _message_segments(data)
+    if parsed is None:
+        return 0
+    meeting_id, segments = parsed
+    persisted: list[dict] = []
+    for seg in segments:
+        await store.append_segment(meeting_id, _stored(seg))
+        persisted.append(seg)
+    if persisted:
+        ingest_stats.segments += len(persisted)
+        await _publish_persisted(
+            store, redis, meeting_id, persisted, data.get("native_meeting_id"), data.get("platform"),
+        )
     return len(persisted)
 
 
+class _MeetingBatch:
+    """One meeting's share of an ingest batch: segments keyed by id (a later rewrite replaces the
+    earlier version in place, first-seen order kept) + the latest stamped native id / platform."""
+
+    __slots__ = ("segments", "native_id", "platform")
+
+    def __init__(self) -> None:
+        self.segments: dict = {}
+        self.native_id: Optional[str] = None
+        self.platform: Optional[str] = None
+
+
+async def ingest_batch(store: TranscriptStore, redis: RedisBus, messages: list) -> int:
+    """Process a whole batch of stream messages (decoded fields, stream order) grouped by meeting:
+    ONE store write and ONE coalesced ``:mutable`` publish per meeting and speaker. A ``session_end`` first
+    flushes that meeting's group so the marker still lands AFTER its segments on the transcript
+    feed. Returns the count of distinct segments persisted."""
+    groups: dict[int, _MeetingBatch] = {}
+
+    async def flush(meeting_id: int) -> int:
+        group = groups.pop(meeting_id, None)
+        if group is None or not group.segments:
+            return 0
+        persisted = list(group.segments.values())
+        await _persist(store, meeting_id, persisted)
+        ingest_stats.segments += len(persisted)
+        await _publish_persisted(store, redis, meeting_id, persisted, group.native_id, group.platform)
+        return len(persisted)
+
+    total = 0
+    for message in messages:
+        data = _decode_payload(message)
+        if data is None:
+            continue
+        if data.get("type") == "session_end":
+            meeting_id = _session_end_meeting(data)
+            if meeting_id is not None:
+                total += await flush(meeting_id)
+            await _emit_session_end(redis, data)
+            continue
+        parsed = _message_segments(data)
+        if parsed is None:
+            continue
+        meeting_id, segments = parsed
+        group = groups.setdefault(meeting_id, _MeetingBatch())
+        for seg in segments:
+            group.segments[seg["segment_id"]] = seg
+        if data.get("native_meeting_id"):
+            group.native_id, group.platform = data.get("native_meeting_id"), data.get("platform")
+    for meeting_id in list(groups):
+        total += await flush(meeting_id)
+    return total
+
+
 async def consume_segments(
     store: TranscriptStore,
     redis: RedisBus,
@@ -271,18 +503,33 @@ async def consume_segments(
     stream: str = STREAM_NAME,
     group: str = CONSUMER_GROUP,
     consumer: str = CONSUMER_NAME,
-    count: int = 10,
+    count: Optional[int] = None,
+    batched: Optional[bool] = None,
 ) -> int:
     """Drain ONE batch from the bus: read → ingest each → ack. Returns the total segments
-    persisted across the batch. No background loop — the caller drives it (eval ``tick``)."""
+    persisted across the batch. No background loop — the caller drives it (eval ``tick``).
+
+    ``batched`` (default ``INGEST_BATCHED``) ingests the read as one ``ingest_batch``; ``count``
+    defaults to 10 per-message, ``INGEST_BATCH_COUNT`` batched."""
+    batched = INGEST_BATCHED if batched is None else batched
+    if count is None:
+        count = INGEST_BATCH_COUNT if batched else 10
     batch = await redis.read_segments(group=group, consumer=consumer, stream=stream, count=count)
-    total = 0
-    acked: list[str] = []
-    for message_id, fields in batch:
-        total += await ingest(store, redis, fields)
-        acked.append(message_id)
-    if acked:
-        await redis.ack(group=group, stream=stream, message_ids=acked)
+    return await _ingest_and_ack(store, redis, batch, stream=stream, group=group, batched=batched)
+
+
+async def _ingest_and_ack(store, redis, batch, *, stream: str, group: str, batched: bool) -> int:
+    if not batch:
+        return 0
+    acked = [message_id for message_id, _ in batch]
+    ingest_stats.observe_batch(acked)
+    if batched:
+        total = await ingest_batch(store, redis, [fields for _, fields in batch])
+    else:
+        total = 0
+        for _, fields in batch:
+            total += await ingest(store, redis, fields)
+    await redis.ack(group=group, stream=stream, message_ids=acked)
     return total
 
 
@@ -311,13 +558,7 @@ async def reclaim_segments(
     reclaimed = await redis.reclaim_orphans(
         group=group, stream=stream, consumer=consumer, min_idle_ms=min_idle_ms, count=count
     )
-    total = 0
-    acked: list[str] = []
-    for message_id, fields in reclaimed:
-        total += await ingest(store, redis, fields)
-        acked.append(message_id)
-    if acked:
-        await redis.ack(group=group, stream=stream, message_ids=acked)
+    total = await _ingest_and_ack(store, redis, reclaimed, stream=stream, group=group, batched=INGEST_BATCHED)
     # #660: same sweep, second sub-step — prune abandoned per-recreate ghost consumers so the group
     # tracks only live replicas. Kept AFTER the reclaim so we never delete a consumer whose orphaned
     # batch we might still be draining this tick.
@@ -30,15 +30,20 @@ class TranscriptStore(Protocol):
     home — there is NO separate recordings table)."""
 
     async def get_transcript(
-        self, user_id: int, platform: str, native_meeting_id: str
+        self, user_id: int, platform: str, native_meeting_id: str, since: Optional[float] = None
     ) -> Optional[dict]:
         """The transcript document for ``(user, platform, native_id)`` — an api.v1
         ``TranscriptionResponse``-shaped dict (id, platform, status, start/end, segments[], …),
-        or ``None`` when the user owns no such meeting (the route maps ``None`` → 404)."""
+        or ``None`` when the user owns no such meeting (the route maps ``None`` → 404).
+
+        ``since`` (a prior response's ``cursor``) asks for only the segments changed after it:
+        ``delta: true`` when the store's change index covers it (``changes.py``), else the full
+        document with ``delta: false``. An indexed store adds ``cursor`` to every response."""
         ...
 
     async def get_transcript_by_id(
-        self, user_id: int, meeting_id: int, member_workspaces: "Optional[set[str]]" = None
+        self, user_id: int, meeting_id: int, member_workspaces: "Optional[set[str]]" = None,
+        since: Optional[float] = None,
     ) -> Optional[dict]:
         """The transcript document for a SPECIFIC meeting ROW (``meeting.id``), authorized by owner OR
         transcript-share viewer OR bound-workspace member (``member_workspaces``) — the same api.v1
@@ -0,0 +1,117 @@
+"""Reconcile deadline index — the next time each non-terminal meeting is worth examining.
+
+The general reconcile sweep (``reconcile.py``) used to list EVERY non-terminal meeting each
+``STOP_RECONCILE_INTERVAL_S`` and re-probe every stale one with ``get_workload`` — O(active meetings)
+per tick, and a quiet-but-live bot was re-probed every 15s for as long as it sat in a silent room.
+The index turns that into O(due): one redis sorted set, member = meeting id, score = the epoch
+second the meeting becomes a reconcile candidate.
+
+  * **armed on every persisted status change** (``note``) — the lifecycle callback and the stop route
+    re-arm the meeting at ``now + reconcile_grace_for_status(status)`` (the SAME per-status window the
+    SQL listing applies to ``updated_at``); a terminal status removes it.
+  * **woken by workload exits** (``wake``) — the runtime kernel's exit callback makes an affected
+    meeting due NOW and marks it woken (``meeting:reconcile:due:woken``), so a bot that died is
+    examined on the next due pass (seconds), not a grace later. The mark is the exit evidence: a
+    woken row skips the sweep's staleness gate and goes straight to the workload probe — a
+    fresh ``updated_at`` (a segment burst just before the crash) must not defer it a grace.
+  * **deferred by the sweep's own verdicts** (``arm_many``) — a live workload comes back after the
+    alive re-check window (its exit will wake it sooner); an unconfirmed teardown or an untracked
+    workload after one tick (today's retry cadence, so the continuous-untracked window stays exact).
+
+The index is a HINT, never the truth. The sweep still re-reads every due row from Postgres and
+applies the same staleness + liveness gates, and a periodic FULL pass (startup + every
+``RECONCILE_FULL_SWEEP_INTERVAL_S``) re-derives every deadline from the rows and drops strays — so a
+missed ``note`` (redis blip, a replica killed mid-callback) only delays a reconcile, never loses one.
+Scores are wall-clock epoch seconds because the set is shared by every meeting-api replica.
+"""
+from __future__ import annotations
+
+import time
+from typing import Any, Callable, Iterable, Optional
+
+from ..bot_spawn.ports import reconcile_grace_for_status
+
+DEADLINES_KEY = "meeting:reconcile:due"
+
+_TERMINAL_STATUSES = frozenset({"completed", "failed"})
+_WOKEN_SUFFIX = ":woken"     # set of meeting ids a workload exit woke, cleared once examined
+
+
+class ReconcileDeadlines:
+    """The deadline index over an async redis client (``zadd`` / ``zrem`` / ``zrangebyscore`` /
+    ``pipeline``). The graces are the sweep's own, so an armed deadline and the listing's staleness
+    test agree on when a row is due."""
+
+    def __init__(
+        self,
+        redis: Any,
+        *,
+        stop_grace: float,
+        active_grace: float,
+        preactive_grace: Optional[float] = None,
+        key: str = DEADLINES_KEY,
+        clock: Callable[[], float] = time.time,
+    ):
+        self._r = redis
+        self.stop_grace = stop_grace
+        self.active_grace = active_grace
+        self.preactive_grace = preactive_grace
+        self.key = key
+        self.woken_key = key + _WOKEN_SUFFIX
+        self._clock = clock
+
+    def now(self) -> float:
+        return self._clock()
+
+    def grace_for(self, status: Optional[str]) -> float:
+        return reconcile_grace_for_status(
+            status, self.stop_grace, self.active_grace, self.preactive_grace
+        )
+
+    async def note(self, meeting_id: Any, status: Optional[str]) -> None:
+        """A status was just persisted for ``meeting_id``: re-arm it one grace out, or drop it once
+        terminal (nothing left to reconcile)."""
+        if status in _TERMINAL_STATUSES:
+            pipe = self._r.pipeline(transaction=False)
+            pipe.zrem(self.key, str(meeting_id))
+            pipe.srem(self.woken_key, str(meeting_id))
+            await pipe.execute()
+        else:
+            await self._r.zadd(self.key, {str(meeting_id): self.now() + self.grace_for(status)})
+
+    async def wake(self, meeting_id: Any) -> None:
+        """Make ``meeting_id`` due now and mark it woken — its workload just reported an exit."""
+        pipe = self._r.pipeline(transaction=False)
+        pipe.zadd(self.key, {str(meeting_id): self.now()})
+        pipe.sadd(self.woken_key, str(meeting_id))
+        await pipe.execute()
+
+    async def woken(self) -> set[int]:
+        """The meeting ids an exit woke that no sweep has examined since."""
+        return {int(m) for m in await self._r.smembers(self.woken_key)}
+
+    async def due(self, *, limit: int) -> list[int]:
+        """Up to ``limit`` meeting ids whose deadline has passed, most overdue first."""
+        members = await self._r.zrangebyscore(self.key, "-inf", self.now(), start=0, num=limit)
+        return [int(m) for m in members]
+
+    async def arm_many(self, deadlines: dict, *, forget: Iterable[Any] = (),
+                       examined: Iterable[Any] = ()) -> None:
+        """Apply one pass's verdicts in a single round trip: ``{meeting_id: epoch}`` re-arms,
+        ``forget`` drops ids that are terminal or gone, and ``examined`` clears the woken mark of
+        ids the pass probed."""
+        drop = [str(m) for m in forget]
+        seen = sorted({str(m) for m in examined} | set(drop))
+        if not deadlines and not seen:
+            return
+        pipe = self._r.pipeline(transaction=False)
+        if deadlines:
+            pipe.zadd(self.key, {str(m): at for m, at in deadlines.items()})
+        if drop:
+            pipe.zrem(self.key, *drop)
+        if seen:
+            pipe.srem(self.woken_key, *seen)
+        await pipe.execute()
+
+    async def members(self) -> list[int]:
+        return [int(m) for m in await self._r.zrange(self.key, 0, -1)]
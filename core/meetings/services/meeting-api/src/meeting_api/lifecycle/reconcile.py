@@ -291,103 +291,240 @@ async def reconcile_stale_nonterminal_sweep(
     except Exception:
         log.exception("nonterminal-reconcile: list_stale_nonterminal failed")
         return 0
-    reconciled = 0
     tracker = _UNTRACKED_SINCE if untracked_since is None else untracked_since
     seen_untracked: set = set()
     now = time.monotonic()
-    for meeting_id, status, session_uid, bot_container_id, stop_requested in stale:
-        probe, probe_info = "unknown", None
-        # LIVENESS GATE (the correctness fix): for a status where a bot may be alive and legitimately
-        # QUIET — in the meeting (`active`/`needs_help`) or on its way in (`requested`/`joining`/
-        # `awaiting_admission`) — `updated_at` staleness is NOT evidence the bot is gone. Segments
-        # stop bumping it through a silent room, and a lobby bot emits `awaiting_admission` ONCE and
-        # then polls silently for the whole budget we handed it (#862: the sweep force-deleted
-        # HEALTHY bots that were still waiting to be let in, at 300s of a 600s wait). Only POSITIVE
-        # evidence ("gone": the kernel TRACKS the workload and reports it terminal) reaps. A 404
-        # ("untracked") is NOT evidence — a recreated runtime forgets live bots (the orphaned-live-bot
-        # incident advanced a live, capturing meeting to `completed` on exactly that 404). `stopping`
-        # is exempt (a stop was requested → it converges on its grace, gated on a CONFIRMED teardown
-        # below).
-        if status in _LIVENESS_GATED and bot_container_id:
-            probe, probe_info = await _probe_bot_workload(runtime, bot_container_id, log=log)
-            if probe == "untracked":
-                _log_workload_untracked(meeting_id, status, bot_container_id)
-                log.error(
-                    "nonterminal-reconcile: runtime does not know workload %s for %s meeting %s — "
-                    "NOT evidence the bot is gone; not reaping (waiting for runtime re-adoption / "
-                    "the bot's own callback)",
-                    bot_container_id, status, meeting_id,
-                )
-                # BOUNDED (the zombie-loop fix): once the meeting has been CONTINUOUSLY untracked
-                # past the escalation window — no re-adoption, no bot callback — it converges to
-                # `failed` with the evidence note instead of looping this error forever.
-                if _untracked_window_elapsed(
-                    tracker, meeting_id, seen_untracked, grace=untracked_grace, now=now
-                ) and await _escalate_untracked_zombie(
-                    meeting_id, status, session_uid, bot_container_id, post_lifecycle,
-                    tracker, grace=untracked_grace, log=log, stop_requested=stop_requested,
-                ):
-                    reconciled += 1
-                continue
-            if probe != "gone":
-                # ALIVE or UNKNOWN → do not reap a possibly-live, bot-present meeting.
-                # (No bot_container_id at all falls through to the time-based reap — there is no
-                #  live workload that could be holding the meeting open.)
-                log.info("nonterminal-reconcile: skip live/unknown bot for meeting %s "
-                         "(status %s, workload %s, probe=%s)",
-                         meeting_id, status, bot_container_id, probe)
-                continue
-        # GUARANTEE teardown BEFORE the FSM advances (CC6 + the incident fix): a terminal meeting
-        # must never leave a live container behind. Unconfirmed (runtime 404 / delete failure) →
-        # the meeting keeps its current status, loud in the logs, retried next sweep — except a
-        # CONTINUOUSLY untracked workload (`stopping`/pre-active rows land here), which escalates
-        # on the same bounded window instead of retrying the dead DELETE every sweep forever.
-        verdict = await _teardown_verdict(
-            runtime, bot_container_id, meeting_id=meeting_id, log=log
-        )
-        if verdict != "confirmed":
-            if verdict == "untracked" and _untracked_window_elapsed(
+    reconciled = 0
+    for row in stale:
+        if await _reconcile_one(
+            row, runtime, post_lifecycle, tracker, seen_untracked,
+            untracked_grace=untracked_grace, now=now, log=log,
+        ) == "reconciled":
+            reconciled += 1
+    # RECOVERY resets the window: any meeting NOT observed untracked in THIS sweep — the runtime
+    # re-adopted it (probe alive/gone), a bot callback bumped/terminated the row (no longer listed
+    # stale), or it was reconciled — drops its tracker entry. Only CONTINUOUS untracked escalates.
+    for mid in [m for m in tracker if m not in seen_untracked]:
+        tracker.pop(mid, None)
+    return reconciled
+
+
+async def _reconcile_one(
+    row: tuple,
+    runtime: Optional[Any],
+    post_lifecycle: Callable[[dict], Awaitable[Any]],
+    tracker: dict,
+    seen_untracked: set,
+    *,
+    untracked_grace: float,
+    now: float,
+    log: Any,
+) -> str:
+    """Reconcile ONE stale non-terminal row; returns the outcome the indexed sweep re-arms on:
+
+      * ``"reconciled"`` — a terminal was posted (including a bounded untracked escalation).
+      * ``"alive"``      — the liveness gate held: the workload is alive, or the probe inconclusive.
+      * ``"retry"``      — untracked, an unconfirmed teardown, or the terminal post failed: the same
+                           row must be looked at again on the next tick.
+    """
+    meeting_id, status, session_uid, bot_container_id, stop_requested = row
+    probe, probe_info = "unknown", None
+    # LIVENESS GATE (the correctness fix): for a status where a bot may be alive and legitimately
+    # QUIET — in the meeting (`active`/`needs_help`) or on its way in (`requested`/`joining`/
+    # `awaiting_admission`) — `updated_at` staleness is NOT evidence the bot is gone. Segments
+    # stop bumping it through a silent room, and a lobby bot emits `awaiting_admission` ONCE and
+    # then polls silently for the whole budget we handed it (#862: the sweep force-deleted
+    # HEALTHY bots that were still waiting to be let in, at 300s of a 600s wait). Only POSITIVE
+    # evidence ("gone": the kernel TRACKS the workload and reports it terminal) reaps. A 404
+    # ("untracked") is NOT evidence — a recreated runtime forgets live bots (the orphaned-live-bot
+    # incident advanced a live, capturing meeting to `completed` on exactly that 404). `stopping`
+    # is exempt (a stop was requested → it converges on its grace, gated on a CONFIRMED teardown
+    # below).
+    if status in _LIVENESS_GATED and bot_container_id:
+        probe, probe_info = await _probe_bot_workload(runtime, bot_container_id, log=log)
+        if probe == "untracked":
+            _log_workload_untracked(meeting_id, status, bot_container_id)
+            log.error(
+                "nonterminal-reconcile: runtime does not know workload %s for %s meeting %s — "
+                "NOT evidence the bot is gone; not reaping (waiting for runtime re-adoption / "
+                "the bot's own callback)",
+                bot_container_id, status, meeting_id,
+            )
+            # BOUNDED (the zombie-loop fix): once the meeting has been CONTINUOUSLY untracked
+            # past the escalation window — no re-adoption, no bot callback — it converges to
+            # `failed` with the evidence note instead of looping this error forever.
+            if _untracked_window_elapsed(
                 tracker, meeting_id, seen_untracked, grace=untracked_grace, now=now
             ) and await _escalate_untracked_zombie(
                 meeting_id, status, session_uid, bot_container_id, post_lifecycle,
                 tracker, grace=untracked_grace, log=log, stop_requested=stop_requested,
             ):
-                reconciled += 1
-            continue
-        terminal = "failed" if status in _PRE_ACTIVE_NONTERMINAL else "completed"
-        body: dict[str, Any] = {"connection_id": session_uid, "status": terminal}
-        if terminal == "completed":
-            body["completion_reason"] = "stopped" if stop_requested else "left_alone"
-            if stop_requested:
-                body["data"] = {"stop_requested": True}
+                return "reconciled"
+            return "retry"
+        if probe != "gone":
+            # ALIVE or UNKNOWN → do not reap a possibly-live, bot-present meeting.
+            # (No bot_container_id at all falls through to the time-based reap — there is no
+            #  live workload that could be holding the meeting open.)
+            log.info("nonterminal-reconcile: skip live/unknown bot for meeting %s "
+                     "(status %s, workload %s, probe=%s)",
+                     meeting_id, status, bot_container_id, probe)
+            return "alive"
+    # GUARANTEE teardown BEFORE the FSM advances (CC6 + the incident fix): a terminal meeting
+    # must never leave a live container behind. Unconfirmed (runtime 404 / delete failure) →
+    # the meeting keeps its current status, loud in the logs, retried next sweep — except a
+    # CONTINUOUSLY untracked workload (`stopping`/pre-active rows land here), which escalates
+    # on the same bounded window instead of retrying the dead DELETE every sweep forever.
+    verdict = await _teardown_verdict(
+        runtime, bot_container_id, meeting_id=meeting_id, log=log
+    )
+    if verdict != "confirmed":
+        if verdict == "untracked" and _untracked_window_elapsed(
+            tracker, meeting_id, seen_untracked, grace=untracked_grace, now=now
+        ) and await _escalate_untracked_zombie(
+            meeting_id, status, session_uid, bot_container_id, post_lifecycle,
+            tracker, grace=untracked_grace, log=log, stop_requested=stop_requested,
+        ):
+            return "reconciled"
+        return "retry"
+    terminal = "failed" if status in _PRE_ACTIVE_NONTERMINAL else "completed"
+    body: dict[str, Any] = {"connection_id": session_uid, "status": terminal}
+    if terminal == "completed":
+        body["completion_reason"] = "stopped" if stop_requested else "left_alone"
+        if stop_requested:
+            body["data"] = {"stop_requested": True}
+    else:
+        # ATTRIBUTE, never manufacture (#862). The reason is DERIVED from the stage the bot
+        # died in, and the note carries the probe's own answer (workload state, exit code) —
+        # the only things this sweep actually knows. A default of `left_alone` would be a claim
+        # with no evidence behind it (the sweep issued the delete itself), and `left_alone` is
+        # `_PERMANENT` in ``retry.py``, so it would also cancel the legitimate re-spawn.
+        body["completion_reason"] = _pre_active_completion_reason(status, stop_requested)
+        body["reason"] = (
+            f"{_workload_evidence(bot_container_id, probe_info)}; "
+            f"reconciled to failed at {status} (never reached active)"
+        )
+        if stop_requested:
+            body["data"] = {"stop_requested": True}
+    try:
+        result = await post_lifecycle(body)
+        log.info("nonterminal-reconcile %s meeting %s (status %s, session %s) → %s",
+                 terminal, meeting_id, status, session_uid, result)
+        return "reconciled"
+    except Exception:
+        log.exception("nonterminal-reconcile failed for meeting %s (status %s)", meeting_id, status)
+        return "retry"
+
+
+async def reconcile_due_nonterminal_sweep(
+    repo: Any,
+    runtime: Optional[Any],
+    post_lifecycle: Callable[[dict], Awaitable[Any]],
+    deadlines: Any,
+    *,
+    stop_grace: float,
+    active_grace: float,
+    log: Any,
+    preactive_grace: Optional[float] = None,
+    untracked_grace: float = 600.0,
+    untracked_since: Optional[dict] = None,
+    full: bool = False,
+    retry_after: float = 15.0,
+    alive_recheck: float = 300.0,
+    limit: int = 200,
+) -> int:
+    """The general backstop driven by the deadline index (``deadlines.ReconcileDeadlines``): examine
+    only the meetings whose deadline has passed, with the SAME per-row gates as
+    ``reconcile_stale_nonterminal_sweep`` (``_reconcile_one``), then re-arm each by its verdict.
+
+    A pass reads at most ``limit`` due ids and re-reads just those rows from the repo
+    (``list_reconcile_candidates(meeting_ids=…)``) — nothing due, no DB query at all. Per row:
+    terminal/gone → dropped from the index; not yet stale (the row was bumped since it was armed) →
+    re-armed at its real deadline (``updated_at + grace``); stale → ``_reconcile_one``, then
+    ``"alive"`` waits ``alive_recheck`` (the runtime's exit callback wakes it sooner) and
+    ``"retry"`` comes back after ``retry_after`` (one tick — the cadence the unindexed sweep retried
+    at, so the continuous-untracked window measures the same thing). A row an exit WOKE
+    (``deadlines.wake``) carries its own evidence: when its status is liveness-gated and it names a
+    workload it skips the staleness gate and is probed now — a row bumped just before its bot
+    died is reaped on the probe's "gone", not a grace later. Its woken mark is cleared once probed.
+
+    ``full=True`` lists EVERY non-terminal row instead (startup + the periodic backstop): it
+    reconciles whatever is stale, re-derives every other row's deadline from the rows, and drops
+    index members that are no longer non-terminal — the index converges even after a missed ``note``.
+
+    Returns the number of meetings reconciled. Best-effort per meeting — never raises."""
+    if repo is None or deadlines is None or not hasattr(repo, "list_reconcile_candidates"):
+        return 0
+    graces = dict(stop_grace=stop_grace, active_grace=active_grace,
+                  preactive_grace=active_grace if preactive_grace is None else preactive_grace)
+    try:
+        due_ids = None if full else await deadlines.due(limit=limit)
+        if due_ids is not None and not due_ids:
+            return 0
+        rows = await repo.list_reconcile_candidates(**graces, meeting_ids=due_ids)
+        indexed = await deadlines.members() if full else due_ids
+        woken = await deadlines.woken() if hasattr(deadlines, "woken") else set()
+    except Exception:
+        log.exception("nonterminal-reconcile: deadline index / candidate listing failed")
+        return 0
+    wall = deadlines.now()
+    listed = {row[0] for row in rows}
+    rearm: dict[Any, float] = {}
+    stale = []
+    for row in rows:
+        if row[5] > wall and not (row[0] in woken and row[1] in _LIVENESS_GATED and row[3]):
+            rearm[row[0]] = row[5]
         else:
-            # ATTRIBUTE, never manufacture (#862). The reason is DERIVED from the stage the bot
-            # died in, and the note carries the probe's own answer (workload state, exit code) —
-            # the only things this sweep actually knows. A default of `left_alone` would be a claim
-            # with no evidence behind it (the sweep issued the delete itself), and `left_alone` is
-            # `_PERMANENT` in ``retry.py``, so it would also cancel the legitimate re-spawn.
-            body["completion_reason"] = _pre_active_completion_reason(status, stop_requested)
-            body["reason"] = (
-                f"{_workload_evidence(bot_container_id, probe_info)}; "
-                f"reconciled to failed at {status} (never reached active)"
-            )
-            if stop_requested:
-                body["data"] = {"stop_requested": True}
-        try:
-            result = await post_lifecycle(body)
+            stale.append(row[:5])
+    tracker = _UNTRACKED_SINCE if untracked_since is None else untracked_since
+    seen_untracked: set = set()
+    now = time.monotonic()
+    reconciled = 0
+    done: list = []
+    for row in stale:
+        outcome = await _reconcile_one(
+            row, runtime, post_lifecycle, tracker, seen_untracked,
+            untracked_grace=untracked_grace, now=now, log=log,
+        )
+        if outcome == "reconciled":
             reconciled += 1
-            log.info("nonterminal-reconcile %s meeting %s (status %s, session %s) → %s",
-                     terminal, meeting_id, status, session_uid, result)
-        except Exception:
-            log.exception("nonterminal-reconcile failed for meeting %s (status %s)", meeting_id, status)
-    # RECOVERY resets the window: any meeting NOT observed untracked in THIS sweep — the runtime
-    # re-adopted it (probe alive/gone), a bot callback bumped/terminated the row (no longer listed
-    # stale), or it was reconciled — drops its tracker entry. Only CONTINUOUS untracked escalates.
-    for mid in [m for m in tracker if m not in seen_untracked]:
+            done.append(row[0])
+        else:
+            rearm[row[0]] = wall + (alive_recheck if outcome == "alive" else retry_after)
+    try:
+        await deadlines.arm_many(
+            rearm, forget=[m for m in indexed if m not in listed] + done,
+            examined=[row[0] for row in stale if row[0] in woken],
+        )
+    except Exception:
+        log.exception("nonterminal-reconcile: deadline index update failed")
+    # RECOVERY resets the window — but only for meetings this pass actually LOOKED at: a meeting
+    # that is simply not due yet has shown no recovery, and its window must keep running.
+    examined = {row[0] for row in stale} if not full else set(tracker)
+    for mid in [m for m in tracker if m in examined and m not in seen_untracked]:
         tracker.pop(mid, None)
     return reconciled
 
 
+async def wake_for_exited_workload(
+    repo: Any, deadlines: Any, workload_id: Optional[str], state: Optional[str], *, log: Any
+) -> bool:
+    """The runtime kernel reported ``workload_id`` in a TERMINAL state but its meeting is still
+    non-terminal (the synthetic terminal did not land — a transient persist failure, or a state the
+    synthesizer does not drive): make the meeting due NOW, so the next due pass examines it in
+    seconds instead of a grace window later. Returns True iff a meeting was woken. Never raises."""
+    if deadlines is None or repo is None or not workload_id or state not in TERMINAL_WORKLOAD_STATES:
+        return False
+    try:
+        info = await repo.find_by_container(bot_container_id=workload_id)
+        if not info or info.get("status") in ("completed", "failed") or info.get("meeting_id") is None:
+            return False
+        await deadlines.wake(info["meeting_id"])
+        return True
+    except Exception as e:  # noqa: BLE001 — the periodic full pass remains the backstop
+        log.warning("runtime-callback: could not wake the reconcile deadline for %s: %s", workload_id, e)
+        return False
+
+
 def _log_orphan_kill_failed(meeting_id, workload_id, err, *, unconfirmed: bool = False) -> None:
     try:
         from ..obs import log_event
@@ -20,7 +20,7 @@ from __future__ import annotations
 import json
 from typing import Any, Optional, Protocol, runtime_checkable
 
-from fastapi import APIRouter, Header, HTTPException
+from fastapi import APIRouter, Header, HTTPException, Request
 
 from ..bot_spawn.ports import MeetingRepo, WorkloadUnknown
 from .stop import leave_command_channel, leave_command_payload
@@ -78,6 +78,7 @@ def build_stop_router(repo: MeetingRepo, publisher: CommandPublisher, runtime=No
     async def stop_bot(
         platform: str,
         native_meeting_id: str,
+        request: Request,
         x_user_id: Optional[str] = Header(default=None),
     ):
         user_id = _resolve_user_id(x_user_id)
@@ -121,11 +122,21 @@ def build_stop_router(repo: MeetingRepo, publisher: CommandPublisher, runtime=No
         # reached.
         sessions = await repo.list_sessions(meeting_id=meeting_id)
         if sessions:
+            marked = status if status in _BOOTING_STATUSES else "stopping"
             await repo.update_meeting_status(
-                session_uid=sessions[-1],
-                status=status if status in _BOOTING_STATUSES else "stopping",
-                data={"stop_requested": True},
+                session_uid=sessions[-1], status=marked, data={"stop_requested": True},
             )
+            # Arm the stop's reconcile deadline (``stop_grace`` for `stopping`): a bot that misses the
+            # leave is examined right when it becomes a candidate, not on some later full sweep.
+            deadlines = getattr(request.app.state, "reconcile_deadlines", None)
+            if deadlines is not None:
+                try:
+                    await deadlines.note(meeting_id, marked)
+                except Exception as e:  # noqa: BLE001 — best-effort; the full reconcile pass re-arms it
+                    from ..obs import log_event
+
+                    log_event("reconcile_deadline_arm_failed", audience="system", level="warning",
+                              span="bots.stop", fields={"meeting_id": meeting_id, "error": str(e)})
         # Publish the leave command — an ACTIVE (listening) bot honours it, leaves, emits its terminal event.
         # #809: this is a GENUINELY Redis-dependent path (pub/sub is the only delivery). During a Redis
         # outage it must fail NARROWLY per-request (503, retryable) — not as an opaque 500 stack trace,
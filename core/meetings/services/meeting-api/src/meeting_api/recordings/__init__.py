@@ -18,7 +18,8 @@ Public surface:
   * ``upload_chunk(...)`` / ``finalize_master(...)`` — the flow core (callable directly in tests).
   * ``apply_chunk_to_recording`` / ``chunk_storage_key`` / ``master_storage_key`` /
     ``new_recording_numeric_id`` — the pure JSONB record materializers.
-  * ``Storage`` / ``RecordingRepo`` ports + ``SessionNotFound``.
+  * ``Storage`` / ``RecordingRepo`` ports (+ the optional ``MultipartStorage`` /
+    ``MediaDeliveryStorage`` capabilities) + ``SessionNotFound``.
   * ``adapters.build_production_router(...)`` — wire with real MinIO/S3 + SQLAlchemy.
   * ``fakes`` — ``InMemoryStorage`` / ``InMemoryRecordingRepo`` (offline drivers).
 """
@@ -30,7 +31,7 @@ from .jsonb import (
     master_storage_key,
     new_recording_numeric_id,
 )
-from .ports import RecordingRepo, Storage
+from .ports import MediaDeliveryStorage, MultipartStorage, RecordingRepo, Storage
 from .router import build_router
 from .service import SessionNotFound, finalize_master, upload_chunk
 
@@ -42,6 +43,8 @@ __all__ = [
     "chunk_storage_key",
     "master_storage_key",
     "new_recording_numeric_id",
+    "MediaDeliveryStorage",
+    "MultipartStorage",
     "RecordingRepo",
     "Storage",
     "SessionNotFound",
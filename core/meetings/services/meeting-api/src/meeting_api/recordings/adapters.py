@@ -18,12 +18,17 @@ class S3Storage:
     """``Storage`` over an S3/MinIO bucket (boto3). Lazy client so the package imports without boto3."""
 
     def __init__(self, *, bucket: str, endpoint_url: Optional[str] = None,
-                 access_key: Optional[str] = None, secret_key: Optional[str] = None):
+                 access_key: Optional[str] = None, secret_key: Optional[str] = None,
+                 public_endpoint_url: Optional[str] = None):
         self._bucket = bucket
         self._endpoint = endpoint_url
         self._access_key = access_key
         self._secret_key = secret_key
+        # The host a presigned URL is SIGNED for — the one the player can reach (S3_PUBLIC_ENDPOINT),
+        # which for a compose MinIO is not the in-network ``minio:9000`` meeting-api talks to.
+        self._public_endpoint = public_endpoint_url or endpoint_url
         self._client = None
+        self._signer = None
 
     def _c(self):
         if self._client is None:
@@ -85,6 +90,59 @@ class S3Storage:
         resp = await self._run(self._c().get_object, Bucket=self._bucket, Key=key, Range=f"bytes={start}-{end}")
         return await self._run(resp["Body"].read)
 
+    async def stream(self, key: str, start: Optional[int] = None, end: Optional[int] = None, *,
+                     chunk_size: int = 1 << 20):
+        """``MediaDeliveryStorage.stream`` — one ranged ``get_object``, its body read ``chunk_size``
+        at a time off the event loop (the same G4 offload as every other call here)."""
+        extra = {"Range": f"bytes={start}-{end}"} if start is not None else {}
+        resp = await self._run(self._c().get_object, Bucket=self._bucket, Key=key, **extra)
+        body = resp["Body"]
+        try:
+            while True:
+                chunk = await self._run(body.read, chunk_size)
+                if not chunk:
+                    return
+                yield chunk
+        finally:
+            body.close()
+
+    async def presign_get(self, key: str, *, expires_s: int, content_type: Optional[str] = None) -> str:
+        """``MediaDeliveryStorage.presign_get`` — a SigV4 query-signed GET, computed locally (no
+        round trip to the store)."""
+        if self._signer is None:
+            import boto3
+            from botocore.config import Config
+
+            self._signer = boto3.client(
+                "s3", endpoint_url=self._public_endpoint,
+                aws_access_key_id=self._access_key, aws_secret_access_key=self._secret_key,
+                config=Config(signature_version="s3v4"),
+            )
+        params = {"Bucket": self._bucket, "Key": key}
+        if content_type:
+            params["ResponseContentType"] = content_type
+        return self._signer.generate_presigned_url("get_object", Params=params, ExpiresIn=expires_s)
+
+    # ── multipart (RECORDING_MULTIPART — recordings/multipart.py) ──
+    async def create_multipart(self, key: str, *, content_type: str) -> str:
+        resp = await self._run(self._c().create_multipart_upload, Bucket=self._bucket, Key=key,
+                               ContentType=content_type)
+        return resp["UploadId"]
+
+    async def upload_part(self, key: str, upload_id: str, part_number: int, data: bytes) -> str:
+        resp = await self._run(self._c().upload_part, Bucket=self._bucket, Key=key, UploadId=upload_id,
+                               PartNumber=part_number, Body=data)
+        return resp["ETag"]
+
+    async def complete_multipart(self, key: str, upload_id: str, parts: list[tuple[int, str]]) -> None:
+        await self._run(
+            self._c().complete_multipart_upload, Bucket=self._bucket, Key=key, UploadId=upload_id,
+            MultipartUpload={"Parts": [{"PartNumber": n, "ETag": etag} for n, etag in parts]},
+        )
+
+    async def abort_multipart(self, key: str, upload_id: str) -> None:
+        await self._run(self._c().abort_multipart_upload, Bucket=self._bucket, Key=key, UploadId=upload_id)
+
     async def exists(self, key: str) -> bool:
         from botocore.exceptions import ClientError
 
@@ -201,5 +259,6 @@ def build_production_router(*, database_url: Optional[str] = None):
         endpoint_url=os.getenv("S3_ENDPOINT"),
         access_key=os.getenv("S3_ACCESS_KEY"),
         secret_key=os.getenv("S3_SECRET_KEY"),
+        public_endpoint_url=os.getenv("S3_PUBLIC_ENDPOINT"),
     )
     return build_router(SqlAlchemyRecordingRepo(session_factory), storage)
@@ -11,15 +11,23 @@ in-process.
 """
 from __future__ import annotations
 
+import hashlib
+import uuid
 from typing import Optional
 
 
 class InMemoryStorage:
-    """A dict-backed ``Storage`` (key → bytes)."""
+    """A dict-backed ``Storage`` (key → bytes), with S3's multipart surface: every part but the
+    last must be at least ``min_part_bytes`` (S3's 5 MiB; tests lower it) or completion fails."""
 
-    def __init__(self):
+    def __init__(self, *, min_part_bytes: int = 5 * 1024 * 1024):
         self.blobs: dict[str, bytes] = {}
         self.content_types: dict[str, str] = {}
+        self.min_part_bytes = min_part_bytes
+        self.uploads: dict[str, dict] = {}          # upload_id -> {key, content_type, parts: {n: bytes}}
+        self.gets: list[str] = []                   # every key read back whole (get)
+        self.streams: list[tuple] = []              # every (key, start, end) streamed
+        self.presigned: list[tuple[str, int]] = []  # every (key, expires_s) presigned
 
     async def upload(self, key: str, data: bytes, *, content_type: str) -> None:
         self.blobs[key] = data
@@ -29,6 +37,7 @@ class InMemoryStorage:
         return sorted(k for k in self.blobs if k.startswith(prefix))
 
     async def get(self, key: str) -> bytes:
+        self.gets.append(key)
         return self.blobs[key]
 
     async def size(self, key: str) -> int:
@@ -38,9 +47,48 @@ class InMemoryStorage:
         # INCLUSIVE [start, end], like S3's get_object(Range=...).
         return self.blobs[key][start : end + 1]
 
+    async def stream(self, key: str, start: Optional[int] = None, end: Optional[int] = None, *,
+                     chunk_size: int = 1 << 20):
+        self.streams.append((key, start, end))
+        data = self.blobs[key] if start is None else self.blobs[key][start : end + 1]
+        for i in range(0, len(data), chunk_size):
+            yield data[i : i + chunk_size]
+
+    async def presign_get(self, key: str, *, expires_s: int, content_type: Optional[str] = None) -> str:
+        self.presigned.append((key, expires_s))
+        return f"https://objects.test/{key}?X-Amz-Expires={expires_s}"
+
     async def exists(self, key: str) -> bool:
         return key in self.blobs
 
+    async def create_multipart(self, key: str, *, content_type: str) -> str:
+        upload_id = uuid.uuid4().hex
+        self.uploads[upload_id] = {"key": key, "content_type": content_type, "parts": {}}
+        return upload_id
+
+    async def upload_part(self, key: str, upload_id: str, part_number: int, data: bytes) -> str:
+        self.uploads[upload_id]["parts"][part_number] = data   # a re-upload replaces the part, like S3
+        return hashlib.md5(data).hexdigest()
+
+    async def complete_multipart(self, key: str, upload_id: str, parts: list[tuple[int, str]]) -> None:
+        up = self.uploads.pop(upload_id)
+        numbers = [n for n, _ in parts]
+        if numbers != sorted(numbers) or not parts:
+            raise ValueError("InvalidPartOrder")
+        bodies = []
+        for i, (n, etag) in enumerate(parts):
+            body = up["parts"][n]
+            if hashlib.md5(body).hexdigest() != etag:
+                raise ValueError(f"InvalidPart {n}")
+            if i < len(parts) - 1 and len(body) < self.min_part_bytes:
+                raise ValueError(f"EntityTooSmall part {n}")
+            bodies.append(body)
+        self.blobs[key] = b"".join(bodies)
+        self.content_types[key] = up["content_type"]
+
+    async def abort_multipart(self, key: str, upload_id: str) -> None:
+        self.uploads.pop(upload_id, None)
+
 
 class InMemoryRecordingRepo:
     """A dict-backed ``RecordingRepo``. ``seed`` plants a meeting + its bot session."""
@@ -0,0 +1,340 @@
+"""Streaming multipart assembly of a recording master (opt-in ``RECORDING_MULTIPART``).
+
+Without it, ``finalize_master`` GETs every chunk object of a recording and PUTs the concatenated
+master — for a multi-hour meeting that is gigabytes re-downloaded and re-uploaded at meeting end, and
+the recording is unavailable until it finishes. With it, the master is an S3 multipart upload opened
+on the first chunk: as chunks arrive they are coalesced (in ``chunk_seq`` order) into parts of at
+least ``RECORDING_MULTIPART_PART_BYTES`` and uploaded straight away, so at finalize only the tail
+(< one part) is left to upload and ``CompleteMultipartUpload`` is a metadata call — bounded work,
+independent of meeting length.
+
+The parts are the SAME bytes ``build_recording_master`` would produce (recording.v1): webm is a
+byte-concat, so a part is its chunks concatenated; wav strips each chunk's 44-byte header, so a part
+is the chunks' PCM — and part 1 is re-uploaded at completion with the one corrected RIFF header in
+front (the total data size is only known then; part 1 is bounded by the part size).
+
+State lives beside the media-file it assembles, in ``media_files[].multipart`` (JSONB), and every
+transition is a PURE function run inside ``repo.mutate_recordings`` (one row lock), so concurrent
+chunk uploads on any replica claim disjoint parts. The IO (fetch a part's chunks, upload the part)
+runs outside the lock.
+
+Fail-safe by construction: the chunk objects are still written exactly as before, so anything the
+multipart path cannot vouch for — a chunk that never arrived, a part upload error, a wav ``fmt``
+change, a storage without the capability — ABANDONS the upload (aborted, logged) and finalize falls
+back to the full ``build_recording_master`` rebuild. Out-of-order chunks are parked until the gap
+fills. Operators should still set a bucket lifecycle rule that aborts incomplete multipart uploads
+(a replica killed mid-meeting leaves one behind).
+"""
+from __future__ import annotations
+
+import copy
+import os
+import struct
+from typing import Any, Callable, Optional
+
+from ..obs import log_event
+
+S3_MIN_PART_BYTES = 5 * 1024 * 1024      # S3's floor for every part but the last
+DEFAULT_PART_BYTES = 8 * 1024 * 1024     # RECORDING_MULTIPART_PART_BYTES
+_WAV_HEADER_BYTES = 44
+
+_OPEN, _COMPLETING, _COMPLETED, _ABANDONED = "open", "completing", "completed", "abandoned"
+_TRUE = ("true", "1", "yes", "on")
+
+
+def enabled(storage) -> bool:
+    """``RECORDING_MULTIPART`` is on AND the storage can do multipart (the fakes/S3 adapter can)."""
+    flag = (os.getenv("RECORDING_MULTIPART") or "").strip().lower() in _TRUE
+    return flag and callable(getattr(storage, "create_multipart", None))
+
+
+def part_bytes(storage=None) -> int:
+    """The configured part size, raised to the storage's part floor (``min_part_bytes``, else S3's
+    5 MiB) — a smaller part would make ``CompleteMultipartUpload`` fail with EntityTooSmall."""
+    floor = int(getattr(storage, "min_part_bytes", S3_MIN_PART_BYTES))
+    return max(floor, int(os.getenv("RECORDING_MULTIPART_PART_BYTES") or DEFAULT_PART_BYTES))
+
+
+def payload_size(media_format: str, size: int) -> int:
+    """The bytes a chunk contributes to the master — a wav chunk minus its header (the empty final
+    signal chunk contributes nothing)."""
+    if (media_format or "").lower() == "wav":
+        return max(0, size - _WAV_HEADER_BYTES) if size >= _WAV_HEADER_BYTES else 0
+    return size
+
+
+def chunk_key(mp: dict, seq: int) -> str:
+    return f"{mp['prefix']}/{seq:06d}.{mp['format']}"
+
+
+# ── pure state transitions (run under the recording row lock) ───────────────────────────────────
+
+def _new(prefix: str, media_format: str) -> dict:
+    return {"state": _OPEN, "upload_id": None, "creating": False, "prefix": prefix,
+            "format": media_format, "next_seq": 0, "ahead": {}, "pending": [], "pending_bytes": 0,
+            "parts": []}
+
+
+def _claim_part(mp: dict, threshold: int) -> Optional[dict]:
+    """Move the pending run into a new part once it reaches ``threshold`` (upload id required)."""
+    if mp["state"] != _OPEN or not mp["upload_id"] or not mp["pending"]:
+        return None
+    if mp["pending_bytes"] < threshold:
+        return None
+    n = len(mp["parts"]) + 1
+    seqs = list(mp["pending"])
+    mp["parts"].append({"n": n, "first": seqs[0], "last": seqs[-1], "etag": None, "data_bytes": None})
+    mp["pending"], mp["pending_bytes"] = [], 0
+    return {"part": {"n": n, "seqs": seqs}}
+
+
+def fold_chunk(mp: Optional[dict], *, prefix: str, media_format: str, chunk_seq: int, size: int,
+               threshold: int) -> tuple[dict, Optional[dict]]:
+    """Account one stored chunk. Returns ``(state, action)``; ``action`` is ``{"create": True}`` (open
+    the upload), ``{"part": {...}}`` (upload that part) or ``None``."""
+    mp = copy.deepcopy(mp) if mp else _new(prefix, media_format)
+    if mp["state"] != _OPEN:
+        return mp, None
+    if chunk_seq < mp["next_seq"] or str(chunk_seq) in mp["ahead"]:
+        return mp, None                                   # a retried upload of a chunk already counted
+    mp["ahead"][str(chunk_seq)] = size
+    while str(mp["next_seq"]) in mp["ahead"]:             # drain the contiguous run
+        mp["pending"].append(mp["next_seq"])
+        mp["pending_bytes"] += mp["ahead"].pop(str(mp["next_seq"]))
+        mp["next_seq"] += 1
+    if mp["upload_id"] is None and not mp["creating"]:
+        mp["creating"] = True
+        return mp, {"create": True}
+    return mp, _claim_part(mp, threshold)
+
+
+def attach_upload(mp: dict, upload_id: str, *, threshold: int) -> tuple[dict, Optional[dict]]:
+    mp = copy.deepcopy(mp)
+    if mp["state"] != _OPEN:
+        return mp, {"abort": upload_id}                   # abandoned while the create was in flight
+    mp["upload_id"], mp["creating"] = upload_id, False
+    return mp, _claim_part(mp, threshold)
+
+
+def record_part(mp: dict, n: int, etag: str, data_bytes: int, *, threshold: int,
+                wav_fmt: Optional[str] = None) -> tuple[dict, Optional[dict]]:
+    if wav_fmt and mp.get("wav_fmt") not in (None, wav_fmt):
+        mp, upload_id = abandon(mp)                       # parts disagree on the PCM format
+        return mp, {"abort": upload_id}
+    mp = copy.deepcopy(mp)
+    part = next((p for p in mp["parts"] if p["n"] == n), None)
+    if part is not None:
+        part["etag"], part["data_bytes"] = etag, data_bytes
+    if wav_fmt:
+        mp["wav_fmt"] = wav_fmt
+    return mp, _claim_part(mp, threshold)
+
+
+def abandon(mp: Optional[dict]) -> tuple[Optional[dict], Optional[str]]:
+    """Mark the upload abandoned; returns the upload id to abort (once)."""
+    if not mp or mp["state"] in (_ABANDONED, _COMPLETED):
+        return mp, None
+    mp = copy.deepcopy(mp)
+    mp["state"] = _ABANDONED
+    return mp, mp.get("upload_id")
+
+
+def covered_seqs(mp: dict) -> set[int]:
+    seqs = set(mp["pending"])
+    for p in mp["parts"]:
+        seqs.update(range(p["first"], p["last"] + 1))
+    return seqs
+
+
+def claim_completion(mp: Optional[dict], listed_seqs: set[int]) -> tuple[Optional[dict], Optional[dict]]:
+    """Claim the completion if the upload covers EXACTLY the listed chunks and no part is in flight:
+    the pending tail becomes the last part. Otherwise abandon (``{"abort": id}``) — the caller
+    rebuilds the master the old way."""
+    if mp and mp["state"] == _COMPLETING:
+        return mp, None                                   # a concurrent finalize owns it
+    if not mp or mp["state"] != _OPEN or not mp["upload_id"]:
+        mp, upload_id = abandon(mp)
+        return mp, ({"abort": upload_id} if upload_id else None)
+    if mp["ahead"] or any(p["etag"] is None for p in mp["parts"]) or covered_seqs(mp) != listed_seqs:
+        mp, upload_id = abandon(mp)
+        return mp, {"abort": upload_id}
+    mp = copy.deepcopy(mp)
+    tail = None
+    if mp["pending"]:
+        n = len(mp["parts"]) + 1
+        tail = {"n": n, "seqs": list(mp["pending"])}
+        mp["parts"].append({"n": n, "first": tail["seqs"][0], "last": tail["seqs"][-1],
+                            "etag": None, "data_bytes": None})
+        mp["pending"], mp["pending_bytes"] = [], 0
+    mp["state"] = _COMPLETING
+    return mp, {"complete": {"upload_id": mp["upload_id"], "tail": tail, "parts": copy.deepcopy(mp["parts"])}}
+
+
+def mark_completed(mp: dict, etags: dict[int, str]) -> tuple[dict, None]:
+    mp = copy.deepcopy(mp)
+    for p in mp["parts"]:
+        p["etag"] = etags.get(p["n"], p["etag"])
+    mp["state"] = _COMPLETED
+    return mp, None
+
+
+# ── IO (outside the lock) ───────────────────────────────────────────────────────────────────────
+
+def _wav_header(fmt_body: bytes, total_data: int) -> bytes:
+    # The same corrected master header ``_build_wav_master`` writes (recording.v1 golden-locked).
+    return (b"RIFF" + struct.pack("<I", 36 + total_data) + b"WAVE" + b"fmt " + struct.pack("<I", 16)
+            + fmt_body + b"data" + struct.pack("<I", total_data))
+
+
+async def _part_body(storage, mp: dict, seqs: list[int],
+                     inline: dict[int, bytes]) -> tuple[bytes, int, Optional[str]]:
+    """The part's master bytes + its data size (+ the wav fmt body, hex). Raises on a wav chunk whose
+    fmt differs from the recording's — the master would be unplayable either way."""
+    wav = mp["format"].lower() == "wav"
+    body = bytearray()
+    fmt_hex = mp.get("wav_fmt")
+    for seq in seqs:
+        chunk = inline[seq] if seq in inline else await storage.get(chunk_key(mp, seq))
+        if not wav:
+            body += chunk
+            continue
+        if len(chunk) < _WAV_HEADER_BYTES:
+            continue                                          # the empty final signal chunk
+        if chunk[:4] != b"RIFF" or chunk[8:12] != b"WAVE" or chunk[36:40] != b"data":
+            raise ValueError(f"non-canonical WAV chunk {seq}")
+        fmt = chunk[20:36].hex()
+        if fmt_hex is None:
+            fmt_hex = fmt
+        elif fmt != fmt_hex:
+            raise ValueError(f"WAV fmt chunk mismatch at chunk {seq}")
+        body += chunk[_WAV_HEADER_BYTES:]
+    return bytes(body), len(body), fmt_hex if wav else None
+
+
+class _Ctx:
+    """One media-file's multipart state, read/modified under ``repo.mutate_recordings``."""
+
+    def __init__(self, repo, storage, *, meeting_id: int, recording_id: int, media_type: str,
+                 master_key: str, content_type: str):
+        self.repo, self.storage = repo, storage
+        self.meeting_id, self.recording_id, self.media_type = meeting_id, recording_id, media_type
+        self.master_key, self.content_type = master_key, content_type
+        self.mp: Optional[dict] = None
+
+    async def mutate(self, fn: Callable[[Optional[dict]], tuple[Optional[dict], Any]]):
+        def _mut(recs):
+            r = next((x for x in recs if x.get("id") == self.recording_id), None)
+            m = next((x for x in (r or {}).get("media_files", []) if x.get("type") == self.media_type), None)
+            if m is None:
+                return recs, None
+            mp, result = fn(m.get("multipart"))
+            if mp is not None or "multipart" in m:
+                m["multipart"] = mp
+            self.mp = copy.deepcopy(mp)
+            return recs, result
+        return await self.repo.mutate_recordings(self.meeting_id, _mut)
+
+    async def give_up(self, error: Exception, stage: str) -> None:
+        upload_id = await self.mutate(abandon)
+        if upload_id:
+            try:
+                await self.storage.abort_multipart(self.master_key, upload_id)
+            except Exception:
+                pass                                          # the bucket lifecycle rule reaps it
+        log_event("recording_multipart_abandoned", audience="operator", level="warning",
+                  span="recordings.multipart", meeting_id=str(self.meeting_id),
+                  fields={"recording_id": self.recording_id, "media_type": self.media_type,
+                          "stage": stage, "error": f"{type(error).__name__}: {error}"})
+
+
+async def advance(repo, storage, action: Optional[dict], *, meeting_id: int, recording_id: int,
+                  media_type: str, master_key: str, content_type: str, mp: Optional[dict],
+                  inline: dict[int, bytes]) -> None:
+    """Carry out a chunk fold's ``action``: open the upload and/or upload every part that became
+    due. Never raises — a failure abandons the upload and finalize rebuilds the old way."""
+    if action is None:
+        return
+    ctx = _Ctx(repo, storage, meeting_id=meeting_id, recording_id=recording_id,
+               media_type=media_type, master_key=master_key, content_type=content_type)
+    ctx.mp = mp
+    threshold = part_bytes(storage)
+    stage = "create"
+    try:
+        if action.get("create"):
+            upload_id = await storage.create_multipart(master_key, content_type=content_type)
+            action = await ctx.mutate(lambda m: attach_upload(m, upload_id, threshold=threshold))
+        stage = "part"
+        while action and action.get("part"):
+            part = action["part"]
+            body, data_bytes, fmt_hex = await _part_body(storage, ctx.mp, part["seqs"], inline)
+            etag = await storage.upload_part(master_key, ctx.mp["upload_id"], part["n"], body)
+            action = await ctx.mutate(lambda m: record_part(
+                m, part["n"], etag, data_bytes, threshold=threshold, wav_fmt=fmt_hex))
+        if action and action.get("abort"):
+            await storage.abort_multipart(master_key, action["abort"])
+    except Exception as e:
+        await ctx.give_up(e, stage)
+
+
+async def complete(repo, storage, *, meeting_id: int, recording_id: int, media_type: str,
+                   master_key: str, content_type: str, listed_keys: list[str]) -> bool:
+    """Finish the master from its open upload: upload the tail, (wav) re-upload part 1 with the
+    corrected header, complete. ``True`` when the master object now exists; ``False`` means the caller
+    must rebuild it from the chunks (the upload was abandoned or never covered them all)."""
+    ctx = _Ctx(repo, storage, meeting_id=meeting_id, recording_id=recording_id,
+               media_type=media_type, master_key=master_key, content_type=content_type)
+    listed = set()
+    for k in listed_keys:
+        stem = k.rsplit("/", 1)[-1].split(".", 1)[0]
+        if not stem.isdigit():
+            return False
+        listed.add(int(stem))
+    claim = await ctx.mutate(lambda m: claim_completion(m, listed))
+    if not claim:
+        return False
+    if claim.get("abort"):
+        try:
+            await storage.abort_multipart(master_key, claim["abort"])
+        except Exception:
+            pass
+        return False
+    job = claim["complete"]
+    try:
+        upload_id, parts = job["upload_id"], job["parts"]
+        etags = {p["n"]: p["etag"] for p in parts}
+        data_bytes = {p["n"]: p["data_bytes"] for p in parts}
+        fmt_hex = ctx.mp.get("wav_fmt")
+        tail_body = None
+        if job["tail"]:
+            tail_body, data_bytes[job["tail"]["n"]], tail_fmt = await _part_body(
+                storage, ctx.mp, job["tail"]["seqs"], {})
+            fmt_hex = fmt_hex or tail_fmt
+        if ctx.mp["format"].lower() == "wav":
+            total = sum(data_bytes.values())
+            if not fmt_hex or total <= 0:
+                raise ValueError("no PCM payload to assemble")
+            first = parts[0]
+            if job["tail"] and job["tail"]["n"] == 1:
+                body1 = tail_body
+            else:
+                body1, _, _ = await _part_body(storage, ctx.mp, list(range(first["first"], first["last"] + 1)), {})
+            etags[1] = await storage.upload_part(
+                master_key, upload_id, 1, _wav_header(bytes.fromhex(fmt_hex), total) + body1)
+            if job["tail"] and job["tail"]["n"] == 1:
+                tail_body = None                              # already uploaded as part 1
+        if tail_body is not None and not tail_body and len(parts) > 1:
+            del etags[job["tail"]["n"]]                       # only the empty final signal chunk was left
+        elif tail_body is not None:
+            etags[job["tail"]["n"]] = await storage.upload_part(master_key, upload_id, job["tail"]["n"], tail_body)
+        await storage.complete_multipart(master_key, upload_id, sorted(etags.items()))
+    except Exception as e:
+        await ctx.give_up(e, "complete")
+        return False
+    await ctx.mutate(lambda m: mark_completed(m, etags))
+    log_event("recording_multipart_completed", audience="operator", span="recordings.multipart",
+              meeting_id=str(meeting_id),
+              fields={"recording_id": recording_id, "media_type": media_type, "parts": len(etags),
+                      "chunks": len(listed)})
+    return True
+
+
@@ -17,7 +17,7 @@ fakes (an in-memory blob store + an in-memory meeting store).
 """
 from __future__ import annotations
 
-from typing import Optional, Protocol, runtime_checkable
+from typing import AsyncIterator, Optional, Protocol, runtime_checkable
 
 
 @runtime_checkable
@@ -45,6 +45,46 @@ class Storage(Protocol):
         ...
 
 
+@runtime_checkable
+class MultipartStorage(Protocol):
+    """OPTIONAL ``Storage`` capability — S3 multipart upload, so the master is assembled as chunks
+    arrive (``RECORDING_MULTIPART``; ``multipart.py``). A storage without it just rebuilds at finalize.
+    A ``min_part_bytes`` attribute, when present, is the part floor the configured size is raised to
+    (absent → S3's 5 MiB)."""
+
+    async def create_multipart(self, key: str, *, content_type: str) -> str:
+        """Open a multipart upload for ``key`` → its upload id."""
+        ...
+
+    async def upload_part(self, key: str, upload_id: str, part_number: int, data: bytes) -> str:
+        """Upload (or replace) part ``part_number`` → its ETag."""
+        ...
+
+    async def complete_multipart(self, key: str, upload_id: str, parts: list[tuple[int, str]]) -> None:
+        """Stitch ``[(part_number, etag)]`` (ascending) into the object ``key`` — no data moves."""
+        ...
+
+    async def abort_multipart(self, key: str, upload_id: str) -> None: ...
+
+
+@runtime_checkable
+class MediaDeliveryStorage(Protocol):
+    """OPTIONAL ``Storage`` capability — hand master bytes to a player WITHOUT buffering them. A
+    storage without it serves the raw media route from ``get`` / ``get_range`` as before."""
+
+    def stream(self, key: str, start: Optional[int] = None, end: Optional[int] = None, *,
+               chunk_size: int = 1 << 20) -> AsyncIterator[bytes]:
+        """The object (or its INCLUSIVE ``[start, end]`` window) as ``chunk_size`` reads — the
+        proxied route relays them as they arrive, never holding the master in memory."""
+        ...
+
+    async def presign_get(self, key: str, *, expires_s: int, content_type: Optional[str] = None) -> str:
+        """A short-lived GET URL for ``key`` that the CLIENT fetches directly
+        (``RECORDING_MEDIA_DELIVERY=presign``). The object store answers Range / Content-Range
+        itself, so playback and seeking never touch meeting-api or the gateway."""
+        ...
+
+
 @runtime_checkable
 class RecordingRepo(Protocol):
     """The DB side of recordings: resolve the session, read/modify ``meeting.data['recordings']``."""
@@ -7,7 +7,10 @@
   * **GET /recordings** — the caller's recordings (from ``meeting.data``), scoped by the
     gateway-injected ``x-user-id``.
   * **GET /recordings/{recording_id}/master?type=audio|video** — finalize-on-read: build + upload the
-    master if absent, then return its storage key. (The byte stream / Range download is P3.)
+    master if absent, then return its storage key.
+  * **GET /recordings/{recording_id}/media/{media_file_id}/raw** — the master bytes, Range-aware.
+    ``RECORDING_MEDIA_DELIVERY=presign`` answers a 307 to a short-lived presigned object-store URL
+    instead (the store serves the bytes + Range itself); the default ``proxy`` streams them.
 """
 from __future__ import annotations
 
@@ -16,7 +19,7 @@ import os
 from typing import Optional
 
 from fastapi import APIRouter, File, Form, Header, HTTPException, Request, UploadFile
-from fastapi.responses import JSONResponse, Response
+from fastapi.responses import JSONResponse, Response, StreamingResponse
 
 from .ports import RecordingRepo, Storage
 from .service import SessionNotFound, _verify_meeting_token, finalize_master, upload_chunk
@@ -104,6 +107,24 @@ async def _storage_get_range(storage: Storage, key: str, start: int, end: int) -
     return await getter(key, start, end)
 
 
+# Proxied playback reads the store in 1 MiB windows — the relay moves few, large buffers.
+_STREAM_CHUNK_BYTES = 1 << 20
+DEFAULT_PRESIGN_TTL_SECONDS = 300
+
+
+def _presign_enabled(storage: Storage) -> bool:
+    """``RECORDING_MEDIA_DELIVERY=presign`` AND the storage can presign (the S3 adapter + fakes can)."""
+    mode = (os.getenv("RECORDING_MEDIA_DELIVERY") or "proxy").strip().lower()
+    return mode == "presign" and callable(getattr(storage, "presign_get", None))
+
+
+def _presign_ttl_seconds() -> int:
+    try:
+        return max(1, int(os.getenv("RECORDING_PRESIGN_TTL_SECONDS") or DEFAULT_PRESIGN_TTL_SECONDS))
+    except ValueError:
+        return DEFAULT_PRESIGN_TTL_SECONDS
+
+
 def build_router(
     repo: RecordingRepo,
     storage: Storage,
@@ -283,6 +304,16 @@ def build_router(
         else:
             content_type = "application/octet-stream"
 
+        # Presigned delivery: ownership + finalize-on-read above are the authorization; the bytes
+        # come straight from the object store, which honors Range / Content-Range natively — so
+        # neither meeting-api nor the gateway carries playback traffic. ``no-store``: the URL
+        # expires, a cached redirect would outlive it.
+        if _presign_enabled(storage):
+            url = await storage.presign_get(
+                storage_path, expires_s=_presign_ttl_seconds(), content_type=content_type
+            )
+            return Response(status_code=307, headers={"Location": url, "Cache-Control": "private, no-store"})
+
         # Honor HTTP Range so the <audio>/<video> element + dashboard proxy can seek without
         # downloading the whole master. Resolve total size cheaply (S3 head) when we can; only fall
         # back to fetching the full body if neither size() nor get_range() are available.
@@ -294,6 +325,27 @@ def build_router(
             total = len(full_body)
 
         rng = _parse_range(range_header, total)  # may raise 416
+        streamer = getattr(storage, "stream", None)
+        if streamer is not None and full_body is None:
+            # Proxied delivery without buffering the master: relay the store's body (or just the
+            # requested window) in large reads, with the exact Content-Length up front.
+            if rng is None:
+                return StreamingResponse(
+                    streamer(storage_path, chunk_size=_STREAM_CHUNK_BYTES),
+                    media_type=content_type,
+                    headers={"Accept-Ranges": "bytes", "Content-Length": str(total)},
+                )
+            start, end = rng
+            return StreamingResponse(
+                streamer(storage_path, start, end, chunk_size=_STREAM_CHUNK_BYTES),
+                status_code=206,
+                media_type=content_type,
+                headers={
+                    "Accept-Ranges": "bytes",
+                    "Content-Range": f"bytes {start}-{end}/{total}",
+                    "Content-Length": str(end - start + 1),
+                },
+            )
         if rng is None:
             data = full_body if full_body is not None else await storage.get(storage_path)
             return Response(
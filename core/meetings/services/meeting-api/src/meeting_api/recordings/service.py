@@ -10,6 +10,9 @@ Port of the parent ``recordings.internal_upload_recording`` + ``recording_finali
     golden-locked ``build_recording_master`` codec, upload the master, and stamp the JSONB media-file
     (``storage_path`` → master key, ``finalized_by``, ``is_final``, ``playback_url``).
 
+With ``RECORDING_MULTIPART`` the master is instead assembled AS THE CHUNKS ARRIVE (``multipart.py``):
+each upload feeds an open S3 multipart upload, and finalize only completes it.
+
 The codec itself (``meeting_api.build_recording_master``, recording.v1) is already ported +
 golden-locked — this module only orchestrates the IO + the JSONB bookkeeping around it.
 """
@@ -20,6 +23,7 @@ from typing import Any, Optional
 
 from ..obs import log_event
 from ..recording_codec import build_recording_master
+from . import multipart
 from .jsonb import apply_chunk_to_recording, chunk_storage_key, master_storage_key, new_recording_numeric_id
 from .ports import RecordingRepo, Storage
 
@@ -87,6 +91,8 @@ async def upload_chunk(
         media_type=media_type, media_format=media_format, chunk_seq=chunk_seq,
     )
     await storage.upload(key, data, content_type=_content_type(media_format))
+    streaming = multipart.enabled(storage)
+    threshold = multipart.part_bytes(storage) if streaming else 0
 
     # G3 — fold the chunk into the JSONB ATOMICALLY: the mutator reads the LIVE recordings under one
     # row lock and folds cumulatively, so a concurrent chunk/finalize can't clobber it (the old
@@ -104,11 +110,31 @@ async def upload_chunk(
             storage_path=key, file_size=len(data), chunk_seq=chunk_seq, is_final=is_final,
             duration_seconds=duration_seconds, sample_rate=sample_rate,
         )
+        action = mp = None
+        if streaming:
+            # RECORDING_MULTIPART — the folded media-file is rebuilt from scratch, so carry the
+            # multipart state forward and account this chunk in it (multipart.py).
+            prior = next((m for m in (ex or {}).get("media_files", []) if m.get("type") == media_type), {})
+            new_mf = next(m for m in payload["media_files"] if m["type"] == media_type)
+            mp, action = multipart.fold_chunk(
+                prior.get("multipart"), prefix=key.rsplit("/", 1)[0], media_format=media_format,
+                chunk_seq=chunk_seq, size=multipart.payload_size(media_format, len(data)),
+                threshold=threshold,
+            )
+            new_mf["multipart"] = mp
         others = [r for r in recs if r.get("id") != rid]
-        return others + [payload], (payload, transitioned_)
+        return others + [payload], (payload, transitioned_, action, mp)
 
-    rec_payload, transitioned = await repo.mutate_recordings(meeting_id, _fold)
+    rec_payload, transitioned, action, mp = await repo.mutate_recordings(meeting_id, _fold)
     recording_id = rec_payload["id"]
+    if action is not None:
+        # Open the upload / upload the parts this chunk completed — outside the row lock; never fails
+        # the chunk (the chunk object is durable and finalize can always rebuild from it).
+        await multipart.advance(
+            repo, storage, action, meeting_id=meeting_id, recording_id=recording_id,
+            media_type=media_type, master_key=master_storage_key(key, media_format),
+            content_type=_content_type(media_format), mp=mp, inline={chunk_seq: data},
+        )
 
     media_file = next((mf for mf in rec_payload["media_files"] if mf["type"] == media_type), {})
     if transitioned:
@@ -190,9 +216,20 @@ async def finalize_master(
                 fields={"recording_id": recording_id, "media_type": media_type,
                         "prior_assembled_count": assembled_count, "new_count": listed_count},
             )
-        chunks = [await storage.get(k) for k in keys]
-        master_bytes = build_recording_master(chunks, media_format)
-        await storage.upload(master_key, master_bytes, content_type=_content_type(media_format))
+        # RECORDING_MULTIPART: a COMPLETED recording whose parts were uploaded as its chunks arrived is
+        # finished by a bounded tail upload + CompleteMultipartUpload. A partial (still-recording) read,
+        # or an upload that does not cover exactly the listed chunks, rebuilds from the chunks below.
+        streamed = False
+        if multipart.enabled(storage) and rec.get("status") == "completed":
+            streamed = await multipart.complete(
+                repo, storage, meeting_id=meeting_id, recording_id=recording_id,
+                media_type=media_type, master_key=master_key,
+                content_type=_content_type(media_format), listed_keys=keys,
+            )
+        if not streamed:
+            chunks = [await storage.get(k) for k in keys]
+            master_bytes = build_recording_master(chunks, media_format)
+            await storage.upload(master_key, master_bytes, content_type=_content_type(media_format))
 
     # G3 — stamp the media-file finalized ATOMICALLY (read→modify→write under one row lock), so a late
     # concurrent chunk upload can't clobber the finalized master pointer (the master bytes are already
@@ -17,6 +17,10 @@ runtime is outside meeting-api's import graph; the SSOT remains the `schedule.v1
 * ``conforms`` — the schedule.v1 schema-by-path validator (raises on non-conformance).
 * ``Clock`` / ``SystemClock`` / ``FakeClock`` — the time port.
 * ``Scheduler`` — schedule / tick / cancel / get / list, Clock-gated, capturing-dispatch ready.
+* ``SchedulerStore`` — the state replicas share (the runtime's redis keys); orphan recovery leaves
+  a live replica's in-flight claims alone.
+* ``upcoming_by_platform`` / ``warm_targets`` — warm-pool sizing from the scheduled-meeting
+  lookahead (the runtime kernel's ``PUT /warm-pool/targets`` map).
 * ``DEFAULT_BOTS_URL`` — the meeting-api ``/bots`` endpoint the fire targets.
 """
 from .clock import Clock, FakeClock, SystemClock
@@ -26,7 +30,8 @@ from .compiler import (
     compile_scheduled_bot,
     conforms,
 )
-from .scheduler import Scheduler
+from .lookahead import upcoming_by_platform, warm_targets
+from .scheduler import Scheduler, SchedulerStore
 
 __all__ = [
     "Clock",
@@ -37,4 +42,7 @@ __all__ = [
     "compile_scheduled_bot",
     "conforms",
     "Scheduler",
+    "SchedulerStore",
+    "upcoming_by_platform",
+    "warm_targets",
 ]
@@ -0,0 +1,67 @@
+"""Warm-pool sizing from the calendar lookahead — how many pre-started bots each platform needs.
+
+The runtime kernel's warm pool (``RUNTIME_WARM_POOL``) only removes join latency for the requests
+that find an idle bot, and every idle bot is a browser held open for nobody. The demand that IS
+knowable ahead of time is the planned meetings: ``scheduled`` rows (calendar sync + manual planning)
+whose ``data.scheduled_at`` falls inside the next ``horizon_s`` and whose auto-join is on — each of
+those is an auto-join spawn the sweep will make at ``scheduled_at - lead``.
+
+``warm_targets`` turns them into the kernel's ``{profile: {variant: count}}`` map: a per-platform
+``base`` floor (ad-hoc "send a bot now" traffic) plus one bot per upcoming meeting, capped per
+platform. Pure over rows + a clock — ``__main__`` PUTs the result on an interval; tests drive it
+offline.
+"""
+from __future__ import annotations
+
+from datetime import datetime, timedelta, timezone
+from typing import Any, Mapping, Optional
+
+BOT_PROFILE = "meeting-bot"
+DEFAULT_HORIZON_S = 900        # BOT_WARM_POOL_LOOKAHEAD_S — meetings starting within 15 minutes
+DEFAULT_MAX_PER_PLATFORM = 4   # BOT_WARM_POOL_MAX_PER_PLATFORM
+DEFAULT_GRACE_S = 600          # AUTO_JOIN_GRACE_S — the sweep's late-join window
+
+
+def _parse_iso(value: Any) -> Optional[datetime]:
+    if not isinstance(value, str) or not value:
+        return None
+    try:
+        dt = datetime.fromisoformat(value.replace("Z", "+00:00"))
+    except ValueError:
+        return None
+    return dt if dt.tzinfo else dt.replace(tzinfo=timezone.utc)
+
+
+def upcoming_by_platform(rows: list[dict], *, now: datetime,
+                         horizon_s: float = DEFAULT_HORIZON_S,
+                         grace_s: float = DEFAULT_GRACE_S) -> dict[str, int]:
+    """Count the ``scheduled`` rows an auto-join will spawn for within ``horizon_s``, per platform.
+    A meeting already past its start still counts inside the sweep's ``grace_s`` (it spawns late),
+    so the slot is not torn down under a meeting that is about to join."""
+    counts: dict[str, int] = {}
+    since = now - timedelta(seconds=grace_s)
+    until = now + timedelta(seconds=horizon_s)
+    for row in rows:
+        data = row.get("data") if isinstance(row.get("data"), dict) else {}
+        if data.get("auto_join") is False:
+            continue
+        platform = row.get("platform")
+        if not row.get("native_meeting_id") or platform in (None, "", "unknown"):
+            continue
+        at = _parse_iso(data.get("scheduled_at"))
+        if at is None or not since <= at <= until:
+            continue
+        counts[platform] = counts.get(platform, 0) + 1
+    return counts
+
+
+def warm_targets(upcoming: Mapping[str, int], *, base: Optional[Mapping[str, int]] = None,
+                 max_per_platform: int = DEFAULT_MAX_PER_PLATFORM,
+                 profile: str = BOT_PROFILE) -> dict[str, dict[str, int]]:
+    """The kernel targets map: ``min(max_per_platform, base + upcoming)`` per platform."""
+    base = base or {}
+    slots = {
+        platform: min(max_per_platform, int(base.get(platform, 0)) + int(upcoming.get(platform, 0)))
+        for platform in set(base) | set(upcoming)
+    }
+    return {profile: {p: n for p, n in sorted(slots.items()) if n > 0}}
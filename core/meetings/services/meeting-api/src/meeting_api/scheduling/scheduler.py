@@ -12,13 +12,26 @@ fire/re-arm/cancel behaviour with a `FakeClock` and a capturing dispatch (no rea
 Storage is an in-memory sorted list (the runtime uses a redis sorted set; the wire shape and
 the operations — zadd / zrangebyscore / zrem — are identical, just backed by a list here so the
 eval needs no redis at all). The fire ACTION is `dispatch(request)`; the eval injects a capture.
+
+`tick()` drains like the runtime's: bounded claims of `batch_size` (lowest execute_at first,
+taken under a lock — the runtime's Lua claim), dispatched over at most `concurrency` threads, with
+schedule lag (claim time − execute_at) kept for `stats()`.
+
+Claims are stamped like the runtime's (`claimed_by` / `claimed_at`) and replicas heartbeat into the
+store, so `recover_orphans()` re-queues an in-flight job only past its lease, when its replica's
+heartbeat has lapsed, or when it is this replica's own claim that no dispatch here still holds.
+Replicas sharing one `SchedulerStore` stand in for replicas sharing one redis.
 """
 from __future__ import annotations
 
 import json
 import logging
+import math
+import threading
+from collections import deque
+from concurrent.futures import ThreadPoolExecutor
 from datetime import datetime, timezone
-from typing import Any, Callable, Dict, List, Optional
+from typing import Any, Callable, Deque, Dict, List, Optional, Tuple
 from uuid import uuid4
 
 from croniter import croniter
@@ -28,23 +41,69 @@ from .clock import Clock, SystemClock
 logger = logging.getLogger("meeting_api.scheduling.scheduler")
 
 DEFAULT_RETRY = {"max_attempts": 3, "backoff": [30, 120, 300], "attempt": 0}
+DEFAULT_BATCH_SIZE = 200   # jobs claimed per drain step (mirrors the runtime's SCHED_BATCH_SIZE)
+DEFAULT_CLAIM_LEASE_S = 900.0   # mirrors SCHED_CLAIM_LEASE_S: must exceed the longest batch dispatch
+DEFAULT_HEARTBEAT_TTL_S = 30.0  # mirrors SCHED_HEARTBEAT_TTL_S: a replica silent this long is gone
 
 # A dispatch is given the job's `request` (the captured POST /bots call) and returns a result
 # dict on success / raises on a retryable failure. Production does HTTP; the eval captures.
 Dispatch = Callable[[Dict[str, Any]], Dict[str, Any]]
 
 
+def _percentile(samples: Deque[float], q: float) -> Optional[float]:
+    if not samples:
+        return None
+    ordered = sorted(samples)
+    return round(ordered[max(0, math.ceil(q * len(ordered)) - 1)], 3)
+
+
+class SchedulerStore:
+    """The state replicas share — the runtime's redis keys, held in dicts under one lock."""
+
+    def __init__(self) -> None:
+        self.lock = threading.RLock()           # stands in for redis' single-threaded atomicity
+        # member-json -> score(execute_at); mirrors the redis sorted set `scheduler:jobs`.
+        self.jobs: Dict[str, float] = {}
+        self.executing: Dict[str, str] = {}     # job_id -> job json (in-flight)
+        self.history: Dict[str, str] = {}       # job_id -> job json (terminal)
+        self.idem: Dict[str, str] = {}          # idempotency_key -> job json
+        self.claims: Dict[str, Dict[str, Any]] = {}  # job_id -> {"claimed_by", "claimed_at"}
+        self.replicas: Dict[str, float] = {}    # replica_id -> last heartbeat (Clock seconds)
+
+
 class Scheduler:
     """Schedule compiled `schedule.v1` jobs and fire them when the `Clock` says they're due."""
 
-    def __init__(self, dispatch: Dispatch, clock: Optional[Clock] = None) -> None:
+    def __init__(
+        self,
+        dispatch: Dispatch,
+        clock: Optional[Clock] = None,
+        *,
+        batch_size: int = DEFAULT_BATCH_SIZE,
+        concurrency: int = 1,
+        store: Optional[SchedulerStore] = None,
+        replica_id: Optional[str] = None,
+        lease_s: float = DEFAULT_CLAIM_LEASE_S,
+        heartbeat_ttl_s: float = DEFAULT_HEARTBEAT_TTL_S,
+    ) -> None:
         self._dispatch = dispatch
         self.clock: Clock = clock or SystemClock()
-        # member-json -> score(execute_at); mirrors the redis sorted set `scheduler:jobs`.
-        self._jobs: Dict[str, float] = {}
-        self._executing: Dict[str, str] = {}   # job_id -> job json (in-flight)
-        self._history: Dict[str, str] = {}      # job_id -> job json (terminal)
-        self._idem: Dict[str, str] = {}         # idempotency_key -> job json
+        self.batch_size = max(1, int(batch_size))
+        self.concurrency = max(1, int(concurrency))
+        self.store = store or SchedulerStore()
+        self.replica_id = replica_id or f"sched-{uuid4().hex[:12]}"
+        self.lease_s = float(lease_s)
+        self.heartbeat_ttl_s = float(heartbeat_ttl_s)
+        self._lock = self.store.lock
+        self._inflight: set = set()             # job ids THIS scheduler claimed and is still running
+        self._pool: Optional[ThreadPoolExecutor] = None
+        self._lag_s: Deque[float] = deque(maxlen=1024)
+        self._claimed = 0
+        self._jobs = self.store.jobs
+        self._executing = self.store.executing
+        self._history = self.store.history
+        self._idem = self.store.idem
+        self._claims = self.store.claims
 
     # ── job CRUD ─────────────────────────────────────────────────────────────
     def _resolve_execute_at(self, spec: Dict[str, Any]) -> float:
@@ -126,6 +185,39 @@ class Scheduler:
         return results
 
     # ── execution ────────────────────────────────────────────────────────────
+    def heartbeat(self) -> None:
+        """Mark this replica alive; peers leave its claims alone while the beat is fresh."""
+        with self._lock:
+            self.store.replicas[self.replica_id] = self.clock.now()
+
+    def _orphaned(self, job_id: str, now: float) -> bool:
+        claim = self._claims.get(job_id)
+        if not claim:
+            return True
+        if now - claim["claimed_at"] > self.lease_s:
+            return True
+        if claim["claimed_by"] == self.replica_id:
+            return job_id not in self._inflight
+        beat = self.store.replicas.get(claim["claimed_by"])
+        return beat is None or now - beat > self.heartbeat_ttl_s
+
+    def recover_orphans(self) -> int:
+        """Re-queue executing jobs whose replica is gone — past the claim lease, owned by a replica
+        whose heartbeat lapsed, or this replica's own claim no dispatch here holds. A live peer's
+        in-flight job is left alone (the runtime's rule; re-firing it would double a bot join)."""
+        now = self.clock.now()
+        recovered = 0
+        with self._lock:
+            for job_id in [j for j in self._executing if self._orphaned(j, now)]:
+                job = json.loads(self._executing.pop(job_id))
+                claim = self._claims.pop(job_id, None) or {}
+                job["status"] = "pending"
+                self._jobs[json.dumps(job)] = now
+                logger.warning("recovered orphaned job %s (claimed by %s)", job_id,
+                               claim.get("claimed_by", "unknown"))
+                recovered += 1
+        return recovered
+
     def _reschedule_cron(self, job: Dict[str, Any]) -> None:
         cron = job.get("cron")
         if not cron:
@@ -142,14 +234,31 @@ class Scheduler:
             }
         )
 
+    def _claim(self, now: float, limit: int) -> List[Tuple[str, float]]:
+        """Pop up to `limit` due jobs (lowest execute_at first) into executing, atomically."""
+        with self._lock:
+            due = sorted(((r, sc) for r, sc in self._jobs.items() if sc <= now), key=lambda x: x[1])[:limit]
+            for raw, _ in due:
+                del self._jobs[raw]
+                job = json.loads(raw)
+                job["status"] = "executing"
+                self._executing[job["job_id"]] = json.dumps(job)
+                self._claims[job["job_id"]] = {"claimed_by": self.replica_id, "claimed_at": now}
+                self._inflight.add(job["job_id"])
+            return due
+
     def _process(self, raw: str) -> None:
+        """Run one CLAIMED job (already out of the sorted set, recorded as executing)."""
+        try:
+            self._run(raw)
+        finally:
+            with self._lock:
+                self._inflight.discard(json.loads(raw)["job_id"])
+
+    def _run(self, raw: str) -> None:
         job = json.loads(raw)
         job_id = job["job_id"]
-        # Atomic claim — if it's already gone (taken/cancelled), skip.
-        if self._jobs.pop(raw, None) is None:
-            return
         job["status"] = "executing"
-        self._executing[job_id] = json.dumps(job)
 
         retry = job.get("retry", {})
         try:
@@ -165,8 +274,10 @@ class Scheduler:
                 delay = backoff[min(attempt - 1, len(backoff) - 1)]
                 job["retry"]["attempt"] = attempt
                 job["status"] = "pending"
-                self._executing.pop(job_id, None)
-                self._jobs[json.dumps(job)] = self.clock.now() + delay
+                with self._lock:
+                    self._executing.pop(job_id, None)
+                    self._claims.pop(job_id, None)
+                    self._jobs[json.dumps(job)] = self.clock.now() + delay
                 logger.warning(
                     "job %s attempt %d/%d failed (%s), retry in %ss",
                     job_id, attempt, max_attempts, e, delay,
@@ -177,19 +288,53 @@ class Scheduler:
             job["failed_at"] = self.clock.now()
             logger.error("job %s permanently failed after %d attempts: %s", job_id, max_attempts, e)
 
-        self._executing.pop(job_id, None)
-        self._history[job_id] = json.dumps(job)
-        if job["status"] == "completed":
-            self._reschedule_cron(job)
+        with self._lock:
+            self._executing.pop(job_id, None)
+            self._claims.pop(job_id, None)
+            self._history[job_id] = json.dumps(job)
+            if job["status"] == "completed":
+                self._reschedule_cron(job)
 
     def tick(self) -> int:
         """Fire every job due at the current Clock time. Returns the count processed.
 
-        A real deployment loops `tick()` on an interval; the eval calls it explicitly after
-        advancing the FakeClock.
+        Drains in claims of `batch_size`, each fanned out over up to `concurrency` threads; a short
+        claim ends the tick. A real deployment loops `tick()` on an interval; the eval calls it
+        explicitly after advancing the FakeClock.
         """
         now = self.clock.now()
-        due = [raw for raw, score in self._jobs.items() if score <= now]
-        for raw in due:
-            self._process(raw)
-        return len(due)
+        self.heartbeat()
+        processed = 0
+        while True:
+            claimed = self._claim(now, self.batch_size)
+            if not claimed:
+                break
+            members = [raw for raw, _ in claimed]
+            if self.concurrency == 1 or len(members) == 1:
+                for raw in members:
+                    self._process(raw)
+            else:
+                if self._pool is None:
+                    self._pool = ThreadPoolExecutor(max_workers=self.concurrency, thread_name_prefix="scheduler-dispatch")
+                list(self._pool.map(self._process, members))
+            processed += len(claimed)
+            with self._lock:
+                self._claimed += len(claimed)
+                self._lag_s.extend(max(0.0, now - sc) for _, sc in claimed)
+            if len(claimed) < self.batch_size:
+                break
+        return processed
+
+    def stats(self) -> Dict[str, Any]:
+        """Claimed count + schedule lag (seconds a job sat due before it was claimed)."""
+        with self._lock:
+            return {
+                "claimed": self._claimed,
+                "batch_size": self.batch_size,
+                "concurrency": self.concurrency,
+                "replica_id": self.replica_id,
+                "inflight": len(self._inflight),
+                "lag_s_p50": _percentile(self._lag_s, 0.50),
+                "lag_s_p99": _percentile(self._lag_s, 0.99),
+                "lag_s_max": round(max(self._lag_s), 3) if self._lag_s else None,
+            }
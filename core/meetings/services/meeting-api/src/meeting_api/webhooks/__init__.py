@@ -14,6 +14,7 @@ in `meetings/contracts/webhook.v1`.
 * ``WebhookSink`` — the port: build → SSRF-guard → filter → deliver → enqueue-on-failure.
 * ``RetryQueue`` — the fakeredis-backed exponential-backoff retry queue.
 * ``drain_retry_queue`` — the retry-worker sweep (the worker loop's one tick).
+* ``DeliveryEngine`` / ``delivery_engine_from_env`` — the pooled, per-endpoint-bounded transport.
 * ``WEBHOOK_API_VERSION`` / ``RETRY_QUEUE_KEY`` / ``BACKOFF_SCHEDULE`` — frozen constants.
 """
 from .delivery import (
@@ -27,6 +28,8 @@ from .delivery import (
     sign_payload,
     verify_signature,
 )
+from .engine import DeliveryEngine
+from .engine import from_env as delivery_engine_from_env
 from .ledger import (
     DEFAULT_MAX_PER_USER,
     InMemoryDeliveryLedger,
@@ -57,6 +60,8 @@ __all__ = [
     "RETRY_QUEUE_KEY",
     "RetryQueue",
     "drain_retry_queue",
+    "DeliveryEngine",
+    "delivery_engine_from_env",
     "DEFAULT_MAX_PER_USER",
     "InMemoryDeliveryLedger",
     "RedisDeliveryLedger",
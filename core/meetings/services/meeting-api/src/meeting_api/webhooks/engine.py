@@ -0,0 +1,237 @@
+"""Pooled, bounded webhook delivery — the ``Transport`` both delivery paths share when
+``WEBHOOK_DELIVERY_POOLED`` is on.
+
+Without it every POST opens a fresh ``httpx.AsyncClient`` (a new TCP + TLS handshake per event) and
+the retry drain resolves its queue one entry at a time, so ONE slow receiver (the 10s timeout times
+its backlog) holds up every other customer's retries. ``DeliveryEngine``:
+
+  * keeps one keep-alive ``httpx.AsyncClient`` per destination endpoint (``scheme://host:port``).
+    Each is still IP-pinned (``ssrf.build_pinned_transport`` re-validates every request) and is never
+    shared across hostnames, so a TLS connection negotiated for one host is never reused for another
+    that happens to resolve to the same IP. Idle endpoints past ``max_endpoints`` are closed, LRU;
+  * bounds each endpoint to ``max_per_endpoint`` concurrent POSTs and the process to
+    ``max_concurrency``. A delivery takes its ENDPOINT slot first and only then a global worker, so a
+    slow receiver's backlog queues on its own semaphore without holding the workers everyone else
+    needs;
+  * records per endpoint: queued (waiting for a slot) and in-flight gauges, delivered/failed
+    counters, HTTP latency p50/p99 and the slot wait. Through ``transport`` (the lifecycle
+    callback's first send) that wait IS the time-to-first-attempt; ``retry_transport`` (the drain)
+    records its wait separately.
+
+Endpoints are labelled by host only — a webhook URL's path or query can carry a token (P14). The
+snapshot is served on ``/health`` as ``pipeline.webhooks``.
+
+The drain half is ``retry.drain_retry_queue(parallel=True, endpoint_budget=…)``: claims stay
+sequential (the reliable-queue invariants), the deliveries resolve concurrently through this engine.
+
+Batching several events into one POST is deliberately NOT here: webhook.v1 is sealed as one
+Envelope per body, so that is a contract change (``lane:contract``), not a delivery knob.
+"""
+from __future__ import annotations
+
+import asyncio
+import math
+import os
+import time
+from collections import OrderedDict, deque
+from typing import Any, Callable, Deque, Dict, Optional, Set
+from urllib.parse import urlsplit
+
+POOLED = os.environ.get("WEBHOOK_DELIVERY_POOLED", "false").strip().lower() in ("1", "true", "yes", "on")
+
+DEFAULT_MAX_CONCURRENCY = 32
+DEFAULT_MAX_PER_ENDPOINT = 4
+DEFAULT_MAX_ENDPOINTS = 256
+# The per-request timeout retry.DEFAULT_LEASE_SECONDS is sized against — keep the two in step.
+DEFAULT_TIMEOUT_S = 10.0
+KEEPALIVE_EXPIRY_S = 30.0
+# Latency / wait samples kept per endpoint for the p50/p99 (a sliding window, not all time).
+_SAMPLES = 512
+
+
+def endpoint_key(url: str) -> str:
+    """``scheme://host:port`` — the pool, the concurrency bound and the metrics label of a URL."""
+    parts = urlsplit(url)
+    scheme = (parts.scheme or "https").lower()
+    host = (parts.hostname or "").lower()
+    try:
+        port = parts.port
+    except ValueError:
+        port = None
+    return f"{scheme}://{host}:{port or (443 if scheme == 'https' else 80)}"
+
+
+def _percentile(samples: Deque[float], q: float) -> Optional[float]:
+    if not samples:
+        return None
+    ordered = sorted(samples)
+    return round(ordered[max(0, math.ceil(q * len(ordered)) - 1)], 1)
+
+
+class _Endpoint:
+    __slots__ = ("slots", "client", "queued", "in_flight", "delivered", "failed",
+                 "latency_ms", "first_wait_ms", "retry_wait_ms")
+
+    def __init__(self, limit: int, client: Any):
+        self.slots = asyncio.Semaphore(limit)
+        self.client = client
+        self.queued = 0
+        self.in_flight = 0
+        self.delivered = 0
+        self.failed = 0
+        self.latency_ms: Deque[float] = deque(maxlen=_SAMPLES)
+        self.first_wait_ms: Deque[float] = deque(maxlen=_SAMPLES)
+        self.retry_wait_ms: Deque[float] = deque(maxlen=_SAMPLES)
+
+    def idle(self) -> bool:
+        return self.queued == 0 and self.in_flight == 0
+
+    def snapshot(self) -> dict:
+        return {
+            "queued": self.queued,
+            "in_flight": self.in_flight,
+            "delivered": self.delivered,
+            "failed": self.failed,
+            "latency_ms_p50": _percentile(self.latency_ms, 0.50),
+            "latency_ms_p99": _percentile(self.latency_ms, 0.99),
+            "first_attempt_wait_ms_p99": _percentile(self.first_wait_ms, 0.99),
+            "retry_wait_ms_p99": _percentile(self.retry_wait_ms, 0.99),
+        }
+
+
+class DeliveryEngine:
+    def __init__(
+        self,
+        *,
+        max_concurrency: int = DEFAULT_MAX_CONCURRENCY,
+        max_per_endpoint: int = DEFAULT_MAX_PER_ENDPOINT,
+        max_endpoints: int = DEFAULT_MAX_ENDPOINTS,
+        timeout_s: float = DEFAULT_TIMEOUT_S,
+        client_factory: Optional[Callable[[str], Any]] = None,
+        clock: Optional[Callable[[], float]] = None,
+    ):
+        if max_concurrency <= 0 or max_per_endpoint <= 0 or max_endpoints <= 0 or timeout_s <= 0:
+            raise ValueError("max_concurrency, max_per_endpoint, max_endpoints and timeout_s must be > 0")
+        self.max_concurrency = max_concurrency
+        self.max_per_endpoint = max_per_endpoint
+        self.max_endpoints = max_endpoints
+        self.timeout_s = float(timeout_s)
+        self._client_factory = client_factory or self._pinned_client
+        self._clock = clock or time.monotonic
+        self._workers = asyncio.Semaphore(max_concurrency)
+        self._endpoints: "OrderedDict[str, _Endpoint]" = OrderedDict()
+        self._closing: Set[asyncio.Future] = set()
+
+    def _pinned_client(self, key: str) -> Any:
+        import httpx
+
+        from .ssrf import build_pinned_transport
+
+        limits = httpx.Limits(
+            max_connections=self.max_per_endpoint,
+            max_keepalive_connections=self.max_per_endpoint,
+            keepalive_expiry=KEEPALIVE_EXPIRY_S,
+        )
+        return httpx.AsyncClient(
+            timeout=self.timeout_s,
+            transport=build_pinned_transport(httpx.AsyncHTTPTransport(limits=limits)),
+        )
+
+    # ---- endpoints ----
+    def _endpoint(self, key: str) -> _Endpoint:
+        ep = self._endpoints.get(key)
+        if ep is not None:
+            self._endpoints.move_to_end(key)
+            return ep
+        ep = self._endpoints[key] = _Endpoint(self.max_per_endpoint, self._client_factory(key))
+        if len(self._endpoints) > self.max_endpoints:
+            for old in [k for k, e in self._endpoints.items() if e.idle() and k != key]:
+                self._close_later(self._endpoints.pop(old).client)
+                if len(self._endpoints) <= self.max_endpoints:
+                    break
+        return ep
+
+    def _close_later(self, client: Any) -> None:
+        aclose = getattr(client, "aclose", None)
+        if aclose is None:
+            return
+        task = asyncio.ensure_future(aclose())
+        self._closing.add(task)
+        task.add_done_callback(self._closing.discard)
+
+    # ---- delivery ----
+    async def post(self, url: str, body: bytes, headers: Dict[str, str], *, first_attempt: bool = True) -> Any:
+        """POST through the endpoint's pool once an endpoint slot AND a worker are free."""
+        ep = self._endpoint(endpoint_key(url))
+        asked = self._clock()
+        ep.queued += 1
+        try:
+            await ep.slots.acquire()
+            try:
+                await self._workers.acquire()
+            except BaseException:
+                ep.slots.release()
+                raise
+        finally:
+            ep.queued -= 1
+        started = self._clock()
+        (ep.first_wait_ms if first_attempt else ep.retry_wait_ms).append((started - asked) * 1000)
+        ep.in_flight += 1
+        try:
+            resp = await ep.client.post(url, content=body, headers=headers)
+        except BaseException:
+            ep.failed += 1
+            raise
+        finally:
+            ep.latency_ms.append((self._clock() - started) * 1000)
+            ep.in_flight -= 1
+            self._workers.release()
+            ep.slots.release()
+        if getattr(resp, "status_code", 0) < 300:
+            ep.delivered += 1
+        else:
+            ep.failed += 1
+        return resp
+
+    async def transport(self, url: str, body: bytes, headers: Dict[str, str]) -> Any:
+        """The ``WebhookSink`` transport: a first attempt."""
+        return await self.post(url, body, headers, first_attempt=True)
+
+    async def retry_transport(self, url: str, body: bytes, headers: Dict[str, str]) -> Any:
+        """The ``drain_retry_queue`` transport: a redelivery."""
+        return await self.post(url, body, headers, first_attempt=False)
+
+    async def aclose(self) -> None:
+        for ep in self._endpoints.values():
+            self._close_later(ep.client)
+        self._endpoints.clear()
+        if self._closing:
+            await asyncio.gather(*self._closing, return_exceptions=True)
+
+    def stats(self) -> dict:
+        endpoints = {key: ep.snapshot() for key, ep in self._endpoints.items()}
+        return {
+            "pooled": True,
+            "max_concurrency": self.max_concurrency,
+            "max_per_endpoint": self.max_per_endpoint,
+            "in_flight": sum(e["in_flight"] for e in endpoints.values()),
+            "queued": sum(e["queued"] for e in endpoints.values()),
+            "endpoints": endpoints,
+        }
+
+
+def from_env(getenv: Callable[[str, str], str] = None) -> Optional[DeliveryEngine]:
+    """Build the production engine from env, or ``None`` (a fresh client per POST, as before).
+
+    ``WEBHOOK_DELIVERY_POOLED=1`` → on: ``WEBHOOK_MAX_CONCURRENCY`` (32), ``WEBHOOK_MAX_PER_ENDPOINT``
+    (4)."""
+    if getenv is None:
+        if not POOLED:
+            return None
+        getenv = os.getenv
+    elif getenv("WEBHOOK_DELIVERY_POOLED", "false").strip().lower() not in ("1", "true", "yes", "on"):
+        return None
+    return DeliveryEngine(
+        max_concurrency=int(getenv("WEBHOOK_MAX_CONCURRENCY", str(DEFAULT_MAX_CONCURRENCY))),
+        max_per_endpoint=int(getenv("WEBHOOK_MAX_PER_ENDPOINT", str(DEFAULT_MAX_PER_ENDPOINT))),
+    )
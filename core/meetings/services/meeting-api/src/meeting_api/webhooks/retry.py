@@ -27,12 +27,14 @@ as `WebhookSink`, so the worker drains against the fake receiver too.
 """
 from __future__ import annotations
 
+import asyncio
 import json
 import time
 from typing import Any, Awaitable, Callable, Dict, List, Optional
 from uuid import uuid4
 
 from .delivery import build_headers
+from .engine import endpoint_key
 
 RETRY_QUEUE_KEY = "webhook:retry_queue"
 
@@ -218,6 +220,9 @@ async def drain_retry_queue(
     key: str = RETRY_QUEUE_KEY,
     processing_key: str = PROCESSING_KEY,
     dead_letter_key: str = DEAD_LETTER_KEY,
+    parallel: bool = False,
+    endpoint_budget: Optional[int] = None,
+    max_inflight: Optional[int] = None,
 ) -> int:
     """One crash-safe worker sweep: process every READY entry once. Returns #processed.
 
@@ -236,6 +241,19 @@ async def drain_retry_queue(
 
     A crash at ANY point leaves the in-flight entry in the processing list, recoverable at lease
     expiry — never held only in process memory (the loss the old LPOP-hold-RPUSH drain had).
+
+    ``parallel=True`` (the pooled ``engine.DeliveryEngine`` transport) keeps the claims sequential but
+    resolves the due deliveries concurrently, so one slow receiver no longer serialises the sweep —
+    the engine's per-endpoint bound is what limits it. ``endpoint_budget`` caps the deliveries ONE
+    endpoint gets per sweep; the rest go back to the queue untouched, like a not-yet-due entry, and
+    are picked up next tick. Each entry is still finalised by its own exact-match LREM, so the
+    crash-safety argument above is unchanged.
+
+    ``max_inflight`` caps the deliveries ONE parallel sweep claims (pass the engine's concurrency). A
+    claim is lease-stamped when it is taken, so an entry claimed beyond the engine's slots would wait
+    behind whole waves of transport timeouts and outlive the lease — and a peer's reclaim would
+    redeliver it while it is still in flight. Capped, every claimed entry starts at once; the rest stay
+    in the queue for the next tick.
     """
     clock = time.time() if now is None else now
 
@@ -249,8 +267,38 @@ async def drain_retry_queue(
         return 0
 
     processed = 0
+    per_endpoint: Dict[str, int] = {}
+    pending: List[asyncio.Task] = []
+
+    async def _resolve(entry: dict, stamped: str) -> None:
+        attempt = entry.get("attempt", 0)
+        success, status_code, error = await _deliver_one(entry, transport)
+
+        if success:
+            await redis.lrem(processing_key, 1, stamped)  # ack — drop from processing
+            return
+
+        # The first wait (BACKOFF[0]) was already applied at enqueue, so the next wait is
+        # BACKOFF[attempt + 1]. When that index runs off the end the schedule is exhausted.
+        next_idx = attempt + 1
+        if next_idx >= len(BACKOFF_SCHEDULE):
+            # exhausted — dead-letter (permanently failed)
+            await _dead_letter(
+                redis, entry, reason="schedule_exhausted",
+                status_code=status_code, error=error, now=clock, key=dead_letter_key,
+            )
+            await redis.lrem(processing_key, 1, stamped)
+            return
+        entry["attempt"] = next_idx
+        entry["next_retry_at"] = clock + BACKOFF_SCHEDULE[next_idx]
+        # Re-queue to the HEAD (LPUSH: not re-popped this sweep, since we claim from the tail) and
+        # LPUSH-before-LREM so a crash here duplicates rather than loses (deduped on event_id).
+        await redis.lpush(key, json.dumps(entry))
+        await redis.lrem(processing_key, 1, stamped)
 
     for _ in range(queue_len):
+        if parallel and max_inflight is not None and len(pending) >= max_inflight:
+            break  # the sweep's slots are spent — leave the rest queued, unclaimed
         raw = await redis.rpoplpush(key, processing_key)  # atomic claim into the processing list
         if raw is None:
             break
@@ -271,7 +319,6 @@ async def drain_retry_queue(
 
         created_at = entry.get("created_at", 0)
         next_retry_at = entry.get("next_retry_at", 0)
-        attempt = entry.get("attempt", 0)
 
         if clock - created_at > MAX_AGE_SECONDS:
             processed += 1  # expired — dead-letter (don't deliver)
@@ -279,37 +326,32 @@ async def drain_retry_queue(
             await redis.lrem(processing_key, 1, stamped)
             continue
 
-        if next_retry_at > clock:
-            # not due yet — return the ORIGINAL entry to the queue HEAD (LPUSH: we claim from the
-            # tail via RPOPLPUSH, so a head re-queue is not re-popped within this same sweep).
+        over_budget = False
+        if endpoint_budget is not None and next_retry_at <= clock:
+            ep = endpoint_key(str(entry.get("url", "")))
+            over_budget = per_endpoint.get(ep, 0) >= endpoint_budget
+            if not over_budget:
+                per_endpoint[ep] = per_endpoint.get(ep, 0) + 1
+
+        if next_retry_at > clock or over_budget:
+            # not due yet (or this endpoint's share of the sweep is spent) — return the ORIGINAL
+            # entry to the queue HEAD (LPUSH: we claim from the tail via RPOPLPUSH, so a head
+            # re-queue is not re-popped within this same sweep).
             # LPUSH-before-LREM so a crash here duplicates rather than loses (deduped on event_id).
             await redis.lpush(key, raw)
             await redis.lrem(processing_key, 1, stamped)
             continue
 
-        success, status_code, error = await _deliver_one(entry, transport)
         processed += 1
-
-        if success:
-            await redis.lrem(processing_key, 1, stamped)  # ack — drop from processing
-            continue
-
-        # The first wait (BACKOFF[0]) was already applied at enqueue, so the next wait is
-        # BACKOFF[attempt + 1]. When that index runs off the end the schedule is exhausted.
-        next_idx = attempt + 1
-        if next_idx >= len(BACKOFF_SCHEDULE):
-            # exhausted — dead-letter (permanently failed)
-            await _dead_letter(
-                redis, entry, reason="schedule_exhausted",
-                status_code=status_code, error=error, now=clock, key=dead_letter_key,
-            )
-            await redis.lrem(processing_key, 1, stamped)
-            continue
-        entry["attempt"] = next_idx
-        entry["next_retry_at"] = clock + BACKOFF_SCHEDULE[next_idx]
-        # Re-queue to the HEAD (LPUSH: not re-popped this sweep, since we claim from the tail) and
-        # LPUSH-before-LREM so a crash here duplicates rather than loses (deduped on event_id).
-        await redis.lpush(key, json.dumps(entry))
-        await redis.lrem(processing_key, 1, stamped)
+        if parallel:
+            pending.append(asyncio.ensure_future(_resolve(entry, stamped)))
+        else:
+            await _resolve(entry, stamped)
+
+    if pending:
+        results = await asyncio.gather(*pending, return_exceptions=True)
+        for result in results:
+            if isinstance(result, BaseException):
+                raise result  # a redis failure mid-resolve; the entry stays in processing (lease)
 
     return processed
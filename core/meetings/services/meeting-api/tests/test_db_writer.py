@@ -102,6 +102,32 @@ async def test_consumer_tick_then_db_writer_tick_lands_segments_durably(store, b
     assert await redis_c.smembers(ACTIVE_MEETINGS_KEY) == set()
 
 
+async def test_db_writer_tick_records_flush_latency(store, bus, redis_c):
+    """``pipeline.db_writer``: a tick that stores segments records the sink call and each segment's
+    updated_at → durable age (here ≈ the 120s jump to LATER); a failed write is counted, not timed."""
+    from meeting_api.collector.db_writer import flush_stats
+
+    flush_stats.reset()
+    await bus.xadd("transcription_segments", json.loads(_message(1, [
+        _seg("s1", 1.0, "Hello"), _seg("s2", 2.5, "world"),
+    ])["payload"]))
+    await consume_segments(store, bus)
+
+    class _DownSink:
+        async def upsert_segments(self, meeting_id, segments):
+            raise RuntimeError("postgres down")
+
+    await db_writer_tick(redis_c, _DownSink(), now=LATER)
+    await db_writer_tick(redis_c, store, now=LATER)
+    snap = flush_stats.snapshot()
+    assert snap["ticks"] == 2 and snap["segments"] == 2 and snap["failures"] == 1
+    assert snap["latency_ms"]["sink_ms"]["count"] == 1
+    durable = snap["latency_ms"]["durable_ms"]
+    assert durable["count"] == 2
+    assert durable["buckets"]["60000"] == 0 and durable["buckets"]["120000"] == 2
+    assert snap["last_tick_ms"] is not None
+
+
 async def test_db_writer_tick_is_idempotent_and_upserts_rewrites(store, bus, redis_c):
     await bus.xadd("transcription_segments", json.loads(_message(1, [_seg("s1", 1.0, "draft")])["payload"]))
     await consume_segments(store, bus)
@@ -493,3 +519,98 @@ async def test_rest_after_completion_with_redis_wiped_serves_transcript_and_proc
     assert [n["text"] for n in views[0]["doc"]["notes"]] == ["Closing words, cleaned."]
     assert views[0]["params"] == {"model": "claude-x"}
     assert_api_conforms("TranscriptionResponse", body)
+
+
+# ── (e) the batched flush — ripe index, pipelined redis, one multi-meeting durable write ─────────
+
+class _CommandCountingRedis(_ScanCountingRedis):
+    """Counts the per-meeting sweep's whole-hash reads — the batched tick must issue none."""
+
+    def __init__(self, inner):
+        super().__init__(inner)
+        self.hgetall_calls = 0
+
+    async def hgetall(self, *args, **kwargs):
+        self.hgetall_calls += 1
+        return await self._inner.hgetall(*args, **kwargs)
+
+
+@pytest.fixture
+def batched(monkeypatch):
+    """Batched mode on the WRITE side too: append_segment ZADDs the ripe index."""
+    from meeting_api.collector import db_writer
+
+    monkeypatch.setattr(db_writer, "DB_WRITER_BATCHED", True)
+    return db_writer
+
+
+async def _ingest_two_meetings(store, bus):
+    store.seed_meeting(user_id=USER, platform="google_meet", native_meeting_id="zzz-zzzz-zzz", meeting_id=2)
+    await bus.xadd("transcription_segments", json.loads(_message(1, [
+        _seg("s1", 1.0, "Hello"), _seg("s2", 2.5, "world"),
+    ])["payload"]))
+    await bus.xadd("transcription_segments", json.loads(_message(2, [_seg("t1", 0.5, "Other room")])["payload"]))
+    assert await consume_segments(store, bus) == 3
+
+
+async def test_batched_tick_flushes_every_meeting_in_one_durable_write(batched, store, bus, redis_c):
+    await _ingest_two_meetings(store, bus)
+    assert await redis_c.zcard(batched.SEGMENTS_BY_UPDATED_KEY) == 3
+
+    spy = _CommandCountingRedis(redis_c)
+    assert await db_writer_tick(spy, store, now=LATER) == 3
+    assert spy.hgetall_calls == 0 and spy.scan_calls == 0   # only the ripe fields were fetched
+    assert store.upsert_batches == 1                        # both meetings, ONE sink transaction
+    assert _durable_texts(store, 1) == ["Hello", "world"] and _durable_texts(store, 2) == ["Other room"]
+    # Trim-after-confirm across meetings: hashes, index and sweep set all drained.
+    assert await redis_c.hlen(segments_hash_key(1)) == 0 and await redis_c.hlen(segments_hash_key(2)) == 0
+    assert await redis_c.zcard(batched.SEGMENTS_BY_UPDATED_KEY) == 0
+    assert await redis_c.smembers(ACTIVE_MEETINGS_KEY) == set()
+
+
+async def test_batched_tick_leaves_the_mutable_tail_unfetched(batched, store, bus, redis_c):
+    await bus.xadd("transcription_segments", json.loads(_message(1, [_seg("s1", 1.0, "fresh")])["payload"]))
+    await consume_segments(store, bus)
+    assert await db_writer_tick(redis_c, store) == 0          # real `now` — seconds old, not ripe
+    assert await redis_c.hlen(segments_hash_key(1)) == 1
+    assert await redis_c.zcard(batched.SEGMENTS_BY_UPDATED_KEY) == 1
+    assert await db_writer_tick(redis_c, store, now=LATER) == 1
+
+
+async def test_batched_tick_isolates_a_failing_meeting(batched, store, bus, redis_c):
+    """The multi-meeting write fails ⇒ per-meeting retry: meeting 1 lands and is trimmed, meeting 2's
+    hash and index entries stay intact for the next tick (trim-after-confirm, per meeting)."""
+    await _ingest_two_meetings(store, bus)
+
+    class _OneBadMeeting:
+        async def upsert_segments_many(self, batches):
+            raise RuntimeError("one row poisons the transaction")
+
+        async def upsert_segments(self, meeting_id, segments):
+            if meeting_id == 2:
+                raise RuntimeError("postgres rejects meeting 2")
+            await store.upsert_segments(meeting_id, segments)
+
+    assert await db_writer_tick(redis_c, _OneBadMeeting(), now=LATER) == 2
+    assert _durable_texts(store, 1) == ["Hello", "world"]
+    assert await redis_c.hlen(segments_hash_key(1)) == 0
+    assert await redis_c.hlen(segments_hash_key(2)) == 1
+    members = {m.decode() for m in await redis_c.zrange(batched.SEGMENTS_BY_UPDATED_KEY, 0, -1)}
+    assert members == {"2:t1"}
+
+    assert await db_writer_tick(redis_c, store, now=LATER) == 1   # healthy sink drains the rest
+    assert _durable_texts(store, 2) == ["Other room"]
+
+
+async def test_batched_mode_self_heals_unindexed_hashes_on_reconcile(batched, store, redis_c):
+    """A field written before the index existed is invisible to the batched tick; the reconcile
+    tick still runs the per-meeting sweep and drains it (and prunes index members left stale)."""
+    seg = {**_seg("s9", 3.0, "pre-index"), "updated_at": "2026-06-20T09:00:00Z"}
+    await redis_c.sadd(ACTIVE_MEETINGS_KEY, "1")
+    await redis_c.hset(segments_hash_key(1), "s9", json.dumps(seg))      # NO index entry
+    await redis_c.zadd(batched.SEGMENTS_BY_UPDATED_KEY, {"1:gone": 0})    # index entry, NO field
+
+    assert await db_writer_tick(redis_c, store, now=LATER) == 0
+    assert await redis_c.zcard(batched.SEGMENTS_BY_UPDATED_KEY) == 0     # stale member pruned
+    assert await db_writer_tick(redis_c, store, now=LATER, reconcile=True) == 1
+    assert _durable_texts(store) == ["pre-index"]
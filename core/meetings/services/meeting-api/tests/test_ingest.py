@@ -8,7 +8,11 @@ Asserts:
   * a ``:mutable`` update is published on the EXACT channel the gateway ``/ws`` subscribes to
     (``tc:meeting:{id}:mutable``) with the bot's live payload shape;
   * malformed segments (missing segment_id / zero-length / inverted) are filtered;
-  * ``consume_segments`` drains a fakeredis stream batch via XREADGROUP + XACK.
+  * ``consume_segments`` drains a fakeredis stream batch via XREADGROUP + XACK;
+  * batched (``COLLECTOR_INGEST_BATCHED``): one store write + one publish per meeting per batch,
+    rewrites collapse, and a ``session_end`` still trails its segments on the transcript feed;
+  * a transcript.v1 ``trace`` rides to ``:mutable`` stamped ``ingested_ms`` ≤ ``mutable_ms`` and
+    never reaches the store.
 """
 from __future__ import annotations
 
@@ -146,3 +150,110 @@ async def test_consume_segments_drains_a_fakeredis_batch(store, bus):
     assert {s["text"] for s in doc["segments"]} == {"one", "two"}
     # acked: a second drain reads nothing new
     assert await consume_segments(store, bus) == 0
+
+
+# ── micro-batched ingest (COLLECTOR_INGEST_BATCHED) ──────────────────────────────────────────────
+
+def _seg(sid: str, start: float, text: str, *, completed: bool = True) -> dict:
+    return {"segment_id": sid, "start": start, "end": start + 1.0, "text": text,
+            "speaker": "Alice", "completed": completed}
+
+
+async def test_batched_consume_writes_and_publishes_once_per_meeting(store, bus):
+    from meeting_api.collector.ingest import ingest_stats
+
+    store.seed_meeting(user_id=8, platform="google_meet", native_meeting_id="zzz-zzzz-zzz", meeting_id=2)
+    ingest_stats.reset()
+    for payload in (
+        {"type": "transcription", "meeting_id": "1", "segments": [_seg("a", 0.0, "draft", completed=False)]},
+        {"type": "transcription", "meeting_id": "2", "segments": [_seg("x", 0.0, "other room")]},
+        {"type": "transcription", "meeting_id": "1", "segments": [_seg("a", 0.0, "final"), _seg("b", 1.0, "next")]},
+    ):
+        await bus.xadd(STREAM_NAME, payload)
+
+    # the drafted-then-finalized "a" collapses to its latest version: 3 distinct segments
+    assert await consume_segments(store, bus, batched=True) == 3
+    assert store.append_batches == 2                                  # ONE store write per meeting
+    assert sorted(ch for ch, _ in bus.published) == [_mutable_channel(1), _mutable_channel(2)]
+    m1 = json.loads(next(raw for ch, raw in bus.published if ch == _mutable_channel(1)))
+    assert [s["text"] for s in m1["confirmed"]] == ["final", "next"] and m1["pending"] == []
+    doc = await store.get_transcript(7, "google_meet", "abc-defg-hij")
+    assert [s["text"] for s in doc["segments"]] == ["final", "next"]
+
+    snap = ingest_stats.snapshot()
+    assert snap["batches"] == 1 and snap["messages"] == 3 and snap["last_batch_size"] == 3
+    assert snap["batch_size"]["5"] == 1 and snap["batch_size"]["2"] == 0
+    assert snap["publishes"] == 2 and snap["last_lag_ms"] is not None
+    assert await consume_segments(store, bus, batched=True) == 0      # bulk-acked: nothing re-reads
+
+
+async def test_batched_publish_splits_a_multi_speaker_batch_per_speaker(store, bus):
+    """A coalesced batch spanning speakers publishes one update per speaker (the bot's live-path
+    shape) — each segment rides under its OWN speaker, never the batch's first one."""
+    from meeting_api.collector import ingest_batch
+
+    bob = {**_seg("b", 1.0, "hi alice"), "speaker": "Bob"}
+    await ingest_batch(store, bus, [
+        {"payload": json.dumps({"type": "transcription", "meeting_id": "1",
+                                "segments": [_seg("a", 0.0, "hi bob"), bob]})},
+        {"payload": json.dumps({"type": "transcription", "meeting_id": "1",
+                                "segments": [_seg("c", 2.0, "draft", completed=False)]})},
+    ])
+    updates = [json.loads(raw) for ch, raw in bus.published if ch == _mutable_channel(1)]
+    assert [u["speaker"] for u in updates] == ["Alice", "Bob"]
+    alice, bob_update = updates
+    assert [s["text"] for s in alice["confirmed"]] == ["hi bob"]
+    assert [s["text"] for s in alice["pending"]] == ["draft"]
+    assert [s["text"] for s in bob_update["confirmed"]] == ["hi alice"] and bob_update["pending"] == []
+
+
+async def test_batched_ingest_keeps_session_end_after_its_segments(store, bus):
+    """A session_end mid-batch flushes that meeting's group FIRST, so the transcript feed still
+    reads segment → marker in stream order."""
+    from meeting_api.collector import ingest_batch
+    from meeting_api.collector.ingest import _transcript_stream
+
+    n = await ingest_batch(store, bus, [
+        {"payload": json.dumps({"type": "transcription", "meeting_id": "1", "segments": [_seg("a", 0.0, "bye")]})},
+        {"payload": json.dumps({"type": "session_end", "meeting_id": "1", "uid": "sess-1"})},
+        {"payload": "not-json{"},
+    ])
+    assert n == 1
+    feed = await bus._client.xrange(_transcript_stream(1))
+    assert [json.loads(f[b"payload"])["type"] for _, f in feed] == ["transcription", "session_end"]
+
+
+def test_ingest_stats_lag_is_the_oldest_entry_age():
+    from meeting_api.collector.ingest import IngestStats
+
+    stats = IngestStats()
+    stats.observe_batch(["1000-0", "1500-3", "bogus"], now_ms=4000)
+    assert stats.last_lag_ms == 3000 and stats.max_lag_ms == 3000
+    stats.observe_batch(["3900-0"], now_ms=4000)
+    assert stats.last_lag_ms == 100 and stats.max_lag_ms == 3000
+
+
+async def test_trace_rides_to_mutable_but_not_into_the_store(store, bus):
+    from meeting_api.collector.ingest import ingest_stats
+
+    ingest_stats.reset()
+    trace = {"captured_ms": 1000, "submitted_ms": 1200, "transcribed_ms": 1500, "published_ms": 1600, "bogus": "x"}
+    await ingest(store, bus, _message(1, [
+        {"segment_id": "ch-0:1:a", "start": 1.0, "end": 2.5, "text": "Hello", "speaker": "Alice",
+         "completed": True, "trace": trace},
+        {"segment_id": "ch-0:1:b", "start": 2.5, "end": 3.0, "text": "untraced", "speaker": "Alice",
+         "completed": True},
+    ]))
+    payload = json.loads(bus.published[0][1])
+    live = payload["confirmed"][0]["trace"]
+    assert {k: live[k] for k in ("captured_ms", "submitted_ms", "transcribed_ms", "published_ms")} == {
+        "captured_ms": 1000, "submitted_ms": 1200, "transcribed_ms": 1500, "published_ms": 1600}
+    assert "bogus" not in live
+    assert live["published_ms"] <= live["ingested_ms"] <= live["mutable_ms"]
+    assert "trace" not in payload["confirmed"][1]
+    # persistence is unchanged: no stored row carries the live-only trace
+    doc = await store.get_transcript(7, "google_meet", "abc-defg-hij")
+    assert doc["segments"] and all("trace" not in s for s in doc["segments"])
+    latency = ingest_stats.snapshot()["latency_ms"]
+    assert latency["stream_ms"]["count"] == 1 and latency["collector_ms"]["count"] == 1
+    ingest_stats.reset()
@@ -0,0 +1,249 @@
+"""Reconcile deadline index — the general reconcile examines only DUE meetings, re-arms each by its
+verdict, and is woken by workload exits (``lifecycle/deadlines.py`` + ``reconcile_due_nonterminal_sweep``).
+
+The per-row gates (liveness, confirmed teardown, bounded untracked escalation) are the ones
+``test_lifecycle_seam.py`` already pins for the full sweep — both sweeps share ``_reconcile_one``. This
+file proves only what the index adds: nothing due ⇒ no listing; a due row is re-read and reconciled or
+re-armed (alive → the re-check window, unconfirmed → one tick, bumped → its real deadline, terminal →
+dropped); an exit-woken row is probed even while its ``updated_at`` is fresh; the full pass
+re-derives the index; bot creation, status writes and exit callbacks arm/wake it.
+OFFLINE — fakeredis + the in-memory repo + the shipped app over ASGI.
+"""
+from __future__ import annotations
+
+import logging
+from datetime import datetime, timezone
+
+import httpx
+
+from meeting_api import create_app
+from meeting_api.bot_spawn.fakes import FakeRuntimeClient, InMemoryMeetingRepo
+from meeting_api.lifecycle.deadlines import DEADLINES_KEY, ReconcileDeadlines
+from meeting_api.lifecycle.reconcile import reconcile_due_nonterminal_sweep, wake_for_exited_workload
+
+LIFECYCLE = "/bots/internal/callback/lifecycle"
+RUNTIME = "/runtime/callback"
+GRACES = dict(stop_grace=45.0, active_grace=300.0, preactive_grace=660.0)
+log = logging.getLogger("test.reconcile.deadlines")
+
+
+class _CountingRepo(InMemoryMeetingRepo):
+    """Counts candidate listings — the query the index exists to avoid."""
+
+    def __init__(self):
+        super().__init__()
+        self.listings: list = []
+
+    async def list_reconcile_candidates(self, *, meeting_ids=None, **graces):
+        self.listings.append(meeting_ids)
+        return await super().list_reconcile_candidates(meeting_ids=meeting_ids, **graces)
+
+
+async def _seed(repo, *, status, workload=None, session_uid="sess-uid", native="m1", fresh=False):
+    m = await repo.create_meeting(user_id=1, platform="google_meet", native_meeting_id=native, data={})
+    await repo.create_session(meeting_id=m["id"], session_uid=session_uid)
+    if workload:
+        await repo.set_bot_container(meeting_id=m["id"], bot_container_id=workload)
+    repo.set_status(m["id"], status)
+    if fresh:
+        repo._meetings[m["id"]]["updated_at"] = datetime.now(timezone.utc).isoformat()
+    return m
+
+
+async def _sweep(repo, runtime, deadlines, **kw):
+    async def _post(body: dict):
+        repo.set_status(
+            next(s["meeting_id"] for s in repo.sessions if s["session_uid"] == body["connection_id"]),
+            body["status"],
+        )
+        return 200
+
+    return await reconcile_due_nonterminal_sweep(
+        repo, runtime, _post, deadlines, log=log, untracked_since={}, retry_after=5.0,
+        alive_recheck=300.0, **GRACES, **kw,
+    )
+
+
+async def _score(redis, meeting_id):
+    return await redis.zscore(DEADLINES_KEY, str(meeting_id))
+
+
+async def test_nothing_due_costs_no_listing(fake_redis):
+    repo = _CountingRepo()
+    await _seed(repo, status="active", workload="wl-1")
+    deadlines = ReconcileDeadlines(fake_redis, **GRACES)
+    assert await _sweep(repo, FakeRuntimeClient(workloads={}), deadlines) == 0
+    assert repo.listings == []
+
+
+async def test_note_arms_one_grace_out_and_a_terminal_drops_it(fake_redis):
+    deadlines = ReconcileDeadlines(fake_redis, **GRACES, clock=lambda: 1000.0)
+    await deadlines.note(7, "stopping")
+    assert await _score(fake_redis, 7) == 1045.0
+    await deadlines.note(7, "awaiting_admission")
+    assert await _score(fake_redis, 7) == 1660.0
+    await deadlines.note(7, "completed")
+    assert await _score(fake_redis, 7) is None
+
+
+async def test_a_due_dead_workload_is_reconciled_and_leaves_the_index(fake_redis):
+    repo = _CountingRepo()
+    m = await _seed(repo, status="active", workload="wl-dead")
+    other = await _seed(repo, status="active", workload="wl-other", session_uid="s2", native="m2")
+    runtime = FakeRuntimeClient(workloads={"wl-dead": {"state": "exited", "exitCode": 137}})
+    deadlines = ReconcileDeadlines(fake_redis, **GRACES)
+    await deadlines.wake(m["id"])
+
+    assert await _sweep(repo, runtime, deadlines) == 1
+    assert repo._meetings[m["id"]]["status"] == "completed"
+    assert repo.listings == [[m["id"]]]  # only the due row was read — `other` was never looked at
+    assert repo._meetings[other["id"]]["status"] == "active"
+    assert await deadlines.members() == []
+
+
+async def test_a_live_workload_waits_the_recheck_window_instead_of_every_tick(fake_redis):
+    repo = _CountingRepo()
+    m = await _seed(repo, status="active", workload="wl-live")
+    runtime = FakeRuntimeClient(workloads={"wl-live": {"state": "running"}})
+    deadlines = ReconcileDeadlines(fake_redis, **GRACES)
+    await deadlines.wake(m["id"])
+
+    assert await _sweep(repo, runtime, deadlines) == 0
+    assert await _score(fake_redis, m["id"]) >= deadlines.now() + 299
+    assert await _sweep(repo, runtime, deadlines) == 0
+    assert len(repo.listings) == 1  # not due again — no second probe
+
+
+async def test_an_untracked_workload_is_retried_next_tick(fake_redis):
+    repo = InMemoryMeetingRepo()
+    m = await _seed(repo, status="active", workload="wl-gone")
+    deadlines = ReconcileDeadlines(fake_redis, **GRACES)
+    await deadlines.wake(m["id"])
+
+    assert await _sweep(repo, FakeRuntimeClient(workloads={}), deadlines) == 0
+    assert repo._meetings[m["id"]]["status"] == "active"  # a 404 is never evidence
+    assert await _score(fake_redis, m["id"]) <= deadlines.now() + 5.0
+
+
+async def test_a_bumped_row_is_rearmed_at_its_real_deadline(fake_redis):
+    repo = InMemoryMeetingRepo()
+    m = await _seed(repo, status="stopping", fresh=True)
+    deadlines = ReconcileDeadlines(fake_redis, **GRACES)
+    await deadlines.wake(m["id"])
+
+    assert await _sweep(repo, None, deadlines) == 0
+    assert repo._meetings[m["id"]]["status"] == "stopping"
+    assert deadlines.now() + 40 < await _score(fake_redis, m["id"]) <= deadlines.now() + 45
+
+
+async def test_an_exit_wake_probes_a_fresh_row_instead_of_deferring_it_a_grace(fake_redis):
+    """A segment burst bumped ``updated_at`` just before the bot crashed: the wake is the evidence,
+    so the row skips the staleness gate and the probe's "gone" reaps it now."""
+    repo = InMemoryMeetingRepo()
+    m = await _seed(repo, status="active", workload="wl-dead", fresh=True)
+    runtime = FakeRuntimeClient(workloads={"wl-dead": {"state": "exited", "exitCode": 137}})
+    deadlines = ReconcileDeadlines(fake_redis, **GRACES)
+    await deadlines.note(m["id"], "active")
+    assert await _sweep(repo, runtime, deadlines) == 0            # not due, not woken: untouched
+
+    assert await wake_for_exited_workload(repo, deadlines, "wl-dead", "exited", log=log) is True
+    assert await _sweep(repo, runtime, deadlines) == 1
+    assert repo._meetings[m["id"]]["status"] == "completed"
+    assert await deadlines.members() == [] and await deadlines.woken() == set()
+
+
+async def test_a_woken_fresh_row_whose_workload_is_alive_waits_the_recheck_window(fake_redis):
+    repo = InMemoryMeetingRepo()
+    m = await _seed(repo, status="active", workload="wl-live", fresh=True)
+    deadlines = ReconcileDeadlines(fake_redis, **GRACES)
+    await deadlines.wake(m["id"])
+
+    runtime = FakeRuntimeClient(workloads={"wl-live": {"state": "running"}})
+    assert await _sweep(repo, runtime, deadlines) == 0
+    assert repo._meetings[m["id"]]["status"] == "active"
+    assert await _score(fake_redis, m["id"]) >= deadlines.now() + 299
+    assert await deadlines.woken() == set()                        # the mark is spent once probed
+
+
+async def test_a_due_id_that_is_already_terminal_is_dropped(fake_redis):
+    repo = InMemoryMeetingRepo()
+    m = await _seed(repo, status="completed")
+    deadlines = ReconcileDeadlines(fake_redis, **GRACES)
+    await deadlines.wake(m["id"])
+    assert await _sweep(repo, None, deadlines) == 0
+    assert await deadlines.members() == []
+
+
+async def test_the_full_pass_rederives_the_index(fake_redis):
+    repo = InMemoryMeetingRepo()
+    live = await _seed(repo, status="active", workload="wl-1", fresh=True)
+    done = await _seed(repo, status="completed", session_uid="s2", native="m2")
+    deadlines = ReconcileDeadlines(fake_redis, **GRACES)
+    await deadlines.wake(done["id"])  # a stray: its terminal note was missed
+
+    assert await _sweep(repo, FakeRuntimeClient(), deadlines, full=True) == 0
+    assert await deadlines.members() == [live["id"]]
+    assert await _score(fake_redis, live["id"]) > deadlines.now() + 290  # updated_at + active_grace
+
+
+async def test_status_writes_arm_the_index(fake_redis):
+    repo = InMemoryMeetingRepo()
+    m = await _seed(repo, status="requested", workload="wl-1")
+    app = create_app(meeting_repo=repo)
+    app.state.reconcile_deadlines = deadlines = ReconcileDeadlines(fake_redis, **GRACES)
+    async with httpx.AsyncClient(transport=httpx.ASGITransport(app=app), base_url="http://tsrv") as c:
+        for status in ("joining", "active"):
+            r = await c.post(LIFECYCLE, json={"connection_id": "sess-uid", "status": status})
+            assert r.status_code == 200, r.text
+        assert await _score(fake_redis, m["id"]) > deadlines.now() + 290
+
+        r = await c.delete("/bots/google_meet/m1", headers={"X-User-ID": "1"})
+        assert r.status_code == 200, r.text
+        assert await _score(fake_redis, m["id"]) <= deadlines.now() + 45  # stop_grace
+
+        r = await c.post(LIFECYCLE, json={"connection_id": "sess-uid", "status": "completed",
+                                          "completion_reason": "stopped"})
+        assert r.status_code == 200, r.text
+    assert await deadlines.members() == []
+
+
+async def test_creating_a_bot_arms_the_index(fake_redis, monkeypatch):
+    monkeypatch.setenv("ADMIN_TOKEN", "test-admin-token")
+    repo = InMemoryMeetingRepo()
+    app = create_app(meeting_repo=repo, runtime=FakeRuntimeClient())
+    app.state.reconcile_deadlines = deadlines = ReconcileDeadlines(fake_redis, **GRACES)
+    async with httpx.AsyncClient(transport=httpx.ASGITransport(app=app), base_url="http://tsrv") as c:
+        r = await c.post("/bots", headers={"X-User-ID": "1"},
+                         json={"platform": "google_meet", "native_meeting_id": "abc-defg-hij"})
+        assert r.status_code == 201, r.text
+    # `requested` → the pre-active grace out, so a bot that never calls back is examined on time.
+    assert deadlines.now() + 650 < await _score(fake_redis, r.json()["id"]) <= deadlines.now() + 660
+
+
+async def test_an_exit_event_wakes_a_meeting_it_could_not_converge(fake_redis):
+    repo = InMemoryMeetingRepo()
+    m = await _seed(repo, status="active", workload="wl-1")
+    deadlines = ReconcileDeadlines(fake_redis, **GRACES)
+    await deadlines.note(m["id"], "active")
+
+    assert await wake_for_exited_workload(repo, deadlines, "wl-1", "running", log=log) is False
+    assert await wake_for_exited_workload(repo, deadlines, "wl-1", "exited", log=log) is True
+    assert await deadlines.due(limit=10) == [m["id"]]
+    repo.set_status(m["id"], "completed")
+    await deadlines.note(m["id"], "completed")
+    assert await wake_for_exited_workload(repo, deadlines, "wl-1", "exited", log=log) is False
+    assert await deadlines.members() == []
+
+
+async def test_a_converged_exit_event_leaves_nothing_due(fake_redis):
+    repo = InMemoryMeetingRepo()
+    m = await _seed(repo, status="requested", workload="wl-1")
+    app = create_app(meeting_repo=repo)
+    app.state.reconcile_deadlines = deadlines = ReconcileDeadlines(fake_redis, **GRACES)
+    async with httpx.AsyncClient(transport=httpx.ASGITransport(app=app), base_url="http://tsrv") as c:
+        r = await c.post(LIFECYCLE, json={"connection_id": "sess-uid", "status": "joining"})
+        assert r.status_code == 200, r.text
+        r = await c.post(RUNTIME, json={"workloadId": "wl-1", "state": "exited"})
+        assert r.status_code == 200, r.text
+    assert repo._meetings[m["id"]]["status"] == "failed"
+    assert await deadlines.members() == []
@@ -0,0 +1,161 @@
+"""recordings — streaming multipart assembly of the master (RECORDING_MULTIPART).
+
+Drives the SHIPPED ``upload_chunk`` / ``finalize_master`` over the in-memory fakes (whose multipart
+surface enforces S3's part rules), OFFLINE:
+
+  * parts upload as chunks arrive, so finalizing a completed recording reads back only the tail,
+    never every chunk — and the master is byte-identical to ``build_recording_master`` (webm concat,
+    wav header-merge) on the same chunks;
+  * out-of-order chunks are parked until the gap fills; a retried chunk is not counted twice;
+  * a missing chunk, a part upload error or a mid-recording read fall back to the full rebuild, and an
+    abandoned upload is aborted;
+  * flag off (or a storage without multipart) — no multipart upload is ever opened.
+"""
+from __future__ import annotations
+
+import struct
+
+from meeting_api.recording_codec import build_recording_master
+from meeting_api.recordings import finalize_master, multipart, upload_chunk
+from meeting_api.recordings.fakes import InMemoryRecordingRepo, InMemoryStorage
+
+USER = 7
+MEETING_ID = 1
+SESSION_UID = "conn-abc"
+PART = 64                # RECORDING_MULTIPART_PART_BYTES for the tests (the fake's floor matches)
+
+
+def _wav(byte_val: int, n_data: int = 24) -> bytes:
+    data = bytes([byte_val % 256]) * n_data
+    fmt = struct.pack("<4sIHHIIHH", b"fmt ", 16, 1, 1, 16000, 32000, 2, 16)
+    chunk = struct.pack("<4sI", b"data", len(data)) + data
+    return struct.pack("<4sI4s", b"RIFF", 4 + len(fmt) + len(chunk), b"WAVE") + fmt + chunk
+
+
+def _webm(seq: int) -> bytes:
+    return (b"\x1a\x45\xdf\xa3" if seq == 0 else b"\x1f\x43\xb6\x75") + bytes([seq % 256]) * 27
+
+
+def _setup(monkeypatch, *, on=True, storage=None):
+    if on:
+        monkeypatch.setenv("RECORDING_MULTIPART", "1")
+    else:
+        monkeypatch.delenv("RECORDING_MULTIPART", raising=False)
+    monkeypatch.setenv("RECORDING_MULTIPART_PART_BYTES", str(PART))
+    repo = InMemoryRecordingRepo()
+    repo.seed(meeting_id=MEETING_ID, user_id=USER, session_uid=SESSION_UID)
+    return repo, storage or InMemoryStorage(min_part_bytes=PART)
+
+
+async def _upload(repo, storage, seqs, chunks, fmt, *, final_seq=None):
+    receipt = None
+    for seq in seqs:
+        receipt = await upload_chunk(
+            repo, storage, token_meeting_id=MEETING_ID, session_uid=SESSION_UID, data=chunks[seq],
+            media_format=fmt, chunk_seq=seq, is_final=(seq == final_seq),
+        )
+    return receipt
+
+
+def _mp(repo):
+    (rec,) = repo._meetings[MEETING_ID]["recordings"]
+    return rec["id"], rec["media_files"][0].get("multipart")
+
+
+async def _finalize(repo, storage):
+    rid, _ = _mp(repo)
+    return await finalize_master(repo, storage, meeting_id=MEETING_ID, recording_id=rid)
+
+
+async def test_wav_master_streams_and_matches_the_codec(monkeypatch):
+    repo, storage = _setup(monkeypatch)
+    chunks = [_wav(i) for i in range(10)] + [b""]            # + the empty final signal chunk
+    await _upload(repo, storage, range(11), chunks, "wav", final_seq=10)
+    _, mp = _mp(repo)
+    assert mp["state"] == "open" and len(mp["parts"]) == 3 and all(p["etag"] for p in mp["parts"])
+
+    del storage.gets[:]
+    key = await _finalize(repo, storage)
+    assert storage.blobs[key] == build_recording_master(chunks, "wav")
+    # bounded: only part 1's chunks (header rewrite) + the tail are read back — not all ten
+    assert len(storage.gets) <= 2 * (PART // 24 + 1) + 1 and len(storage.gets) < 10
+    assert _mp(repo)[1]["state"] == "completed" and storage.uploads == {}
+    assert await _finalize(repo, storage) == key              # idempotent: no re-assembly
+
+
+async def test_webm_master_streams_and_matches_the_codec(monkeypatch):
+    repo, storage = _setup(monkeypatch)
+    chunks = [_webm(i) for i in range(9)] + [b""]
+    await _upload(repo, storage, range(10), chunks, "webm", final_seq=9)
+    del storage.gets[:]
+    key = await _finalize(repo, storage)
+    assert storage.blobs[key] == build_recording_master(chunks, "webm")
+    assert [k.rsplit("/", 1)[-1] for k in storage.gets] == ["000009.webm"]      # the tail only
+    assert storage.content_types[key] == "video/webm"
+
+
+async def test_out_of_order_and_retried_chunks(monkeypatch):
+    repo, storage = _setup(monkeypatch)
+    chunks = [_wav(i) for i in range(8)] + [b""]
+    await _upload(repo, storage, [0, 2, 1, 3, 3, 5, 4, 6, 7, 8], chunks, "wav", final_seq=8)
+    _, mp = _mp(repo)
+    assert mp["ahead"] == {} and mp["next_seq"] == 9
+    key = await _finalize(repo, storage)
+    assert storage.blobs[key] == build_recording_master(chunks, "wav")
+    assert _mp(repo)[1]["state"] == "completed"
+
+
+async def test_a_missing_chunk_falls_back_to_the_rebuild(monkeypatch):
+    repo, storage = _setup(monkeypatch)
+    chunks = [_wav(i) for i in range(8)] + [b""]
+    await _upload(repo, storage, [0, 1, 2, 4, 5, 6, 7, 8], chunks, "wav", final_seq=8)   # 3 lost
+    key = await _finalize(repo, storage)
+    present = [c for i, c in enumerate(chunks) if i != 3]
+    assert storage.blobs[key] == build_recording_master(present, "wav")
+    assert _mp(repo)[1]["state"] == "abandoned" and storage.uploads == {}          # aborted
+
+
+async def test_a_part_upload_error_abandons_and_still_finalizes(monkeypatch):
+    class Flaky(InMemoryStorage):
+        async def upload_part(self, key, upload_id, part_number, data):
+            if part_number == 2:
+                raise ConnectionError("s3 reset")
+            return await super().upload_part(key, upload_id, part_number, data)
+
+    repo, storage = _setup(monkeypatch, storage=Flaky(min_part_bytes=PART))
+    chunks = [_webm(i) for i in range(10)] + [b""]
+    receipt = await _upload(repo, storage, range(11), chunks, "webm", final_seq=10)
+    assert receipt["status"] == "completed"                   # the chunk upload itself never fails
+    assert _mp(repo)[1]["state"] == "abandoned" and storage.uploads == {}
+    key = await _finalize(repo, storage)
+    assert storage.blobs[key] == build_recording_master(chunks, "webm")
+
+
+async def test_a_mid_recording_read_rebuilds_and_keeps_streaming(monkeypatch):
+    repo, storage = _setup(monkeypatch)
+    chunks = [_wav(i) for i in range(10)] + [b""]
+    await _upload(repo, storage, range(5), chunks, "wav")
+    key = await _finalize(repo, storage)                      # still recording → partial rebuild
+    assert storage.blobs[key] == build_recording_master(chunks[:5], "wav")
+    assert _mp(repo)[1]["state"] == "open"
+    await _upload(repo, storage, range(5, 11), chunks, "wav", final_seq=10)
+    assert await _finalize(repo, storage) == key
+    assert storage.blobs[key] == build_recording_master(chunks, "wav")
+    assert _mp(repo)[1]["state"] == "completed"
+
+
+def test_a_part_size_below_the_floor_is_raised_to_it(monkeypatch):
+    monkeypatch.setenv("RECORDING_MULTIPART_PART_BYTES", "1024")
+    assert multipart.part_bytes() == multipart.S3_MIN_PART_BYTES        # the S3 adapter: no override
+    assert multipart.part_bytes(InMemoryStorage(min_part_bytes=4096)) == 4096
+    monkeypatch.setenv("RECORDING_MULTIPART_PART_BYTES", str(16 * 1024 * 1024))
+    assert multipart.part_bytes() == 16 * 1024 * 1024                   # above the floor: as configured
+
+
+async def test_flag_off_never_opens_an_upload(monkeypatch):
+    repo, storage = _setup(monkeypatch, on=False)
+    chunks = [_webm(i) for i in range(6)]
+    await _upload(repo, storage, range(6), chunks, "webm", final_seq=5)
+    assert _mp(repo)[1] is None and storage.uploads == {}
+    key = await _finalize(repo, storage)
+    assert storage.blobs[key] == build_recording_master(chunks, "webm")
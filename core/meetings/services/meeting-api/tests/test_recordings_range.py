@@ -23,10 +23,10 @@ STORAGE_PATH = "recordings/7/100/conn-abc/audio/master.wav"
 MASTER = bytes(range(256))  # 256 bytes: byte i == i
 
 
-def _client():
+def _client(storage=None):
     """A seeded client: one finalized audio media-file whose master bytes live in storage."""
     repo = InMemoryRecordingRepo()
-    storage = InMemoryStorage()
+    storage = storage if storage is not None else InMemoryStorage()
     storage.blobs[STORAGE_PATH] = MASTER
     storage.content_types[STORAGE_PATH] = "audio/wav"
     repo.seed(meeting_id=MEETING_ID, user_id=USER, session_uid="conn-abc")
@@ -118,3 +118,37 @@ def test_end_past_eof_is_clamped():
     assert r.status_code == 206, r.text
     assert r.headers["content-range"] == f"bytes 200-{total - 1}/{total}"
     assert r.content == MASTER[200:]
+
+
+def test_proxied_playback_streams_the_window_without_reading_the_master():
+    storage = InMemoryStorage()
+    client = _client(storage)
+    r = client.get(_URL, headers={**_HDRS, "Range": "bytes=100-149"})
+    assert r.status_code == 206 and r.content == MASTER[100:150]
+    assert r.headers["content-length"] == "50"
+    r = client.get(_URL, headers=_HDRS)
+    assert r.status_code == 200 and r.content == MASTER
+    assert storage.streams == [(STORAGE_PATH, 100, 149), (STORAGE_PATH, None, None)]
+    assert STORAGE_PATH not in storage.gets  # the master was never buffered whole
+
+
+def test_presign_mode_redirects_to_a_short_lived_store_url(monkeypatch):
+    monkeypatch.setenv("RECORDING_MEDIA_DELIVERY", "presign")
+    monkeypatch.setenv("RECORDING_PRESIGN_TTL_SECONDS", "120")
+    storage = InMemoryStorage()
+    client = _client(storage)
+    r = client.get(_URL, headers={**_HDRS, "Range": "bytes=0-9"}, follow_redirects=False)
+    assert r.status_code == 307
+    assert r.headers["location"] == f"https://objects.test/{STORAGE_PATH}?X-Amz-Expires=120"
+    assert r.headers["cache-control"] == "private, no-store"
+    assert storage.presigned == [(STORAGE_PATH, 120)]
+    assert storage.streams == [] and STORAGE_PATH not in storage.gets  # no bytes through meeting-api
+
+
+def test_presign_mode_still_scopes_to_the_owner(monkeypatch):
+    monkeypatch.setenv("RECORDING_MEDIA_DELIVERY", "presign")
+    storage = InMemoryStorage()
+    client = _client(storage)
+    r = client.get(_URL, headers={"x-user-id": str(USER + 1)}, follow_redirects=False)
+    assert r.status_code == 404
+    assert storage.presigned == []
@@ -8,11 +8,16 @@ Autonomous: no docker, no live meeting, no network. The four cases prove the pla
 2. a `FakeClock` advanced past the fire time fires the captured request EXACTLY once — we
    assert the captured POST /bots payload and that NO real bot spawns (capturing dispatch);
 3. a `{cron: …}` recurring job RE-ARMS for the next occurrence after firing;
-4. CANCEL removes the job so it never fires.
+4. CANCEL removes the job so it never fires;
+5. a top-of-the-hour burst drains in bounded claims over a bounded fan-out, each bot fired once,
+   with the schedule lag reported;
+6. two replicas sharing one store: a peer's orphan sweep never re-fires a live replica's
+   in-flight join, and recovers it once that replica's heartbeat lapses.
 """
 from __future__ import annotations
 
 import json
+import threading
 from pathlib import Path
 
 import jsonschema
@@ -24,6 +29,7 @@ from meeting_api.scheduling import (
     FakeClock,
     ScheduledBot,
     Scheduler,
+    SchedulerStore,
     compile_scheduled_bot,
     conforms,
 )
@@ -198,3 +204,61 @@ def test_cancel_removes_job_so_it_never_fires():
     # Cancelling an unknown / already-cancelled job is a no-op (returns None).
     assert scheduler.cancel(job_id) is None
     assert scheduler.cancel("job_does_not_exist") is None
+
+
+# --- case 5: a top-of-the-hour burst drains in bounded, fanned-out claims -------------------
+
+def test_burst_drains_in_bounded_claims_each_bot_fired_once():
+    clock = FakeClock(start=0)
+    dispatch = CapturingDispatch()
+    scheduler = Scheduler(dispatch=dispatch, clock=clock, batch_size=10, concurrency=4)
+
+    for i in range(25):
+        body = {**BOT_BODY, "native_meeting_id": f"abc-defg-{i:03d}"}
+        scheduler.schedule(compile_scheduled_bot(ScheduledBot(bot=body, at=3_600)))
+
+    clock.set(3_600 + 45)                          # the scheduler came round 45s late
+    assert scheduler.tick() == 25
+    fired = sorted(c["body"]["native_meeting_id"] for c in dispatch.calls)
+    assert fired == [f"abc-defg-{i:03d}" for i in range(25)]
+    assert scheduler.list() == []
+
+    stats = scheduler.stats()
+    assert stats["claimed"] == 25
+    assert stats["lag_s_p50"] == 45.0 and stats["lag_s_max"] == 45.0
+
+
+# --- case 6: two replicas sharing one store — recovery is lease- and owner-aware -------------
+
+def test_a_peer_recovers_an_inflight_join_only_once_its_replica_goes_silent():
+    clock = FakeClock(start=0)
+    store = SchedulerStore()
+    entered, release, calls = threading.Event(), threading.Event(), []
+
+    def blocking(request):
+        calls.append(request)
+        entered.set()
+        release.wait(5)
+        return {"status": 201}
+
+    a = Scheduler(dispatch=blocking, clock=clock, store=store, replica_id="a", heartbeat_ttl_s=30)
+    b = Scheduler(dispatch=blocking, clock=clock, store=store, replica_id="b", heartbeat_ttl_s=30)
+    job = a.schedule(compile_scheduled_bot(ScheduledBot(bot=BOT_BODY, at=60)))
+    clock.set(60)
+    ticking = threading.Thread(target=a.tick)
+    ticking.start()
+    assert entered.wait(5)
+    assert store.claims[job["job_id"]] == {"claimed_by": "a", "claimed_at": 60}
+
+    clock.set(80)                                  # B restarts mid-dispatch; A beat at 60
+    b.heartbeat()
+    assert b.recover_orphans() == 0
+    assert a.recover_orphans() == 0                # A's own job is still in its dispatch
+    assert b.tick() == 0 and len(calls) == 1       # one join, not two
+
+    clock.set(95)                                  # A silent past its 30s heartbeat TTL
+    assert b.recover_orphans() == 1
+    assert store.executing == {} and store.claims == {}
+    assert [j["job_id"] for j in b.list(status="pending")] == [job["job_id"]]
+    release.set()
+    ticking.join(5)
@@ -0,0 +1,182 @@
+"""Incremental transcript reads — ``?since=<cursor>`` over the per-meeting change index
+(``collector/changes.py``) and the ETag / If-None-Match → 304 path.
+
+Drives the REAL ``SqlAlchemyTranscriptStore._live_transcript`` (the post-session half) with a
+redis stub and a recorded ``_pg_segments`` — no SQLAlchemy, no docker:
+  * a covered cursor → ONLY the segments written after it (``delta: true``) + the next cursor; a
+    segment the db-writer already flushed out of the hash is read back from Postgres BY ID;
+  * an uncovered cursor (cursor older than the index floor / no index) → the full transcript,
+    ``delta: false``;
+  * the index writes ride the segment write's own pipeline, only with the flag on.
+"""
+from __future__ import annotations
+
+import json
+from datetime import datetime, timezone
+
+from fastapi.testclient import TestClient
+
+from meeting_api.collector import changes, create_app
+from meeting_api.collector.adapters import SqlAlchemyTranscriptStore, _segment_to_api
+from meeting_api.collector.fakes import InMemoryTranscriptStore
+
+START = datetime(2026, 7, 14, 12, 0, 0, tzinfo=timezone.utc)
+KEY = changes.changes_key(5)
+HASH = "meeting:5:segments"
+
+
+class _IndexRedis:
+    """zscore / zrangebyscore / zrevrange / hmget / hgetall over plain dicts."""
+
+    def __init__(self, zset, hash_map):
+        self.zset = zset
+        self.hash_map = hash_map
+
+    async def zscore(self, key, member):
+        return self.zset.get(key, {}).get(member)
+
+    async def zrangebyscore(self, key, lo, hi, withscores=False):
+        items = sorted((s, m) for m, s in self.zset.get(key, {}).items() if s >= lo)
+        return [(m.encode(), s) for s, m in items]
+
+    async def zrevrange(self, key, start, stop, withscores=False):
+        items = sorted(((s, m) for m, s in self.zset.get(key, {}).items()), reverse=True)
+        return [(m.encode(), s) for s, m in items[start:stop + 1]]
+
+    async def hmget(self, key, fields):
+        h = self.hash_map.get(key, {})
+        return [h.get(f) for f in fields]
+
+    async def hgetall(self, key):
+        return self.hash_map.get(key, {})
+
+
+class _NoSession:
+    async def __aenter__(self):
+        return object()
+
+    async def __aexit__(self, *exc):
+        return False
+
+
+def _snap():
+    return {"id": 5, "platform": "google_meet", "platform_specific_id": "abc-defg-hij", "status": "active",
+            "start_time": START, "end_time": None, "created_at": START, "data": {}}
+
+
+def _live(sid, start, text):
+    return json.dumps({"segment_id": sid, "start": start, "end": start + 1, "text": text, "completed": False})
+
+
+def _store(zset, hash_map, pg_rows):
+    store = SqlAlchemyTranscriptStore(session_factory=_NoSession, redis_client=_IndexRedis(zset, hash_map))
+    asked = []
+
+    async def pg_segments(db, meeting_id, segment_ids=None):
+        asked.append(None if segment_ids is None else sorted(segment_ids))
+        rows = {sid: s for sid, s in pg_rows.items() if segment_ids is None or sid in segment_ids}
+        return dict(rows), list(rows)
+
+    store._pg_segments = pg_segments
+    return store, asked
+
+
+async def test_covered_cursor_returns_only_changed_segments():
+    zset = {KEY: {changes.FLOOR_MEMBER: 100.0, "s-old": 101.0, "s-flushed": 150.0, "s-new": 152.5}}
+    hash_map = {HASH: {"s-old": _live("s-old", 1.0, "old"), "s-new": _live("s-new", 9.0, "new")}}
+    pg = {"s-flushed": _segment_to_api({"segment_id": "s-flushed", "start": 5.0, "end": 6.0, "text": "flushed",
+                                        "completed": True})}
+    store, asked = _store(zset, hash_map, pg)
+
+    doc = await store._live_transcript(_snap(), 149.0)
+
+    assert doc["delta"] is True
+    assert [s["segment_id"] for s in doc["segments"]] == ["s-flushed", "s-new"]  # sorted by start
+    assert doc["cursor"] == changes.format_cursor(152.5)
+    assert asked == [["s-flushed"]]  # Postgres read ONLY for the flushed id, never the whole meeting
+    assert all(s.get("absolute_start_time") for s in doc["segments"])
+
+
+async def test_nothing_changed_keeps_the_cursor_and_an_empty_delta():
+    zset = {KEY: {changes.FLOOR_MEMBER: 100.0, "s-old": 101.0}}
+    store, asked = _store(zset, {HASH: {"s-old": _live("s-old", 1.0, "old")}}, {})
+
+    doc = await store._live_transcript(_snap(), 200.0)
+
+    assert doc["delta"] is True and doc["segments"] == [] and asked == []
+    assert doc["cursor"] == changes.format_cursor(200.0)
+
+
+async def test_write_just_before_the_cursor_is_re_covered_by_the_overlap():
+    # Score taken before the previous read, landed after it: within SINCE_OVERLAP_S → re-sent.
+    zset = {KEY: {changes.FLOOR_MEMBER: 100.0, "s-late": 199.0}}
+    store, _ = _store(zset, {HASH: {"s-late": _live("s-late", 3.0, "late")}}, {})
+
+    doc = await store._live_transcript(_snap(), 200.0)
+
+    assert [s["segment_id"] for s in doc["segments"]] == ["s-late"]
+
+
+async def test_uncovered_cursor_falls_back_to_the_full_transcript():
+    zset = {KEY: {changes.FLOOR_MEMBER: 500.0, "s-new": 501.0}}  # indexing began AFTER the cursor
+    pg = {"s-pg": _segment_to_api({"segment_id": "s-pg", "start": 0.5, "end": 1.0, "text": "durable", "completed": True})}
+    store, asked = _store(zset, {HASH: {"s-new": _live("s-new", 2.0, "new")}}, pg)
+
+    doc = await store._live_transcript(_snap(), 400.0)
+
+    assert doc["delta"] is False
+    assert [s["segment_id"] for s in doc["segments"]] == ["s-pg", "s-new"]
+    assert asked == [None] and doc["cursor"] == changes.format_cursor(501.0)
+
+    no_index, _ = _store({}, {HASH: {}}, pg)
+    doc = await no_index._live_transcript(_snap(), 400.0)
+    assert doc["delta"] is False and "cursor" not in doc
+
+
+class _Pipe:
+    def __init__(self):
+        self.cmds = []
+
+    def zadd(self, key, mapping, nx=False):
+        self.cmds.append(("zadd", key, dict(mapping), nx))
+
+    def expire(self, key, ttl):
+        self.cmds.append(("expire", key, ttl))
+
+
+def test_index_writes_are_opt_in(monkeypatch):
+    pipe = _Pipe()
+    monkeypatch.setattr(changes, "TRANSCRIPT_CHANGE_INDEX", False)
+    changes.index_segments(pipe, 5, ["a"], 3600, now=10.0)
+    assert pipe.cmds == []
+    monkeypatch.setattr(changes, "TRANSCRIPT_CHANGE_INDEX", True)
+    changes.index_segments(pipe, 5, ["a", "b"], 3600, now=10.0)
+    assert pipe.cmds == [
+        ("zadd", KEY, {changes.FLOOR_MEMBER: 10.0}, True),  # the floor is set once (NX)
+        ("zadd", KEY, {"a": 10.0, "b": 10.0}, False),
+        ("expire", KEY, 3600),
+    ]
+
+
+def test_etag_and_if_none_match_gives_304():
+    store = InMemoryTranscriptStore()
+    store.seed_meeting(user_id=7, platform="google_meet", native_meeting_id="abc-defg-hij", status="active",
+                       segments=[{"segment_id": "s1", "start": 1.0, "end": 2.0, "text": "hi", "language": "en"}])
+    client = TestClient(create_app(store, redis=None))
+    headers = {"x-user-id": "7"}
+    r = client.get("/transcripts/google_meet/abc-defg-hij", headers=headers)
+    assert r.status_code == 200 and r.headers["etag"]
+    etag = r.headers["etag"]
+    again = client.get("/transcripts/google_meet/abc-defg-hij", headers={**headers, "if-none-match": etag})
+    assert again.status_code == 304 and again.headers["etag"] == etag and again.content == b""
+    stale = client.get("/transcripts/google_meet/abc-defg-hij", headers={**headers, "if-none-match": '"nope"'})
+    assert stale.status_code == 200 and stale.json()["segments"][0]["text"] == "hi"
+
+
+def test_since_on_an_unindexed_store_is_a_full_read_and_junk_is_422():
+    store = InMemoryTranscriptStore()
+    mid = store.seed_meeting(user_id=7, platform="google_meet", native_meeting_id="abc-defg-hij", status="active")
+    client = TestClient(create_app(store, redis=None))
+    r = client.get(f"/transcripts/by-id/{mid}?since=1760000000.5", headers={"x-user-id": "7"})
+    assert r.status_code == 200 and r.json()["delta"] is False
+    assert client.get(f"/transcripts/by-id/{mid}?since=yesterday", headers={"x-user-id": "7"}).status_code == 422
@@ -0,0 +1,99 @@
+"""Warm pool (BOT_WARM_POOL) — a request claims a pre-started bot; the calendar sizes the pool.
+
+Asserts:
+  * with BOT_WARM_POOL=1 ``request_bot`` claims an idle warm workload of the meeting's platform
+    with the SAME spec a cold spawn would send (no ``create_workload``);
+  * a miss (no idle workload for the platform) spawns cold with that spec;
+  * the flag off, or an authenticated bot, never claims;
+  * ``upcoming_by_platform`` counts only auto-join rows starting inside the horizon (or inside the
+    sweep's late-join grace), and ``warm_targets`` = base floor + upcoming, capped per platform.
+
+OFFLINE — the shipped ``request_bot`` + ``scheduling.lookahead`` over the in-memory fakes.
+"""
+from __future__ import annotations
+
+from datetime import datetime, timedelta, timezone
+
+from meeting_api.bot_spawn import request_bot
+from meeting_api.bot_spawn.fakes import FakeRuntimeClient, InMemoryMeetingRepo
+from meeting_api.scheduling import upcoming_by_platform, warm_targets
+
+KW = dict(redis_url="r", token_secret="test-admin-token", meeting_api_url="http://meeting-api:8080")
+NOW = datetime(2026, 7, 10, 15, 0, 0, tzinfo=timezone.utc)
+
+
+async def _spawn(runtime, nid="abc-defg-hij", platform="google_meet"):
+    return await request_bot(InMemoryMeetingRepo(), runtime, user_id=7, platform=platform,
+                             native_meeting_id=nid, **KW)
+
+
+# ── request-time claim ──────────────────────────────────────────────────────────────────────────
+
+async def test_a_request_claims_an_idle_warm_bot(monkeypatch):
+    monkeypatch.setenv("BOT_WARM_POOL", "1")
+    runtime = FakeRuntimeClient(warm={"google_meet": 1})
+    meeting = await _spawn(runtime)
+    assert meeting["status"] == "requested"
+    assert len(runtime.claims) == 1 and runtime.claims[0][1] == "google_meet"
+    assert runtime.specs == []                                       # no cold spawn
+    assert runtime.warm == {"google_meet": 0}
+
+
+async def test_a_miss_spawns_cold_with_the_same_spec(monkeypatch):
+    monkeypatch.setenv("BOT_WARM_POOL", "1")
+    runtime = FakeRuntimeClient(warm={"google_meet": 1})
+    await _spawn(runtime, platform="teams", nid="19:meeting_abc@thread.v2")
+    assert runtime.claims and runtime.claims[0][1] == "teams"
+    (spec,) = runtime.specs
+    assert spec["workloadId"] == runtime.claims[0][0]                # same spec, cold
+    assert runtime.warm == {"google_meet": 1}
+
+
+async def test_flag_off_never_claims(monkeypatch):
+    monkeypatch.delenv("BOT_WARM_POOL", raising=False)
+    runtime = FakeRuntimeClient(warm={"google_meet": 1})
+    await _spawn(runtime)
+    assert runtime.claims == [] and len(runtime.specs) == 1
+
+
+async def test_an_authenticated_bot_never_claims(monkeypatch):
+    monkeypatch.setenv("BOT_WARM_POOL", "1")
+    for k, v in {"BOT_AUTHENTICATED": "true", "BOT_USERDATA_S3_PATH": "userdata/bot-identity-1",
+                 "BOT_S3_ENDPOINT": "http://minio:9000", "BOT_S3_BUCKET": "vexa",
+                 "BOT_S3_ACCESS_KEY": "userdata-key", "BOT_S3_SECRET_KEY": "userdata-secret"}.items():
+        monkeypatch.setenv(k, v)
+    runtime = FakeRuntimeClient(warm={"google_meet": 1})
+    await _spawn(runtime)
+    assert runtime.claims == [] and len(runtime.specs) == 1
+
+
+# ── lookahead sizing ────────────────────────────────────────────────────────────────────────────
+
+def _row(platform="google_meet", at=NOW, native="abc-defg-hij", **data):
+    d = {"auto_join": True, **data}
+    if at is not None:
+        d["scheduled_at"] = at.isoformat()
+    return {"platform": platform, "native_meeting_id": native, "status": "scheduled", "data": d}
+
+
+def test_upcoming_counts_auto_join_rows_inside_the_horizon():
+    rows = [
+        _row(at=NOW + timedelta(minutes=5)),
+        _row(at=NOW - timedelta(minutes=2)),                         # late, inside grace
+        _row(platform="teams", at=NOW + timedelta(minutes=14)),
+        _row(at=NOW + timedelta(minutes=20)),                        # beyond the horizon
+        _row(at=NOW - timedelta(hours=1)),                           # stale
+        _row(auto_join=False),                                       # toggled off
+        _row(native=None),                                           # no link
+        _row(at=None),                                               # no time
+        _row(platform="unknown"),
+    ]
+    assert upcoming_by_platform(rows, now=NOW, horizon_s=900, grace_s=600) == {
+        "google_meet": 2, "teams": 1}
+
+
+def test_warm_targets_is_base_plus_upcoming_capped():
+    targets = warm_targets({"google_meet": 6, "teams": 1}, base={"google_meet": 1, "zoom": 1},
+                           max_per_platform=4)
+    assert targets == {"meeting-bot": {"google_meet": 4, "teams": 1, "zoom": 1}}
+    assert warm_targets({}) == {"meeting-bot": {}}                   # nothing planned → drain
@@ -0,0 +1,154 @@
+"""Pooled webhook delivery (``webhooks/engine.py``) + the concurrent retry drain.
+
+  * one client per endpoint (``scheme://host:port``), reused across POSTs and labelled host-only;
+  * a slow receiver saturates only ITS endpoint bound — another endpoint's POST still goes out;
+  * the global worker bound caps the process;
+  * ``drain_retry_queue(parallel=True)`` resolves due entries concurrently, and
+    ``endpoint_budget`` leaves an endpoint's excess in the queue for the next sweep, and
+    ``max_inflight`` leaves whatever the engine cannot start at once unclaimed.
+"""
+from __future__ import annotations
+
+import asyncio
+import json
+
+from meeting_api.webhooks import DeliveryEngine, RetryQueue, build_envelope, delivery_engine_from_env, drain_retry_queue
+from meeting_api.webhooks.engine import endpoint_key
+from meeting_api.webhooks.retry import BACKOFF_SCHEDULE, PROCESSING_KEY, RETRY_QUEUE_KEY
+
+
+class _Resp:
+    def __init__(self, status_code):
+        self.status_code = status_code
+
+
+class _Client:
+    """A stand-in ``httpx.AsyncClient``: POSTs to a gated host block until the gate opens."""
+
+    def __init__(self, key, gates, log):
+        self.key = key
+        self.gates = gates
+        self.log = log
+        self.closed = False
+
+    async def post(self, url, content=None, headers=None):
+        self.log.append(url)
+        gate = self.gates.get(self.key)
+        if gate is not None:
+            await gate.wait()
+        return _Resp(200)
+
+    async def aclose(self):
+        self.closed = True
+
+
+def _engine(gates=None, **kw):
+    clients, log = {}, []
+
+    def factory(key):
+        clients[key] = _Client(key, gates or {}, log)
+        return clients[key]
+
+    return DeliveryEngine(client_factory=factory, **kw), clients, log
+
+
+def test_endpoint_key_is_host_only():
+    assert endpoint_key("https://Hooks.Example.com/v/tok?secret=x") == "https://hooks.example.com:443"
+    assert endpoint_key("http://a.example:8080/x") == "http://a.example:8080"
+    assert delivery_engine_from_env(lambda k, d=None: {"WEBHOOK_DELIVERY_POOLED": "0"}.get(k, d)) is None
+    engine = delivery_engine_from_env(lambda k, d=None: {"WEBHOOK_DELIVERY_POOLED": "1",
+                                                         "WEBHOOK_MAX_PER_ENDPOINT": "2"}.get(k, d))
+    assert engine.max_per_endpoint == 2 and engine.max_concurrency == 32
+
+
+async def test_slow_endpoint_does_not_block_another():
+    slow = asyncio.Event()
+    engine, clients, log = _engine({"https://slow.example:443": slow}, max_per_endpoint=2, max_concurrency=8)
+
+    stuck = [asyncio.ensure_future(engine.transport(f"https://slow.example/{i}", b"{}", {})) for i in range(4)]
+    await asyncio.sleep(0)
+    fast = await asyncio.wait_for(engine.transport("https://fast.example/a", b"{}", {}), 1.0)
+    assert fast.status_code == 200
+
+    stats = engine.stats()["endpoints"]
+    assert stats["https://slow.example:443"]["in_flight"] == 2  # the per-endpoint bound
+    assert stats["https://slow.example:443"]["queued"] == 2
+    assert stats["https://fast.example:443"]["delivered"] == 1
+    assert all("/" not in k.split("://", 1)[1] for k in stats)  # never a path (P14)
+
+    slow.set()
+    await asyncio.gather(*stuck)
+    stats = engine.stats()["endpoints"]["https://slow.example:443"]
+    assert stats["delivered"] == 4 and stats["in_flight"] == 0 and stats["queued"] == 0
+    assert stats["latency_ms_p99"] is not None and stats["first_attempt_wait_ms_p99"] is not None
+    assert len(clients) == 2  # one pooled client per endpoint, reused across its 4 POSTs
+
+    await engine.aclose()
+    assert all(c.closed for c in clients.values())
+
+
+async def test_global_worker_bound():
+    gates = {f"https://h{i}.example:443": asyncio.Event() for i in range(3)}
+    engine, _, log = _engine(gates, max_per_endpoint=4, max_concurrency=2)
+    posts = [asyncio.ensure_future(engine.transport(f"https://h{i}.example/", b"{}", {})) for i in range(3)]
+    await asyncio.sleep(0)
+    assert len(log) == 2 and engine.stats()["queued"] == 1
+    for g in gates.values():
+        g.set()
+    await asyncio.gather(*posts)
+    assert len(log) == 3
+
+
+async def test_idle_endpoints_are_evicted_lru():
+    engine, clients, _ = _engine(max_endpoints=2)
+    for host in ("a", "b", "c"):
+        await engine.transport(f"https://{host}.example/", b"{}", {})
+    await asyncio.sleep(0)
+    assert list(engine.stats()["endpoints"]) == ["https://b.example:443", "https://c.example:443"]
+    assert clients["https://a.example:443"].closed
+
+
+async def test_parallel_drain_overlaps_and_respects_the_budget(fake_redis):
+    queue = RetryQueue(fake_redis)
+    for i in range(3):
+        await queue.enqueue("https://slow.example/hook", build_envelope("meeting.completed", {"i": i}), now=0.0)
+    await queue.enqueue("https://fast.example/hook", build_envelope("meeting.completed", {"i": 9}), now=0.0)
+
+    inflight, peak = [0], [0]
+
+    async def transport(url, body, headers):
+        inflight[0] += 1
+        peak[0] = max(peak[0], inflight[0])
+        await asyncio.sleep(0)
+        inflight[0] -= 1
+        return _Resp(200)
+
+    due = BACKOFF_SCHEDULE[0] + 1.0
+    processed = await drain_retry_queue(fake_redis, transport, now=due, parallel=True, endpoint_budget=2)
+    assert processed == 3 and peak[0] == 3  # resolved concurrently, 2 slow + 1 fast
+    left = [json.loads(r) for r in await fake_redis.lrange(RETRY_QUEUE_KEY, 0, -1)]
+    assert [e["url"] for e in left] == ["https://slow.example/hook"] and left[0]["attempt"] == 0
+    assert await fake_redis.llen(PROCESSING_KEY) == 0
+
+    assert await drain_retry_queue(fake_redis, transport, now=due, parallel=True, endpoint_budget=2) == 1
+    assert await fake_redis.llen(RETRY_QUEUE_KEY) == 0
+
+
+async def test_a_parallel_sweep_claims_no_more_than_the_engine_can_start(fake_redis):
+    queue = RetryQueue(fake_redis)
+    for i in range(5):
+        await queue.enqueue(f"https://h{i}.example/hook", build_envelope("meeting.completed", {"i": i}), now=0.0)
+
+    seen_processing = []
+
+    async def transport(url, body, headers):
+        seen_processing.append(await fake_redis.llen(PROCESSING_KEY))
+        return _Resp(200)
+
+    due = BACKOFF_SCHEDULE[0] + 1.0
+    assert await drain_retry_queue(fake_redis, transport, now=due, parallel=True, max_inflight=2) == 2
+    assert max(seen_processing) <= 2  # never more claimed (lease running) than slots
+    assert await fake_redis.llen(RETRY_QUEUE_KEY) == 3 and await fake_redis.llen(PROCESSING_KEY) == 0
+    assert await drain_retry_queue(fake_redis, transport, now=due, parallel=True, max_inflight=2) == 2
+    assert await drain_retry_queue(fake_redis, transport, now=due, parallel=True, max_inflight=2) == 1
+    assert await fake_redis.llen(RETRY_QUEUE_KEY) == 0
@@ -0,0 +1,209 @@
+"""Cross-request micro-batching for the STT worker.
+
+Dozens of short bot windows each running their own ``model.transcribe`` leave a GPU mostly idle
+between tiny forward passes. ``MicroBatcher`` sits in front of the model: requests that can share
+a forward pass (same grouping key — model, language, tier, decode options) wait at most
+``window_ms`` for company, then go to ``run_batch`` together as ONE call. A group is dispatched
+early as soon as it reaches ``max_size``.
+
+Tier priority is strict: whenever a dispatch slot is free, a ready realtime group always goes
+first, and a deferred group is only dispatched while NO realtime request is queued. Deferred
+batches never take the last ``realtime_reserved_slots`` slots — the batch-level twin of the
+admission rule in ``_deferred_capacity_available``.
+
+Pure asyncio and model-agnostic (``run_batch`` is injected), so the scheduling contract is
+unit-testable without faster-whisper. Batch-size and queue-wait histograms are exposed via
+``stats()``; ``submit(..., timing=)`` also reports one request's own wait to its caller.
+"""
+from __future__ import annotations
+
+import asyncio
+import time
+from dataclasses import dataclass, field
+from typing import Any, Awaitable, Callable, Dict, Hashable, List, Optional, Sequence, Tuple
+
+BATCH_SIZE_BUCKETS: Tuple[float, ...] = (1, 2, 4, 8, 16, 32, 64)
+QUEUE_WAIT_MS_BUCKETS: Tuple[float, ...] = (1, 2, 5, 10, 25, 50, 100, 250, 500, 1000, 2500)
+DECODE_MS_BUCKETS: Tuple[float, ...] = (25, 50, 100, 250, 500, 1000, 2500, 5000, 10000, 30000)
+
+
+class Histogram:
+    """Cumulative fixed-bucket histogram (Prometheus ``le`` semantics) with count and sum."""
+
+    def __init__(self, buckets: Sequence[float]):
+        self.buckets = tuple(buckets)
+        self.counts = [0] * len(self.buckets)
+        self.count = 0
+        self.sum = 0.0
+
+    def observe(self, value: float) -> None:
+        self.count += 1
+        self.sum += value
+        for i, le in enumerate(self.buckets):
+            if value <= le:
+                self.counts[i] += 1
+
+    def snapshot(self) -> Dict[str, Any]:
+        return {
+            "buckets": {str(le): n for le, n in zip(self.buckets, self.counts)},
+            "count": self.count,
+            "sum": round(self.sum, 3),
+        }
+
+
+@dataclass
+class _Pending:
+    payload: Any
+    future: asyncio.Future
+    enqueued_at: float
+    started_at: Optional[float] = None
+
+
+@dataclass
+class _Group:
+    key: Hashable
+    tier: str
+    items: List[_Pending] = field(default_factory=list)
+
+
+RunBatch = Callable[[Hashable, List[Any]], Awaitable[List[Any]]]
+
+
+class MicroBatcher:
+    """Group ``submit()`` calls by key and dispatch each group as one ``run_batch(key, payloads)``.
+
+    ``run_batch`` must return one result per payload, in order. A raised exception fails every
+    request of that batch; a result that is itself an ``Exception`` fails only its own request.
+    """
+
+    def __init__(
+        self,
+        run_batch: RunBatch,
+        *,
+        max_size: int,
+        window_ms: float,
+        max_inflight: int = 1,
+        realtime_reserved_slots: int = 0,
+        clock: Callable[[], float] = time.monotonic,
+    ):
+        self._run_batch = run_batch
+        self.max_size = max(1, max_size)
+        self.window_s = max(0.0, window_ms) / 1000.0
+        self.max_inflight = max(1, max_inflight)
+        self.deferred_limit = max(1, self.max_inflight - max(0, realtime_reserved_slots))
+        self._clock = clock
+        self._groups: Dict[Tuple[str, Hashable], _Group] = {}
+        self._inflight = {"realtime": 0, "deferred": 0}
+        self._wake: Optional[asyncio.Event] = None
+        self._task: Optional[asyncio.Task] = None
+        self.batch_size = Histogram(BATCH_SIZE_BUCKETS)
+        self.queue_wait_ms = {tier: Histogram(QUEUE_WAIT_MS_BUCKETS) for tier in ("realtime", "deferred")}
+        self.batches = {"realtime": 0, "deferred": 0}
+
+    async def submit(
+        self, key: Hashable, tier: str, payload: Any, *, timing: Optional[Dict[str, float]] = None,
+    ) -> Any:
+        """Queue ``payload`` and await its result. With ``timing``, its ``queue_ms`` is increased by
+        how long this request waited for its batch to be dispatched."""
+        tier = "deferred" if tier == "deferred" else "realtime"
+        loop = asyncio.get_running_loop()
+        self._ensure_dispatcher(loop)
+        group = self._groups.get((tier, key))
+        if group is None:
+            group = self._groups[(tier, key)] = _Group(key, tier)
+        pending = _Pending(payload, loop.create_future(), self._clock())
+        group.items.append(pending)
+        self._wake.set()
+        try:
+            return await pending.future
+        finally:
+            if timing is not None and pending.started_at is not None:
+                timing["queue_ms"] = timing.get("queue_ms", 0.0) + (pending.started_at - pending.enqueued_at) * 1000.0
+
+    def queued(self, tier: Optional[str] = None) -> int:
+        return sum(len(g.items) for g in self._groups.values() if tier is None or g.tier == tier)
+
+    def stats(self) -> Dict[str, Any]:
+        return {
+            "max_size": self.max_size,
+            "window_ms": self.window_s * 1000.0,
+            "max_inflight": self.max_inflight,
+            "queued": {"realtime": self.queued("realtime"), "deferred": self.queued("deferred")},
+            "inflight": dict(self._inflight),
+            "batches": dict(self.batches),
+            "batch_size": self.batch_size.snapshot(),
+            "queue_wait_ms": {tier: h.snapshot() for tier, h in self.queue_wait_ms.items()},
+        }
+
+    # ---- dispatcher --------------------------------------------------------------------------
+
+    def _ensure_dispatcher(self, loop: asyncio.AbstractEventLoop) -> None:
+        if self._task is not None and not self._task.done() and self._task.get_loop() is loop:
+            return
+        self._wake = asyncio.Event()
+        self._task = loop.create_task(self._dispatch_loop())
+
+    def _ready(self, group: _Group, now: float) -> bool:
+        return len(group.items) >= self.max_size or now - group.items[0].enqueued_at >= self.window_s
+
+    def _next_group(self, now: float) -> Tuple[Optional[_Group], Optional[float]]:
+        """The group to dispatch now (or None) and, if none, how long until one could be ready."""
+        free = self._inflight["realtime"] + self._inflight["deferred"] < self.max_inflight
+        realtime = [g for g in self._groups.values() if g.tier == "realtime"]
+        deferred = [g for g in self._groups.values() if g.tier == "deferred"]
+        candidates = realtime if realtime else (
+            deferred if self._inflight["deferred"] < self.deferred_limit else []
+        )
+        if not free or not candidates:
+            return None, None
+        ready = [g for g in candidates if self._ready(g, now)]
+        if ready:
+            return min(ready, key=lambda g: g.items[0].enqueued_at), None
+        soonest = min(g.items[0].enqueued_at for g in candidates) + self.window_s
+        return None, max(0.0, soonest - now)
+
+    async def _dispatch_loop(self) -> None:
+        while True:
+            group, wait_s = self._next_group(self._clock())
+            if group is not None:
+                self._start(group)
+                continue
+            self._wake.clear()
+            try:
+                await asyncio.wait_for(self._wake.wait(), timeout=wait_s)
+            except asyncio.TimeoutError:
+                pass
+
+    def _start(self, group: _Group) -> None:
+        items = group.items[: self.max_size]
+        group.items = group.items[self.max_size:]
+        if not group.items:
+            del self._groups[(group.tier, group.key)]
+        now = self._clock()
+        self.batch_size.observe(len(items))
+        self.batches[group.tier] += 1
+        for item in items:
+            item.started_at = now
+            self.queue_wait_ms[group.tier].observe((now - item.enqueued_at) * 1000.0)
+        self._inflight[group.tier] += 1
+        asyncio.get_running_loop().create_task(self._run(group.key, group.tier, items))
+
+    async def _run(self, key: Hashable, tier: str, items: List[_Pending]) -> None:
+        try:
+            results = await self._run_batch(key, [item.payload for item in items])
+            if len(results) != len(items):
+                raise RuntimeError(f"run_batch returned {len(results)} results for {len(items)} requests")
+            for item, result in zip(items, results):
+                if item.future.done():
+                    continue
+                if isinstance(result, Exception):
+                    item.future.set_exception(result)
+                else:
+                    item.future.set_result(result)
+        except Exception as exc:  # noqa: BLE001 — every waiter of the batch must see the failure
+            for item in items:
+                if not item.future.done():
+                    item.future.set_exception(exc)
+        finally:
+            self._inflight[tier] -= 1
+            self._wake.set()
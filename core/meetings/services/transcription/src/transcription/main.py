@@ -7,9 +7,15 @@ import io
 import time
 import logging
 import asyncio
+import bisect
+import functools
 import json
+import subprocess
 from concurrent.futures import ThreadPoolExecutor
+from contextlib import contextmanager
+from dataclasses import dataclass
 from datetime import datetime
+from types import SimpleNamespace
 from typing import Optional, List, Dict, Any, Tuple
 import numpy as np
 import soundfile as sf
@@ -17,8 +23,11 @@ from fastapi import FastAPI, File, UploadFile, Form, HTTPException, Depends, Req
 from fastapi.responses import JSONResponse
 from fastapi.security import APIKeyHeader
 import uvicorn
-from faster_whisper import WhisperModel
+from faster_whisper import BatchedInferencePipeline, WhisperModel
+from faster_whisper.vad import VadOptions, get_speech_timestamps
 # faster-whisper uses CTranslate2 internally (no PyTorch needed)
+from transcription.batching import DECODE_MS_BUCKETS, QUEUE_WAIT_MS_BUCKETS, Histogram, MicroBatcher
+from transcription.models import ModelUnavailable, ResidentModels, first_artifact, prefetch, weights_bytes
 
 # Logging
 logging.basicConfig(
@@ -75,6 +84,20 @@ def _env_float(name: str, default: float) -> float:
         logger.warning(f"Invalid float env {name}={raw!r}, using default {default}")
         return default
 
+# Model residency (transcription/models.py). MODEL_SIZE is the default model: loaded, warmed and
+# pinned before /health reports ready. SERVED_MODELS names further models a request's `model` field
+# may select; they load on first use and share MODEL_MEMORY_BUDGET_MB (0 = unbounded) with the
+# default, least-recently-used idle ones evicted first. Any other `model` value (e.g. the
+# OpenAI-style "whisper-1") is served by MODEL_SIZE. Preconverted artifacts (<dir>/<name>/model.bin)
+# are looked up in BAKED_MODEL_DIR — baked into the image with `python -m transcription.models
+# <name>...`, outside any volume so a newer image's models are always the ones served — then in
+# MODEL_DIR, the download cache compose persists in a named volume.
+BAKED_MODEL_DIR = os.getenv("BAKED_MODEL_DIR", "/opt/models")
+MODEL_DIR = os.getenv("MODEL_DIR", "/app/models")
+SERVED_MODELS = [m.strip() for m in os.getenv("SERVED_MODELS", "").split(",") if m.strip() and m.strip() != MODEL_SIZE]
+MODEL_MEMORY_BUDGET_MB = _env_int("MODEL_MEMORY_BUDGET_MB", 0)
+MODEL_WARMUP = _env_bool("MODEL_WARMUP", True)
+
 # Transcription defaults (can be overridden via env)
 BEAM_SIZE = _env_int("BEAM_SIZE", 5)
 BEST_OF = _env_int("BEST_OF", 5)
@@ -92,9 +115,27 @@ VAD_FILTER_THRESHOLD = _env_float("VAD_FILTER_THRESHOLD", 0.5)
 VAD_MIN_SILENCE_DURATION_MS = _env_int("VAD_MIN_SILENCE_DURATION_MS", 160)
 VAD_MAX_SPEECH_DURATION_S = _env_float("VAD_MAX_SPEECH_DURATION_S", 15.0)  # max segment length before forced split
 
+# Upload codecs decoded in memory by soundfile (libsndfile) — advertised on /health and / so a
+# client can pick the compressed body. FLAC carries the same 16-bit samples as WAV at ~half the
+# bytes; anything else still goes through the ffmpeg fallback below.
+UPLOAD_CODECS = ("wav", "flac")
+# Everything else (webm/opus from the recording path, ogg, mp3, ...) is piped through ffmpeg:
+# upload bytes on stdin, 16 kHz mono float32 PCM on stdout — no temp files, off the event loop,
+# at most DECODE_CONCURRENCY decoders at a time.
+DECODE_CONCURRENCY = _env_int("DECODE_CONCURRENCY", 2)
+DECODE_TIMEOUT_S = _env_float("DECODE_TIMEOUT_S", 120.0)
+
 # Temperature fallback chain
 USE_TEMPERATURE_FALLBACK = _env_bool("USE_TEMPERATURE_FALLBACK", False)
 TEMPERATURE_FALLBACK_CHAIN = [0.0, 0.2, 0.4, 0.6, 0.8, 1.0]
+# "full" re-decodes the whole clip at each fallback temperature (legacy). "segments" keeps the
+# first pass and re-decodes ONLY the spans of segments that fail the compression-ratio / log-prob
+# gate, in one clip_timestamps call per temperature — the first pass's VAD timing is reused, so
+# a noisy second in a 30s window no longer costs five more 30s decodes.
+TEMPERATURE_FALLBACK_MODE = (os.getenv("TEMPERATURE_FALLBACK_MODE", "full").strip().lower() or "full")
+if TEMPERATURE_FALLBACK_MODE not in ("full", "segments"):
+    TEMPERATURE_FALLBACK_MODE = "full"
+FALLBACK_SPAN_PAD_S = _env_float("FALLBACK_SPAN_PAD_S", 0.2)  # context either side of a retried span
 
 def _looks_like_silence(segments: List[Dict[str, Any]]) -> bool:
     """Heuristic: treat as silence if all segments look like no-speech."""
@@ -108,14 +149,16 @@ def _looks_like_silence(segments: List[Dict[str, Any]]) -> bool:
             return False
     return True
 
+def _segment_low_confidence(s: Dict[str, Any]) -> bool:
+    """The per-segment confidence gate: too repetitive or too unlikely to keep as-is."""
+    return (
+        float(s.get("compression_ratio", 0.0)) > COMPRESSION_RATIO_THRESHOLD
+        or float(s.get("avg_logprob", 0.0)) < LOG_PROB_THRESHOLD
+    )
+
 def _looks_like_hallucination(segments: List[Dict[str, Any]]) -> bool:
     """Heuristic: reject segments that look like hallucinations / low-confidence."""
-    for s in segments:
-        if float(s.get("compression_ratio", 0.0)) > COMPRESSION_RATIO_THRESHOLD:
-            return True
-        if float(s.get("avg_logprob", 0.0)) < LOG_PROB_THRESHOLD:
-            return True
-    return False
+    return any(_segment_low_confidence(s) for s in segments)
 
 # API Token Authentication
 API_TOKEN = os.getenv("API_TOKEN", "").strip()
@@ -159,8 +202,14 @@ app = FastAPI(
     openapi_url="/openapi.json" if _PUBLIC_DOCS else None,
 )
 
-# Global model instance
+# Global model instance — the default (MODEL_SIZE), set only once it is loaded AND warmed
 model: Optional[WhisperModel] = None
+# Batched pipeline over the same model — built at startup only when micro-batching is on
+batched_model: Optional[BatchedInferencePipeline] = None
+# The SERVED_MODELS beside it — built at startup only when SERVED_MODELS names any
+resident_models: Optional[ResidentModels] = None
+# How the default model's startup went: artifact resolve + load, then the warm-up pass
+startup_timing: Dict[str, float] = {}
 
 # Load management: Global concurrency limit and bounded queue
 # These settings control how many transcription requests can be processed concurrently.
@@ -178,12 +227,26 @@ FAIL_FAST_WHEN_BUSY = _env_bool("FAIL_FAST_WHEN_BUSY", True)
 BUSY_RETRY_AFTER_S = _env_int("BUSY_RETRY_AFTER_S", 1)
 REALTIME_RESERVED_SLOTS = _env_int("REALTIME_RESERVED_SLOTS", 1)
 
+# Cross-request micro-batching (transcription/batching.py). Off unless BATCH_MAX_SIZE > 1.
+# Requests sharing model / language / tier / decode options wait up to BATCH_WINDOW_MS for company
+# and run as ONE batched forward pass (faster-whisper's BatchedInferencePipeline), at most
+# BATCH_MAX_INFLIGHT batches at a time; realtime batches always dispatch before deferred ones.
+# Requests without an explicit language are never batched (a batch shares one language
+# detection); prompted requests batch only with the same prompt unless BATCH_DROP_PROMPT=true.
+BATCH_MAX_SIZE = _env_int("BATCH_MAX_SIZE", 1)
+BATCH_WINDOW_MS = _env_float("BATCH_WINDOW_MS", 25.0)
+BATCH_MAX_INFLIGHT = _env_int("BATCH_MAX_INFLIGHT", 1)
+BATCH_DROP_PROMPT = _env_bool("BATCH_DROP_PROMPT", False)
+
 # Semaphore to limit concurrent transcriptions (protects GPU/CPU from overload)
 transcription_semaphore = asyncio.Semaphore(MAX_CONCURRENT_TRANSCRIPTIONS)
 
 # Thread pool for running blocking transcription calls
 transcription_executor = ThreadPoolExecutor(max_workers=MAX_CONCURRENT_TRANSCRIPTIONS)
 
+# Bounded pool for upload decoding (soundfile in memory, else an ffmpeg pipe)
+decode_executor = ThreadPoolExecutor(max_workers=max(1, DECODE_CONCURRENCY), thread_name_prefix="decode")
+
 # Queue to track waiting requests (for 429/503 responses when full)
 # We use a simple counter since FastAPI doesn't have a built-in queue
 waiting_requests = 0
@@ -206,12 +269,501 @@ def _deferred_capacity_available(active_rt: int, active_df: int) -> bool:
     return deferred_limit > 0 and active_df < deferred_limit and total_active < MAX_CONCURRENT_TRANSCRIPTIONS
 
 
+class AudioDecodeError(Exception):
+    """The upload could not be decoded; ``detail`` is the client-facing 400 message."""
+
+
+def _ffmpeg_decode(audio_bytes: bytes) -> np.ndarray:
+    """Pipe ``audio_bytes`` through ffmpeg → 16 kHz mono float32, entirely in memory."""
+    result = subprocess.run(
+        ['ffmpeg', '-nostdin', '-hide_banner', '-loglevel', 'error', '-i', 'pipe:0',
+         '-f', 'f32le', '-acodec', 'pcm_f32le', '-ac', '1', '-ar', str(SAMPLE_RATE), 'pipe:1'],
+        input=audio_bytes, capture_output=True, timeout=DECODE_TIMEOUT_S,
+    )
+    if result.returncode != 0:
+        raise RuntimeError(f"ffmpeg failed: {result.stderr.decode(errors='replace')[:500]}")
+    return np.frombuffer(result.stdout, dtype=np.float32)
+
+
+def _decode_audio(audio_bytes: bytes) -> Tuple[np.ndarray, int]:
+    """Upload bytes → (float32 samples, sample rate). Blocking: run it on ``decode_executor``."""
+    try:
+        return sf.read(io.BytesIO(audio_bytes), dtype=np.float32)
+    except Exception as e:
+        logger.warning(f"Worker {WORKER_ID} soundfile failed ({e}), trying ffmpeg fallback")
+        try:
+            audio_array = _ffmpeg_decode(audio_bytes)
+        except FileNotFoundError:
+            logger.error(f"Worker {WORKER_ID} ffmpeg not installed - cannot decode non-WAV formats")
+            raise AudioDecodeError(f"Failed to decode audio file: {e}. Install ffmpeg for webm/opus support.")
+        except Exception as e2:
+            logger.error(f"Worker {WORKER_ID} ffmpeg fallback also failed: {e2}")
+            raise AudioDecodeError(f"Failed to decode audio file: {e2}")
+        logger.info(f"Worker {WORKER_ID} decoded via ffmpeg - shape: {audio_array.shape}, sample_rate: {SAMPLE_RATE}")
+        return audio_array, SAMPLE_RATE
+
+
+# Inference. faster-whisper decodes lazily while its segment generator is consumed, so both paths
+# materialize the segments INSIDE the executor thread — never on the event loop.
+SAMPLE_RATE = 16000
+BATCH_CHUNK_SAMPLES = 30 * SAMPLE_RATE  # the batched pipeline's chunk unit (Whisper's 30s window)
+
+
+@dataclass
+class _LoadedModel:
+    """One resident model and, when micro-batching is on, its batched pipeline."""
+    model: WhisperModel
+    batched: Optional[BatchedInferencePipeline]
+
+
+@functools.lru_cache(maxsize=None)
+def _model_path(name: str) -> str:
+    """The preconverted artifact under BAKED_MODEL_DIR or MODEL_DIR when there is one (no hub round
+    trip), else the hub snapshot faster-whisper resolves into MODEL_DIR."""
+    local = first_artifact([BAKED_MODEL_DIR, MODEL_DIR], name)
+    if local is not None:
+        return local
+    from faster_whisper.utils import download_model
+
+    return download_model(name, cache_dir=MODEL_DIR)
+
+
+def _model_cost(name: str) -> int:
+    return weights_bytes(_model_path(name))
+
+
+def _open_model(name: str) -> _LoadedModel:
+    """Load ``name`` with its weights paged in ahead of CTranslate2's own reads."""
+    path = _model_path(name)
+    prefetch(path)
+    model_kwargs = {"model_size_or_path": path, "device": DEVICE, "compute_type": COMPUTE_TYPE}
+    # Add CPU threads for CPU mode (optimization from research)
+    if DEVICE == "cpu" and CPU_THREADS > 0:
+        model_kwargs["cpu_threads"] = CPU_THREADS
+    whisper = WhisperModel(**model_kwargs)
+    return _LoadedModel(whisper, BatchedInferencePipeline(model=whisper) if batcher is not None else None)
+
+
+def _warm_up(whisper: WhisperModel) -> None:
+    """One throwaway pass over a second of silence, so the first real request does not pay for
+    kernel selection and allocator growth."""
+    if not MODEL_WARMUP:
+        return
+    segments, _ = whisper.transcribe(
+        np.zeros(SAMPLE_RATE, dtype=np.float32), language="en", beam_size=1, vad_filter=False, without_timestamps=True,
+    )
+    list(segments)
+
+
+def _load_model(name: str) -> _LoadedModel:
+    """The ``ResidentModels`` loader: open + warm, so a model is resident only once it is fast."""
+    loaded = _open_model(name)
+    _warm_up(loaded.model)
+    logger.info(f"Worker {WORKER_ID} loaded {name} into the resident set")
+    return loaded
+
+
+def _served_model(requested: Optional[str]) -> str:
+    """The model that serves a request's ``model`` field: a SERVED_MODELS name, else the default."""
+    return requested if requested in SERVED_MODELS else MODEL_SIZE
+
+
+@contextmanager
+def _whisper_for(served: str):
+    """``(model, batched pipeline)`` for ``served``, held resident for one pass. The default is
+    pinned (the globals); any other model is leased from ``resident_models``."""
+    if served == MODEL_SIZE or resident_models is None:
+        yield model, batched_model
+        return
+    with resident_models.lease(served) as loaded:
+        yield loaded.model, loaded.batched
+
+
+def _resident_names() -> List[str]:
+    """Models loaded and warm right now, the pinned default first."""
+    if model is None:
+        return []
+    return [MODEL_SIZE, *(resident_models.resident() if resident_models is not None else [])]
+
+
+def _transcribe_with_model(
+    served: str,
+    audio: np.ndarray,
+    language: Optional[str],
+    task: str,
+    prompt: Optional[str],
+    temperature: float,
+    want_word_timestamps: bool,
+    min_silence_ms: int,
+    max_speech_s: float,
+) -> Tuple[List[Any], Any]:
+    with _whisper_for(served) as (whisper, _):
+        segments, info = whisper.transcribe(
+            audio,
+            language=language,
+            task=task,
+            initial_prompt=prompt,
+            temperature=temperature,
+            beam_size=BEAM_SIZE,
+            best_of=BEST_OF,
+            compression_ratio_threshold=COMPRESSION_RATIO_THRESHOLD,
+            log_prob_threshold=LOG_PROB_THRESHOLD,
+            no_speech_threshold=NO_SPEECH_THRESHOLD,
+            condition_on_previous_text=CONDITION_ON_PREVIOUS_TEXT,
+            prompt_reset_on_temperature=PROMPT_RESET_ON_TEMPERATURE,
+            repetition_penalty=REPETITION_PENALTY,
+            no_repeat_ngram_size=NO_REPEAT_NGRAM_SIZE,
+            vad_filter=VAD_FILTER,
+            vad_parameters={
+                "threshold": VAD_FILTER_THRESHOLD,
+                "min_silence_duration_ms": min_silence_ms,
+                "max_speech_duration_s": max_speech_s,
+            },
+            word_timestamps=want_word_timestamps,
+        )
+        return list(segments), info
+
+
+@dataclass
+class _BatchRequest:
+    """One request's share of a micro-batch (its decode options live in the batch key)."""
+    audio: np.ndarray
+    min_silence_ms: int
+    max_speech_s: float
+
+
+def _batch_key(
+    served: str,
+    language: Optional[str],
+    task: str,
+    want_word_timestamps: bool,
+    prompt: Optional[str],
+    temperature: float,
+) -> Optional[tuple]:
+    """Grouping key for the micro-batcher, or None when this request must run on its own."""
+    if batcher is None or not language:
+        return None
+    return (served, language, task, want_word_timestamps, None if BATCH_DROP_PROMPT else prompt, temperature)
+
+
+def _pack_clips(spans: List[Dict[str, int]], max_samples: int) -> List[Dict[str, int]]:
+    """Merge ordered speech spans (sample offsets) into clips of at most ``max_samples``."""
+    clips: List[Dict[str, int]] = []
+    for span in spans:
+        start, end = int(span["start"]), int(span["end"])
+        while end - start > max_samples:
+            clips.append({"start": start, "end": start + max_samples})
+            start += max_samples
+        if clips and end - clips[-1]["start"] <= max_samples:
+            clips[-1]["end"] = end
+        else:
+            clips.append({"start": start, "end": end})
+    return clips
+
+
+def _speech_clips(req: _BatchRequest) -> List[Dict[str, int]]:
+    """The request's VAD speech regions as batch clips — the same VAD the solo path applies."""
+    if not VAD_FILTER:
+        return _pack_clips([{"start": 0, "end": len(req.audio)}], BATCH_CHUNK_SAMPLES)
+    spans = get_speech_timestamps(
+        req.audio,
+        VadOptions(
+            threshold=VAD_FILTER_THRESHOLD,
+            min_silence_duration_ms=req.min_silence_ms,
+            max_speech_duration_s=req.max_speech_s,
+        ),
+    )
+    return _pack_clips(spans, BATCH_CHUNK_SAMPLES)
+
+
+def _split_batch_segments(segments: List[Any], offsets: List[int]) -> List[List[Any]]:
+    """Hand each segment of a concatenated batch back to the request it starts in, with its
+    (and its words') timestamps shifted back onto that request's own timeline."""
+    starts = [o / SAMPLE_RATE for o in offsets]
+    out: List[List[Any]] = [[] for _ in offsets]
+    for seg in segments:
+        i = max(0, bisect.bisect_right(starts, seg.start + 1e-6) - 1)
+        base = starts[i]
+        words = getattr(seg, "words", None)
+        out[i].append(SimpleNamespace(
+            start=seg.start - base,
+            end=seg.end - base,
+            text=seg.text,
+            avg_logprob=seg.avg_logprob,
+            compression_ratio=seg.compression_ratio,
+            no_speech_prob=seg.no_speech_prob,
+            words=[
+                SimpleNamespace(word=w.word, start=w.start - base, end=w.end - base, probability=w.probability)
+                for w in words
+            ] if words else None,
+        ))
+    return out
+
+
+def _transcribe_batch_sync(key: tuple, reqs: List[_BatchRequest]) -> List[Tuple[List[Any], Any]]:
+    """Run one micro-batch. A lone request takes the exact solo path; otherwise the requests'
+    speech clips are concatenated into one array and decoded as one batched pass."""
+    served, language, task, want_word_timestamps, prompt, temperature = key
+    with _whisper_for(served) as (_, batched):
+        if len(reqs) == 1 or batched is None:
+            return [
+                _transcribe_with_model(served, r.audio, language, task, prompt, temperature, want_word_timestamps, r.min_silence_ms, r.max_speech_s)
+                for r in reqs
+            ]
+        return _transcribe_batched(batched, key, reqs)
+
+
+def _transcribe_batched(batched: BatchedInferencePipeline, key: tuple, reqs: List[_BatchRequest]) -> List[Tuple[List[Any], Any]]:
+    """The concatenated-clips pass for a multi-request batch on ``batched``."""
+    _served, language, task, want_word_timestamps, prompt, temperature = key
+    clips: List[Dict[str, int]] = []
+    offsets: List[int] = []
+    offset = 0
+    for r in reqs:
+        offsets.append(offset)
+        clips.extend({"start": c["start"] + offset, "end": c["end"] + offset} for c in _speech_clips(r))
+        offset += len(r.audio)
+    if not clips:
+        silent = SimpleNamespace(language=language, language_probability=1.0)
+        return [([], silent) for _ in reqs]
+    segments, info = batched.transcribe(
+        np.concatenate([r.audio for r in reqs]),
+        language=language,
+        task=task,
+        initial_prompt=prompt,
+        temperature=temperature,
+        beam_size=BEAM_SIZE,
+        compression_ratio_threshold=COMPRESSION_RATIO_THRESHOLD,
+        log_prob_threshold=LOG_PROB_THRESHOLD,
+        no_speech_threshold=NO_SPEECH_THRESHOLD,
+        repetition_penalty=REPETITION_PENALTY,
+        no_repeat_ngram_size=NO_REPEAT_NGRAM_SIZE,
+        vad_filter=False,
+        clip_timestamps=clips,
+        word_timestamps=want_word_timestamps,
+        batch_size=max(1, min(len(clips), BATCH_MAX_SIZE)),
+    )
+    return [(segs, info) for segs in _split_batch_segments(list(segments), offsets)]
+
+
+async def _run_transcription_batch(key: tuple, reqs: List[_BatchRequest]) -> List[Tuple[List[Any], Any]]:
+    return await asyncio.get_running_loop().run_in_executor(transcription_executor, _transcribe_batch_sync, key, reqs)
+
+
+batcher: Optional[MicroBatcher] = (
+    MicroBatcher(
+        _run_transcription_batch,
+        max_size=BATCH_MAX_SIZE,
+        window_ms=BATCH_WINDOW_MS,
+        max_inflight=BATCH_MAX_INFLIGHT,
+        realtime_reserved_slots=REALTIME_RESERVED_SLOTS,
+    )
+    if BATCH_MAX_SIZE > 1
+    else None
+)
+
+
+# Per-request result shaping + the segment-level temperature fallback.
+
+def _segment_dicts(segments_list: List[Any], temperature: float, want_word_timestamps: bool) -> List[Dict[str, Any]]:
+    """faster-whisper segments → the verbose_json segment dicts the client consumes."""
+    segments: List[Dict[str, Any]] = []
+    for idx, segment in enumerate(segments_list):
+        seg_dict: Dict[str, Any] = {
+            "id": idx,
+            "seek": 0,
+            "start": segment.start,
+            "end": segment.end,
+            "text": segment.text,
+            "tokens": [],
+            "temperature": temperature,
+            "avg_logprob": segment.avg_logprob,
+            "compression_ratio": segment.compression_ratio,
+            "no_speech_prob": segment.no_speech_prob,
+            "audio_start": segment.start,
+            "audio_end": segment.end,
+        }
+        if want_word_timestamps and hasattr(segment, 'words') and segment.words:
+            seg_dict["words"] = [
+                {"word": w.word, "start": w.start, "end": w.end, "probability": w.probability}
+                for w in segment.words
+            ]
+        segments.append(seg_dict)
+    return segments
+
+
+@dataclass(frozen=True)
+class _RetrySpan:
+    """Seconds [start, end) re-decoded for the low-confidence segments first..last (inclusive)."""
+    start: float
+    end: float
+    first: int
+    last: int
+
+
+def _retry_spans(segments: List[Dict[str, Any]], audio_s: float, pad_s: float) -> List[_RetrySpan]:
+    """One span per run of consecutive low-confidence segments, padded but never into a kept neighbour."""
+    runs: List[List[int]] = []
+    for i, seg in enumerate(segments):
+        if not _segment_low_confidence(seg):
+            continue
+        if runs and runs[-1][1] == i - 1:
+            runs[-1][1] = i
+        else:
+            runs.append([i, i])
+    spans: List[_RetrySpan] = []
+    for first, last in runs:
+        lo = max(0.0, float(segments[first]["start"]) - pad_s)
+        hi = min(audio_s, float(segments[last]["end"]) + pad_s)
+        if first > 0:
+            lo = max(lo, float(segments[first - 1]["end"]))
+        if last + 1 < len(segments):
+            hi = min(hi, float(segments[last + 1]["start"]))
+        if hi > lo:
+            spans.append(_RetrySpan(lo, hi, first, last))
+    return spans
+
+
+def _assign_to_spans(retry: List[Dict[str, Any]], spans: List[_RetrySpan]) -> List[List[Dict[str, Any]]]:
+    """Bucket re-decoded segments onto the span holding their midpoint (strays are dropped)."""
+    starts = [sp.start for sp in spans]
+    buckets: List[List[Dict[str, Any]]] = [[] for _ in spans]
+    for seg in retry:
+        mid = (float(seg["start"]) + float(seg["end"])) / 2.0
+        i = bisect.bisect_right(starts, mid) - 1
+        if i >= 0 and mid < spans[i].end:
+            buckets[i].append(seg)
+    return buckets
+
+
+def _splice_spans(segments: List[Dict[str, Any]], accepted: Dict[_RetrySpan, List[Dict[str, Any]]]) -> List[Dict[str, Any]]:
+    """First-pass segments with every accepted span's originals swapped for its re-decode."""
+    by_first = {sp.first: sp for sp in accepted}
+    out: List[Dict[str, Any]] = []
+    i = 0
+    while i < len(segments):
+        sp = by_first.get(i)
+        if sp is None:
+            out.append(segments[i])
+            i += 1
+            continue
+        out.extend(accepted[sp])
+        i = sp.last + 1
+    for idx, seg in enumerate(out):
+        seg["id"] = idx
+    return out
+
+
+def _transcribe_clips(
+    served: str,
+    audio: np.ndarray,
+    language: Optional[str],
+    task: str,
+    prompt: Optional[str],
+    temperature: float,
+    want_word_timestamps: bool,
+    clips: List[float],
+) -> List[Any]:
+    """Decode only ``clips`` (flat start,end seconds) of ``audio``; timestamps stay on its timeline."""
+    with _whisper_for(served) as (whisper, _):
+        segments, _ = whisper.transcribe(
+            audio,
+            language=language,
+            task=task,
+            initial_prompt=prompt,
+            temperature=temperature,
+            beam_size=BEAM_SIZE,
+            best_of=BEST_OF,
+            compression_ratio_threshold=COMPRESSION_RATIO_THRESHOLD,
+            log_prob_threshold=LOG_PROB_THRESHOLD,
+            no_speech_threshold=NO_SPEECH_THRESHOLD,
+            condition_on_previous_text=False,
+            prompt_reset_on_temperature=PROMPT_RESET_ON_TEMPERATURE,
+            repetition_penalty=REPETITION_PENALTY,
+            no_repeat_ngram_size=NO_REPEAT_NGRAM_SIZE,
+            vad_filter=False,  # the spans come from the first pass's (VAD-filtered) segments
+            clip_timestamps=clips,
+            word_timestamps=want_word_timestamps,
+        )
+        return list(segments)
+
+
+async def _retry_low_confidence_spans(
+    served: str,
+    audio: np.ndarray,
+    segments: List[Dict[str, Any]],
+    temps: List[float],
+    language: Optional[str],
+    task: str,
+    prompt: Optional[str],
+    want_word_timestamps: bool,
+    counters: Dict[str, Any],
+) -> List[Dict[str, Any]]:
+    """Walk ``temps`` over the failing spans only; a span that never passes keeps its first pass."""
+    pending = _retry_spans(segments, len(audio) / SAMPLE_RATE, FALLBACK_SPAN_PAD_S)
+    accepted: Dict[_RetrySpan, List[Dict[str, Any]]] = {}
+    loop = asyncio.get_running_loop()
+    for t in temps:
+        if not pending:
+            break
+        clips = [x for sp in pending for x in (sp.start, sp.end)]
+        raw = await loop.run_in_executor(
+            transcription_executor, _transcribe_clips,
+            served, audio, language, task, prompt, t, want_word_timestamps, clips,
+        )
+        counters["passes"] += 1
+        counters["retried_audio_s"] += sum(sp.end - sp.start for sp in pending)
+        still: List[_RetrySpan] = []
+        for sp, segs in zip(pending, _assign_to_spans(_segment_dicts(raw, t, want_word_timestamps), pending)):
+            if segs and not _looks_like_hallucination(segs):
+                accepted[sp] = segs
+                counters["segments_recovered"] += sp.last - sp.first + 1
+            else:
+                still.append(sp)
+        pending = still
+    return _splice_spans(segments, accepted)
+
+
+# Process-wide fallback totals (served on /stats); each response carries its own counters.
+fallback_totals: Dict[str, Any] = {
+    "requests": 0, "requests_with_fallback": 0, "passes": 0,
+    "segments_retried": 0, "segments_recovered": 0, "retried_audio_s": 0.0,
+}
+
+
+# Where a request's time went, per request: ``queue`` = waiting for capacity (the concurrency
+# semaphore, then the micro-batch window), ``decode`` = the work once admitted (audio decode, the
+# model pass, fallback re-decodes). Returned on the response as ``timing`` so the caller can split
+# its STT round trip, and aggregated here for /stats — the two numbers the STT tier is sized on.
+request_latency_ms: Dict[str, Histogram] = {
+    "queue": Histogram(QUEUE_WAIT_MS_BUCKETS), "decode": Histogram(DECODE_MS_BUCKETS),
+}
+
+
+def _request_timing(arrived: float, admitted: float, batch_wait_ms: float, now: float) -> Dict[str, float]:
+    """``{queue_ms, decode_ms}`` for one request from its monotonic checkpoints, recorded in
+    ``request_latency_ms``."""
+    queue_ms = (admitted - arrived) * 1000.0 + batch_wait_ms
+    decode_ms = max(0.0, (now - admitted) * 1000.0 - batch_wait_ms)
+    request_latency_ms["queue"].observe(queue_ms)
+    request_latency_ms["decode"].observe(decode_ms)
+    return {"queue_ms": round(queue_ms, 1), "decode_ms": round(decode_ms, 1)}
+
+
+def _record_fallback(counters: Dict[str, Any]) -> None:
+    fallback_totals["requests"] += 1
+    if counters["passes"]:
+        fallback_totals["requests_with_fallback"] += 1
+    for k in ("passes", "segments_retried", "segments_recovered", "retried_audio_s"):
+        fallback_totals[k] += counters[k]
+
+
 @app.on_event("startup")
 async def startup_event():
-    """Initialize Whisper model on startup"""
-    global model
+    """Load and warm the default model on startup; /health stays 503 until both are done"""
+    global model, batched_model, resident_models
     logger.info(f"Worker {WORKER_ID} starting up...")
-    logger.info(f"Device: {DEVICE}, Model: {MODEL_SIZE}, Compute: {COMPUTE_TYPE}")
+    logger.info(f"Device: {DEVICE}, Model: {MODEL_SIZE}, Compute: {COMPUTE_TYPE}, Served: {SERVED_MODELS}")
     logger.info(
         "Quality params - "
         f"beam_size={BEAM_SIZE}, best_of={BEST_OF}, "
@@ -221,25 +773,39 @@ async def startup_event():
         f"no_speech_threshold={NO_SPEECH_THRESHOLD}, "
         f"vad_filter={VAD_FILTER}, "
         f"repetition_penalty={REPETITION_PENALTY}, "
-        f"no_repeat_ngram_size={NO_REPEAT_NGRAM_SIZE}"
+        f"no_repeat_ngram_size={NO_REPEAT_NGRAM_SIZE}, "
+        f"temperature_fallback={USE_TEMPERATURE_FALLBACK} ({TEMPERATURE_FALLBACK_MODE})"
     )
     
     try:
-        # Build model initialization parameters
-        model_kwargs = {
-            "model_size_or_path": MODEL_SIZE,
-            "device": DEVICE,
-            "compute_type": COMPUTE_TYPE,
-            "download_root": "/app/models"
-        }
-        
-        # Add CPU threads for CPU mode (optimization from research)
+        loop = asyncio.get_running_loop()
+        if first_artifact([BAKED_MODEL_DIR, MODEL_DIR], MODEL_SIZE) is None:
+            logger.warning(f"Worker {WORKER_ID} no preconverted artifact for {MODEL_SIZE} in {BAKED_MODEL_DIR} or {MODEL_DIR} - resolving via the hub")
         if DEVICE == "cpu" and CPU_THREADS > 0:
-            model_kwargs["cpu_threads"] = CPU_THREADS
             logger.info(f"Worker {WORKER_ID} using {CPU_THREADS} CPU threads")
-        
-        model = WhisperModel(**model_kwargs)
-        logger.info(f"Worker {WORKER_ID} ready - Model loaded successfully")
+        started = time.monotonic()
+        loaded = await loop.run_in_executor(transcription_executor, _open_model, MODEL_SIZE)
+        opened = time.monotonic()
+        await loop.run_in_executor(transcription_executor, _warm_up, loaded.model)
+        startup_timing["load_ms"] = round((opened - started) * 1000.0, 1)
+        startup_timing["warmup_ms"] = round((time.monotonic() - opened) * 1000.0, 1)
+        if batcher is not None:
+            logger.info(
+                f"Worker {WORKER_ID} micro-batching on - max_size={BATCH_MAX_SIZE}, "
+                f"window={BATCH_WINDOW_MS}ms, max_inflight={BATCH_MAX_INFLIGHT}"
+            )
+        if SERVED_MODELS:
+            # The pinned default spends its share of the budget first; the rest is the LRU's.
+            budget = MODEL_MEMORY_BUDGET_MB * 1024 * 1024
+            resident_models = ResidentModels(
+                _load_model, _model_cost,
+                budget_bytes=max(1, budget - _model_cost(MODEL_SIZE)) if budget else 0,
+            )
+        model, batched_model = loaded.model, loaded.batched
+        logger.info(
+            f"Worker {WORKER_ID} ready - Model loaded in {startup_timing['load_ms']}ms, "
+            f"warmed in {startup_timing['warmup_ms']}ms"
+        )
     except Exception as e:
         logger.error(f"Failed to load model: {e}")
         raise
@@ -253,8 +819,12 @@ async def health_check():
         "worker_id": WORKER_ID,
         "timestamp": datetime.utcnow().isoformat(),
         "model": MODEL_SIZE,
+        "served_models": [MODEL_SIZE, *SERVED_MODELS],
+        "resident_models": _resident_names(),
+        "startup_ms": dict(startup_timing),
         "device": DEVICE,
         "gpu_available": DEVICE == "cuda",
+        "upload_codecs": list(UPLOAD_CODECS),
     }
     
     if DEVICE == "cuda":
@@ -299,8 +869,11 @@ async def transcribe_audio(
         raise HTTPException(status_code=400, detail="Model parameter is required")
     global waiting_requests, active_realtime_requests, active_deferred_requests
 
+    served = _served_model(requested_model)
     tier_from_header = request.headers.get("X-Transcription-Tier")
     transcription_tier = _normalize_transcription_tier(transcription_tier_form or tier_from_header)
+    arrived = time.monotonic()
+    batch_timing: Dict[str, float] = {}
 
     semaphore_acquired = False
     waiting_counted = False
@@ -344,6 +917,7 @@ async def transcribe_audio(
         # Acquire semaphore (blocks if MAX_CONCURRENT_TRANSCRIPTIONS is reached)
         await transcription_semaphore.acquire()
         semaphore_acquired = True
+        admitted = time.monotonic()
         
         async with waiting_requests_lock:
             if waiting_counted:
@@ -360,44 +934,20 @@ async def transcribe_audio(
         start_time = time.time()
         logger.info(
             f"Worker {WORKER_ID} received transcription request - "
-            f"tier={transcription_tier}, filename: {file.filename}, content_type: {file.content_type}"
+            f"tier={transcription_tier}, model={served}, filename: {file.filename}, content_type: {file.content_type}"
         )
         # Read audio file
         audio_bytes = await file.read()
         logger.info(f"Worker {WORKER_ID} read {len(audio_bytes)} bytes of audio data")
         
-        # Convert to format suitable for faster-whisper
-        # Use soundfile to properly decode audio formats (WAV, MP3, etc.)
-        # Falls back to ffmpeg subprocess for formats soundfile can't handle (webm, opus, etc.)
-        audio_io = io.BytesIO(audio_bytes)
+        # Decode in memory off the event loop: soundfile for WAV/FLAC, an ffmpeg pipe otherwise
         try:
-            audio_array, sample_rate = sf.read(audio_io, dtype=np.float32)
-            logger.info(f"Worker {WORKER_ID} decoded audio - shape: {audio_array.shape}, sample_rate: {sample_rate}")
-        except Exception as e:
-            logger.warning(f"Worker {WORKER_ID} soundfile failed ({e}), trying ffmpeg fallback")
-            try:
-                import subprocess, tempfile
-                with tempfile.NamedTemporaryFile(suffix='.webm', delete=False) as tmp_in:
-                    tmp_in.write(audio_bytes)
-                    tmp_in_path = tmp_in.name
-                tmp_out_path = tmp_in_path.replace('.webm', '.wav')
-                result = subprocess.run(
-                    ['ffmpeg', '-y', '-i', tmp_in_path, '-ar', '16000', '-ac', '1', '-f', 'wav', tmp_out_path],
-                    capture_output=True, timeout=120
-                )
-                if result.returncode != 0:
-                    raise RuntimeError(f"ffmpeg failed: {result.stderr.decode()[:500]}")
-                audio_array, sample_rate = sf.read(tmp_out_path, dtype=np.float32)
-                logger.info(f"Worker {WORKER_ID} decoded via ffmpeg - shape: {audio_array.shape}, sample_rate: {sample_rate}")
-                import os
-                os.unlink(tmp_in_path)
-                os.unlink(tmp_out_path)
-            except FileNotFoundError:
-                logger.error(f"Worker {WORKER_ID} ffmpeg not installed - cannot decode non-WAV formats")
-                raise HTTPException(status_code=400, detail=f"Failed to decode audio file: {e}. Install ffmpeg for webm/opus support.")
-            except Exception as e2:
-                logger.error(f"Worker {WORKER_ID} ffmpeg fallback also failed: {e2}")
-                raise HTTPException(status_code=400, detail=f"Failed to decode audio file: {e2}")
+            audio_array, sample_rate = await asyncio.get_running_loop().run_in_executor(
+                decode_executor, _decode_audio, audio_bytes
+            )
+        except AudioDecodeError as e:
+            raise HTTPException(status_code=400, detail=str(e))
+        logger.info(f"Worker {WORKER_ID} decoded audio - shape: {audio_array.shape}, sample_rate: {sample_rate}")
         
         # Ensure mono audio (convert stereo to mono if needed)
         if len(audio_array.shape) > 1:
@@ -425,62 +975,32 @@ async def transcribe_audio(
         best: Optional[Tuple[str, str, float, List[Dict[str, Any]]]] = None
         last_info = None
         last_segments: List[Dict[str, Any]] = []
+        audio_s = len(audio_array) / SAMPLE_RATE
+        fallback = {
+            "mode": TEMPERATURE_FALLBACK_MODE, "passes": 0, "segments_retried": 0,
+            "segments_recovered": 0, "retried_audio_s": 0.0,
+        }
 
-        for t in temps:
-            # Run blocking transcription in thread pool to avoid blocking event loop
-            def _transcribe_sync():
-                return model.transcribe(
-                    audio_array,
-                    language=language,
-                    task=task,
-                    initial_prompt=prompt,
-                    temperature=t,
-                    beam_size=BEAM_SIZE,
-                    best_of=BEST_OF,
-                    compression_ratio_threshold=COMPRESSION_RATIO_THRESHOLD,
-                    log_prob_threshold=LOG_PROB_THRESHOLD,
-                    no_speech_threshold=NO_SPEECH_THRESHOLD,
-                    condition_on_previous_text=CONDITION_ON_PREVIOUS_TEXT,
-                    prompt_reset_on_temperature=PROMPT_RESET_ON_TEMPERATURE,
-                    repetition_penalty=REPETITION_PENALTY,
-                    no_repeat_ngram_size=NO_REPEAT_NGRAM_SIZE,
-                    vad_filter=VAD_FILTER,
-                    vad_parameters={
-                        "threshold": VAD_FILTER_THRESHOLD,
-                        "min_silence_duration_ms": req_min_silence,
-                        "max_speech_duration_s": req_max_speech,
-                    },
-                    word_timestamps=want_word_timestamps,
+        for attempt, t in enumerate(temps):
+            # Run blocking transcription in thread pool to avoid blocking event loop. The first
+            # attempt rides a micro-batch when one can take it; fallback re-runs go solo.
+            batch_key = _batch_key(served, language, task, want_word_timestamps, prompt, t) if attempt == 0 else None
+            if batch_key is not None:
+                segments_list, info = await batcher.submit(
+                    batch_key, transcription_tier, _BatchRequest(audio_array, req_min_silence, req_max_speech),
+                    timing=batch_timing,
+                )
+            else:
+                segments_list, info = await asyncio.get_event_loop().run_in_executor(
+                    transcription_executor, _transcribe_with_model,
+                    served, audio_array, language, task, prompt, t, want_word_timestamps, req_min_silence, req_max_speech,
                 )
-            
-            segments_list, info = await asyncio.get_event_loop().run_in_executor(
-                transcription_executor, _transcribe_sync
-            )
             last_info = info
+            if attempt > 0:
+                fallback["passes"] += 1
+                fallback["retried_audio_s"] += audio_s
 
-            # Convert segments to list (faster-whisper returns generator)
-            segments: List[Dict[str, Any]] = []
-            for idx, segment in enumerate(segments_list):
-                seg_dict: Dict[str, Any] = {
-                    "id": idx,
-                    "seek": 0,
-                    "start": segment.start,
-                    "end": segment.end,
-                    "text": segment.text,
-                    "tokens": [],
-                    "temperature": t,
-                    "avg_logprob": segment.avg_logprob,
-                    "compression_ratio": segment.compression_ratio,
-                    "no_speech_prob": segment.no_speech_prob,
-                    "audio_start": segment.start,
-                    "audio_end": segment.end,
-                }
-                if want_word_timestamps and hasattr(segment, 'words') and segment.words:
-                    seg_dict["words"] = [
-                        {"word": w.word, "start": w.start, "end": w.end, "probability": w.probability}
-                        for w in segment.words
-                    ]
-                segments.append(seg_dict)
+            segments = _segment_dicts(segments_list, t, want_word_timestamps)
             last_segments = segments
 
             if _looks_like_silence(segments):
@@ -489,8 +1009,25 @@ async def transcribe_audio(
                 break
 
             is_hallucination = _looks_like_hallucination(segments)
+            if is_hallucination and attempt == 0 and len(temps) > 1:
+                fallback["segments_retried"] = sum(1 for s in segments if _segment_low_confidence(s))
+
+            if is_hallucination and attempt == 0 and len(temps) > 1 and TEMPERATURE_FALLBACK_MODE == "segments":
+                # Re-decode only the failing spans (language pinned to the first pass's detection).
+                segments = await _retry_low_confidence_spans(
+                    served, audio_array, segments, temps[1:], language or info.language, task, prompt,
+                    want_word_timestamps, fallback,
+                )
+                is_hallucination = False
+                logger.info(
+                    f"Worker {WORKER_ID} segment fallback: {fallback['segments_recovered']}/"
+                    f"{fallback['segments_retried']} segments recovered in {fallback['passes']} passes "
+                    f"({fallback['retried_audio_s']:.2f}s of {audio_s:.2f}s re-decoded)"
+                )
 
             if not is_hallucination:
+                if attempt > 0:
+                    fallback["segments_recovered"] = fallback["segments_retried"]
                 full_text = " ".join([s["text"].strip() for s in segments]).strip()
                 duration = segments[-1]["end"] if segments else 0.0
                 best = (full_text, info.language, getattr(info, 'language_probability', 0.0), duration, segments)
@@ -524,7 +1061,12 @@ async def transcribe_audio(
             "language_probability": detected_language_probability,
             "duration": duration,
             "segments": segments,
+            "timing": _request_timing(arrived, admitted, batch_timing.get("queue_ms", 0.0), time.monotonic()),
         }
+        if USE_TEMPERATURE_FALLBACK:
+            fallback["retried_audio_s"] = round(fallback["retried_audio_s"], 3)
+            response["fallback"] = fallback
+            _record_fallback(fallback)
         
         # CTranslate2 handles memory management automatically
         
@@ -533,6 +1075,14 @@ async def transcribe_audio(
     except HTTPException:
         # Re-raise HTTP exceptions (429, 503, etc.)
         raise
+    except ModelUnavailable as e:
+        # The requested model cannot be made resident beside the ones in use — a retryable 503.
+        logger.warning(f"Worker {WORKER_ID} cannot serve {served}: {e}")
+        raise HTTPException(
+            status_code=503,
+            detail=str(e),
+            headers={"Retry-After": str(max(1, BUSY_RETRY_AFTER_S))},
+        )
     except Exception as e:
         logger.error(f"Worker {WORKER_ID} transcription failed: {e}", exc_info=True)
         raise HTTPException(status_code=500, detail=str(e))
@@ -555,6 +1105,24 @@ async def transcribe_audio(
             transcription_semaphore.release()
 
 
+@app.get("/stats")
+async def stats():
+    """Load counters, per-request queue/decode latency histograms, plus micro-batching histograms,
+    the resident-model LRU and temperature-fallback totals when enabled."""
+    return {
+        "worker_id": WORKER_ID,
+        "active": {"realtime": active_realtime_requests, "deferred": active_deferred_requests},
+        "waiting": waiting_requests,
+        "batching": batcher.stats() if batcher is not None else None,
+        "latency_ms": {stage: h.snapshot() for stage, h in request_latency_ms.items()},
+        "models": resident_models.stats() if resident_models is not None else None,
+        "fallback": (
+            {"mode": TEMPERATURE_FALLBACK_MODE, **fallback_totals, "retried_audio_s": round(fallback_totals["retried_audio_s"], 3)}
+            if USE_TEMPERATURE_FALLBACK else None
+        ),
+    }
+
+
 @app.get("/")
 async def root():
     """Root endpoint with service info"""
@@ -562,11 +1130,14 @@ async def root():
         "service": "Vexa Transcription Service",
         "worker_id": WORKER_ID,
         "model": MODEL_SIZE,
+        "served_models": [MODEL_SIZE, *SERVED_MODELS],
         "device": DEVICE,
         "status": "ready" if model is not None else "initializing",
+        "upload_codecs": list(UPLOAD_CODECS),
         "endpoints": {
             "transcribe": "/v1/audio/transcriptions",
-            "health": "/health"
+            "health": "/health",
+            "stats": "/stats",
         }
     }
 
@@ -0,0 +1,196 @@
+"""Model residency for the STT worker — preconverted artifacts and an LRU of loaded models.
+
+A replica used to be only as fast to serve as its first ``WhisperModel(...)``: a hub lookup, a
+possible download, then a cold read of the weights. ``artifact_dir`` finds a preconverted
+CTranslate2 artifact (``<root>/<name>/model.bin``, baked with ``python -m transcription.models``)
+so no hub round trip happens, and ``prefetch`` mmaps its weights and asks the kernel to page them
+in ahead of the loader's own reads — the page cache then serves every worker on the host.
+
+``ResidentModels`` keeps several models loaded at once so one worker serves whichever model a
+request names. Entries are least-recently-used ordered and cost their on-disk weight size; a
+load that would exceed ``budget_bytes`` first evicts idle entries from the cold end, and is
+refused with ``ModelUnavailable`` when only leased entries are left. A model is never evicted
+while a pass holds its ``lease``. Concurrent requests for the same cold model share one load.
+
+Thread-based (``lease`` is called from the transcription executor) and model-agnostic (``load``
+and ``cost`` are injected), so the residency contract is unit-testable without faster-whisper.
+"""
+from __future__ import annotations
+
+import mmap
+import os
+import sys
+import threading
+import time
+from collections import OrderedDict
+from contextlib import contextmanager
+from dataclasses import dataclass
+from typing import Any, Callable, Dict, Iterator, List, Optional
+
+WEIGHTS_FILE = "model.bin"
+
+
+def artifact_dir(root: str, name: str) -> Optional[str]:
+    """``<root>/<name>`` when it holds a preconverted CTranslate2 artifact, else None."""
+    path = os.path.join(root, name)
+    return path if os.path.isfile(os.path.join(path, WEIGHTS_FILE)) else None
+
+
+def first_artifact(roots: List[str], name: str) -> Optional[str]:
+    """The artifact for ``name`` under the first root that holds one. The image's baked root comes
+    before the download cache, so a rebuilt image's models are never shadowed by an older copy
+    persisted in the cache volume."""
+    for root in roots:
+        path = artifact_dir(root, name)
+        if path is not None:
+            return path
+    return None
+
+
+def weights_bytes(path: str) -> int:
+    """On-disk size of the artifact's weights — the residency cost of the loaded model."""
+    return os.path.getsize(os.path.join(path, WEIGHTS_FILE))
+
+
+def prefetch(path: str) -> int:
+    """Map the artifact's weights read-only and advise the kernel to read them in now; returns
+    their size in bytes. Best-effort: a platform without ``madvise`` still gets the size."""
+    size = weights_bytes(path)
+    if size == 0:
+        return 0
+    with open(os.path.join(path, WEIGHTS_FILE), "rb") as f, mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ) as m:
+        advice = getattr(mmap, "MADV_WILLNEED", None)
+        if advice is not None:
+            m.madvise(advice)
+    return size
+
+
+class ModelUnavailable(Exception):
+    """The model cannot be made resident within the memory budget right now."""
+
+
+@dataclass
+class _Entry:
+    value: Any
+    nbytes: int
+    leases: int = 0
+
+
+class ResidentModels:
+    """LRU of loaded models under a byte budget (``budget_bytes=0`` = unbounded)."""
+
+    def __init__(
+        self,
+        load: Callable[[str], Any],
+        cost: Callable[[str], int],
+        *,
+        budget_bytes: int = 0,
+    ):
+        self._load = load
+        self._cost = cost
+        self.budget_bytes = max(0, budget_bytes)
+        self._lock = threading.Lock()
+        self._entries: "OrderedDict[str, _Entry]" = OrderedDict()
+        self._loading: Dict[str, threading.Lock] = {}
+        self._reserved = 0
+        self.hits = 0
+        self.loads = 0
+        self.evictions = 0
+        self.refused = 0
+        self.load_ms: Dict[str, float] = {}
+
+    @contextmanager
+    def lease(self, name: str) -> Iterator[Any]:
+        """The loaded model for ``name``, held resident until the block exits."""
+        entry = self._acquire(name)
+        try:
+            yield entry.value
+        finally:
+            with self._lock:
+                entry.leases -= 1
+
+    def resident(self) -> List[str]:
+        """Loaded model names, least recently used first."""
+        with self._lock:
+            return list(self._entries)
+
+    def stats(self) -> Dict[str, Any]:
+        with self._lock:
+            return {
+                "resident": [{"model": n, "bytes": e.nbytes, "leases": e.leases} for n, e in self._entries.items()],
+                "budget_bytes": self.budget_bytes,
+                "used_bytes": self._used(),
+                "hits": self.hits,
+                "loads": self.loads,
+                "evictions": self.evictions,
+                "refused": self.refused,
+                "load_ms": dict(self.load_ms),
+            }
+
+    def _used(self) -> int:
+        return sum(e.nbytes for e in self._entries.values()) + self._reserved
+
+    def _hit(self, name: str) -> Optional[_Entry]:
+        entry = self._entries.get(name)
+        if entry is not None:
+            entry.leases += 1
+            self._entries.move_to_end(name)
+            self.hits += 1
+        return entry
+
+    def _acquire(self, name: str) -> _Entry:
+        with self._lock:
+            entry = self._hit(name)
+            if entry is not None:
+                return entry
+            gate = self._loading.setdefault(name, threading.Lock())
+        with gate:
+            with self._lock:
+                entry = self._hit(name)
+                if entry is not None:
+                    return entry
+            nbytes = self._cost(name)
+            with self._lock:
+                self._make_room(name, nbytes)
+                self._reserved += nbytes
+            started = time.monotonic()
+            try:
+                value = self._load(name)
+            finally:
+                with self._lock:
+                    self._reserved -= nbytes
+            with self._lock:
+                entry = _Entry(value, nbytes, leases=1)
+                self._entries[name] = entry
+                self.loads += 1
+                self.load_ms[name] = round((time.monotonic() - started) * 1000.0, 1)
+            return entry
+
+    def _make_room(self, name: str, nbytes: int) -> None:
+        """Evict idle entries, coldest first, until ``nbytes`` fits; caller holds ``_lock``."""
+        if not self.budget_bytes:
+            return
+        if nbytes > self.budget_bytes:
+            self.refused += 1
+            raise ModelUnavailable(f"model {name} ({nbytes} bytes) exceeds the {self.budget_bytes}-byte budget")
+        for victim in [n for n, e in self._entries.items() if e.leases == 0]:
+            if self._used() + nbytes <= self.budget_bytes:
+                break
+            del self._entries[victim]
+            self.evictions += 1
+        if self._used() + nbytes > self.budget_bytes:
+            self.refused += 1
+            raise ModelUnavailable(f"model {name} does not fit beside the models in use")
+
+
+def bake(names: List[str], root: str) -> None:
+    """Fetch each CTranslate2 model into ``<root>/<name>`` — the layout ``artifact_dir`` reads —
+    so a replica built or started from ``root`` never goes to the hub."""
+    from faster_whisper.utils import download_model
+
+    for name in names:
+        print(download_model(name, output_dir=os.path.join(root, name)))
+
+
+if __name__ == "__main__":
+    bake(sys.argv[1:], os.getenv("BAKED_MODEL_DIR", "/opt/models"))
@@ -0,0 +1,147 @@
+"""Micro-batching scheduler contract — grouping, the wait window, strict realtime priority, and
+the histograms. Model-free: ``run_batch`` is a recording fake, so no faster-whisper is touched.
+The clip packing / segment split helpers the batched dispatch relies on are pinned below it.
+"""
+from __future__ import annotations
+
+import asyncio
+from types import SimpleNamespace
+
+from transcription.batching import Histogram, MicroBatcher
+
+
+def _recorder(delay: float = 0.0):
+    calls = []
+
+    async def run_batch(key, payloads):
+        calls.append((key, list(payloads)))
+        if delay:
+            await asyncio.sleep(delay)
+        return [f"{key}:{p}" for p in payloads]
+
+    return calls, run_batch
+
+
+async def test_same_key_requests_share_one_batch():
+    calls, run = _recorder()
+    b = MicroBatcher(run, max_size=8, window_ms=20)
+    results = await asyncio.gather(*(b.submit("en", "realtime", i) for i in range(3)))
+    assert results == ["en:0", "en:1", "en:2"]
+    assert calls == [("en", [0, 1, 2])]
+    snap = b.stats()
+    assert snap["batch_size"]["count"] == 1 and snap["batch_size"]["buckets"]["4"] == 1
+    assert snap["queue_wait_ms"]["realtime"]["count"] == 3
+
+
+async def test_groups_split_by_key_and_tier():
+    calls, run = _recorder()
+    b = MicroBatcher(run, max_size=8, window_ms=10, max_inflight=4)
+    await asyncio.gather(
+        b.submit("en", "realtime", 1), b.submit("de", "realtime", 2), b.submit("en", "deferred", 3),
+    )
+    assert sorted((k, tuple(p)) for k, p in calls) == [("de", (2,)), ("en", (1,)), ("en", (3,))]
+
+
+async def test_full_group_dispatches_before_the_window():
+    calls, run = _recorder()
+    b = MicroBatcher(run, max_size=2, window_ms=10_000)
+    results = await asyncio.wait_for(asyncio.gather(b.submit("k", "realtime", "a"), b.submit("k", "realtime", "b")), 1.0)
+    assert results == ["k:a", "k:b"] and calls == [("k", ["a", "b"])]
+
+
+async def test_realtime_dispatches_before_older_deferred():
+    calls, run = _recorder(delay=0.02)
+    b = MicroBatcher(run, max_size=4, window_ms=0, max_inflight=1)
+    # Occupy the single slot, then queue deferred BEFORE realtime: realtime must still go next.
+    first = asyncio.ensure_future(b.submit("busy", "realtime", 0))
+    await asyncio.sleep(0.005)
+    deferred = asyncio.ensure_future(b.submit("d", "deferred", 1))
+    await asyncio.sleep(0)
+    realtime = asyncio.ensure_future(b.submit("r", "realtime", 2))
+    await asyncio.gather(first, deferred, realtime)
+    assert [k for k, _ in calls] == ["busy", "r", "d"]
+
+
+async def test_deferred_never_takes_the_reserved_slots():
+    calls, run = _recorder(delay=0.02)
+    b = MicroBatcher(run, max_size=1, window_ms=0, max_inflight=2, realtime_reserved_slots=1)
+    tasks = [asyncio.ensure_future(b.submit(f"d{i}", "deferred", i)) for i in range(2)]
+    await asyncio.sleep(0.005)
+    assert b.stats()["inflight"] == {"realtime": 0, "deferred": 1}
+    await asyncio.gather(*tasks)
+    assert len(calls) == 2
+
+
+async def test_batch_failure_reaches_every_waiter_and_per_item_errors_stay_local():
+    async def boom(key, payloads):
+        raise RuntimeError("gpu fell over")
+
+    b = MicroBatcher(boom, max_size=4, window_ms=5)
+    outcomes = await asyncio.gather(b.submit("k", "realtime", 1), b.submit("k", "realtime", 2), return_exceptions=True)
+    assert all(isinstance(o, RuntimeError) for o in outcomes)
+
+    async def partial(key, payloads):
+        return [ValueError("bad clip") if p == 2 else p for p in payloads]
+
+    b2 = MicroBatcher(partial, max_size=4, window_ms=5)
+    outcomes = await asyncio.gather(b2.submit("k", "realtime", 1), b2.submit("k", "realtime", 2), return_exceptions=True)
+    assert outcomes[0] == 1 and isinstance(outcomes[1], ValueError)
+
+
+def test_histogram_is_cumulative():
+    h = Histogram((1, 5, 10))
+    for v in (0.5, 3, 7, 50):
+        h.observe(v)
+    snap = h.snapshot()
+    assert snap["buckets"] == {"1": 1, "5": 2, "10": 3} and snap["count"] == 4 and snap["sum"] == 60.5
+
+
+def test_pack_clips_merges_short_spans_and_splits_long_ones():
+    import transcription.main as svc
+
+    spans = [{"start": 0, "end": 100}, {"start": 150, "end": 250}, {"start": 300, "end": 1000}]
+    assert svc._pack_clips(spans, 400) == [
+        {"start": 0, "end": 250}, {"start": 300, "end": 700}, {"start": 700, "end": 1000},
+    ]
+
+
+def test_split_batch_segments_restores_each_request_timeline():
+    import transcription.main as svc
+
+    sr = svc.SAMPLE_RATE
+    seg = lambda start, end, text: SimpleNamespace(  # noqa: E731
+        start=start, end=end, text=text, avg_logprob=-0.1, compression_ratio=1.2, no_speech_prob=0.01,
+        words=[SimpleNamespace(word=text, start=start, end=end, probability=0.9)],
+    )
+    # Request 0 spans [0, 2s), request 1 spans [2s, 5s) of the concatenated batch audio.
+    out = svc._split_batch_segments([seg(0.2, 1.5, "a"), seg(2.0, 2.8, "b"), seg(3.1, 4.9, "c")], [0, 2 * sr])
+    assert [s.text for s in out[0]] == ["a"] and [s.text for s in out[1]] == ["b", "c"]
+    assert abs(out[1][0].start) < 1e-9 and abs(out[1][1].end - 2.9) < 1e-9
+    assert abs(out[1][1].words[0].start - 1.1) < 1e-9
+
+
+def test_batching_is_off_by_default_and_stats_say_so(client):
+    import transcription.main as svc
+
+    assert svc.batcher is None
+    assert svc._batch_key("whisper-1", "en", "transcribe", False, None, 0.0) is None
+    body = client.get("/stats").json()
+    assert body["batching"] is None and body["active"] == {"realtime": 0, "deferred": 0}
+
+
+async def test_submit_reports_its_own_batch_wait():
+    _, run = _recorder()
+    b = MicroBatcher(run, max_size=8, window_ms=30)
+    timing = {"queue_ms": 5.0}
+    assert await b.submit("en", "realtime", 1, timing=timing) == "en:1"
+    assert 25.0 <= timing["queue_ms"] - 5.0 < 500.0  # added to what the caller already waited
+
+
+def test_request_timing_splits_queue_from_decode(monkeypatch):
+    import transcription.main as svc
+
+    fresh = {"queue": Histogram(svc.QUEUE_WAIT_MS_BUCKETS), "decode": Histogram(svc.DECODE_MS_BUCKETS)}
+    monkeypatch.setattr(svc, "request_latency_ms", fresh)
+    t = svc._request_timing(arrived=10.0, admitted=10.2, batch_wait_ms=30.0, now=10.7)
+    assert t == {"queue_ms": 230.0, "decode_ms": 470.0}
+    assert fresh["queue"].count == 1 and fresh["decode"].snapshot()["buckets"]["500"] == 1
@@ -0,0 +1,68 @@
+"""Upload decoding — in memory, never on disk.
+
+WAV/FLAC decode with soundfile straight from the request bytes; anything else is piped through
+ffmpeg (stdin → f32le stdout). ``subprocess.run`` is faked, so no ffmpeg binary is needed, and
+``tempfile`` is booby-trapped to pin that neither path writes a temp file.
+"""
+from __future__ import annotations
+
+import io
+import tempfile
+
+import numpy as np
+import pytest
+import soundfile as sf
+
+
+@pytest.fixture(autouse=True)
+def _no_temp_files(monkeypatch):
+    def boom(*a, **kw):
+        raise AssertionError("upload decoding must not touch disk")
+
+    monkeypatch.setattr(tempfile, "NamedTemporaryFile", boom)
+    monkeypatch.setattr(tempfile, "mkstemp", boom)
+
+
+def test_flac_decodes_in_memory_without_ffmpeg(monkeypatch):
+    import transcription.main as svc
+
+    monkeypatch.setattr(svc.subprocess, "run", lambda *a, **kw: pytest.fail("ffmpeg must not run for FLAC"))
+    pcm = (np.sin(np.arange(1600) / 8.0) * 0.5).astype(np.float32)
+    buf = io.BytesIO()
+    sf.write(buf, pcm, 16000, format="FLAC", subtype="PCM_16")
+    audio, sr = svc._decode_audio(buf.getvalue())
+    assert sr == 16000 and audio.shape == (1600,) and np.max(np.abs(audio - pcm)) < 1e-3
+
+
+def test_other_formats_pipe_through_ffmpeg(monkeypatch):
+    import transcription.main as svc
+
+    seen = {}
+    pcm = np.linspace(-0.5, 0.5, 320, dtype=np.float32)
+
+    def fake_run(args, input=None, capture_output=False, timeout=None):
+        seen.update(args=args, input=input)
+        return type("R", (), {"returncode": 0, "stdout": pcm.tobytes(), "stderr": b""})()
+
+    monkeypatch.setattr(svc.subprocess, "run", fake_run)
+    audio, sr = svc._decode_audio(b"\x1aE\xdf\xa3 not-a-wav webm bytes")
+    assert seen["input"].startswith(b"\x1aE\xdf\xa3")
+    assert "pipe:0" in seen["args"] and seen["args"][-1] == "pipe:1"
+    assert sr == svc.SAMPLE_RATE and np.array_equal(audio, pcm)
+
+
+def test_missing_ffmpeg_is_a_400(client, monkeypatch):
+    import transcription.main as svc
+
+    def no_ffmpeg(*a, **kw):
+        raise FileNotFoundError("ffmpeg")
+
+    monkeypatch.setattr(svc, "API_TOKEN", "")
+    monkeypatch.setattr(svc, "model", object())
+    monkeypatch.setattr(svc.subprocess, "run", no_ffmpeg)
+    r = client.post(
+        "/v1/audio/transcriptions",
+        files={"file": ("a.webm", b"\x1aE\xdf\xa3 webm", "audio/webm")},
+        data={"model": "large-v3-turbo"},
+    )
+    assert r.status_code == 400 and "Install ffmpeg" in r.json()["detail"]
@@ -0,0 +1,111 @@
+"""Segment-level temperature fallback — only the failing spans are re-decoded.
+
+Model-free: ``svc.model`` is swapped for a fake whose ``transcribe`` records each call, so the
+real handler runs end to end. The first pass returns one low-confidence segment between two good
+ones; ``TEMPERATURE_FALLBACK_MODE=segments`` must re-decode just that span (clip_timestamps, no
+VAD) and splice the result back, with the per-request counters on the response.
+"""
+from __future__ import annotations
+
+import io
+from types import SimpleNamespace
+
+import numpy as np
+import soundfile as sf
+
+
+def _seg(start, end, text, logprob=-0.2):
+    return SimpleNamespace(
+        start=start, end=end, text=text, avg_logprob=logprob, compression_ratio=1.1, no_speech_prob=0.01, words=None,
+    )
+
+
+class _FakeModel:
+    def __init__(self, retry):
+        self.calls = []
+        self._retry = retry
+
+    def transcribe(self, audio, **kw):
+        self.calls.append(kw)
+        info = SimpleNamespace(language="en", language_probability=0.99)
+        if "clip_timestamps" not in kw:
+            return iter([_seg(0.0, 2.0, " hello there"), _seg(2.0, 4.0, " la la la", -2.5), _seg(4.0, 6.0, " goodbye")]), info
+        return iter(self._retry(kw)), info
+
+
+def _wav(seconds=6.0):
+    buf = io.BytesIO()
+    sf.write(buf, np.zeros(int(16000 * seconds), dtype=np.float32), 16000, format="WAV", subtype="PCM_16")
+    return buf.getvalue()
+
+
+def _post(client):
+    return client.post(
+        "/v1/audio/transcriptions",
+        files={"file": ("a.wav", _wav(), "audio/wav")},
+        data={"model": "large-v3-turbo", "language": "en"},
+    )
+
+
+def _segments_mode(monkeypatch, svc, retry):
+    fake = _FakeModel(retry)
+    monkeypatch.setattr(svc, "API_TOKEN", "")
+    monkeypatch.setattr(svc, "model", fake)
+    monkeypatch.setattr(svc, "USE_TEMPERATURE_FALLBACK", True)
+    monkeypatch.setattr(svc, "TEMPERATURE_FALLBACK_MODE", "segments")
+    return fake
+
+
+def test_only_the_failing_span_is_redecoded(client, monkeypatch):
+    import transcription.main as svc
+
+    fake = _segments_mode(monkeypatch, svc, lambda kw: [_seg(2.1, 3.9, " we agreed")])
+    body = _post(client).json()
+    assert body["text"] == "hello there we agreed goodbye"
+    assert [s["id"] for s in body["segments"]] == [0, 1, 2]
+    assert len(fake.calls) == 2
+    retry = fake.calls[1]
+    # Padded span clamped to the kept neighbours; no VAD (the first pass already ran it).
+    assert retry["clip_timestamps"] == [2.0, 4.0] and retry["vad_filter"] is False
+    assert retry["temperature"] == svc.TEMPERATURE_FALLBACK_CHAIN[1]
+    assert body["fallback"] == {
+        "mode": "segments", "passes": 1, "segments_retried": 1, "segments_recovered": 1, "retried_audio_s": 2.0,
+    }
+
+
+def test_a_span_that_never_passes_keeps_its_first_pass(client, monkeypatch):
+    import transcription.main as svc
+
+    fake = _segments_mode(monkeypatch, svc, lambda kw: [_seg(2.1, 3.9, " still noise", -3.0)])
+    body = _post(client).json()
+    assert body["text"] == "hello there la la la goodbye"
+    passes = len(svc.TEMPERATURE_FALLBACK_CHAIN) - 1
+    assert len(fake.calls) == 1 + passes
+    assert body["fallback"]["passes"] == passes and body["fallback"]["segments_recovered"] == 0
+    assert client.get("/stats").json()["fallback"]["passes"] >= passes
+
+
+def test_full_mode_counts_whole_clip_redecodes(client, monkeypatch):
+    import transcription.main as svc
+
+    fake = _segments_mode(monkeypatch, svc, lambda kw: [])
+    monkeypatch.setattr(svc, "TEMPERATURE_FALLBACK_MODE", "full")
+    body = _post(client).json()
+    passes = len(svc.TEMPERATURE_FALLBACK_CHAIN) - 1
+    assert all("clip_timestamps" not in kw for kw in fake.calls) and len(fake.calls) == 1 + passes
+    assert body["fallback"]["passes"] == passes and body["fallback"]["retried_audio_s"] == 6.0 * passes
+
+
+def test_retry_spans_merge_runs_and_respect_neighbours():
+    import transcription.main as svc
+
+    good = {"compression_ratio": 1.0, "avg_logprob": -0.1}
+    bad = {"compression_ratio": 3.0, "avg_logprob": -0.1}
+    segs = [
+        {**good, "start": 0.0, "end": 1.0}, {**bad, "start": 1.5, "end": 2.0},
+        {**bad, "start": 2.0, "end": 3.0}, {**good, "start": 3.1, "end": 4.0}, {**bad, "start": 5.0, "end": 5.5},
+    ]
+    spans = svc._retry_spans(segs, audio_s=5.6, pad_s=0.2)
+    assert [(sp.start, sp.end, sp.first, sp.last) for sp in spans] == [(1.3, 3.1, 1, 2), (4.8, 5.6, 4, 4)]
+    buckets = svc._assign_to_spans([{"start": 1.4, "end": 2.9}, {"start": 3.2, "end": 3.8}, {"start": 5.0, "end": 5.4}], spans)
+    assert [len(b) for b in buckets] == [1, 1]
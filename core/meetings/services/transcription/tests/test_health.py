@@ -24,3 +24,9 @@ def test_root_reports_service_info(client):
     assert body["service"] == "Vexa Transcription Service"
     assert body["endpoints"]["transcribe"] == "/v1/audio/transcriptions"
     assert body["endpoints"]["health"] == "/health"
+
+
+def test_health_and_root_advertise_upload_codecs(client, loaded):
+    # The whisper client's FLAC body is decoded in memory; both info routes name what is accepted.
+    assert client.get("/health").json()["upload_codecs"] == ["wav", "flac"]
+    assert client.get("/").json()["upload_codecs"] == ["wav", "flac"]
@@ -0,0 +1,159 @@
+"""Model residency contract — preconverted artifacts, the LRU under a byte budget, leases that pin
+a model through its pass, single-flight loads, and the request's ``model`` field routing. Model-free:
+``load`` / ``cost`` are fakes and the routed models are recording stand-ins for WhisperModel.
+"""
+from __future__ import annotations
+
+import io
+import threading
+import time
+from types import SimpleNamespace
+
+import numpy as np
+import pytest
+import soundfile as sf
+
+from transcription.models import ModelUnavailable, ResidentModels, artifact_dir, first_artifact, prefetch
+
+
+def _cache(budget=0, sizes=None, delay=0.0):
+    loads = []
+
+    def load(name):
+        loads.append(name)
+        if delay:
+            time.sleep(delay)
+        return f"model:{name}"
+
+    return loads, ResidentModels(load, lambda name: (sizes or {}).get(name, 10), budget_bytes=budget)
+
+
+def test_artifact_dir_needs_the_weights_and_prefetch_reports_their_size(tmp_path):
+    assert artifact_dir(str(tmp_path), "small") is None
+    (tmp_path / "small").mkdir()
+    assert artifact_dir(str(tmp_path), "small") is None
+    (tmp_path / "small" / "model.bin").write_bytes(b"\0" * 4096)
+    path = artifact_dir(str(tmp_path), "small")
+    assert path == str(tmp_path / "small")
+    assert prefetch(path) == 4096
+
+
+def test_a_baked_artifact_wins_over_a_stale_copy_in_the_cache_volume(tmp_path):
+    baked, cache = tmp_path / "opt", tmp_path / "app"
+    (cache / "small").mkdir(parents=True)
+    (cache / "small" / "model.bin").write_bytes(b"old")
+    assert first_artifact([str(baked), str(cache)], "small") == str(cache / "small")  # nothing baked
+
+    (baked / "small").mkdir(parents=True)
+    (baked / "small" / "model.bin").write_bytes(b"new")
+    assert first_artifact([str(baked), str(cache)], "small") == str(baked / "small")
+    assert first_artifact([str(baked), str(cache)], "tiny") is None
+
+
+def test_hits_reuse_the_loaded_model():
+    loads, cache = _cache()
+    for _ in range(3):
+        with cache.lease("small") as m:
+            assert m == "model:small"
+    assert loads == ["small"]
+    assert cache.stats()["hits"] == 2 and cache.stats()["loads"] == 1
+
+
+def test_budget_evicts_the_least_recently_used_idle_model():
+    loads, cache = _cache(budget=25)
+    for name in ("a", "b", "a", "c"):
+        with cache.lease(name):
+            pass
+    # a was touched after b, so b is the coldest and goes to make room for c.
+    assert cache.resident() == ["a", "c"]
+    assert loads == ["a", "b", "c"] and cache.stats()["evictions"] == 1
+
+
+def test_a_leased_model_is_never_evicted_and_a_load_that_cannot_fit_is_refused():
+    _, cache = _cache(budget=15)
+    with cache.lease("a"):
+        with pytest.raises(ModelUnavailable):
+            with cache.lease("b"):
+                pass
+        assert cache.resident() == ["a"]
+    with cache.lease("b"):
+        pass
+    assert cache.resident() == ["b"] and cache.stats()["refused"] == 1
+
+
+def test_a_model_larger_than_the_budget_is_refused_without_evicting():
+    _, cache = _cache(budget=15, sizes={"large": 20})
+    with cache.lease("a"):
+        pass
+    with pytest.raises(ModelUnavailable):
+        with cache.lease("large"):
+            pass
+    assert cache.resident() == ["a"]
+
+
+def test_concurrent_cold_requests_share_one_load():
+    loads, cache = _cache(delay=0.05)
+    seen = []
+
+    def worker():
+        with cache.lease("medium") as m:
+            seen.append(m)
+
+    threads = [threading.Thread(target=worker) for _ in range(4)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    assert loads == ["medium"] and seen == ["model:medium"] * 4
+
+
+class _Recording:
+    def __init__(self, name):
+        self.name = name
+        self.calls = 0
+
+    def transcribe(self, audio, **kw):
+        self.calls += 1
+        seg = SimpleNamespace(start=0.0, end=1.0, text=f" from {self.name}", avg_logprob=-0.1,
+                              compression_ratio=1.1, no_speech_prob=0.01, words=None)
+        return iter([seg]), SimpleNamespace(language="en", language_probability=0.99)
+
+
+def _wav(seconds=1.0):
+    buf = io.BytesIO()
+    sf.write(buf, np.zeros(int(16000 * seconds), dtype=np.float32), 16000, format="WAV", subtype="PCM_16")
+    return buf.getvalue()
+
+
+def test_the_model_field_selects_a_served_model_and_anything_else_gets_the_default(client, monkeypatch):
+    import transcription.main as svc
+
+    default, small = _Recording("default"), _Recording("small")
+    monkeypatch.setattr(svc, "API_TOKEN", "")
+    monkeypatch.setattr(svc, "USE_TEMPERATURE_FALLBACK", False)
+    monkeypatch.setattr(svc, "model", default)
+    monkeypatch.setattr(svc, "SERVED_MODELS", ["small"])
+    monkeypatch.setattr(svc, "resident_models", ResidentModels(lambda n: svc._LoadedModel(small, None), lambda n: 1))
+
+    def post(name):
+        r = client.post("/v1/audio/transcriptions", files={"file": ("a.wav", _wav(), "audio/wav")}, data={"model": name})
+        assert r.status_code == 200, r.text
+        return r.json()["text"]
+
+    assert post("small") == "from small"
+    assert post("whisper-1") == "from default"
+    assert post(svc.MODEL_SIZE) == "from default"
+    assert (default.calls, small.calls) == (2, 1)
+    assert client.get("/health").json()["resident_models"] == [svc.MODEL_SIZE, "small"]
+    assert client.get("/stats").json()["models"]["loads"] == 1
+
+
+def test_a_model_that_cannot_be_made_resident_is_a_retryable_503(client, monkeypatch):
+    import transcription.main as svc
+
+    monkeypatch.setattr(svc, "API_TOKEN", "")
+    monkeypatch.setattr(svc, "model", _Recording("default"))
+    monkeypatch.setattr(svc, "SERVED_MODELS", ["large-v3"])
+    monkeypatch.setattr(svc, "resident_models", ResidentModels(lambda n: None, lambda n: 10, budget_bytes=5))
+    r = client.post("/v1/audio/transcriptions", files={"file": ("a.wav", _wav(), "audio/wav")}, data={"model": "large-v3"})
+    assert r.status_code == 503 and "Retry-After" in r.headers
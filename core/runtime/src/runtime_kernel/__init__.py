@@ -5,6 +5,7 @@ from .profiles import Runnable, Profile, ProfileRegistry, default_registry
 from .process_backend import ProcessBackend
 from .docker_backend import DockerBackend
 from .k8s_backend import K8sBackend
+from .k8s_watch_backend import K8sWatchBackend
 from .store import (
     WorkloadStore,
     WorkloadRecord,
@@ -14,6 +15,7 @@ from .store import (
 )
 from .clock import Clock, SystemClock, FakeClock
 from .enforcement import Enforcer
+from .warm_pool import WarmPool, RedisBinder
 from .scheduler import Scheduler, DispatchError
 from .callbacks import (
     CallbackQueue,
@@ -24,12 +26,13 @@ from .callbacks import (
 __all__ = [
     "Runtime", "QuotaExceeded", "StartFailed",
     "Runnable", "Profile", "ProfileRegistry", "default_registry",
-    "ProcessBackend", "DockerBackend", "K8sBackend",
+    "ProcessBackend", "DockerBackend", "K8sBackend", "K8sWatchBackend",
     "WorkloadSpec", "WorkloadStatus", "RuntimeEvent",
     "RuntimeState", "StopReason", "BackendKind",
     "WorkloadStore", "WorkloadRecord", "InMemoryStore", "RedisStore", "default_owner",
     "Clock", "SystemClock", "FakeClock",
     "Enforcer",
+    "WarmPool", "RedisBinder",
     "Scheduler", "DispatchError",
     "CallbackQueue", "InMemoryPendingStore", "RedisPendingStore",
 ]
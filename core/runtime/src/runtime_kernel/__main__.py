@@ -67,31 +67,105 @@ def _build_scheduler():
         socket_timeout=10, socket_connect_timeout=5, socket_keepalive=True,
         health_check_interval=30, retry_on_timeout=True,
     )
-    return Scheduler(client, dispatch=_http_dispatch)
+    # Claims of SCHED_BATCH_SIZE due jobs fan out over SCHED_CONCURRENCY dispatch threads — sized
+    # for the top-of-the-hour burst of calendar joins; replicas share the due set via the claim.
+    # Each claim is stamped with this replica's id (pod/container hostname) so a peer's orphan
+    # sweep leaves it alone while this replica heartbeats and the claim is inside its lease.
+    return Scheduler(
+        client, dispatch=_http_dispatch,
+        batch_size=int(os.getenv("SCHED_BATCH_SIZE", "200")),
+        concurrency=int(os.getenv("SCHED_CONCURRENCY", "16")),
+        replica_id=os.getenv("SCHED_REPLICA_ID") or os.getenv("HOSTNAME") or None,
+        lease_s=float(os.getenv("SCHED_CLAIM_LEASE_S", "900")),
+        heartbeat_ttl_s=float(os.getenv("SCHED_HEARTBEAT_TTL_S", "30")),
+    )
 
 
 def _start_ticker(scheduler) -> None:
     """Run the scheduler's tick() loop in a daemon thread (a real deployment loops tick on an
-    interval; the eval calls tick() explicitly under a FakeClock). Recovers orphans on startup."""
+    interval; the eval calls tick() explicitly under a FakeClock). Recovers orphans on startup and
+    every loop — a dead peer's claims are picked up once its heartbeat lapses, not only when some
+    replica restarts. The heartbeat runs on its own thread: a tick draining a large batch can
+    outlast the heartbeat TTL, and peers must not read that as this replica being gone."""
     interval = float(os.getenv("SCHED_TICK_SEC", "5"))
-    try:
-        recovered = scheduler.recover_orphans()
-        if recovered:
-            logger.info("scheduler recovered %d orphaned job(s)", recovered)
-    except Exception as e:  # noqa: BLE001 — never let startup recovery crash the boot
-        logger.warning("scheduler orphan recovery failed: %s", e)
+    beat_every = max(1.0, scheduler.heartbeat_ttl_s / 3)
+
+    def _beat() -> None:
+        while True:
+            try:
+                scheduler.heartbeat()
+            except Exception as e:  # noqa: BLE001 — a missed beat is retried next interval
+                logger.warning("scheduler heartbeat error: %s", e)
+            time.sleep(beat_every)
+
+    def _recover() -> None:
+        try:
+            recovered = scheduler.recover_orphans()
+            if recovered:
+                logger.info("scheduler recovered %d orphaned job(s)", recovered)
+        except Exception as e:  # noqa: BLE001 — never let recovery crash the boot or the loop
+            logger.warning("scheduler orphan recovery failed: %s", e)
 
     def _loop() -> None:
         while True:
+            _recover()
             try:
                 scheduler.tick()
             except Exception as e:  # noqa: BLE001 — a bad tick must not kill the loop
                 logger.warning("scheduler tick error: %s", e)
             time.sleep(interval)
 
+    try:
+        scheduler.heartbeat()  # before the first sweep, so peers never see this replica unbeaten
+    except Exception as e:  # noqa: BLE001
+        logger.warning("scheduler heartbeat error: %s", e)
+    threading.Thread(target=_beat, name="scheduler-heartbeat", daemon=True).start()
     threading.Thread(target=_loop, name="scheduler-tick", daemon=True).start()
 
 
+def _build_warm_pool(runtime):
+    """The warm pool when ``RUNTIME_WARM_POOL`` holds a targets map (``{profile: {variant: n}}``;
+    ``{}`` wires an empty pool the control plane sizes through ``PUT /warm-pool/targets``), or
+    None. Needs REDIS_URL: a claimed spec reaches its workload over a redis bind key."""
+    raw = os.getenv("RUNTIME_WARM_POOL", "").strip()
+    redis_url = os.getenv("REDIS_URL")
+    if not raw:
+        return None
+    if not redis_url:
+        logger.warning("RUNTIME_WARM_POOL is set but REDIS_URL is not — warm pool disabled")
+        return None
+    import redis as redis_lib
+
+    from .warm_pool import DEFAULT_MAX_TOTAL, RedisBinder, WarmPool, parse_targets
+
+    client = redis_lib.from_url(
+        redis_url, decode_responses=True,
+        socket_timeout=10, socket_connect_timeout=5, socket_keepalive=True,
+        health_check_interval=30, retry_on_timeout=True,
+    )
+    return WarmPool(
+        runtime, RedisBinder(client),
+        targets=parse_targets(raw),
+        max_total=int(os.getenv("RUNTIME_WARM_POOL_MAX", str(DEFAULT_MAX_TOTAL))),
+        bind_url=redis_url,
+    )
+
+
+def _start_warm_pool(pool) -> None:
+    """Top the pool up on an interval in a daemon thread (like the scheduler ticker)."""
+    interval = float(os.getenv("RUNTIME_WARM_POOL_INTERVAL_S", "10"))
+
+    def _loop() -> None:
+        while True:
+            try:
+                pool.reconcile()
+            except Exception as e:  # noqa: BLE001 — a bad tick must not kill the loop
+                logger.warning("warm pool reconcile error: %s", e)
+            time.sleep(interval)
+
+    threading.Thread(target=_loop, name="warm-pool", daemon=True).start()
+
+
 def _build_backend():
     """Select the spawn backend from ``RUNTIME_BACKEND`` (default ``docker``). compose/desktop run
     ``docker`` (host socket API); a k8s deployment runs ``k8s`` (spawns Pods via kubectl under the
@@ -100,9 +174,15 @@ def _build_backend():
     kind = os.getenv("RUNTIME_BACKEND", "docker").strip().lower()
     if kind == "k8s":
         from .k8s_backend import K8sBackend
-
-        # Namespace is injected via the downward API (POD_NAMESPACE); None ⇒ kubectl's current ns.
-        return K8sBackend(namespace=os.getenv("POD_NAMESPACE") or None)
+        from .k8s_watch_backend import K8sWatchBackend, watch_enabled
+
+        # Namespace is injected via the downward API (POD_NAMESPACE); None ⇒ kubectl's current ns
+        # (the watch backend: the ServiceAccount's namespace).
+        namespace = os.getenv("POD_NAMESPACE") or None
+        if watch_enabled():
+            # RUNTIME_K8S_WATCH: the REST API + a list/watch Pod cache instead of kubectl per call.
+            return K8sWatchBackend(namespace=namespace)
+        return K8sBackend(namespace=namespace)
     if kind == "process":
         from .process_backend import ProcessBackend
 
@@ -179,7 +259,11 @@ def build_production_app():
             )
     except Exception as e:  # noqa: BLE001 — adoption is a boot aid; it must never block the boot
         logger.warning("workload re-adoption failed: %s", e)
-    return create_app(runtime, scheduler=scheduler)
+    # Started AFTER adoption: its first reconcile reaps the previous process's unclaimable warm-*.
+    warm_pool = _build_warm_pool(runtime)
+    if warm_pool is not None:
+        _start_warm_pool(warm_pool)
+    return create_app(runtime, scheduler=scheduler, warm_pool=warm_pool)
 
 
 def main() -> None:
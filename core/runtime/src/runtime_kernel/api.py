@@ -4,6 +4,7 @@ RuntimeEvents to each workload's callbackUrl. A thin FastAPI surface over the ke
 
 O-RT-2 additions:
   • /health — 200 when the backend + store are reachable and the scheduler (if wired) is live; 503 otherwise.
+    The body carries the scheduler's `stats()` (claims, outcomes, schedule lag) additively.
   • durable callback delivery — events go through a CallbackQueue (enqueue + retry-until-ack), replacing
     the old fire-once POST. A receiver that 500s is retried on the next sweep until it acks."""
 from __future__ import annotations
@@ -19,6 +20,7 @@ from .kernel import QuotaExceeded, Runtime, StartFailed
 from .models import RuntimeEvent, StopReason, WorkloadSpec
 from .obs import TraceMiddleware, log_event
 from .scheduler import Scheduler
+from .warm_pool import WarmPool, parse_targets
 
 # A health probe returns True when its dependency is reachable. Probes must never raise.
 HealthCheck = Callable[[], bool]
@@ -28,6 +30,15 @@ class StopBody(BaseModel):
     reason: Optional[StopReason] = None
 
 
+class ClaimBody(BaseModel):
+    variant: str
+    spec: WorkloadSpec
+
+
+class TargetsBody(BaseModel):
+    targets: dict[str, dict[str, int]]
+
+
 def _queue_deliver(rt: Runtime, queue: CallbackQueue) -> Callable[[RuntimeEvent], None]:
     """Durable delivery: enqueue each event for the workload's callbackUrl. The queue posts
     immediately and keeps anything the receiver hasn't acked, so a later sweep() retries it."""
@@ -60,6 +71,7 @@ def create_app(
     callback_queue: Optional[CallbackQueue] = None,
     health_checks: Optional[dict[str, HealthCheck]] = None,
     scheduler: Optional[Scheduler] = None,
+    warm_pool: Optional[WarmPool] = None,
 ) -> FastAPI:
     rt = runtime or Runtime()
     queue = callback_queue or CallbackQueue()
@@ -78,6 +90,7 @@ def create_app(
     app.state.runtime = rt
     app.state.callback_queue = queue
     app.state.scheduler = scheduler
+    app.state.warm_pool = warm_pool
     # Reuse the control-plane caller's X-Trace-Id so workload-spawn logs (logevent.v1) join
     # the same trace as the meeting-api/agent-api request that asked for the workload.
     app.add_middleware(TraceMiddleware)
@@ -100,6 +113,10 @@ def create_app(
 
         body = {"status": "ok" if healthy else "degraded", "checks": results,
                 "capabilities": capability_health()}
+        if warm_pool is not None:
+            body["warm_pool"] = warm_pool.stats()        # additive, like `capabilities`
+        if scheduler is not None:
+            body["scheduler"] = scheduler.stats()        # claims, outcomes, schedule lag
         return JSONResponse(body, status_code=200 if healthy else 503)
 
     @app.post("/workloads", status_code=201)
@@ -194,6 +211,47 @@ def create_app(
             raise HTTPException(status_code=404, detail="unknown job")
         return cancelled
 
+    # ── warm pool — pre-started workloads claimed instead of spawned (RUNTIME_WARM_POOL) ──
+    def _require_warm_pool() -> WarmPool:
+        if warm_pool is None:
+            raise HTTPException(status_code=503, detail="warm pool not wired")
+        return warm_pool
+
+    @app.post("/warm-pool/claim", status_code=201)
+    def claim_warm(body: ClaimBody):
+        """Bind ``spec`` onto an idle warm workload of ``(spec.profile, variant)``. 404 when the slot
+        is empty — the caller falls back to ``POST /workloads`` with the same spec."""
+        pool = _require_warm_pool()
+        try:
+            status = pool.claim(body.spec, body.variant)
+        except QuotaExceeded as e:
+            raise HTTPException(status_code=429, detail=str(e))
+        except ValueError as e:
+            raise HTTPException(status_code=400, detail=str(e))
+        if status is None:
+            raise HTTPException(status_code=404, detail="no idle warm workload")
+        log_event(
+            "workload_claimed",
+            audience="system",
+            span="warm_pool.claim",
+            fields={"workload_id": body.spec.workloadId, "profile": body.spec.profile,
+                    "variant": body.variant},
+        )
+        return dump(status)
+
+    @app.get("/warm-pool")
+    def warm_pool_stats():
+        return _require_warm_pool().stats()
+
+    @app.put("/warm-pool/targets")
+    def set_warm_targets(body: TargetsBody):
+        pool = _require_warm_pool()
+        try:
+            pool.set_targets(parse_targets(body.targets))
+        except ValueError as e:
+            raise HTTPException(status_code=400, detail=str(e))
+        return pool.stats()
+
     return app
 
 
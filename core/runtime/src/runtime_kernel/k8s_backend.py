@@ -110,6 +110,25 @@ def pod_overrides(env: dict[str, str], *, container_name: str) -> Optional[dict]
     return {"spec": spec}
 
 
+def pod_exit_code(pod: dict) -> Optional[int]:
+    """A Pod object's exit code: None while Pending/Running (or an unknown phase), 0 on Succeeded,
+    the container's terminated exitCode on Failed (1 when none is recorded). Shared with the
+    watch backend, which reads the same object from its cache."""
+    status = pod.get("status", {})
+    phase = status.get("phase")
+    if phase in ("Pending", "Running"):
+        return None                                      # still scheduling / running
+    if phase == "Succeeded":
+        return 0
+    if phase == "Failed":
+        for cs in status.get("containerStatuses", []):
+            term = cs.get("state", {}).get("terminated")
+            if term and "exitCode" in term:
+                return int(term["exitCode"])
+        return 1
+    return None
+
+
 class K8sBackend:
     name = "k8s"
 
@@ -199,19 +218,7 @@ class K8sBackend:
         r = _kubectl("get", "pod", h._impl, "-o", "json", *self._ns_args(), check=False)  # type: ignore[attr-defined]
         if r.returncode != 0:
             return 0                                     # gone (deleted/never-found) → no longer running
-        status = json.loads(r.stdout).get("status", {})
-        phase = status.get("phase")
-        if phase in ("Pending", "Running"):
-            return None                                  # still scheduling / running
-        if phase == "Succeeded":
-            return 0
-        if phase == "Failed":
-            for cs in status.get("containerStatuses", []):
-                term = cs.get("state", {}).get("terminated")
-                if term and "exitCode" in term:
-                    return int(term["exitCode"])
-            return 1
-        return None
+        return pod_exit_code(json.loads(r.stdout))
 
     def terminate(self, h: WorkloadHandle) -> None:      # graceful: SIGTERM + grace, then SIGKILL
         _kubectl("delete", "pod", h._impl, f"--grace-period={_stop_grace_sec()}", "--wait=false",
@@ -0,0 +1,404 @@
+"""K8sWatchBackend — the k8s substrate over the Kubernetes REST API with a list+watch Pod cache,
+instead of a ``kubectl`` process per call (``RUNTIME_K8S_WATCH=true``; ``K8sBackend`` stays the
+default).
+
+``K8sBackend`` forks ``kubectl`` for every ``find`` / ``exit_code``, and the control plane's
+reconcile sweep asks about every live bot every tick — hundreds of processes per sweep at scale, and
+a pod death is only noticed when someone next asks. Here one daemon thread keeps an informer-style
+cache of the managed Pods (``runtime.managed=true``): a LIST for the baseline + ``resourceVersion``,
+then a WATCH stream from it (re-LIST on ``410 Gone`` or a dropped stream). With the cache synced:
+
+  * ``find`` / ``exit_code`` / ``list_workload_containers`` are in-memory lookups (no API call);
+  * ``start`` is one POST that returns as soon as the API server admits the Pod (scheduling and the
+    image pull happen in the background, as with ``kubectl run``). A Pod created but not yet seen
+    on the watch is remembered as *expected*, so it reads as still starting, not gone;
+  * a Pod turning terminal (Succeeded/Failed) or vanishing is PUSHED to the exit listener the
+    kernel registers (``set_exit_listener``), which reflects it to ``stopped`` and emits the
+    RuntimeEvent straight away instead of on the next poll.
+
+While the cache is not synced (boot, a dropped watch) every lookup falls back to a direct GET, so an
+answer is never served from a cache that might be stale.
+
+The Pod object is the one ``kubectl run`` would build (name, adoption labels, restart=Never, env,
+``--command``), with the same ``pod_overrides`` seams (workspace mounts, the runtime's own
+scheduling) folded in directly. The API transport (``KubeApi``) is injectable, so the eval drives the
+cache with a fake API — no cluster.
+"""
+from __future__ import annotations
+
+import json
+import logging
+import os
+import threading
+import time
+from typing import Any, Callable, Iterator, Optional
+
+from .backend import WorkloadHandle
+from .k8s_backend import (
+    MANAGED_LABEL,
+    WORKLOAD_ID_LABEL,
+    K8sBackend,
+    _runtime_scheduling_env,
+    _stop_grace_sec,
+    pod_exit_code,
+    pod_overrides,
+)
+from .profiles import Runnable
+
+logger = logging.getLogger("runtime_kernel.k8s_watch_backend")
+
+WATCH_ENV = "RUNTIME_K8S_WATCH"
+_SA_DIR = "/var/run/secrets/kubernetes.io/serviceaccount"
+# Server-side watch timeout: the stream is re-opened (from the last resourceVersion) at least this
+# often, so a silently half-open connection cannot freeze the cache for long.
+WATCH_TIMEOUT_S = 300
+# How long a boot-time lookup waits for the first LIST before falling back to a direct call.
+SYNC_WAIT_S = 10.0
+RESYNC_BACKOFF_S = 1.0
+_TERMINAL = ("Succeeded", "Failed")
+
+
+def watch_enabled(env: Optional[dict] = None) -> bool:
+    raw = (env if env is not None else os.environ).get(WATCH_ENV, "false")
+    return str(raw).strip().lower() in ("1", "true", "yes", "on")
+
+
+class WatchExpired(Exception):
+    """The API server no longer has the requested resourceVersion (410 Gone) — re-LIST."""
+
+
+class KubeApi:
+    """The handful of Pod calls the backend makes, over the in-cluster API server (ServiceAccount
+    token + CA; the chart's runtime Role already grants create/delete/get/list/watch on pods)."""
+
+    def __init__(self, namespace: str, host: Optional[str] = None, sa_dir: str = _SA_DIR) -> None:
+        import httpx
+
+        self.namespace = namespace
+        host = host or "https://{}:{}".format(
+            os.environ.get("KUBERNETES_SERVICE_HOST", "kubernetes.default.svc"),
+            os.environ.get("KUBERNETES_SERVICE_PORT", "443"),
+        )
+        ca = os.path.join(sa_dir, "ca.crt")
+        self._token_path = os.path.join(sa_dir, "token")
+        self._client = httpx.Client(
+            base_url=host, verify=ca if os.path.exists(ca) else True, timeout=httpx.Timeout(15.0),
+        )
+        # A watch holds its response open for up to WATCH_TIMEOUT_S; only the read timeout differs.
+        self._watch_timeout = httpx.Timeout(15.0, read=WATCH_TIMEOUT_S + 30.0)
+
+    def _headers(self) -> dict:
+        # Re-read per request: projected ServiceAccount tokens rotate under a long-lived process.
+        with open(self._token_path) as f:
+            return {"Authorization": f"Bearer {f.read().strip()}"}
+
+    def _pods(self, name: str = "") -> str:
+        return f"/api/v1/namespaces/{self.namespace}/pods" + (f"/{name}" if name else "")
+
+    def list_pods(self, selector: str) -> tuple[list[dict], str]:
+        r = self._client.get(self._pods(), params={"labelSelector": selector}, headers=self._headers())
+        r.raise_for_status()
+        body = r.json()
+        return body.get("items", []), body.get("metadata", {}).get("resourceVersion", "")
+
+    def watch_pods(self, selector: str, resource_version: str) -> Iterator[dict]:
+        params = {
+            "labelSelector": selector, "watch": "1", "resourceVersion": resource_version,
+            "allowWatchBookmarks": "true", "timeoutSeconds": str(WATCH_TIMEOUT_S),
+        }
+        with self._client.stream("GET", self._pods(), params=params, headers=self._headers(),
+                                 timeout=self._watch_timeout) as r:
+            if r.status_code == 410:
+                raise WatchExpired(resource_version)
+            r.raise_for_status()
+            for line in r.iter_lines():
+                if line.strip():
+                    yield json.loads(line)
+
+    def get_pod(self, name: str) -> Optional[dict]:
+        r = self._client.get(self._pods(name), headers=self._headers())
+        if r.status_code == 404:
+            return None
+        r.raise_for_status()
+        return r.json()
+
+    def create_pod(self, manifest: dict) -> dict:
+        r = self._client.post(self._pods(), json=manifest, headers=self._headers())
+        if r.status_code >= 300:
+            try:
+                reason = r.json().get("message") or r.text
+            except ValueError:
+                reason = r.text
+            raise RuntimeError(f"create pod {manifest['metadata']['name']} failed: {r.status_code} {reason}")
+        return r.json()
+
+    def delete_pod(self, name: str, grace_period: int) -> None:
+        body = {"kind": "DeleteOptions", "apiVersion": "v1",
+                "gracePeriodSeconds": grace_period, "propagationPolicy": "Background"}
+        r = self._client.request("DELETE", self._pods(name), json=body, headers=self._headers())
+        if r.status_code not in (200, 202, 404):
+            raise RuntimeError(f"delete pod {name} failed: {r.status_code} {r.text}")
+
+
+def _default_namespace() -> str:
+    ns = os.getenv("POD_NAMESPACE")
+    if ns:
+        return ns
+    try:
+        with open(os.path.join(_SA_DIR, "namespace")) as f:
+            return f.read().strip() or "default"
+    except OSError:
+        return "default"
+
+
+def pod_manifest(name: str, workload_id: str, runnable: Runnable, env: dict[str, str]) -> dict:
+    """The Pod ``kubectl run <name> --image --restart=Never --labels --env… [--overrides]
+    [--command -- cmd…]`` produces, built directly. ``pod_overrides`` is read from the SAME env the
+    kubectl backend passes it (workload env + the runtime's scheduling knobs); its volumeMounts land
+    on the container here rather than by a list-replacing merge."""
+    container: dict[str, Any] = {
+        "name": name,
+        "image": runnable.image,
+        "env": [{"name": k, "value": v} for k, v in env.items()],
+    }
+    if runnable.command:
+        container["command"] = list(runnable.command)
+    spec: dict[str, Any] = {"restartPolicy": "Never", "containers": [container]}
+    overrides = pod_overrides({**env, **_runtime_scheduling_env()}, container_name=name)
+    if overrides:
+        extra = dict(overrides["spec"])
+        for c in extra.pop("containers", []):
+            if c.get("volumeMounts"):
+                container["volumeMounts"] = c["volumeMounts"]
+        spec.update(extra)
+    return {
+        "apiVersion": "v1",
+        "kind": "Pod",
+        "metadata": {
+            "name": name,
+            "labels": {MANAGED_LABEL: "true", WORKLOAD_ID_LABEL: workload_id},
+        },
+        "spec": spec,
+    }
+
+
+class K8sWatchBackend(K8sBackend):
+    name = "k8s"
+
+    def __init__(
+        self,
+        name_prefix: str = "vexa-",
+        namespace: Optional[str] = None,
+        api: Optional[Any] = None,
+        sync_wait_s: float = SYNC_WAIT_S,
+    ) -> None:
+        super().__init__(name_prefix=name_prefix, namespace=namespace)
+        self._api = api                                  # built lazily: no connection at __init__
+        self._sync_wait_s = sync_wait_s
+        self._lock = threading.Lock()
+        self._pods: dict[str, dict] = {}                 # pod name → the latest observed object
+        # Created by us, not yet seen on the watch → monotonic time the POST was acknowledged
+        # (``inf`` while it is in flight). A re-LIST prunes the ones it should have seen.
+        self._expected: dict[str, float] = {}
+        self._synced = threading.Event()
+        self._thread: Optional[threading.Thread] = None
+        self._stopping = threading.Event()
+        self._exit_listener: Optional[Callable[[str], None]] = None
+
+    # ── the cache ────────────────────────────────────────────────────────────
+    def _client(self) -> Any:
+        if self._api is None:
+            self._api = KubeApi(self._ns or _default_namespace())
+        return self._api
+
+    def set_exit_listener(self, listener: Callable[[str], None]) -> None:
+        """Register ``listener(workload_id)``, called from the watch thread when a managed Pod turns
+        terminal or disappears. The kernel reflects + emits from it (``Runtime.get``)."""
+        self._exit_listener = listener
+        self._ensure_watch()
+
+    def _ensure_watch(self) -> None:
+        with self._lock:
+            if self._thread is not None:
+                return
+            self._thread = threading.Thread(target=self._run, name="k8s-pod-watch", daemon=True)
+        self._thread.start()
+
+    def close(self) -> None:
+        self._stopping.set()
+
+    def _run(self) -> None:
+        selector = f"{MANAGED_LABEL}=true"
+        while not self._stopping.is_set():
+            try:
+                listed_at = time.monotonic()
+                items, rv = self._client().list_pods(selector)
+                self._replace(items, listed_at)
+                while not self._stopping.is_set():
+                    for event in self._client().watch_pods(selector, rv):
+                        rv = self._apply(event) or rv
+                    # server-side timeout: resume from the last resourceVersion, no re-LIST
+            except WatchExpired:
+                logger.info("pod watch resourceVersion expired; re-listing")
+            except Exception as e:  # noqa: BLE001 — a dropped stream must never kill the cache thread
+                logger.warning("pod watch failed (%s); falling back to direct calls until re-synced", e)
+                self._synced.clear()
+                time.sleep(RESYNC_BACKOFF_S)
+
+    def _replace(self, items: list[dict], listed_at: float) -> None:
+        """Swap in a LIST taken at ``listed_at``. An expected Pod whose create was acknowledged
+        before the LIST started and is absent from it was created AND deleted while the watch was
+        down — drop it, or ``find`` would report it forever. One created since still awaits its
+        ADDED event on the resumed watch."""
+        fresh = {p.get("metadata", {}).get("name"): p for p in items}
+        fresh.pop(None, None)
+        with self._lock:
+            before, self._pods = self._pods, fresh
+            self._expected = {
+                n: at for n, at in self._expected.items() if n not in fresh and at > listed_at
+            }
+        self._synced.set()
+        # A re-LIST after a gap: anything that died (or vanished) meanwhile is still pushed.
+        for name, old in before.items():
+            self._maybe_push(old, fresh.get(name))
+
+    def _apply(self, event: dict) -> Optional[str]:
+        kind = event.get("type")
+        obj = event.get("object") or {}
+        rv = obj.get("metadata", {}).get("resourceVersion")
+        if kind == "ERROR":
+            if obj.get("code") == 410:
+                raise WatchExpired(rv or "")
+            raise RuntimeError(f"watch error: {obj.get('message') or obj}")
+        if kind == "BOOKMARK":
+            return rv
+        name = obj.get("metadata", {}).get("name")
+        if not name:
+            return rv
+        with self._lock:
+            old = self._pods.get(name)
+            self._expected.pop(name, None)
+            if kind == "DELETED":
+                self._pods.pop(name, None)
+                new = None
+            else:
+                self._pods[name] = new = obj
+        self._maybe_push(old, new)
+        return rv
+
+    def _maybe_push(self, old: Optional[dict], new: Optional[dict]) -> None:
+        """Push an exit when a Pod crosses into terminal / gone (once — a re-delivered terminal
+        MODIFIED after it was already terminal does not push again)."""
+        listener = self._exit_listener
+        if listener is None:
+            return
+        was_terminal = old is not None and old.get("status", {}).get("phase") in _TERMINAL
+        if new is None:
+            if old is None or was_terminal:
+                return
+            pod = old
+        else:
+            if new.get("status", {}).get("phase") not in _TERMINAL or was_terminal:
+                return
+            pod = new
+        wid = (pod.get("metadata", {}).get("labels") or {}).get(WORKLOAD_ID_LABEL)
+        if not wid:
+            return
+        try:
+            listener(wid)
+        except Exception as e:  # noqa: BLE001 — a listener failure must not tear down the watch
+            logger.warning("exit listener for %s failed: %s", wid, e)
+
+    def _cached(self) -> bool:
+        """True once the cache is authoritative (first LIST done, watch not dropped)."""
+        self._ensure_watch()
+        return self._synced.is_set()
+
+    def _lookup(self, name: str) -> tuple[bool, Optional[dict]]:
+        """``(exists, pod)`` — from the cache when synced, else one direct GET. An *expected* Pod
+        (created, not yet observed) exists with no object yet."""
+        if self._cached():
+            with self._lock:
+                pod = self._pods.get(name)
+                return (pod is not None or name in self._expected), pod
+        pod = self._client().get_pod(name)
+        return pod is not None, pod
+
+    # ── the Backend port ─────────────────────────────────────────────────────
+    def start(self, workload_id: str, runnable: Runnable, env: dict[str, str]) -> WorkloadHandle:
+        if not runnable.image:
+            raise ValueError("k8s backend requires an image")
+        name = self._pname(workload_id)
+        manifest = pod_manifest(name, workload_id, runnable, env)
+        self._ensure_watch()
+        with self._lock:
+            self._expected[name] = float("inf")
+        try:
+            self._client().create_pod(manifest)
+        except Exception:
+            with self._lock:
+                self._expected.pop(name, None)
+            raise
+        with self._lock:
+            if name in self._expected:                   # not already seen on the watch
+                self._expected[name] = time.monotonic()
+        return WorkloadHandle(id=workload_id, impl=name)
+
+    def find(self, workload_id: str) -> Optional[WorkloadHandle]:
+        name = self._pname(workload_id)
+        exists, _ = self._lookup(name)
+        return WorkloadHandle(id=workload_id, impl=name) if exists else None
+
+    def list_workload_containers(self) -> list[dict]:
+        """Boot re-adoption from the cache (waiting up to ``sync_wait_s`` for the first LIST), else
+        from one direct LIST. Never raises."""
+        try:
+            self._ensure_watch()
+            if self._synced.wait(self._sync_wait_s):
+                with self._lock:
+                    pods = list(self._pods.values())
+            else:
+                pods, _ = self._client().list_pods(f"{MANAGED_LABEL}=true")
+            out = []
+            for pod in pods:
+                meta = pod.get("metadata", {})
+                wid = (meta.get("labels") or {}).get(WORKLOAD_ID_LABEL)
+                if not wid:
+                    continue
+                code = pod_exit_code(pod)
+                phase = pod.get("status", {}).get("phase")
+                running = phase not in _TERMINAL
+                out.append({
+                    "workload_id": wid,
+                    "name": meta.get("name", self._pname(wid)),
+                    "running": running,
+                    "exit_code": None if running else (code if code is not None else 1),
+                })
+            return out
+        except Exception:  # noqa: BLE001 — discovery is a boot aid; it must never crash the boot
+            return []
+
+    def exit_code(self, h: WorkloadHandle) -> Optional[int]:
+        exists, pod = self._lookup(h._impl)              # type: ignore[attr-defined]
+        if not exists:
+            return 0                                     # gone (deleted/never-found) → no longer running
+        if pod is None:
+            return None                                  # created, not yet observed → starting
+        return pod_exit_code(pod)
+
+    def terminate(self, h: WorkloadHandle) -> None:      # graceful: SIGTERM + grace, then SIGKILL
+        self._delete(h, _stop_grace_sec())
+
+    def kill(self, h: WorkloadHandle) -> None:           # force: immediate SIGKILL + drop the object
+        self._delete(h, 0)
+
+    def cleanup(self, h: WorkloadHandle) -> None:
+        self._delete(h, 0)
+
+    def _delete(self, h: WorkloadHandle, grace: int) -> None:
+        # Like the kubectl backend's check=False deletes: a failure is logged, the kernel's own
+        # exit polling decides what happened.
+        try:
+            self._client().delete_pod(h._impl, grace)    # type: ignore[attr-defined]
+        except Exception as e:  # noqa: BLE001
+            logger.warning("delete pod %s failed: %s", h._impl, e)  # type: ignore[attr-defined]
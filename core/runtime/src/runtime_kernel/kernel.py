@@ -11,6 +11,7 @@ Quotas (O-RT-2): create() rejects the N+1th active workload for an owner via the
 count_for_owner."""
 from __future__ import annotations
 
+import threading
 import time
 from datetime import datetime, timezone
 from typing import Callable, Optional
@@ -56,6 +57,12 @@ def _now() -> str:
     return datetime.now(timezone.utc).isoformat()
 
 
+# Set on a spec that was bound onto a pre-warmed workload (``Runtime.rebind``): the workload id the
+# substrate still knows the container/pod by. ``_handle_for`` / ``adopt`` re-derive the handle through
+# it, so a restarted runtime still reaches a claimed warm bot.
+WARM_ORIGIN_ENV = "VEXA_WARM_WORKLOAD"
+
+
 class Runtime:
     def __init__(
         self,
@@ -80,6 +87,20 @@ class Runtime:
         self.owner_quota = owner_quota
         # Live, non-serializable backend handles. Empty on a fresh process (post-restart).
         self._handles: dict[str, WorkloadHandle] = {}
+        # Serializes get()'s exit reflection: a pushed exit (below) and a concurrent API read must
+        # not both see `running` and emit the stopped event twice.
+        self._reflect_lock = threading.Lock()
+        # A backend that OBSERVES its substrate (k8s_watch_backend) pushes exits instead of waiting
+        # to be polled: reflect them immediately, so the stopped RuntimeEvent goes out on the exit.
+        listen = getattr(self.backend, "set_exit_listener", None)
+        if listen is not None:
+            listen(self._on_backend_exit)
+
+    def _on_backend_exit(self, workload_id: str) -> None:
+        try:
+            self.get(workload_id)                       # reflects running → stopped + emits
+        except KeyError:
+            pass                                        # not ours (or already forgotten)
 
     def _emit(self, workload_id: str, state: RuntimeState, **kw) -> RuntimeEvent:
         ev = RuntimeEvent(workloadId=workload_id, state=state, at=_now(), **kw)
@@ -104,8 +125,10 @@ class Runtime:
         if h is None:
             finder = getattr(self.backend, "find", None)
             if finder is not None:
+                record = self.store.get(workload_id)
+                origin = record.spec.env.get(WARM_ORIGIN_ENV) if record is not None else None
                 try:
-                    h = finder(workload_id)
+                    h = finder(origin or workload_id)
                 except Exception:  # noqa: BLE001 — a failed lookup means "no handle", never a crash
                     h = None
                 if h is not None:
@@ -130,12 +153,19 @@ class Runtime:
             discovered = lister()
         except Exception:  # noqa: BLE001 — discovery failure must not block the boot
             return 0
+        # A claimed warm workload is labelled with its warm id but recorded under the claimed one.
+        try:
+            bound = {r.spec.env[WARM_ORIGIN_ENV]: r.spec.workloadId
+                     for r in self.store.list() if WARM_ORIGIN_ENV in r.spec.env}
+        except Exception:  # noqa: BLE001 — a store fault only costs the alias mapping
+            bound = {}
         adopted = 0
         for info in discovered:
             wid = info.get("workload_id")
             name = info.get("name")
             if not wid or not name:
                 continue
+            wid = bound.get(wid, wid)
             self._handles.setdefault(wid, WorkloadHandle(id=wid, impl=name))
             if self.store.get(wid) is not None:
                 continue                       # durable store kept the record — handle was the gap
@@ -215,6 +245,47 @@ class Runtime:
         self._emit(spec.workloadId, RuntimeState.running, ports={})
         return status
 
+    def admit(self, spec: WorkloadSpec) -> None:
+        """The admission gate ``rebind`` applies — an unknown profile is a ``ValueError``, an owner at
+        cap ``QuotaExceeded``. The warm pool runs it BEFORE it delivers ``spec.env`` to a warm
+        workload, so a refused claim never hands the caller's secrets to a running process."""
+        if self.profiles.get(spec.profile) is None:
+            raise ValueError(f"unknown profile: {spec.profile!r}")
+        if self.owner_quota is not None:
+            owner = self.owner_resolver(spec)
+            if self.store.count_for_owner(owner) >= self.owner_quota:
+                raise QuotaExceeded(owner, self.owner_quota)
+
+    def rebind(self, warm_id: str, spec: WorkloadSpec) -> WorkloadStatus:
+        """Hand the RUNNING workload ``warm_id`` over to ``spec`` — the warm-pool claim
+        (``warm_pool.WarmPool``). The record moves to ``spec.workloadId`` (spec, callbackUrl and
+        owner are the caller's from here on; ``startedAt`` restarts so lifetime limits count from
+        the claim), the live handle moves with it, and the claimed id's ``starting`` → ``running``
+        events go out exactly as a cold ``create`` would emit them. Delivering ``spec.env`` to the
+        process is the pool's binder, not the kernel's: the substrate cannot re-env a running
+        container.
+
+        Raises ``KeyError`` when ``warm_id`` is gone or no longer running, ``ValueError`` on a
+        profile mismatch, ``QuotaExceeded`` like ``create``."""
+        self.admit(spec)
+        with self._reflect_lock:
+            record = self.store.get(warm_id)
+            if record is None or record.status.state != RuntimeState.running:
+                raise KeyError(warm_id)
+            if record.spec.profile != spec.profile:
+                raise ValueError(f"warm workload {warm_id!r} runs {record.spec.profile!r}, not {spec.profile!r}")
+            bound = spec.model_copy(update={"env": {**spec.env, WARM_ORIGIN_ENV: warm_id}})
+            status = record.status.model_copy(
+                update={"workloadId": spec.workloadId, "startedAt": _now(), "ports": {}})
+            self._persist(bound, status)
+            handle = self._handles.pop(warm_id, None)
+            if handle is not None:
+                self._handles[spec.workloadId] = handle
+            self.store.delete(warm_id)
+        self._emit(spec.workloadId, RuntimeState.starting)
+        self._emit(spec.workloadId, RuntimeState.running, ports={})
+        return status
+
     def get(self, workload_id: str) -> WorkloadStatus:
         record = self._record(workload_id)
         status = record.status
@@ -229,11 +300,15 @@ class Runtime:
         if status.state == RuntimeState.running and handle is not None:
             code = self.backend.exit_code(handle)
             if code is not None:
-                status.state = RuntimeState.stopped
-                status.exitCode = code
-                status.stoppedAt = _now()
-                status.stopReason = StopReason.completed if code == 0 else StopReason.failed
-                self._persist(record.spec, status)
+                with self._reflect_lock:
+                    current = self.store.get(workload_id)
+                    if current is not None and current.status.state != RuntimeState.running:
+                        return current.status             # a concurrent reflect/stop got there first
+                    status.state = RuntimeState.stopped
+                    status.exitCode = code
+                    status.stoppedAt = _now()
+                    status.stopReason = StopReason.completed if code == 0 else StopReason.failed
+                    self._persist(record.spec, status)
                 self._emit(workload_id, RuntimeState.stopped, exitCode=code, stopReason=status.stopReason)
         return status
 
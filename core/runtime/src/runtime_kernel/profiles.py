@@ -105,6 +105,13 @@ def default_registry() -> ProfileRegistry:
             "BOT_SPEAKER_CONFIRM_THRESHOLD",
             "BOT_SPEAKER_MAX_BUFFER_SEC",
             "BOT_SPEAKER_IDLE_TIMEOUT_SEC",
+            "BOT_SPEAKER_MAX_WINDOW_SEC",
+            "BOT_SPEAKER_CONTEXT_SEC",
+            "VEXA_SEG_WORKERS",
+            "VEXA_SEG_MAX_BATCH",
+            "VEXA_SEG_BATCH_MS",
+            "VEXA_STT_UPLOAD_CODEC",
+            "VEXA_CAPTURE_BATCH_MS",
         )
         if os.environ.get(key, "").strip()
     }
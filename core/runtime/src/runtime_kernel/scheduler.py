@@ -9,17 +9,35 @@ Faithful to the parent's real shape and behaviour:
     eval captures the request;
   • a failing dispatch retries with exponential backoff up to max_attempts, then marks the job failed;
   • a `cron`-tagged job re-arms itself (croniter) after a successful run;
-  • orphan recovery re-queues jobs that were mid-flight when the process died.
+  • orphan recovery re-queues jobs that were mid-flight when their replica died.
 
-`tick()` is the unit the parent's `_executor_loop` runs each poll: it pulls everything due (per the
-Clock) and processes it. A real deployment loops tick() on an interval; the eval calls it explicitly
-after advancing the FakeClock."""
+`tick()` is the unit the parent's `_executor_loop` runs each poll: it drains everything due (per the
+Clock) in bounded batches. Each batch is CLAIMED atomically — a Lua script pops up to `batch_size`
+due members and parks them in `scheduler:executing` in one server-side step — so several scheduler
+replicas ticking at once split the due set instead of racing for it. A server (or fake) without
+scripting falls back to a pipelined ZRANGEBYSCORE … LIMIT + per-member ZREM claim, which is still
+exactly-once per job (ZREM is the arbiter). A batch's dispatches fan out over at most `concurrency`
+threads; their bookkeeping writes go out as one pipeline per job. Schedule lag (claim time −
+execute_at) is kept for `stats()`, which the API serves on /health.
+
+Every claim records WHO took it and WHEN (`scheduler:claims`), and each replica heartbeats into
+`scheduler:replicas`. Orphan recovery re-queues an in-flight job only when its claim is past
+`lease_s`, when its replica's heartbeat is older than `heartbeat_ttl_s`, or — for this replica's own
+claims — when this process is no longer running it. A restarting replica therefore never re-fires
+a job another replica is still dispatching (a duplicate bot join).
+
+A real deployment loops tick() on an interval; the eval calls it explicitly after advancing the
+FakeClock."""
 from __future__ import annotations
 
 import json
 import logging
+import math
+import threading
+from collections import deque
+from concurrent.futures import ThreadPoolExecutor
 from datetime import datetime, timezone
-from typing import Any, Callable, Optional
+from typing import Any, Callable, Deque, Optional
 from uuid import uuid4
 
 from croniter import croniter
@@ -32,11 +50,51 @@ logger = logging.getLogger("runtime_kernel.scheduler")
 JOBS_KEY = "scheduler:jobs"            # sorted set: score=execute_at, member=job JSON
 EXECUTING_KEY = "scheduler:executing"  # hash: job_id -> job JSON (in-flight)
 HISTORY_KEY = "scheduler:history"      # hash: job_id -> job JSON (completed/failed/cancelled)
+CLAIMS_KEY = "scheduler:claims"        # hash: job_id -> {"claimed_by", "claimed_at"} of an EXECUTING job
+REPLICAS_KEY = "scheduler:replicas"    # hash: replica_id -> last heartbeat (Clock seconds)
 IDEMPOTENCY_PREFIX = "scheduler:idem:"
 HISTORY_TTL = 86400 * 7
 
 DEFAULT_RETRY = {"max_attempts": 3, "backoff": [30, 120, 300], "attempt": 0}
 
+DEFAULT_BATCH_SIZE = 200   # jobs claimed per round trip
+# A claim older than the lease is presumed lost even if its replica still heartbeats (a wedged
+# dispatch). It MUST exceed the longest a claimed job can legitimately take: a full batch waits
+# ceil(batch_size / concurrency) dispatch timeouts — 13 × 30s at the defaults.
+DEFAULT_CLAIM_LEASE_S = 900.0
+DEFAULT_HEARTBEAT_TTL_S = 30.0  # a replica silent this long is presumed dead
+_LAG_SAMPLES = 1024        # rolling window behind the lag percentiles
+
+# KEYS[1]=jobs KEYS[2]=executing KEYS[3]=claims ARGV[1]=now ARGV[2]=limit ARGV[3]=replica_id →
+# flat [member, score, …] of what THIS caller now owns. The member is parked in EXECUTING as-is
+# (still "pending" inside) so an orphan sweep finds it even if the process dies before its own
+# executing write lands; the claim record is built as a string so the member JSON is never
+# re-encoded by cjson.
+_CLAIM_LUA = """
+local due = redis.call('ZRANGEBYSCORE', KEYS[1], '-inf', ARGV[1], 'WITHSCORES', 'LIMIT', 0, tonumber(ARGV[2]))
+local claim = '{"claimed_by":' .. cjson.encode(ARGV[3]) .. ',"claimed_at":' .. ARGV[1] .. '}'
+for i = 1, #due, 2 do
+  local job_id = cjson.decode(due[i])['job_id']
+  redis.call('ZREM', KEYS[1], due[i])
+  redis.call('HSET', KEYS[2], job_id, due[i])
+  redis.call('HSET', KEYS[3], job_id, claim)
+end
+return due
+"""
+
+# KEYS[1]=executing KEYS[2]=claims KEYS[3]=jobs ARGV[1]=job_id ARGV[2]=pending member ARGV[3]=now
+# ARGV[4]=the claim the sweep judged ('' when it saw none) → 1 iff THIS call re-queued the job.
+# A job whose claim changed since the sweep's snapshot (completed, retried, or re-claimed by a
+# peer) is left alone, and of two sweeps racing on one orphan only the one whose HDEL lands
+# re-queues it, so a finished join is never fired again.
+_RECOVER_LUA = """
+if (redis.call('HGET', KEYS[2], ARGV[1]) or '') ~= ARGV[4] then return 0 end
+if redis.call('HDEL', KEYS[1], ARGV[1]) == 0 then return 0 end
+redis.call('HDEL', KEYS[2], ARGV[1])
+redis.call('ZADD', KEYS[3], ARGV[3], ARGV[2])
+return 1
+"""
+
 # A dispatch returns a result dict on success and raises on a retryable failure.
 Dispatch = Callable[[dict[str, Any]], dict[str, Any]]
 
@@ -49,16 +107,49 @@ def _s(v) -> str:
     return v.decode() if isinstance(v, (bytes, bytearray)) else v
 
 
+def _percentile(samples: Deque[float], q: float) -> Optional[float]:
+    if not samples:
+        return None
+    ordered = sorted(samples)
+    return round(ordered[max(0, math.ceil(q * len(ordered)) - 1)], 3)
+
+
+def _no_scripting(e: Exception) -> bool:
+    # fakeredis without its lua extra raises ImportError; a server with EVAL disabled (some managed
+    # redis offerings) answers "unknown command". Anything else is a real error and propagates.
+    return isinstance(e, ImportError) or "unknown command" in str(e).lower()
+
+
 class Scheduler:
     def __init__(
         self,
         redis,
         dispatch: Dispatch,
         clock: Optional[Clock] = None,
+        *,
+        batch_size: int = DEFAULT_BATCH_SIZE,
+        concurrency: int = 1,
+        replica_id: Optional[str] = None,
+        lease_s: float = DEFAULT_CLAIM_LEASE_S,
+        heartbeat_ttl_s: float = DEFAULT_HEARTBEAT_TTL_S,
     ) -> None:
         self._r = redis
         self._dispatch = dispatch
         self.clock: Clock = clock or SystemClock()
+        self.batch_size = max(1, int(batch_size))
+        self.concurrency = max(1, int(concurrency))
+        self.replica_id = replica_id or f"sched-{uuid4().hex[:12]}"
+        self.lease_s = float(lease_s)
+        self.heartbeat_ttl_s = float(heartbeat_ttl_s)
+        self._inflight: set[str] = set()       # job ids THIS process claimed and is still running
+        self._claim_script = redis.register_script(_CLAIM_LUA)
+        self._recover_script = redis.register_script(_RECOVER_LUA)
+        self._scripted = True
+        self._pool: Optional[ThreadPoolExecutor] = None
+        self._lock = threading.Lock()
+        self._lag_s: Deque[float] = deque(maxlen=_LAG_SAMPLES)
+        self._counts = {"ticks": 0, "claimed": 0, "completed": 0, "retried": 0, "failed": 0}
+        self._last_tick_lag_s: Optional[float] = None
 
     # ── job CRUD ─────────────────────────────────────────────────────────────
     def _make_job(self, spec: dict[str, Any]) -> dict[str, Any]:
@@ -140,27 +231,91 @@ class Scheduler:
         return results[:limit]
 
     # ── execution ────────────────────────────────────────────────────────────
+    def heartbeat(self) -> None:
+        """Mark this replica alive; peers leave its claims alone while the beat is fresh."""
+        self._r.hset(REPLICAS_KEY, self.replica_id, self.clock.now())
+
+    def _orphaned(self, job_id: str, claim: Optional[dict], beats: dict, now: float) -> bool:
+        if not claim:
+            return True                                # claimed before claims were recorded
+        if now - float(claim.get("claimed_at", now)) > self.lease_s:
+            return True                                # wedged, whoever holds it
+        owner = claim.get("claimed_by")
+        if owner == self.replica_id:
+            with self._lock:
+                return job_id not in self._inflight    # a previous incarnation's, or a failed write
+        beat = beats.get(owner)
+        return beat is None or now - float(_s(beat)) > self.heartbeat_ttl_s
+
     def recover_orphans(self) -> int:
-        """Re-queue jobs that were executing when the process died (run on startup)."""
-        executing = self._r.hgetall(EXECUTING_KEY)
+        """Re-queue executing jobs whose replica is gone (run on startup, then every loop): past
+        the claim lease, owned by a replica whose heartbeat expired, or this replica's own claim
+        that no dispatch of this process holds. A live peer's in-flight job is left alone.
+
+        The three hashes are read in one MULTI, so a job a peer finishes mid-read never shows up
+        as executing-without-a-claim; each re-queue is then conditional (`_requeue`) on the job
+        still being exactly what the snapshot judged."""
+        pipe = self._r.pipeline(transaction=True)
+        pipe.hgetall(EXECUTING_KEY)
+        pipe.hgetall(CLAIMS_KEY)
+        pipe.hgetall(REPLICAS_KEY)
+        executing, claims, replicas = pipe.execute()
+        if not executing:
+            return 0
+        claims = {_s(k): _s(v) for k, v in claims.items()}
+        beats = {_s(k): v for k, v in replicas.items()}
+        now = self.clock.now()
         recovered = 0
         for job_id, raw in executing.items():
+            job_id = _s(job_id)
+            try:
+                claim = json.loads(claims[job_id]) if job_id in claims else None
+            except ValueError:
+                claim = None
+            if not self._orphaned(job_id, claim, beats, now):
+                continue
             job = json.loads(_s(raw))
             job["status"] = "pending"
-            self._r.zadd(JOBS_KEY, {json.dumps(job): self.clock.now()})
-            self._r.hdel(EXECUTING_KEY, _s(job_id))
-            logger.warning("recovered orphaned job %s", _s(job_id))
+            if not self._requeue(job_id, json.dumps(job), now, claims.get(job_id, "")):
+                continue   # a peer finished, retried or recovered it since the snapshot
+            logger.warning("recovered orphaned job %s (claimed by %s)", job_id,
+                           (claim or {}).get("claimed_by", "unknown"))
             recovered += 1
         return recovered
 
-    def _reschedule_cron(self, job: dict[str, Any]) -> None:
+    def _requeue(self, job_id: str, member: str, now: float, seen_claim: str) -> bool:
+        """Move one orphan from EXECUTING back to JOBS iff its claim is still `seen_claim` and this
+        call's HDEL removed it. Without scripting the claim check and the HDEL are two steps, but
+        the HDEL still decides: only the caller that removed the entry re-queues it."""
+        if self._scripted:
+            try:
+                return bool(self._recover_script(
+                    keys=[EXECUTING_KEY, CLAIMS_KEY, JOBS_KEY], args=[job_id, member, now, seen_claim]))
+            except Exception as e:  # noqa: BLE001 — narrowed by _no_scripting, else re-raised
+                if not _no_scripting(e):
+                    raise
+                logger.info("redis scripting unavailable (%s); recovering with a checked HDEL", e)
+                self._scripted = False
+        if _s(self._r.hget(CLAIMS_KEY, job_id) or "") != seen_claim:
+            return False
+        if not self._r.hdel(EXECUTING_KEY, job_id):
+            return False
+        pipe = self._r.pipeline(transaction=False)
+        pipe.hdel(CLAIMS_KEY, job_id)
+        pipe.zadd(JOBS_KEY, {member: now})
+        pipe.execute()
+        return True
+
+    def _reschedule_cron(self, job: dict[str, Any], r=None) -> None:
+        """Re-arm a cron job for its next occurrence — written through `r` (the caller's pipeline)
+        when given. The re-armed job carries no idempotency_key, so it is a plain ZADD."""
         cron = job.get("cron")
         if not cron:
             return
         next_at = croniter(
             cron, datetime.fromtimestamp(self.clock.now(), tz=timezone.utc)
         ).get_next(float)
-        self.schedule(
+        nxt = self._make_job(
             {
                 "execute_at": next_at,
                 "request": job["request"],
@@ -168,13 +323,50 @@ class Scheduler:
                 "cron": cron,
             }
         )
+        (r or self._r).zadd(JOBS_KEY, {json.dumps(nxt): nxt["execute_at"]})
 
-    def _process(self, raw: str) -> None:
+    def _claim(self, now: float, limit: int) -> list[tuple[str, float]]:
+        """Atomically take up to `limit` jobs due by `now`. Returns (member, execute_at) pairs this
+        caller owns; a concurrent replica's claim never returns the same member."""
+        if self._scripted:
+            try:
+                flat = self._claim_script(
+                    keys=[JOBS_KEY, EXECUTING_KEY, CLAIMS_KEY], args=[now, limit, self.replica_id])
+                won = [(_s(flat[i]), float(flat[i + 1])) for i in range(0, len(flat), 2)]
+                self._hold(won)
+                return won
+            except Exception as e:  # noqa: BLE001 — narrowed by _no_scripting, else re-raised
+                if not _no_scripting(e):
+                    raise
+                logger.info("redis scripting unavailable (%s); claiming with pipelined ZREM", e)
+                self._scripted = False
+        due = self._r.zrangebyscore(JOBS_KEY, "-inf", now, start=0, num=limit, withscores=True)
+        if not due:
+            return []
+        pipe = self._r.pipeline(transaction=False)
+        for raw, _ in due:
+            pipe.zrem(JOBS_KEY, raw)
+        won = [(_s(raw), float(score)) for (raw, score), removed in zip(due, pipe.execute()) if removed]
+        if won:
+            self._hold(won)
+            claim = json.dumps({"claimed_by": self.replica_id, "claimed_at": now})
+            pipe = self._r.pipeline(transaction=False)
+            for raw, _ in won:
+                job_id = json.loads(raw)["job_id"]
+                pipe.hset(EXECUTING_KEY, job_id, raw)
+                pipe.hset(CLAIMS_KEY, job_id, claim)
+            pipe.execute()
+        return won
+
+    def _hold(self, won: list[tuple[str, float]]) -> None:
+        with self._lock:
+            self._inflight.update(json.loads(raw)["job_id"] for raw, _ in won)
+
+    def _process(self, raw: str) -> str:
+        """Run one CLAIMED job (already out of JOBS, parked in EXECUTING). Returns its outcome:
+        "completed" · "retried" · "failed"."""
         job = json.loads(raw)
         job_id = job["job_id"]
-        # Atomic claim — if another worker took it, skip.
-        if not self._r.zrem(JOBS_KEY, raw):
-            return
         job["status"] = "executing"
         self._r.hset(EXECUTING_KEY, job_id, json.dumps(job))
 
@@ -192,29 +384,89 @@ class Scheduler:
                 delay = backoff[min(attempt - 1, len(backoff) - 1)]
                 job["retry"]["attempt"] = attempt
                 job["status"] = "pending"
-                self._r.hdel(EXECUTING_KEY, job_id)
-                self._r.zadd(JOBS_KEY, {json.dumps(job): self.clock.now() + delay})
+                pipe = self._r.pipeline(transaction=False)
+                pipe.hdel(EXECUTING_KEY, job_id)
+                pipe.hdel(CLAIMS_KEY, job_id)
+                pipe.zadd(JOBS_KEY, {json.dumps(job): self.clock.now() + delay})
+                pipe.execute()
                 logger.warning(
                     "job %s attempt %d/%d failed (%s), retry in %ss",
                     job_id, attempt, max_attempts, e, delay,
                 )
-                return
+                return "retried"
             job["status"] = "failed"
             job["error"] = str(e)
             job["failed_at"] = self.clock.now()
             logger.error("job %s permanently failed after %d attempts: %s", job_id, max_attempts, e)
 
-        self._r.hdel(EXECUTING_KEY, job_id)
-        self._r.hset(HISTORY_KEY, job_id, json.dumps(job))
+        pipe = self._r.pipeline(transaction=False)
+        pipe.hdel(EXECUTING_KEY, job_id)
+        pipe.hdel(CLAIMS_KEY, job_id)
+        pipe.hset(HISTORY_KEY, job_id, json.dumps(job))
         if job["status"] == "completed":
-            self._reschedule_cron(job)
+            self._reschedule_cron(job, pipe)
+        pipe.execute()
+        return job["status"]
+
+    def _run(self, raw: str) -> str:
+        try:
+            return self._process(raw)
+        except Exception as e:  # noqa: BLE001 — a bookkeeping failure leaves the job in EXECUTING
+            logger.warning("job processing error (left for orphan recovery): %s", e)
+            return "error"
+        finally:
+            with self._lock:
+                self._inflight.discard(json.loads(raw)["job_id"])
+
+    def _fan_out(self, members: list[str]) -> list[str]:
+        if self.concurrency == 1 or len(members) == 1:
+            return [self._run(raw) for raw in members]
+        if self._pool is None:
+            self._pool = ThreadPoolExecutor(max_workers=self.concurrency, thread_name_prefix="scheduler-dispatch")
+        return list(self._pool.map(self._run, members))
 
     def tick(self) -> int:
-        """Fire every job due at the current Clock time. Returns the count processed."""
+        """Fire every job due at the current Clock time. Returns the count processed.
+
+        Drains in claims of `batch_size`; a short claim means the due set is empty (or the rest
+        went to another replica), which ends the tick."""
         now = self.clock.now()
-        due = self._r.zrangebyscore(JOBS_KEY, "-inf", now)
+        self.heartbeat()
         processed = 0
-        for raw in due:
-            self._process(_s(raw))
-            processed += 1
+        tick_lag: Optional[float] = None
+        while True:
+            claimed = self._claim(now, self.batch_size)
+            if not claimed:
+                break
+            lags = [max(0.0, now - score) for _, score in claimed]
+            tick_lag = max(tick_lag or 0.0, *lags)
+            outcomes = self._fan_out([raw for raw, _ in claimed])
+            processed += len(claimed)
+            with self._lock:
+                self._lag_s.extend(lags)
+                self._counts["claimed"] += len(claimed)
+                for outcome in outcomes:
+                    if outcome in self._counts:
+                        self._counts[outcome] += 1
+            if len(claimed) < self.batch_size:
+                break
+        with self._lock:
+            self._counts["ticks"] += 1
+            self._last_tick_lag_s = tick_lag
         return processed
+
+    def stats(self) -> dict:
+        """Counters + schedule lag (seconds a job sat due before it was claimed), for /health."""
+        with self._lock:
+            return {
+                **self._counts,
+                "batch_size": self.batch_size,
+                "concurrency": self.concurrency,
+                "replica_id": self.replica_id,
+                "inflight": len(self._inflight),
+                "claim": "lua" if self._scripted else "pipeline",
+                "lag_s_p50": _percentile(self._lag_s, 0.50),
+                "lag_s_p99": _percentile(self._lag_s, 0.99),
+                "lag_s_max": round(max(self._lag_s), 3) if self._lag_s else None,
+                "last_tick_lag_s": None if self._last_tick_lag_s is None else round(self._last_tick_lag_s, 3),
+            }
@@ -0,0 +1,305 @@
+"""Pre-warmed workloads — idle, already-started workloads a control-plane request CLAIMS instead of
+spawning cold (``RUNTIME_WARM_POOL``).
+
+A cold meeting-bot spawn pays the container/pod start, the Chromium launch and the capture-bundle
+injection before it can even navigate to the meeting — tens of seconds of join latency on every
+request. The pool keeps ``target`` workloads per slot started and idle; ``claim`` hands one over:
+
+  * a slot is ``(profile, variant)``. The profile stays opaque (P11) and so does the variant: a label
+    the CALLER chooses (meeting-api uses the platform, because the page hooks a pre-launched browser
+    installs are per platform). A warm workload boots with ``VEXA_WARM_POOL=1``, its slot's
+    ``VEXA_WARM_VARIANT``, a private ``VEXA_WARM_BIND_KEY`` and the redis to wait on it at
+    (``VEXA_WARM_REDIS_URL``);
+  * ``claim(spec, variant)`` pops an idle workload, delivers ``spec.env`` through the injected
+    ``bind`` (production: a redis list the workload BLPOPs — the substrate cannot re-env a running
+    container) and ``Runtime.rebind``s the record onto ``spec.workloadId``. From there the claimed
+    workload IS that spec: same callbacks, same stop/destroy, same re-adoption after a restart. An
+    empty slot returns ``None`` and the caller spawns cold — the pool only ever removes latency;
+  * ``reconcile`` (a background tick) tops each slot up to its target, retires surplus and dead
+    idle workloads, and reaps ``warm-*`` workloads nobody tracks (a previous runtime's pool).
+    ``set_targets`` resizes the pool at runtime — meeting-api drives it from the calendar lookahead.
+
+``stats`` (``GET /warm-pool`` and ``/health`` → ``warm_pool``) carries claims, hits, misses, the hit
+rate and the claim latency p50/p99; the latency is the kernel's share (pop + bind + rebind), the
+part a cold spawn's container start would otherwise occupy.
+"""
+from __future__ import annotations
+
+import json
+import logging
+import math
+import re
+import threading
+import time
+import uuid
+from collections import deque
+from typing import Callable, Deque, Optional
+
+from .kernel import QuotaExceeded, Runtime, StartFailed
+from .models import RuntimeState, StopReason, WorkloadSpec, WorkloadStatus
+
+logger = logging.getLogger("runtime_kernel.warm_pool")
+
+WARM_ENV = "VEXA_WARM_POOL"
+VARIANT_ENV = "VEXA_WARM_VARIANT"
+BIND_KEY_ENV = "VEXA_WARM_BIND_KEY"
+BIND_URL_ENV = "VEXA_WARM_REDIS_URL"
+BIND_KEY_PREFIX = "runtime:warm:bind:"
+WARM_ID_PREFIX = "warm-"
+
+DEFAULT_MAX_TOTAL = 16
+# An undelivered bind expires — a workload that died between the pop and its BLPOP must not leave
+# a spec (with its secrets) behind in redis.
+DEFAULT_BIND_TTL_S = 120
+_SAMPLES = 512
+
+Slot = tuple[str, str]
+# bind(key, payload_json) delivers a claimed spec to the warm workload waiting on ``key``.
+Binder = Callable[[str, str], None]
+
+
+def bind_key(warm_id: str) -> str:
+    return f"{BIND_KEY_PREFIX}{warm_id}"
+
+
+def parse_targets(raw: object) -> dict[Slot, int]:
+    """``{"meeting-bot": {"google_meet": 2, "teams": 1}}`` (a dict or its JSON) → ``{slot: n}``.
+    Raises ``ValueError`` on anything else — a malformed target must fail loud, not size to zero."""
+    if isinstance(raw, str):
+        raw = json.loads(raw) if raw.strip() else {}
+    if not isinstance(raw, dict):
+        raise ValueError("warm pool targets must be {profile: {variant: count}}")
+    targets: dict[Slot, int] = {}
+    for profile, variants in raw.items():
+        if not isinstance(variants, dict):
+            raise ValueError(f"warm pool targets for {profile!r} must be {{variant: count}}")
+        for variant, n in variants.items():
+            if isinstance(n, bool) or not isinstance(n, int) or n < 0:
+                raise ValueError(f"warm pool target {profile}/{variant} must be a count >= 0")
+            targets[(str(profile), str(variant))] = n
+    return targets
+
+
+def _dns_label(value: str) -> str:
+    # The id becomes a container/pod name: k8s wants DNS-1123 (lowercase alnum + '-').
+    return re.sub(r"[^a-z0-9-]+", "-", value.lower()).strip("-") or "x"
+
+
+def _percentile(samples: Deque[float], q: float) -> Optional[float]:
+    if not samples:
+        return None
+    ordered = sorted(samples)
+    return round(ordered[max(0, math.ceil(q * len(ordered)) - 1)], 1)
+
+
+class RedisBinder:
+    """``Binder`` over redis: RPUSH the payload onto the workload's bind key with a TTL."""
+
+    def __init__(self, redis, ttl_s: int = DEFAULT_BIND_TTL_S) -> None:
+        self._r = redis
+        self._ttl_s = ttl_s
+
+    def __call__(self, key: str, payload: str) -> None:
+        pipe = self._r.pipeline()
+        pipe.rpush(key, payload)
+        pipe.expire(key, self._ttl_s)
+        pipe.execute()
+
+
+class WarmPool:
+    def __init__(
+        self,
+        runtime: Runtime,
+        bind: Binder,
+        *,
+        targets: Optional[dict[Slot, int]] = None,
+        max_total: int = DEFAULT_MAX_TOTAL,
+        bind_url: Optional[str] = None,
+        clock: Optional[Callable[[], float]] = None,
+    ) -> None:
+        if max_total < 0:
+            raise ValueError("max_total must be >= 0")
+        self.runtime = runtime
+        self._bind = bind
+        self.max_total = max_total
+        self._bind_url = bind_url
+        self._clock = clock or time.monotonic
+        self._lock = threading.Lock()
+        self._targets: dict[Slot, int] = {}
+        self._idle: dict[Slot, Deque[str]] = {}
+        self._claiming: set[str] = set()
+        self._claims = self._hits = self._misses = 0
+        self._started = self._start_failures = self._retired = 0
+        self._claim_ms: Deque[float] = deque(maxlen=_SAMPLES)
+        self.set_targets(targets or {})
+
+    # ---- sizing ----
+    def set_targets(self, targets: dict[Slot, int]) -> dict[Slot, int]:
+        """Replace the per-slot targets, scaled down proportionally to fit ``max_total``. Takes
+        effect on the next ``reconcile``; returns what was applied."""
+        wanted = sum(targets.values())
+        if wanted > self.max_total:
+            # Largest remainder: the scaled targets sum to exactly max_total.
+            exact = {slot: n * self.max_total / wanted for slot, n in targets.items()}
+            targets = {slot: math.floor(x) for slot, x in exact.items()}
+            spare = self.max_total - sum(targets.values())
+            for slot in sorted(exact, key=lambda s: exact[s] - targets[s], reverse=True)[:spare]:
+                targets[slot] += 1
+        with self._lock:
+            self._targets = {slot: n for slot, n in targets.items() if n > 0}
+            for slot in self._targets:
+                self._idle.setdefault(slot, deque())
+            return dict(self._targets)
+
+    def _running(self, warm_id: str) -> bool:
+        try:
+            return self.runtime.get(warm_id).state is RuntimeState.running
+        except KeyError:
+            return False
+
+    def _retire(self, warm_id: str) -> bool:
+        """Stop + destroy a never-claimed workload and forget its record: nobody ever referenced
+        the id, so a destroyed ``warm-*`` record only grows the store."""
+        try:
+            self.runtime.stop(warm_id, StopReason.stopped)
+            self.runtime.destroy(warm_id)
+        except KeyError:
+            return False
+        except Exception as e:  # noqa: BLE001 — a stuck teardown is retried by the next tick
+            logger.warning("warm pool: retiring %s failed: %s", warm_id, e)
+            return False
+        self.runtime.store.delete(warm_id)
+        self._retired += 1
+        return True
+
+    def _start(self, slot: Slot) -> Optional[str]:
+        profile, variant = slot
+        warm_id = f"{WARM_ID_PREFIX}{_dns_label(profile)}-{_dns_label(variant)}-{uuid.uuid4().hex[:8]}"
+        env = {WARM_ENV: "1", VARIANT_ENV: variant, BIND_KEY_ENV: bind_key(warm_id)}
+        if self._bind_url:
+            env[BIND_URL_ENV] = self._bind_url
+        try:
+            self.runtime.create(WorkloadSpec(workloadId=warm_id, profile=profile, env=env))
+        except (StartFailed, QuotaExceeded, ValueError) as e:
+            self._start_failures += 1
+            logger.warning("warm pool: starting a %s/%s workload failed: %s", profile, variant, e)
+            return None
+        self._started += 1
+        return warm_id
+
+    def reconcile(self) -> dict[str, int]:
+        """One tick: drop dead idle workloads, retire surplus and untracked ``warm-*`` ones, then
+        start the deficit (within ``max_total``). Starts run outside the lock — claims never wait
+        on a container start. Returns ``{"started", "retired"}`` for this tick."""
+        started = 0
+        with self._lock:
+            idle = {slot: list(ids) for slot, ids in self._idle.items()}
+            targets = dict(self._targets)
+
+        kept: set[str] = set()
+        for slot, ids in idle.items():
+            alive = [wid for wid in ids if self._running(wid)]
+            kept.update(alive[: targets.get(slot, 0)])
+        with self._lock:
+            for slot, current in self._idle.items():
+                # Keep order; anything claimed meanwhile is no longer in `current`.
+                self._idle[slot] = deque(wid for wid in current if wid in kept)
+            tracked = kept | self._claiming
+        # Everything warm-* left over — surplus, dead idle, a previous runtime's pool — is retired.
+        surplus = [
+            r.spec.workloadId for r in self.runtime.store.list()
+            if r.spec.workloadId.startswith(WARM_ID_PREFIX) and r.spec.workloadId not in tracked
+        ]
+        retired = sum(1 for wid in surplus if self._retire(wid))
+
+        with self._lock:
+            total = sum(len(ids) for ids in self._idle.values()) + len(self._claiming)
+            deficits = [(slot, n - len(self._idle.get(slot, ()))) for slot, n in self._targets.items()]
+        for slot, deficit in deficits:
+            for _ in range(max(0, deficit)):
+                if total >= self.max_total:
+                    break
+                warm_id = self._start(slot)
+                if warm_id is None:
+                    break                              # don't hammer a failing image this tick
+                with self._lock:
+                    self._idle.setdefault(slot, deque()).append(warm_id)
+                total += 1
+                started += 1
+        return {"started": started, "retired": retired}
+
+    # ---- claiming ----
+    def claim(self, spec: WorkloadSpec, variant: str) -> Optional[WorkloadStatus]:
+        """Bind ``spec`` onto an idle warm workload of ``(spec.profile, variant)``, or ``None`` (the
+        slot is empty, or the bind could not be delivered) — the caller then spawns cold. A spec
+        whose workload is already live is a touch, like ``Runtime.create``.
+
+        Admission (profile + owner quota) is checked BEFORE the bind: the bind hands ``spec.env`` —
+        the bot config, secrets included — to a running process, which acts on it at once. A refusal
+        raises like ``create`` with nothing delivered. Should the gate close between the check and
+        the rebind (a concurrent create took the owner's last slot), the bound workload is stopped
+        rather than left running on the caller's credentials."""
+        try:
+            existing = self.runtime.get(spec.workloadId)
+        except KeyError:
+            existing = None
+        if existing is not None and existing.state in (RuntimeState.starting, RuntimeState.running):
+            return existing
+
+        self.runtime.admit(spec)
+        asked = self._clock()
+        slot = (spec.profile, variant)
+        payload = json.dumps({"workloadId": spec.workloadId, "env": spec.env})
+        with self._lock:
+            self._claims += 1
+        while True:
+            with self._lock:
+                ids = self._idle.get(slot)
+                if not ids:
+                    self._misses += 1
+                    return None
+                warm_id = ids.popleft()
+                self._claiming.add(warm_id)
+            try:
+                if not self._running(warm_id):
+                    continue                           # died while idle — the next one
+                try:
+                    self._bind(bind_key(warm_id), payload)
+                except Exception as e:  # noqa: BLE001 — an undeliverable bind is a miss, not an error
+                    logger.warning("warm pool: bind to %s failed: %s", warm_id, e)
+                    with self._lock:
+                        self._idle[slot].appendleft(warm_id)
+                        self._misses += 1
+                    return None
+                try:
+                    status = self.runtime.rebind(warm_id, spec)
+                except KeyError:
+                    continue                           # exited between the check and the rebind
+                except (QuotaExceeded, ValueError):
+                    self._retire(warm_id)          # bound but refused — never leave it running
+                    raise
+            finally:
+                with self._lock:
+                    self._claiming.discard(warm_id)
+            with self._lock:
+                self._hits += 1
+                self._claim_ms.append((self._clock() - asked) * 1000)
+            return status
+
+    def stats(self) -> dict:
+        with self._lock:
+            decided = self._hits + self._misses
+            return {
+                "targets": {f"{p}/{v}": n for (p, v), n in self._targets.items()},
+                "idle": {f"{p}/{v}": len(ids) for (p, v), ids in self._idle.items()},
+                "max_total": self.max_total,
+                "claims": self._claims,
+                "hits": self._hits,
+                "misses": self._misses,
+                "hit_rate": round(self._hits / decided, 4) if decided else None,
+                "claim_ms_p50": _percentile(self._claim_ms, 0.50),
+                "claim_ms_p99": _percentile(self._claim_ms, 0.99),
+                "started": self._started,
+                "start_failures": self._start_failures,
+                "retired": self._retired,
+            }
@@ -39,6 +39,19 @@ def test_k8s_backend_reads_pod_namespace(monkeypatch):
     assert backend._ns == "vexa-prod"
 
 
+def test_k8s_watch_flag_selects_the_watch_backend(monkeypatch):
+    from runtime_kernel.k8s_watch_backend import K8sWatchBackend
+
+    monkeypatch.setenv("RUNTIME_BACKEND", "k8s")
+    monkeypatch.setenv("POD_NAMESPACE", "vexa-prod")
+    monkeypatch.setenv("RUNTIME_K8S_WATCH", "true")
+    backend = _build_backend()
+    assert isinstance(backend, K8sWatchBackend) and backend._ns == "vexa-prod"
+    assert backend._thread is None                       # lazy: no API connection at construction
+    monkeypatch.setenv("RUNTIME_K8S_WATCH", "false")
+    assert type(_build_backend()) is K8sBackend
+
+
 def test_only_docker_backend_ensures_worker_image():
     # build_production_app() guards the AGENT_WORKER_IMAGE presence-ensure (pull-when-absent) on
     # hasattr(backend, "ensure_worker_image"): docker pre-pulls via the socket API (which never
@@ -0,0 +1,208 @@
+"""The watch-based k8s backend (``RUNTIME_K8S_WATCH``) against a fake API server — no cluster.
+
+  * once the first LIST lands, ``find`` / ``exit_code`` are cache lookups (no API call);
+  * a created-but-not-yet-watched Pod reads as starting, never as gone;
+  * a Pod turning Failed on the watch is PUSHED through the kernel: the record goes ``stopped`` with
+    the container's exit code and the RuntimeEvent is emitted without anyone polling;
+  * ``410 Gone`` re-LISTs, and a Pod that died during the gap is still pushed;
+  * a Pod we created that came and went while the watch was down is dropped by the re-LIST;
+  * the POSTed Pod carries what ``kubectl run`` + ``pod_overrides`` would have.
+"""
+from __future__ import annotations
+
+import queue
+import threading
+import time
+
+from runtime_kernel import Runtime
+from runtime_kernel.k8s_backend import MANAGED_LABEL, WORKLOAD_ID_LABEL
+from runtime_kernel.k8s_watch_backend import K8sWatchBackend, WatchExpired, pod_manifest
+from runtime_kernel.models import RuntimeState, StopReason, WorkloadSpec
+from runtime_kernel.profiles import Runnable
+
+
+def _pod(wid: str, phase: str = "Running", rv: str = "1", exit_code: int | None = None) -> dict:
+    status: dict = {"phase": phase}
+    if exit_code is not None:
+        status["containerStatuses"] = [{"state": {"terminated": {"exitCode": exit_code}}}]
+    return {
+        "metadata": {"name": f"vexa-{wid}", "resourceVersion": rv,
+                     "labels": {MANAGED_LABEL: "true", WORKLOAD_ID_LABEL: wid}},
+        "status": status,
+    }
+
+
+class FakeKubeApi:
+    """LIST returns ``pods``; each WATCH drains ``events`` (a ``_CLOSE`` ends the stream, an
+    exception instance is raised). Direct GETs are counted — a synced cache must make none."""
+
+    _CLOSE = object()
+
+    def __init__(self, pods=()):
+        self.pods = {p["metadata"]["name"]: p for p in pods}
+        self.events: "queue.Queue" = queue.Queue()
+        self.lists = 0
+        self.gets = 0
+        self.created: list[dict] = []
+        self.deleted: list[tuple[str, int]] = []
+
+    def list_pods(self, selector):
+        self.lists += 1
+        return list(self.pods.values()), str(self.lists)
+
+    def watch_pods(self, selector, rv):
+        while True:
+            ev = self.events.get()
+            if ev is self._CLOSE:
+                return
+            if isinstance(ev, Exception):
+                raise ev
+            yield ev
+
+    def get_pod(self, name):
+        self.gets += 1
+        return self.pods.get(name)
+
+    def create_pod(self, manifest):
+        self.created.append(manifest)
+        return manifest
+
+    def delete_pod(self, name, grace):
+        self.deleted.append((name, grace))
+
+
+def _wait(pred, timeout=2.0):
+    deadline = time.time() + timeout
+    while time.time() < deadline:
+        if pred():
+            return True
+        time.sleep(0.005)
+    return False
+
+
+def _backend(api):
+    b = K8sWatchBackend(api=api, sync_wait_s=2.0)
+    b._ensure_watch()
+    assert b._synced.wait(2.0)
+    return b
+
+
+def test_lookups_come_from_the_cache_once_synced():
+    api = FakeKubeApi([_pod("w1"), _pod("w2", phase="Succeeded")])
+    b = _backend(api)
+    assert b.find("w1") is not None and b.find("nope") is None
+    assert b.exit_code(b.find("w1")) is None
+    assert b.exit_code(b.find("w2")) == 0
+    listed = {d["workload_id"]: d for d in b.list_workload_containers()}
+    assert listed["w1"]["running"] and listed["w2"]["exit_code"] == 0
+    assert api.gets == 0                                  # no per-call API round trip
+    b.close()
+
+
+def test_created_pod_reads_as_starting_until_the_watch_sees_it():
+    api = FakeKubeApi()
+    b = _backend(api)
+    h = b.start("w3", Runnable(image="img", command=["run", "bot"]), {"A": "1"})
+    assert b.exit_code(h) is None and b.find("w3") is not None   # expected, not gone
+    api.events.put({"type": "ADDED", "object": _pod("w3", phase="Pending", rv="5")})
+    assert _wait(lambda: "vexa-w3" in b._pods)
+    api.events.put({"type": "DELETED", "object": _pod("w3", rv="6")})
+    assert _wait(lambda: b.exit_code(h) == 0)             # gone → no longer running
+    b.close()
+
+
+def test_pod_failure_is_pushed_through_the_kernel():
+    api = FakeKubeApi()
+    backend = K8sWatchBackend(api=api, sync_wait_s=2.0)
+    events = []
+    rt = Runtime(backend=backend, profiles={"bot": Runnable(image="img")}, on_event=events.append)
+    assert backend._synced.wait(2.0)
+    rt.create(WorkloadSpec(workloadId="w4", profile="bot", env={}))
+    api.events.put({"type": "ADDED", "object": _pod("w4", rv="2")})
+    api.events.put({"type": "MODIFIED", "object": _pod("w4", phase="Failed", rv="3", exit_code=137)})
+
+    assert _wait(lambda: rt.store.get("w4").status.state is RuntimeState.stopped)
+    status = rt.store.get("w4").status                    # read the store: no get() poll needed
+    assert status.exitCode == 137 and status.stopReason is StopReason.failed
+    stopped = [e for e in events if e.state is RuntimeState.stopped]
+    assert len(stopped) == 1 and stopped[0].exitCode == 137
+
+    # A re-delivered terminal MODIFIED (or a later read) does not emit a second stopped event.
+    api.events.put({"type": "MODIFIED", "object": _pod("w4", phase="Failed", rv="4", exit_code=137)})
+    api.events.put({"type": "BOOKMARK", "object": {"metadata": {"resourceVersion": "9"}}})
+    time.sleep(0.05)
+    rt.get("w4")
+    assert len([e for e in events if e.state is RuntimeState.stopped]) == 1
+    backend.close()
+
+
+def test_gone_relists_and_pushes_what_died_in_the_gap():
+    api = FakeKubeApi([_pod("w5")])
+    b = _backend(api)
+    pushed = []
+    b.set_exit_listener(pushed.append)
+    api.pods["vexa-w5"] = _pod("w5", phase="Failed", exit_code=2)   # dies while the watch is down
+    api.events.put(WatchExpired("1"))
+    assert _wait(lambda: api.lists == 2 and pushed == ["w5"])
+    assert b.exit_code(b.find("w5")) == 2
+    b.close()
+
+
+def test_relist_drops_an_expected_pod_created_and_deleted_during_the_gap():
+    api = FakeKubeApi()
+    b = _backend(api)
+    h = b.start("w6", Runnable(image="img"), {})
+    assert b.find("w6") is not None                      # expected: created, not yet watched
+    # The watch drops; the Pod is created and deleted server-side before the stream resumes, so
+    # neither its ADDED nor its DELETED is ever delivered and the re-LIST does not carry it.
+    api.events.put(WatchExpired("1"))
+    assert _wait(lambda: api.lists == 2 and b._synced.is_set())
+    assert b.find("w6") is None and b.exit_code(h) == 0   # gone, not "starting" forever
+    assert api.gets == 0
+    b.close()
+
+
+def test_manifest_matches_kubectl_run():
+    m = pod_manifest("vexa-w6", "w6", Runnable(image="img:1", command=["node", "bot.js"]),
+                     {"VEXA_X": "y"})
+    assert m["metadata"]["labels"] == {MANAGED_LABEL: "true", WORKLOAD_ID_LABEL: "w6"}
+    c = m["spec"]["containers"][0]
+    assert m["spec"]["restartPolicy"] == "Never"
+    assert c["name"] == "vexa-w6" and c["image"] == "img:1" and c["command"] == ["node", "bot.js"]
+    assert c["env"] == [{"name": "VEXA_X", "value": "y"}]
+
+
+def test_manifest_carries_the_runtime_scheduling(monkeypatch):
+    monkeypatch.setenv("RUNTIME_K8S_TOLERATIONS", '[{"key": "pool", "operator": "Exists"}]')
+    monkeypatch.setenv("RUNTIME_K8S_NODE_SELECTOR", '{"pool": "bots"}')
+    m = pod_manifest("vexa-w7", "w7", Runnable(image="img"), {})
+    assert m["spec"]["tolerations"] == [{"key": "pool", "operator": "Exists"}]
+    assert m["spec"]["nodeSelector"] == {"pool": "bots"}
+    assert m["spec"]["containers"][0]["image"] == "img"    # the container is never replaced
+
+
+def test_terminate_and_kill_delete_with_grace(monkeypatch):
+    monkeypatch.setenv("RUNTIME_STOP_GRACE_SEC", "12")
+    api = FakeKubeApi([_pod("w8")])
+    b = _backend(api)
+    h = b.find("w8")
+    b.terminate(h)
+    b.kill(h)
+    assert api.deleted == [("vexa-w8", 12), ("vexa-w8", 0)]
+    b.close()
+
+
+def test_lookups_fall_back_to_direct_calls_before_sync():
+    gate = threading.Event()
+
+    class SlowList(FakeKubeApi):
+        def list_pods(self, selector):
+            gate.wait(2.0)
+            return super().list_pods(selector)
+
+    api = SlowList([_pod("w9")])
+    b = K8sWatchBackend(api=api, sync_wait_s=0.01)
+    assert b.find("w9") is not None and api.gets == 1     # not synced yet → one GET
+    gate.set()
+    assert b._synced.wait(2.0)
+    b.close()
@@ -61,12 +61,24 @@ def test_meeting_bot_forwards_speaker_stream_tuning(monkeypatch):
     monkeypatch.setenv("BOT_ALONE_SILENCE_WINDOW_MS", "60000")
     monkeypatch.setenv("BOT_SPEAKER_MIN_AUDIO_SEC", "1")
     monkeypatch.setenv("BOT_SPEAKER_CONFIRM_THRESHOLD", "1")
+    monkeypatch.setenv("BOT_SPEAKER_MAX_WINDOW_SEC", "8")
+    monkeypatch.setenv("VEXA_CAPTURE_BATCH_MS", "20")
+    monkeypatch.setenv("VEXA_STT_UPLOAD_CODEC", "flac")
+    monkeypatch.setenv("VEXA_SEG_WORKERS", "2")
+    monkeypatch.setenv("VEXA_SEG_MAX_BATCH", "4")
+    monkeypatch.setenv("VEXA_SEG_BATCH_MS", "10")
     monkeypatch.delenv("BOT_SPEAKER_SUBMIT_INTERVAL_SEC", raising=False)
     reg = default_registry()
     assert reg.get("meeting-bot").base_env == {
         "BOT_ALONE_SILENCE_WINDOW_MS": "60000",
         "BOT_SPEAKER_MIN_AUDIO_SEC": "1",
         "BOT_SPEAKER_CONFIRM_THRESHOLD": "1",
+        "BOT_SPEAKER_MAX_WINDOW_SEC": "8",
+        "VEXA_CAPTURE_BATCH_MS": "20",
+        "VEXA_STT_UPLOAD_CODEC": "flac",
+        "VEXA_SEG_WORKERS": "2",
+        "VEXA_SEG_MAX_BATCH": "4",
+        "VEXA_SEG_BATCH_MS": "10",
     }
 
 
@@ -21,7 +21,9 @@ def test_schedule_register_list_and_fire():
     client, sched = _client(lambda req: captured.append(req) or {"status_code": 202}, clock)
 
     # health reports the scheduler live.
-    assert client.get("/health").json()["checks"]["scheduler"] is True
+    health = client.get("/health").json()
+    assert health["checks"]["scheduler"] is True
+    assert health["scheduler"]["claimed"] == 0 and health["scheduler"]["lag_s_p99"] is None
 
     # Register a cron job whose request is a unit.v1 Invocation POSTed to agent-api /invocations.
     body = {"trigger": "scheduled", "subject": "u_jane", "workspace_repo": "/repo"}
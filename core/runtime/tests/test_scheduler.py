@@ -6,12 +6,20 @@ Covers the parent scheduler's real behaviour:
     tick() dispatches the captured request;
   • cron re-arm — a cron job re-schedules itself after a successful run;
   • retry/backoff — a dispatch that fails (e.g. 500) is retried up to max_attempts, then marked failed;
-  • idempotency — a duplicate idempotency_key returns the existing job (no second schedule).
+  • idempotency — a duplicate idempotency_key returns the existing job (no second schedule);
+  • batched claims — tick() drains in bounded claims, replicas sharing one redis fire each job once,
+    dispatch fans out up to `concurrency`, and schedule lag lands in stats();
+  • owner-aware recovery — a peer's orphan sweep leaves a live replica's in-flight claim alone and
+    re-queues it only once that replica's heartbeat lapses or the claim outlives its lease.
 """
+import json
+import threading
+import time
+
 import fakeredis
 
 from runtime_kernel import DispatchError, FakeClock, Scheduler
-from runtime_kernel.scheduler import JOBS_KEY
+from runtime_kernel.scheduler import CLAIMS_KEY, EXECUTING_KEY, JOBS_KEY
 
 
 def _scheduler(dispatch, clock):
@@ -192,3 +200,223 @@ def test_cancel_removes_job_so_it_never_fires():
     # Cancelling an unknown / already-cancelled job is a None no-op.
     assert sched.cancel("job_does_not_exist") is None
     assert sched.cancel(jid) is None
+
+
+def test_tick_drains_in_bounded_claims_and_reports_lag():
+    captured = []
+    clock = FakeClock(start=0.0)
+    sched = Scheduler(
+        fakeredis.FakeStrictRedis(decode_responses=True),
+        dispatch=lambda req: captured.append(req["url"]) or {"status_code": 200},
+        clock=clock, batch_size=3,
+    )
+    for i in range(7):
+        sched.schedule({"execute_at": 100.0 + i, "request": {"url": f"http://svc/{i}"}})
+    sched.schedule({"execute_at": 500.0, "request": {"url": "http://svc/later"}})
+
+    # A single claim never takes more than the bound, and only what is due.
+    clock.set(130.0)
+    first = sched._claim(clock.now(), 3)
+    assert [score for _, score in first] == [100.0, 101.0, 102.0]
+    for raw, _ in first:
+        sched._process(raw)
+
+    # tick() drains the rest (4 due → a full claim of 3, then a short one) and leaves the future job.
+    assert sched.tick() == 4
+    assert sorted(captured) == sorted(f"http://svc/{i}" for i in range(7))
+    assert [j["request"]["url"] for j in sched.list(status="pending")] == ["http://svc/later"]
+
+    stats = sched.stats()
+    assert stats["claimed"] == 4 and stats["completed"] == 4
+    assert stats["last_tick_lag_s"] == 27.0       # the oldest job tick() claimed: due at 103, claimed at 130
+    assert stats["lag_s_max"] == 27.0
+    assert stats["batch_size"] == 3
+
+
+def test_replicas_sharing_redis_fire_each_job_exactly_once():
+    """Two schedulers on one redis tick at the same instant: the claim splits the due set, so every
+    job fires once and none twice — the property that lets scheduler replicas scale out."""
+    redis = fakeredis.FakeStrictRedis(decode_responses=True)
+    clock = FakeClock(start=0.0)
+    fired, lock = [], threading.Lock()
+
+    def dispatch(req):
+        with lock:
+            fired.append(req["url"])
+        return {"status_code": 200}
+
+    a = Scheduler(redis, dispatch=dispatch, clock=clock, batch_size=5, concurrency=4)
+    b = Scheduler(redis, dispatch=dispatch, clock=clock, batch_size=5, concurrency=4)
+    for i in range(60):
+        a.schedule({"execute_at": 10.0, "request": {"url": f"http://svc/{i}"}})
+
+    clock.set(10.0)
+    counts = {}
+    threads = [threading.Thread(target=lambda s=s: counts.__setitem__(id(s), s.tick())) for s in (a, b)]
+    [t.start() for t in threads]
+    [t.join() for t in threads]
+
+    assert sorted(fired) == sorted(f"http://svc/{i}" for i in range(60))
+    assert sum(counts.values()) == 60
+    assert redis.zcard(JOBS_KEY) == 0
+
+
+def test_dispatch_fans_out_up_to_concurrency():
+    clock = FakeClock(start=0.0)
+    inflight = {"now": 0, "peak": 0}
+    lock = threading.Lock()
+
+    def slow(req):
+        with lock:
+            inflight["now"] += 1
+            inflight["peak"] = max(inflight["peak"], inflight["now"])
+        time.sleep(0.05)
+        with lock:
+            inflight["now"] -= 1
+        return {"status_code": 200}
+
+    sched = Scheduler(
+        fakeredis.FakeStrictRedis(decode_responses=True), dispatch=slow, clock=clock,
+        batch_size=20, concurrency=4,
+    )
+    for i in range(12):
+        sched.schedule({"execute_at": 0.0, "request": {"url": f"http://svc/{i}"}})
+
+    assert sched.tick() == 12
+    assert 1 < inflight["peak"] <= 4
+    assert sched.stats()["completed"] == 12
+
+
+def _mid_dispatch(clock, **kw):
+    """Replica A holding one claimed job inside a blocked dispatch, and peer B on the same redis."""
+    redis = fakeredis.FakeStrictRedis(decode_responses=True)
+    entered, release, fired = threading.Event(), threading.Event(), []
+
+    def blocking(req):
+        fired.append(req["url"])
+        entered.set()
+        release.wait(5)
+        return {"status_code": 200}
+
+    a = Scheduler(redis, dispatch=blocking, clock=clock, replica_id="a", **kw)
+    b = Scheduler(redis, dispatch=blocking, clock=clock, replica_id="b", **kw)
+    job = a.schedule({"execute_at": 10.0, "request": {"url": "http://svc/join"}})
+    clock.set(10.0)
+    ticking = threading.Thread(target=a.tick)
+    ticking.start()
+    assert entered.wait(5)
+    return redis, a, b, job, fired, release, ticking
+
+
+def test_a_peer_never_recovers_a_live_replicas_inflight_job():
+    clock = FakeClock(start=0.0)
+    redis, a, b, job, fired, release, ticking = _mid_dispatch(clock)
+    assert json.loads(redis.hget(CLAIMS_KEY, job["job_id"])) == {"claimed_by": "a", "claimed_at": 10.0}
+
+    # B restarts mid-dispatch and sweeps: A heartbeats and the claim is inside its lease → untouched.
+    clock.set(20.0)
+    b.heartbeat()
+    assert b.recover_orphans() == 0
+    assert a.recover_orphans() == 0  # A's own sweep sees the job in its own in-flight set
+    assert b.tick() == 0
+    assert redis.zcard(JOBS_KEY) == 0
+
+    release.set()
+    ticking.join(5)
+    assert fired == ["http://svc/join"]  # one bot join, not two
+    assert a.get(job["job_id"])["status"] == "completed"
+    assert redis.hlen(EXECUTING_KEY) == 0 and redis.hlen(CLAIMS_KEY) == 0
+
+
+def test_a_dead_replicas_claim_is_recovered_once_its_heartbeat_lapses():
+    clock = FakeClock(start=0.0)
+    redis, a, b, job, fired, release, ticking = _mid_dispatch(clock, heartbeat_ttl_s=30.0)
+
+    clock.set(20.0)
+    b.heartbeat()
+    assert b.recover_orphans() == 0  # A beat at 10: still live
+    clock.set(45.0)  # …and has been silent past the 30s TTL since
+    b.heartbeat()
+    assert b.recover_orphans() == 1
+    assert redis.hlen(EXECUTING_KEY) == 0 and redis.hlen(CLAIMS_KEY) == 0
+    assert redis.zcard(JOBS_KEY) == 1
+    release.set()
+    ticking.join(5)
+
+
+def test_a_claim_past_its_lease_is_recovered_even_while_its_replica_beats():
+    clock = FakeClock(start=0.0)
+    redis, a, b, job, fired, release, ticking = _mid_dispatch(clock, lease_s=60.0)
+
+    clock.set(50.0)
+    a.heartbeat()
+    assert b.recover_orphans() == 0
+    clock.set(71.0)  # claimed at 10: past the 60s lease, though A beat at 71
+    a.heartbeat()
+    assert b.recover_orphans() == 1
+    release.set()
+    ticking.join(5)
+
+
+def test_a_restarted_replica_recovers_its_previous_incarnations_claims():
+    redis = fakeredis.FakeStrictRedis(decode_responses=True)
+    clock = FakeClock(start=100.0)
+    orphan = {"job_id": "job_prev", "execute_at": 90.0, "status": "pending",
+              "request": {"url": "http://svc/p"}, "retry": {"max_attempts": 3, "backoff": [1], "attempt": 0}}
+    redis.hset(EXECUTING_KEY, "job_prev", json.dumps(orphan))
+    redis.hset(CLAIMS_KEY, "job_prev", json.dumps({"claimed_by": "a", "claimed_at": 95.0}))
+
+    # Same replica id (a pod keeps its hostname), fresh process: nothing of its own is in flight.
+    restarted = Scheduler(redis, dispatch=lambda req: {"status_code": 200}, clock=clock, replica_id="a")
+    restarted.heartbeat()
+    assert restarted.recover_orphans() == 1
+    assert restarted.tick() == 1
+
+
+class _PeerFinishesAfterTheSnapshot:
+    """Redis as a recovering replica sees it while a peer completes a job right after the sweep's
+    read: the first pipeline that reads EXECUTING runs `finish` once its results are in."""
+
+    def __init__(self, redis, finish):
+        self._r, self._finish = redis, finish
+
+    def __getattr__(self, name):
+        return getattr(self._r, name)
+
+    def pipeline(self, *a, **kw):
+        pipe, outer = self._r.pipeline(*a, **kw), self
+
+        class _Pipe:
+            reads = False
+
+            def __getattr__(self, name):
+                return getattr(pipe, name)
+
+            def hgetall(self, key):
+                self.reads = self.reads or key == EXECUTING_KEY
+                return pipe.hgetall(key)
+
+            def execute(self):
+                out = pipe.execute()
+                if self.reads and outer._finish:
+                    outer._finish, finish = None, outer._finish
+                    finish()
+                return out
+        return _Pipe()
+
+
+def test_a_job_a_peer_finishes_mid_sweep_is_not_fired_again():
+    clock = FakeClock(start=0.0)
+    redis, a, b, job, fired, release, ticking = _mid_dispatch(clock, heartbeat_ttl_s=30.0)
+
+    def a_completes():  # A was only slow, not dead: its dispatch returns and clears both hashes
+        release.set()
+        ticking.join(5)
+
+    clock.set(45.0)  # A's beat at 10 has lapsed, so B's snapshot judges the job orphaned
+    b._r = _PeerFinishesAfterTheSnapshot(redis, a_completes)
+    b.heartbeat()
+    assert b.recover_orphans() == 0
+    assert a.get(job["job_id"])["status"] == "completed"
+    assert redis.zcard(JOBS_KEY) == 0
+    assert b.tick() == 0 and fired == ["http://svc/join"]  # one join, not two
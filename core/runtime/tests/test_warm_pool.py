@@ -0,0 +1,251 @@
+"""The warm pool (``RUNTIME_WARM_POOL``) over a fake backend — no docker / cluster.
+
+  * ``reconcile`` tops each ``(profile, variant)`` slot up to its target, within ``max_total``;
+  * ``claim`` binds the caller's spec onto an idle workload: the bind payload carries the spec env,
+    the record moves to the claimed id (same handle, the claimed id's starting/running events), and
+    stop/destroy under the claimed id reach the pre-started container;
+  * an empty slot, a dead idle workload or an undeliverable bind is a miss (``None``) — the caller
+    spawns cold; hit rate and claim latency land in ``stats``;
+  * admission runs before the bind: a claim over quota delivers nothing, and a rebind refused after
+    the bind retires the bound workload;
+  * surplus, dead and untracked ``warm-*`` workloads are retired;
+  * a restarted runtime re-derives a claimed workload's handle through its warm origin;
+  * the HTTP surface: 201 on a hit, 404 on a miss, targets over PUT, stats on /health.
+"""
+from __future__ import annotations
+
+import json
+from typing import Optional
+
+import pytest
+from fastapi.testclient import TestClient
+
+from runtime_kernel import QuotaExceeded, Runtime
+from runtime_kernel.api import create_app
+from runtime_kernel.backend import WorkloadHandle
+from runtime_kernel.kernel import WARM_ORIGIN_ENV
+from runtime_kernel.models import RuntimeState, WorkloadSpec
+from runtime_kernel.profiles import Runnable
+from runtime_kernel.store import InMemoryStore
+from runtime_kernel.warm_pool import BIND_KEY_ENV, WARM_ENV, WarmPool, bind_key, parse_targets
+
+
+class FakeBackend:
+    """Containers are dict entries keyed by workload id; ``exit`` simulates a self-exit."""
+
+    name = "process"
+
+    def __init__(self):
+        self.containers: dict[str, dict] = {}
+        self.cleaned: list[str] = []
+
+    def start(self, workload_id, runnable, env):
+        self.containers[workload_id] = {"env": dict(env), "code": None}
+        return WorkloadHandle(id=workload_id, impl=workload_id)
+
+    def find(self, workload_id) -> Optional[WorkloadHandle]:
+        return WorkloadHandle(id=workload_id, impl=workload_id) if workload_id in self.containers else None
+
+    def exit_code(self, h):
+        c = self.containers.get(h._impl)
+        return 0 if c is None else c["code"]
+
+    def exit(self, workload_id, code=1):
+        self.containers[workload_id]["code"] = code
+
+    def terminate(self, h):
+        if h._impl in self.containers:
+            self.containers[h._impl]["code"] = 143
+
+    kill = terminate
+
+    def cleanup(self, h):
+        self.cleaned.append(h._impl)
+        self.containers.pop(h._impl, None)
+
+
+class Clock:
+    def __init__(self):
+        self.t = 0.0
+
+    def __call__(self):
+        self.t += 0.004                       # every read advances 4ms
+        return self.t
+
+
+def _pool(targets=None, max_total=16, bind=None, store=None, events=None, owner_quota=None):
+    backend = FakeBackend()
+    rt = Runtime(backend=backend, profiles={"meeting-bot": Runnable(image="bot")},
+                 store=store or InMemoryStore(),
+                 on_event=(events.append if events is not None else None), owner_quota=owner_quota)
+    binds: list[tuple[str, str]] = []
+    pool = WarmPool(rt, bind or (lambda k, p: binds.append((k, p))),
+                    targets=targets, max_total=max_total, clock=Clock(), bind_url="redis://r:6379")
+    return rt, backend, pool, binds
+
+
+def _spec(wid="mtg-1-abcd", **env):
+    return WorkloadSpec(workloadId=wid, profile="meeting-bot", env={"VEXA_BOT_CONFIG": "{}", **env},
+                        callbackUrl="http://meeting-api/runtime/callback")
+
+
+def test_reconcile_tops_slots_up_within_the_cap():
+    rt, backend, pool, _ = _pool({("meeting-bot", "google_meet"): 2, ("meeting-bot", "teams"): 5},
+                                 max_total=4)
+    assert pool.reconcile()["started"] == 4
+    stats = pool.stats()
+    assert sum(stats["idle"].values()) == 4 and stats["targets"] == {
+        "meeting-bot/google_meet": 1, "meeting-bot/teams": 3}      # scaled to fit max_total
+    wid = next(w for w in backend.containers if "google-meet" in w)
+    env = backend.containers[wid]["env"]
+    assert env[WARM_ENV] == "1" and env[BIND_KEY_ENV] == bind_key(wid)
+    assert env["VEXA_WARM_VARIANT"] == "google_meet" and env["VEXA_WARM_REDIS_URL"] == "redis://r:6379"
+    assert wid == wid.lower() and "_" not in wid                     # a valid pod name
+    assert pool.reconcile()["started"] == 0                          # already at target
+
+
+def test_claim_binds_the_spec_onto_a_started_workload():
+    events = []
+    rt, backend, pool, binds = _pool({("meeting-bot", "google_meet"): 1}, events=events)
+    pool.reconcile()
+    (warm_id,) = list(backend.containers)
+    del events[:]
+
+    status = pool.claim(_spec(), "google_meet")
+    assert status is not None and status.workloadId == "mtg-1-abcd"
+    assert status.state is RuntimeState.running
+    key, payload = binds[0]
+    assert key == bind_key(warm_id)
+    assert json.loads(payload) == {"workloadId": "mtg-1-abcd", "env": {"VEXA_BOT_CONFIG": "{}"}}
+
+    assert rt.store.get(warm_id) is None                             # the record MOVED
+    record = rt.store.get("mtg-1-abcd")
+    assert record.spec.callbackUrl == "http://meeting-api/runtime/callback"
+    assert record.spec.env[WARM_ORIGIN_ENV] == warm_id
+    assert [(e.workloadId, e.state.value) for e in events] == [
+        ("mtg-1-abcd", "starting"), ("mtg-1-abcd", "running")]
+
+    rt.stop("mtg-1-abcd")
+    rt.destroy("mtg-1-abcd")
+    assert backend.cleaned == [warm_id]                              # reached the real container
+
+    stats = pool.stats()
+    assert stats["hits"] == 1 and stats["misses"] == 0 and stats["hit_rate"] == 1.0
+    assert stats["claim_ms_p50"] is not None and stats["claim_ms_p99"] >= stats["claim_ms_p50"]
+
+
+def test_misses_fall_back_to_the_caller():
+    rt, backend, pool, binds = _pool({("meeting-bot", "google_meet"): 2})
+    assert pool.claim(_spec(), "teams") is None                      # no such slot
+    pool.reconcile()
+    first, second = list(backend.containers)
+    backend.exit(first)                                              # died while idle
+    assert pool.claim(_spec(), "google_meet").workloadId == "mtg-1-abcd"
+    assert binds[0][0] == bind_key(second)
+    assert pool.claim(_spec("mtg-2-ef01"), "google_meet") is None    # slot drained
+    assert pool.stats()["hits"] == 1 and pool.stats()["misses"] == 2
+
+
+def test_an_undeliverable_bind_is_a_miss_and_keeps_the_workload():
+    def broken(key, payload):
+        raise ConnectionError("redis down")
+
+    rt, backend, pool, _ = _pool({("meeting-bot", "google_meet"): 1}, bind=broken)
+    pool.reconcile()
+    (warm_id,) = list(backend.containers)
+    assert pool.claim(_spec(), "google_meet") is None
+    assert rt.store.get("mtg-1-abcd") is None and rt.store.get(warm_id) is not None
+    assert pool.stats()["idle"] == {"meeting-bot/google_meet": 1}
+
+
+def test_a_claim_over_quota_is_refused_before_anything_is_bound():
+    rt, backend, pool, binds = _pool({("meeting-bot", "google_meet"): 1}, owner_quota=1)
+    pool.reconcile()
+    rt.create(_spec("mtg-0-live", VEXA_OWNER="u1"))
+    with pytest.raises(QuotaExceeded):
+        pool.claim(_spec(VEXA_OWNER="u1"), "google_meet")
+    assert binds == []                                               # the secrets never left
+    assert pool.stats()["idle"] == {"meeting-bot/google_meet": 1}     # and the workload stays warm
+
+
+def test_a_rebind_refused_after_the_bind_retires_the_bound_workload():
+    rt, backend, pool, binds = _pool({("meeting-bot", "google_meet"): 1})
+    pool.reconcile()
+    (warm_id,) = list(backend.containers)
+
+    def racing_rebind(warm, spec):
+        raise QuotaExceeded("u1", 1)                                 # a concurrent create won the slot
+
+    rt.rebind = racing_rebind
+    with pytest.raises(QuotaExceeded):
+        pool.claim(_spec(VEXA_OWNER="u1"), "google_meet")
+    assert len(binds) == 1 and warm_id in backend.cleaned            # bound, so never left running
+    assert rt.store.get(warm_id) is None and pool.stats()["idle"] == {"meeting-bot/google_meet": 0}
+
+
+def test_a_live_spec_is_a_touch_not_a_second_claim():
+    rt, backend, pool, binds = _pool({("meeting-bot", "google_meet"): 2})
+    pool.reconcile()
+    pool.claim(_spec(), "google_meet")
+    again = pool.claim(_spec(), "google_meet")
+    assert again.workloadId == "mtg-1-abcd" and len(binds) == 1
+    assert pool.stats()["idle"] == {"meeting-bot/google_meet": 1}
+
+
+def test_surplus_dead_and_untracked_warm_workloads_are_retired():
+    rt, backend, pool, _ = _pool({("meeting-bot", "google_meet"): 3})
+    pool.reconcile()
+    ids = list(backend.containers)
+    backend.exit(ids[0])
+    # a previous runtime's warm workload: on the substrate + in the store, tracked by nobody
+    rt.create(WorkloadSpec(workloadId="warm-meeting-bot-zoom-0000", profile="meeting-bot", env={}))
+    pool.set_targets({("meeting-bot", "google_meet"): 1})
+
+    tick = pool.reconcile()
+    assert tick == {"started": 0, "retired": 3}
+    assert pool.stats()["idle"] == {"meeting-bot/google_meet": 1}
+    assert sorted(backend.cleaned) == sorted([ids[0], ids[2], "warm-meeting-bot-zoom-0000"])
+    assert [r.spec.workloadId for r in rt.store.list()] == [ids[1]]   # retired records forgotten
+
+
+def test_a_restarted_runtime_still_reaches_a_claimed_workload():
+    store = InMemoryStore()
+    rt, backend, pool, _ = _pool({("meeting-bot", "google_meet"): 1}, store=store)
+    pool.reconcile()
+    (warm_id,) = list(backend.containers)
+    pool.claim(_spec(), "google_meet")
+
+    fresh = Runtime(backend=backend, profiles={"meeting-bot": Runnable(image="bot")}, store=store)
+    assert fresh.get("mtg-1-abcd").state is RuntimeState.running
+    fresh.stop("mtg-1-abcd")
+    fresh.destroy("mtg-1-abcd")
+    assert backend.cleaned == [warm_id]
+
+
+def test_parse_targets_fails_loud():
+    assert parse_targets('{"meeting-bot": {"zoom": 2}}') == {("meeting-bot", "zoom"): 2}
+    assert parse_targets("") == {}
+    for bad in ('["x"]', '{"meeting-bot": 2}', '{"meeting-bot": {"zoom": -1}}'):
+        try:
+            parse_targets(bad)
+        except ValueError:
+            continue
+        raise AssertionError(f"accepted {bad}")
+
+
+def test_warm_pool_over_http():
+    rt, backend, pool, _ = _pool()
+    client = TestClient(create_app(rt, warm_pool=pool, deliver=lambda e: None))
+    r = client.put("/warm-pool/targets", json={"targets": {"meeting-bot": {"google_meet": 1}}})
+    assert r.status_code == 200 and r.json()["targets"] == {"meeting-bot/google_meet": 1}
+    pool.reconcile()
+
+    body = {"variant": "google_meet", "spec": _spec().model_dump(exclude_none=True)}
+    hit = client.post("/warm-pool/claim", json=body)
+    assert hit.status_code == 201 and hit.json()["workloadId"] == "mtg-1-abcd"
+    body["spec"]["workloadId"] = "mtg-2-ef01"
+    assert client.post("/warm-pool/claim", json=body).status_code == 404
+    assert client.get("/health").json()["warm_pool"]["hits"] == 1
+
+    unwired = TestClient(create_app(Runtime(backend=FakeBackend(), profiles={}), deliver=lambda e: None))
+    assert unwired.post("/warm-pool/claim", json=body).status_code == 503
@@ -47,6 +47,13 @@ export BOT_SPEAKER_SUBMIT_INTERVAL_SEC="${BOT_SPEAKER_SUBMIT_INTERVAL_SEC:-}"
 export BOT_SPEAKER_CONFIRM_THRESHOLD="${BOT_SPEAKER_CONFIRM_THRESHOLD:-}"
 export BOT_SPEAKER_MAX_BUFFER_SEC="${BOT_SPEAKER_MAX_BUFFER_SEC:-}"
 export BOT_SPEAKER_IDLE_TIMEOUT_SEC="${BOT_SPEAKER_IDLE_TIMEOUT_SEC:-}"
+export BOT_SPEAKER_MAX_WINDOW_SEC="${BOT_SPEAKER_MAX_WINDOW_SEC:-}"
+export BOT_SPEAKER_CONTEXT_SEC="${BOT_SPEAKER_CONTEXT_SEC:-}"
+export VEXA_SEG_WORKERS="${VEXA_SEG_WORKERS:-}"
+export VEXA_SEG_MAX_BATCH="${VEXA_SEG_MAX_BATCH:-}"
+export VEXA_SEG_BATCH_MS="${VEXA_SEG_BATCH_MS:-}"
+export VEXA_STT_UPLOAD_CODEC="${VEXA_STT_UPLOAD_CODEC:-}"
+export VEXA_CAPTURE_BATCH_MS="${VEXA_CAPTURE_BATCH_MS:-}"
 
 export TRANSCRIPTION_SERVICE_URL="${TRANSCRIPTION_SERVICE_URL:-}"
 export TRANSCRIPTION_SERVICE_TOKEN="${TRANSCRIPTION_SERVICE_TOKEN:-}"
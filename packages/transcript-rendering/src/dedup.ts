@@ -29,115 +29,108 @@ export function deduplicateSegments<T extends TranscriptSegment>(segments: T[]):
   const deduped: T[] = [];
 
   for (const seg of segments) {
-    if (deduped.length === 0) {
-      deduped.push(seg);
-      continue;
-    }
+    const step = dedupStep(deduped[deduped.length - 1], seg);
+    if (step === 'push') deduped.push(seg);
+    else if (step === 'replace') deduped[deduped.length - 1] = seg;
+  }
 
-    const last = deduped[deduped.length - 1];
+  return deduped;
+}
 
-    // Different speakers: never dedup — overlapping timestamps are legitimate
-    if ((seg.speaker || '') !== (last.speaker || '')) {
-      deduped.push(seg);
-      continue;
-    }
+/** What `deduplicateSegments` does with the next segment, given the last one it kept. */
+export type DedupStep = 'push' | 'replace' | 'skip';
 
-    // Same speaker — apply dedup heuristics
-    const segStart = parseUTCTimestamp(seg.absolute_start_time).getTime();
-    const segEnd = parseUTCTimestamp(seg.absolute_end_time).getTime();
-    const lastStart = parseUTCTimestamp(last.absolute_start_time).getTime();
-    const lastEnd = parseUTCTimestamp(last.absolute_end_time).getTime();
-
-    const segStartSec = segStart / 1000;
-    const segEndSec = segEnd / 1000;
-    const lastStartSec = lastStart / 1000;
-    const lastEndSec = lastEnd / 1000;
-
-    const sameText = (seg.text || '').trim() === (last.text || '').trim();
-    const overlaps = Math.max(segStartSec, lastStartSec) < Math.min(segEndSec, lastEndSec);
-    const gapSec = (segStart - lastEnd) / 1000;
-
-    // Adjacent duplicate: same text within 1s gap
-    if (!overlaps && sameText && gapSec >= 0 && gapSec <= 1) {
-      // Prefer completed over draft, then longer duration
-      if (preferSeg(seg, last)) {
-        deduped[deduped.length - 1] = seg;
-      }
-      continue;
-    }
+/**
+ * One step of `deduplicateSegments`: keep `seg` after `last` (`push`), let it
+ * take `last`'s place (`replace`), or drop it (`skip`). `last` is `undefined`
+ * for the first segment. Exposed so the incremental manager can re-run the
+ * fold from any position instead of over the whole transcript.
+ */
+export function dedupStep<T extends TranscriptSegment>(last: T | undefined, seg: T): DedupStep {
+  if (last === undefined) return 'push';
+
+  // Different speakers: never dedup — overlapping timestamps are legitimate
+  if ((seg.speaker || '') !== (last.speaker || '')) return 'push';
+
+  // Same speaker — apply dedup heuristics
+  const segStart = parseUTCTimestamp(seg.absolute_start_time).getTime();
+  const segEnd = parseUTCTimestamp(seg.absolute_end_time).getTime();
+  const lastStart = parseUTCTimestamp(last.absolute_start_time).getTime();
+  const lastEnd = parseUTCTimestamp(last.absolute_end_time).getTime();
+
+  const segStartSec = segStart / 1000;
+  const segEndSec = segEnd / 1000;
+  const lastStartSec = lastStart / 1000;
+  const lastEndSec = lastEnd / 1000;
+
+  const sameText = (seg.text || '').trim() === (last.text || '').trim();
+  const overlaps = Math.max(segStartSec, lastStartSec) < Math.min(segEndSec, lastEndSec);
+  const gapSec = (segStart - lastEnd) / 1000;
+
+  // Adjacent duplicate: same text within 1s gap
+  if (!overlaps && sameText && gapSec >= 0 && gapSec <= 1) {
+    // Prefer completed over draft, then longer duration
+    return preferSeg(seg, last) ? 'replace' : 'skip';
+  }
 
-    if (overlaps) {
-      const segFullyInsideLast = segStartSec >= lastStartSec && segEndSec <= lastEndSec;
-      const lastFullyInsideSeg = lastStartSec >= segStartSec && lastEndSec <= segEndSec;
+  if (overlaps) {
+    const segFullyInsideLast = segStartSec >= lastStartSec && segEndSec <= lastEndSec;
+    const lastFullyInsideSeg = lastStartSec >= segStartSec && lastEndSec <= segEndSec;
 
-      if (sameText) {
-        if (preferSeg(seg, last)) {
-          deduped[deduped.length - 1] = seg;
-        }
-        continue;
-      }
+    if (sameText) {
+      return preferSeg(seg, last) ? 'replace' : 'skip';
+    }
 
-      // Different text: containment.
-      // Prefer the confirmed segment over a same-speaker draft regardless of
-      // which one has the wider time range — Vexa routinely trims the
-      // boundary tighter when confirming, which left the draft wider than
-      // its own confirmed version and caused the pending-stuck bug.
-      if (segFullyInsideLast) {
-        if (seg.completed && !last.completed) {
-          deduped[deduped.length - 1] = seg;
-        }
-        continue;
-      }
-      if (lastFullyInsideSeg) {
-        // seg is wider. Keep it unless it's a draft while last is confirmed.
-        if (last.completed && !seg.completed) {
-          continue;
-        }
-        deduped[deduped.length - 1] = seg;
-        continue;
-      }
+    // Different text: containment.
+    // Prefer the confirmed segment over a same-speaker draft regardless of
+    // which one has the wider time range — Vexa routinely trims the
+    // boundary tighter when confirming, which left the draft wider than
+    // its own confirmed version and caused the pending-stuck bug.
+    if (segFullyInsideLast) {
+      return seg.completed && !last.completed ? 'replace' : 'skip';
+    }
+    if (lastFullyInsideSeg) {
+      // seg is wider. Keep it unless it's a draft while last is confirmed.
+      return last.completed && !seg.completed ? 'skip' : 'replace';
+    }
 
-      // Partial overlap heuristics
-      const segTextClean = normalizeText(seg.text || '');
-      const lastTextClean = normalizeText(last.text || '');
-      const segDuration = segEndSec - segStartSec;
-      const lastDuration = lastEndSec - lastStartSec;
-      const overlapStart = Math.max(segStartSec, lastStartSec);
-      const overlapEnd = Math.min(segEndSec, lastEndSec);
-      const overlapDuration = overlapEnd - overlapStart;
-      const overlapRatioSeg = segDuration > 0 ? overlapDuration / segDuration : 0;
-      const overlapRatioLast = lastDuration > 0 ? overlapDuration / lastDuration : 0;
-
-      // Expansion: seg contains last's text and is longer
-      const segExpandsLast =
-        Boolean(lastTextClean) &&
-        Boolean(segTextClean) &&
-        segTextClean.includes(lastTextClean) &&
-        segTextClean.length > lastTextClean.length;
-
-      if (segExpandsLast && overlapRatioLast >= 0.5 && (seg.completed || !last.completed)) {
-        deduped[deduped.length - 1] = seg;
-        continue;
-      }
+    // Partial overlap heuristics
+    const segTextClean = normalizeText(seg.text || '');
+    const lastTextClean = normalizeText(last.text || '');
+    const segDuration = segEndSec - segStartSec;
+    const lastDuration = lastEndSec - lastStartSec;
+    const overlapStart = Math.max(segStartSec, lastStartSec);
+    const overlapEnd = Math.min(segEndSec, lastEndSec);
+    const overlapDuration = overlapEnd - overlapStart;
+    const overlapRatioSeg = segDuration > 0 ? overlapDuration / segDuration : 0;
+    const overlapRatioLast = lastDuration > 0 ? overlapDuration / lastDuration : 0;
+
+    // Expansion: seg contains last's text and is longer
+    const segExpandsLast =
+      Boolean(lastTextClean) &&
+      Boolean(segTextClean) &&
+      segTextClean.includes(lastTextClean) &&
+      segTextClean.length > lastTextClean.length;
+
+    if (segExpandsLast && overlapRatioLast >= 0.5 && (seg.completed || !last.completed)) {
+      return 'replace';
+    }
 
-      // Tail-repeat: seg text already inside last, and seg is tiny
-      const segIsTailRepeat =
-        Boolean(segTextClean) &&
-        Boolean(lastTextClean) &&
-        lastTextClean.includes(segTextClean);
+    // Tail-repeat: seg text already inside last, and seg is tiny
+    const segIsTailRepeat =
+      Boolean(segTextClean) &&
+      Boolean(lastTextClean) &&
+      lastTextClean.includes(segTextClean);
 
-      if (segIsTailRepeat) {
-        const segWordCount = segTextClean.split(/\s+/).filter(w => w.length > 0).length;
-        if (segDuration <= 1.5 && segWordCount <= 2 && overlapRatioSeg >= 0.25) {
-          continue;
-        }
+    if (segIsTailRepeat) {
+      const segWordCount = segTextClean.split(/\s+/).filter(w => w.length > 0).length;
+      if (segDuration <= 1.5 && segWordCount <= 2 && overlapRatioSeg >= 0.25) {
+        return 'skip';
       }
     }
-
-    deduped.push(seg);
   }
 
-  return deduped;
+  return 'push';
 }
 
 /** Return true if seg should replace last (prefer completed, then longer). */
@@ -1,7 +1,10 @@
 import { describe, it, expect } from 'vitest';
-import type { TranscriptSegment } from './types';
+import type { TranscriptSegment, TranscriptState, SegmentGroup } from './types';
 import type { TranscriptMessage } from './manager';
 import { createTranscriptManager } from './manager';
+import { createTranscriptState, bootstrapConfirmed, applyTranscriptTick, recomputeTranscripts } from './state';
+import { deduplicateByIdentity, deduplicateSegments, sortSegments, sortByStartTime } from './dedup';
+import { groupSegments } from './grouping';
 
 function seg(
   speaker: string,
@@ -122,3 +125,95 @@ describe('createTranscriptManager', () => {
     expect(manager.getSegments()).toHaveLength(0);
   });
 });
+
+describe('createTranscriptManager incremental index', () => {
+  type Tagged = TranscriptSegment & { tag: number };
+
+  // Deterministic PRNG so a failure reproduces.
+  function rng(seed: number) {
+    let s = seed >>> 0;
+    return () => {
+      s = (s * 1664525 + 1013904223) >>> 0;
+      return s / 2 ** 32;
+    };
+  }
+
+  const SPEAKERS = ['Alice', 'Bob', 'Carol'];
+  const WORDS = ['hello', 'hello there', 'hello there friend', 'ok', 'ok so', 'yes', 'the plan', 'the plan is fine'];
+
+  function randomSegment(rand: () => number, tag: number, completed: boolean): Tagged {
+    const speaker = SPEAKERS[Math.floor(rand() * SPEAKERS.length)];
+    // Coarse start times: equal absolute_start_time values are common on purpose.
+    const start = Math.floor(rand() * 40) / 2;
+    const end = start + 0.5 + Math.floor(rand() * 6) / 2;
+    const s: Tagged = {
+      ...seg(speaker, start, end, WORDS[Math.floor(rand() * WORDS.length)], { completed }),
+      tag,
+    };
+    if (rand() < 0.7) s.segment_id = `${speaker}:${Math.floor(rand() * 12)}`;
+    if (rand() < 0.4) s.updated_at = new Date(Date.UTC(2026, 2, 21, 12, 0, Math.floor(rand() * 30))).toISOString();
+    if (rand() < 0.1) delete s.speaker;
+    if (rand() < 0.2) s.start_time = Math.floor(rand() * 20);
+    return s;
+  }
+
+  function reference(state: TranscriptState<Tagged>): Tagged[] {
+    return sortByStartTime(deduplicateSegments(sortSegments(deduplicateByIdentity(recomputeTranscripts(state)))));
+  }
+
+  const tags = (segs: Tagged[]) => segs.map(s => s.tag);
+  const groupTags = (groups: SegmentGroup<Tagged>[]) => groups.map(g => `${g.key}|${g.combinedText}|${tags(g.segments).join(',')}`);
+
+  it('matches the batch pipeline tick for tick', () => {
+    for (let seed = 1; seed <= 40; seed++) {
+      const rand = rng(seed);
+      let tag = 0;
+      const manager = createTranscriptManager<Tagged>();
+      const mirror = createTranscriptState<Tagged>();
+
+      const boot = Array.from({ length: Math.floor(rand() * 15) }, () => randomSegment(rand, tag++, true));
+      manager.bootstrap(boot);
+      bootstrapConfirmed(mirror, boot);
+      expect(tags(manager.getSegments())).toEqual(tags(reference(mirror)));
+
+      for (let tick = 0; tick < 60; tick++) {
+        const confirmed = Array.from({ length: Math.floor(rand() * 3) }, () => randomSegment(rand, tag++, true));
+        const speaker = rand() < 0.8 ? SPEAKERS[Math.floor(rand() * SPEAKERS.length)] : undefined;
+        const pending = Array.from({ length: Math.floor(rand() * 3) }, () => randomSegment(rand, tag++, false));
+
+        const got = manager.handleMessage({ type: 'transcript', speaker, confirmed, pending });
+        const expected = applyTranscriptTick(mirror, confirmed, pending, speaker);
+        if (expected === null) {
+          expect(got).toBeNull();
+          continue;
+        }
+        const want = reference(mirror);
+        expect(tags(got!)).toEqual(tags(want));
+        expect(groupTags(manager.getGroups())).toEqual(groupTags(groupSegments(want)));
+        expect(groupTags(manager.getGroups({ maxCharsPerGroup: 20 }))).toEqual(
+          groupTags(groupSegments(want, { maxCharsPerGroup: 20 })),
+        );
+      }
+    }
+  });
+
+  it('reuses unchanged groups and returns fresh arrays', () => {
+    const manager = createTranscriptManager();
+    manager.bootstrap([
+      seg('Alice', 0, 5, 'first', { segment_id: 'a:0' }),
+      seg('Bob', 5, 10, 'second', { segment_id: 'b:0' }),
+    ]);
+    const before = manager.getGroups();
+    manager.handleMessage({
+      type: 'transcript',
+      speaker: 'Carol',
+      confirmed: [seg('Carol', 20, 25, 'third', { segment_id: 'c:0' })],
+      pending: [],
+    });
+    const after = manager.getGroups();
+    expect(after).toHaveLength(3);
+    expect(after[0]).toBe(before[0]);
+    expect(after[1]).toBe(before[1]);
+    expect(manager.getSegments()).not.toBe(manager.getSegments());
+  });
+});
@@ -1,6 +1,5 @@
-import type { TranscriptSegment, TranscriptState } from './types';
-import { createTranscriptState, bootstrapConfirmed, applyTranscriptTick, recomputeTranscripts } from './state';
-import { deduplicateByIdentity, deduplicateSegments, sortSegments, sortByStartTime } from './dedup';
+import type { TranscriptSegment, TranscriptState, SegmentGroup, GroupingOptions } from './types';
+import { createTranscriptIndex } from './indexed';
 
 /**
  * Raw WebSocket transcript message from the Vexa gateway.
@@ -22,6 +21,12 @@ export interface TranscriptMessage {
  * Consumers feed it raw WS messages or REST bootstrap data and get back
  * deduplicated, sorted segments ready for rendering.
  *
+ * State is indexed incrementally: a tick costs O(log n) per segment it
+ * touches plus a local re-dedup of its neighbours, not a rebuild of the whole
+ * transcript. Output is identical to running the batch functions
+ * (`recomputeTranscripts` → `deduplicateByIdentity` → `sortSegments` →
+ * `deduplicateSegments` → `sortByStartTime`) on the same state.
+ *
  * ```ts
  * const manager = createTranscriptManager();
  *
@@ -43,7 +48,15 @@ export interface TranscriptManager<T extends TranscriptSegment = TranscriptSegme
   handleMessage(message: TranscriptMessage): T[] | null;
   /** Get current deduplicated, sorted segments without processing a new message. */
   getSegments(): T[];
-  /** Access the underlying state (for advanced use cases). */
+  /**
+   * `groupSegments(getSegments(), options)`, rebuilding only the groups whose
+   * segments changed. Pass a stable `getGroupKey` function to keep that reuse.
+   */
+  getGroups(options?: GroupingOptions): SegmentGroup<T>[];
+  /**
+   * Access the underlying state (for advanced use cases). Read-only: the
+   * manager's indexes are updated by its own methods, not by edits to the maps.
+   */
   getState(): TranscriptState<T>;
   /** Reset all state. */
   clear(): void;
@@ -56,19 +69,12 @@ export interface TranscriptManager<T extends TranscriptSegment = TranscriptSegme
 export function createTranscriptManager<
   T extends TranscriptSegment = TranscriptSegment,
 >(): TranscriptManager<T> {
-  let state: TranscriptState<T> = createTranscriptState<T>();
-
-  function finalize(segments: T[]): T[] {
-    // 1. Identity dedup (by segment_id, keeps newer by updated_at)
-    // 2. Sort by absolute_start_time (required input for overlap dedup)
-    // 3. Overlap dedup (same speaker: adjacent duplicates, containment, expansion, tail-repeat)
-    // 4. Sort by speech time for display
-    return sortByStartTime(deduplicateSegments(sortSegments(deduplicateByIdentity(segments))));
-  }
+  const index = createTranscriptIndex<T>();
 
   return {
     bootstrap(segments: T[]): T[] {
-      return finalize(bootstrapConfirmed(state, segments));
+      index.bootstrap(segments);
+      return index.segments();
     },
 
     handleMessage(message: TranscriptMessage): T[] | null {
@@ -78,20 +84,23 @@ export function createTranscriptManager<
       const pending = (message.pending || []) as T[];
       const speaker = message.speaker ?? undefined;
 
-      const result = applyTranscriptTick(state, confirmed, pending, speaker);
-      return result ? finalize(result) : null;
+      return index.applyTick(confirmed, pending, speaker) ? index.segments() : null;
     },
 
     getSegments(): T[] {
-      return finalize(recomputeTranscripts(state));
+      return index.segments();
+    },
+
+    getGroups(options?: GroupingOptions): SegmentGroup<T>[] {
+      return index.groups(options);
     },
 
     getState(): TranscriptState<T> {
-      return state;
+      return index.state;
     },
 
     clear(): void {
-      state = createTranscriptState<T>();
+      index.clear();
     },
   };
 }